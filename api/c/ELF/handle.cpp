@@ -0,0 +1,282 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LIEF/ELF/handle.h"
+#include "LIEF/ELF/Binary.h"
+
+#include "LIEF/ELF/Parser.hpp"
+#include "LIEF/ELF/Binary.hpp"
+#include "LIEF/ELF/DynamicEntry.hpp"
+#include "LIEF/ELF/Section.hpp"
+#include "LIEF/ELF/Segment.hpp"
+#include "LIEF/ELF/Symbol.hpp"
+
+#include "../handle.hpp"
+
+using namespace LIEF::ELF;
+using namespace LIEF::c_api;
+
+namespace {
+// The C handles are opaque aliases of the C++ objects
+inline const Binary& from(const lief_elf_binary_t* h) {
+  return *reinterpret_cast<const Binary*>(h);
+}
+
+inline const Section& from(const lief_elf_section_t* h) {
+  return *reinterpret_cast<const Section*>(h);
+}
+
+inline const Segment& from(const lief_elf_segment_t* h) {
+  return *reinterpret_cast<const Segment*>(h);
+}
+
+inline const Symbol& from(const lief_elf_symbol_t* h) {
+  return *reinterpret_cast<const Symbol*>(h);
+}
+
+inline const DynamicEntry& from(const lief_elf_dynamic_entry_t* h) {
+  return *reinterpret_cast<const DynamicEntry*>(h);
+}
+}
+
+lief_elf_binary_t* lief_elf_parse(const char* file) {
+  return reinterpret_cast<lief_elf_binary_t*>(Parser::parse(file).release());
+}
+
+void lief_elf_binary_destroy(lief_elf_binary_t* binary) {
+  delete reinterpret_cast<Binary*>(binary);
+}
+
+lief_elf_binary_t* lief_elf_binary_from_legacy(Elf_Binary_t* binary) {
+  return binary != nullptr ? reinterpret_cast<lief_elf_binary_t*>(binary->handler) : nullptr;
+}
+
+// Binary
+// ======
+uint32_t lief_elf_binary_type(const lief_elf_binary_t* binary) {
+  return static_cast<uint32_t>(from(binary).type());
+}
+
+uint32_t lief_elf_binary_file_type(const lief_elf_binary_t* binary) {
+  return static_cast<uint32_t>(from(binary).header().file_type());
+}
+
+uint32_t lief_elf_binary_machine_type(const lief_elf_binary_t* binary) {
+  return static_cast<uint32_t>(from(binary).header().machine_type());
+}
+
+uint64_t lief_elf_binary_entrypoint(const lief_elf_binary_t* binary) {
+  return from(binary).entrypoint();
+}
+
+uint64_t lief_elf_binary_imagebase(const lief_elf_binary_t* binary) {
+  return from(binary).imagebase();
+}
+
+const char* lief_elf_binary_interpreter(const lief_elf_binary_t* binary) {
+  const Binary& elf = from(binary);
+  return elf.has_interpreter() ? elf.interpreter().c_str() : nullptr;
+}
+
+size_t lief_elf_binary_sections_count(const lief_elf_binary_t* binary) {
+  return from(binary).sections().size();
+}
+
+size_t lief_elf_binary_segments_count(const lief_elf_binary_t* binary) {
+  return from(binary).segments().size();
+}
+
+size_t lief_elf_binary_dynamic_symbols_count(const lief_elf_binary_t* binary) {
+  return from(binary).dynamic_symbols().size();
+}
+
+size_t lief_elf_binary_symtab_symbols_count(const lief_elf_binary_t* binary) {
+  return from(binary).symtab_symbols().size();
+}
+
+size_t lief_elf_binary_dynamic_entries_count(const lief_elf_binary_t* binary) {
+  return from(binary).dynamic_entries().size();
+}
+
+const lief_elf_section_t*
+  lief_elf_binary_section_at(const lief_elf_binary_t* binary, size_t idx)
+{
+  return handle_at<lief_elf_section_t>(from(binary).sections(), idx);
+}
+
+const lief_elf_segment_t*
+  lief_elf_binary_segment_at(const lief_elf_binary_t* binary, size_t idx)
+{
+  return handle_at<lief_elf_segment_t>(from(binary).segments(), idx);
+}
+
+const lief_elf_symbol_t*
+  lief_elf_binary_dynamic_symbol_at(const lief_elf_binary_t* binary, size_t idx)
+{
+  return handle_at<lief_elf_symbol_t>(from(binary).dynamic_symbols(), idx);
+}
+
+const lief_elf_symbol_t*
+  lief_elf_binary_symtab_symbol_at(const lief_elf_binary_t* binary, size_t idx)
+{
+  return handle_at<lief_elf_symbol_t>(from(binary).symtab_symbols(), idx);
+}
+
+const lief_elf_dynamic_entry_t*
+  lief_elf_binary_dynamic_entry_at(const lief_elf_binary_t* binary, size_t idx)
+{
+  return handle_at<lief_elf_dynamic_entry_t>(from(binary).dynamic_entries(), idx);
+}
+
+const lief_elf_section_t*
+  lief_elf_binary_get_section(const lief_elf_binary_t* binary, const char* name)
+{
+  if (name == nullptr) {
+    return nullptr;
+  }
+  return to_handle<lief_elf_section_t>(from(binary).get_section(name));
+}
+
+// Section
+// =======
+const char* lief_elf_section_name(const lief_elf_section_t* section) {
+  return from(section).fullname().c_str();
+}
+
+uint32_t lief_elf_section_type(const lief_elf_section_t* section) {
+  return static_cast<uint32_t>(from(section).type());
+}
+
+uint64_t lief_elf_section_flags(const lief_elf_section_t* section) {
+  return from(section).flags();
+}
+
+uint64_t lief_elf_section_virtual_address(const lief_elf_section_t* section) {
+  return from(section).virtual_address();
+}
+
+uint64_t lief_elf_section_offset(const lief_elf_section_t* section) {
+  return from(section).file_offset();
+}
+
+uint64_t lief_elf_section_size(const lief_elf_section_t* section) {
+  return from(section).size();
+}
+
+uint32_t lief_elf_section_link(const lief_elf_section_t* section) {
+  return from(section).link();
+}
+
+uint32_t lief_elf_section_info(const lief_elf_section_t* section) {
+  return static_cast<uint32_t>(from(section).information());
+}
+
+uint64_t lief_elf_section_alignment(const lief_elf_section_t* section) {
+  return from(section).alignment();
+}
+
+uint64_t lief_elf_section_entry_size(const lief_elf_section_t* section) {
+  return from(section).entry_size();
+}
+
+double lief_elf_section_entropy(const lief_elf_section_t* section) {
+  return from(section).entropy();
+}
+
+const uint8_t* lief_elf_section_content(const lief_elf_section_t* section, size_t* size) {
+  return content_of(from(section), size);
+}
+
+// Segment
+// =======
+uint32_t lief_elf_segment_type(const lief_elf_segment_t* segment) {
+  return static_cast<uint32_t>(from(segment).type());
+}
+
+uint32_t lief_elf_segment_flags(const lief_elf_segment_t* segment) {
+  return static_cast<uint32_t>(from(segment).flags());
+}
+
+uint64_t lief_elf_segment_virtual_address(const lief_elf_segment_t* segment) {
+  return from(segment).virtual_address();
+}
+
+uint64_t lief_elf_segment_virtual_size(const lief_elf_segment_t* segment) {
+  return from(segment).virtual_size();
+}
+
+uint64_t lief_elf_segment_offset(const lief_elf_segment_t* segment) {
+  return from(segment).file_offset();
+}
+
+uint64_t lief_elf_segment_alignment(const lief_elf_segment_t* segment) {
+  return from(segment).alignment();
+}
+
+const uint8_t* lief_elf_segment_content(const lief_elf_segment_t* segment, size_t* size) {
+  return content_of(from(segment), size);
+}
+
+// Symbol
+// ======
+const char* lief_elf_symbol_name(const lief_elf_symbol_t* symbol) {
+  return from(symbol).name().c_str();
+}
+
+uint32_t lief_elf_symbol_type(const lief_elf_symbol_t* symbol) {
+  return static_cast<uint32_t>(from(symbol).type());
+}
+
+uint32_t lief_elf_symbol_binding(const lief_elf_symbol_t* symbol) {
+  return static_cast<uint32_t>(from(symbol).binding());
+}
+
+uint8_t lief_elf_symbol_information(const lief_elf_symbol_t* symbol) {
+  return from(symbol).information();
+}
+
+uint8_t lief_elf_symbol_other(const lief_elf_symbol_t* symbol) {
+  return from(symbol).other();
+}
+
+uint16_t lief_elf_symbol_shndx(const lief_elf_symbol_t* symbol) {
+  return from(symbol).shndx();
+}
+
+uint64_t lief_elf_symbol_value(const lief_elf_symbol_t* symbol) {
+  return from(symbol).value();
+}
+
+uint64_t lief_elf_symbol_size(const lief_elf_symbol_t* symbol) {
+  return from(symbol).size();
+}
+
+bool lief_elf_symbol_is_exported(const lief_elf_symbol_t* symbol) {
+  return from(symbol).is_exported();
+}
+
+bool lief_elf_symbol_is_imported(const lief_elf_symbol_t* symbol) {
+  return from(symbol).is_imported();
+}
+
+// Dynamic entry
+// =============
+uint64_t lief_elf_dynamic_entry_tag(const lief_elf_dynamic_entry_t* entry) {
+  return static_cast<uint64_t>(from(entry).tag());
+}
+
+uint64_t lief_elf_dynamic_entry_value(const lief_elf_dynamic_entry_t* entry) {
+  return from(entry).value();
+}
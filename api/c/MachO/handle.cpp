@@ -0,0 +1,303 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LIEF/MachO/handle.h"
+#include "LIEF/MachO/Binary.h"
+
+#include "LIEF/MachO/Parser.hpp"
+#include "LIEF/MachO/FatBinary.hpp"
+#include "LIEF/MachO/Binary.hpp"
+#include "LIEF/MachO/LoadCommand.hpp"
+#include "LIEF/MachO/SegmentCommand.hpp"
+#include "LIEF/MachO/Section.hpp"
+#include "LIEF/MachO/Symbol.hpp"
+
+#include "../handle.hpp"
+
+using namespace LIEF::MachO;
+using namespace LIEF::c_api;
+
+namespace {
+// The C handles are opaque aliases of the C++ objects
+inline const FatBinary& from(const lief_macho_fat_binary_t* h) {
+  return *reinterpret_cast<const FatBinary*>(h);
+}
+
+inline const Binary& from(const lief_macho_binary_t* h) {
+  return *reinterpret_cast<const Binary*>(h);
+}
+
+inline const LoadCommand& from(const lief_macho_command_t* h) {
+  return *reinterpret_cast<const LoadCommand*>(h);
+}
+
+inline const SegmentCommand& from(const lief_macho_segment_t* h) {
+  return *reinterpret_cast<const SegmentCommand*>(h);
+}
+
+inline const Section& from(const lief_macho_section_t* h) {
+  return *reinterpret_cast<const Section*>(h);
+}
+
+inline const Symbol& from(const lief_macho_symbol_t* h) {
+  return *reinterpret_cast<const Symbol*>(h);
+}
+}
+
+lief_macho_fat_binary_t* lief_macho_parse(const char* file) {
+  return reinterpret_cast<lief_macho_fat_binary_t*>(Parser::parse(file).release());
+}
+
+void lief_macho_fat_binary_destroy(lief_macho_fat_binary_t* fat) {
+  delete reinterpret_cast<FatBinary*>(fat);
+}
+
+size_t lief_macho_fat_binary_size(const lief_macho_fat_binary_t* fat) {
+  return from(fat).size();
+}
+
+const lief_macho_binary_t*
+  lief_macho_fat_binary_at(const lief_macho_fat_binary_t* fat, size_t idx)
+{
+  if (idx >= from(fat).size()) {
+    return nullptr;
+  }
+  return to_handle<lief_macho_binary_t>(from(fat).at(idx));
+}
+
+const lief_macho_binary_t* lief_macho_binary_from_legacy(const Macho_Binary_t* binary) {
+  return binary != nullptr ? to_handle<lief_macho_binary_t>(binary->handler) : nullptr;
+}
+
+// Binary
+// ======
+uint32_t lief_macho_binary_magic(const lief_macho_binary_t* binary) {
+  return static_cast<uint32_t>(from(binary).header().magic());
+}
+
+uint32_t lief_macho_binary_cpu_type(const lief_macho_binary_t* binary) {
+  return static_cast<uint32_t>(from(binary).header().cpu_type());
+}
+
+uint32_t lief_macho_binary_cpu_subtype(const lief_macho_binary_t* binary) {
+  return from(binary).header().cpu_subtype();
+}
+
+uint32_t lief_macho_binary_file_type(const lief_macho_binary_t* binary) {
+  return static_cast<uint32_t>(from(binary).header().file_type());
+}
+
+uint32_t lief_macho_binary_flags(const lief_macho_binary_t* binary) {
+  return from(binary).header().flags();
+}
+
+uint64_t lief_macho_binary_entrypoint(const lief_macho_binary_t* binary) {
+  return from(binary).entrypoint();
+}
+
+uint64_t lief_macho_binary_imagebase(const lief_macho_binary_t* binary) {
+  return from(binary).imagebase();
+}
+
+size_t lief_macho_binary_commands_count(const lief_macho_binary_t* binary) {
+  return from(binary).commands().size();
+}
+
+size_t lief_macho_binary_segments_count(const lief_macho_binary_t* binary) {
+  return from(binary).segments().size();
+}
+
+size_t lief_macho_binary_sections_count(const lief_macho_binary_t* binary) {
+  return from(binary).sections().size();
+}
+
+size_t lief_macho_binary_symbols_count(const lief_macho_binary_t* binary) {
+  return from(binary).symbols().size();
+}
+
+const lief_macho_command_t*
+  lief_macho_binary_command_at(const lief_macho_binary_t* binary, size_t idx)
+{
+  return handle_at<lief_macho_command_t>(from(binary).commands(), idx);
+}
+
+const lief_macho_segment_t*
+  lief_macho_binary_segment_at(const lief_macho_binary_t* binary, size_t idx)
+{
+  return handle_at<lief_macho_segment_t>(from(binary).segments(), idx);
+}
+
+const lief_macho_section_t*
+  lief_macho_binary_section_at(const lief_macho_binary_t* binary, size_t idx)
+{
+  return handle_at<lief_macho_section_t>(from(binary).sections(), idx);
+}
+
+const lief_macho_symbol_t*
+  lief_macho_binary_symbol_at(const lief_macho_binary_t* binary, size_t idx)
+{
+  return handle_at<lief_macho_symbol_t>(from(binary).symbols(), idx);
+}
+
+const lief_macho_segment_t*
+  lief_macho_binary_get_segment(const lief_macho_binary_t* binary, const char* name)
+{
+  if (name == nullptr) {
+    return nullptr;
+  }
+  return to_handle<lief_macho_segment_t>(from(binary).get_segment(name));
+}
+
+const lief_macho_section_t*
+  lief_macho_binary_get_section(const lief_macho_binary_t* binary, const char* name)
+{
+  if (name == nullptr) {
+    return nullptr;
+  }
+  return to_handle<lief_macho_section_t>(from(binary).get_section(name));
+}
+
+const lief_macho_symbol_t*
+  lief_macho_binary_get_symbol(const lief_macho_binary_t* binary, const char* name)
+{
+  if (name == nullptr) {
+    return nullptr;
+  }
+  return to_handle<lief_macho_symbol_t>(from(binary).get_symbol(name));
+}
+
+// Load command
+// ============
+uint32_t lief_macho_command_type(const lief_macho_command_t* cmd) {
+  return static_cast<uint32_t>(from(cmd).command());
+}
+
+uint32_t lief_macho_command_size(const lief_macho_command_t* cmd) {
+  return from(cmd).size();
+}
+
+uint64_t lief_macho_command_offset(const lief_macho_command_t* cmd) {
+  return from(cmd).command_offset();
+}
+
+const uint8_t* lief_macho_command_data(const lief_macho_command_t* cmd, size_t* size) {
+  LIEF::span<const uint8_t> data = from(cmd).data();
+  if (size != nullptr) {
+    *size = data.size();
+  }
+  return data.empty() ? nullptr : data.data();
+}
+
+// Segment
+// =======
+const char* lief_macho_segment_name(const lief_macho_segment_t* segment) {
+  return from(segment).name().c_str();
+}
+
+uint64_t lief_macho_segment_virtual_address(const lief_macho_segment_t* segment) {
+  return from(segment).virtual_address();
+}
+
+uint64_t lief_macho_segment_virtual_size(const lief_macho_segment_t* segment) {
+  return from(segment).virtual_size();
+}
+
+uint64_t lief_macho_segment_file_offset(const lief_macho_segment_t* segment) {
+  return from(segment).file_offset();
+}
+
+uint64_t lief_macho_segment_file_size(const lief_macho_segment_t* segment) {
+  return from(segment).file_size();
+}
+
+uint32_t lief_macho_segment_max_protection(const lief_macho_segment_t* segment) {
+  return from(segment).max_protection();
+}
+
+uint32_t lief_macho_segment_init_protection(const lief_macho_segment_t* segment) {
+  return from(segment).init_protection();
+}
+
+uint32_t lief_macho_segment_flags(const lief_macho_segment_t* segment) {
+  return from(segment).flags();
+}
+
+const uint8_t* lief_macho_segment_content(const lief_macho_segment_t* segment, size_t* size) {
+  return content_of(from(segment), size);
+}
+
+// Section
+// =======
+const char* lief_macho_section_name(const lief_macho_section_t* section) {
+  return from(section).fullname().c_str();
+}
+
+const char* lief_macho_section_segment_name(const lief_macho_section_t* section) {
+  return from(section).segment_name().c_str();
+}
+
+uint64_t lief_macho_section_virtual_address(const lief_macho_section_t* section) {
+  return from(section).virtual_address();
+}
+
+uint64_t lief_macho_section_offset(const lief_macho_section_t* section) {
+  return from(section).offset();
+}
+
+uint64_t lief_macho_section_size(const lief_macho_section_t* section) {
+  return from(section).size();
+}
+
+uint32_t lief_macho_section_alignment(const lief_macho_section_t* section) {
+  return from(section).alignment();
+}
+
+uint32_t lief_macho_section_type(const lief_macho_section_t* section) {
+  return static_cast<uint32_t>(from(section).type());
+}
+
+uint32_t lief_macho_section_flags(const lief_macho_section_t* section) {
+  return from(section).raw_flags();
+}
+
+double lief_macho_section_entropy(const lief_macho_section_t* section) {
+  return from(section).entropy();
+}
+
+const uint8_t* lief_macho_section_content(const lief_macho_section_t* section, size_t* size) {
+  return content_of(from(section), size);
+}
+
+// Symbol
+// ======
+const char* lief_macho_symbol_name(const lief_macho_symbol_t* symbol) {
+  return from(symbol).name().c_str();
+}
+
+uint8_t lief_macho_symbol_type(const lief_macho_symbol_t* symbol) {
+  return from(symbol).raw_type();
+}
+
+uint8_t lief_macho_symbol_numberof_sections(const lief_macho_symbol_t* symbol) {
+  return from(symbol).numberof_sections();
+}
+
+uint16_t lief_macho_symbol_description(const lief_macho_symbol_t* symbol) {
+  return from(symbol).description();
+}
+
+uint64_t lief_macho_symbol_value(const lief_macho_symbol_t* symbol) {
+  return from(symbol).value();
+}
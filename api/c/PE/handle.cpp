@@ -0,0 +1,244 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LIEF/PE/handle.h"
+#include "LIEF/PE/Binary.h"
+
+#include "LIEF/PE/Parser.hpp"
+#include "LIEF/PE/Binary.hpp"
+#include "LIEF/PE/DataDirectory.hpp"
+#include "LIEF/PE/Import.hpp"
+#include "LIEF/PE/ImportEntry.hpp"
+#include "LIEF/PE/Section.hpp"
+
+#include "../handle.hpp"
+
+using namespace LIEF::PE;
+using namespace LIEF::c_api;
+
+namespace {
+// The C handles are opaque aliases of the C++ objects
+inline const Binary& from(const lief_pe_binary_t* h) {
+  return *reinterpret_cast<const Binary*>(h);
+}
+
+inline const Section& from(const lief_pe_section_t* h) {
+  return *reinterpret_cast<const Section*>(h);
+}
+
+inline const DataDirectory& from(const lief_pe_data_directory_t* h) {
+  return *reinterpret_cast<const DataDirectory*>(h);
+}
+
+inline const Import& from(const lief_pe_import_t* h) {
+  return *reinterpret_cast<const Import*>(h);
+}
+
+inline const ImportEntry& from(const lief_pe_import_entry_t* h) {
+  return *reinterpret_cast<const ImportEntry*>(h);
+}
+}
+
+lief_pe_binary_t* lief_pe_parse(const char* file) {
+  return reinterpret_cast<lief_pe_binary_t*>(Parser::parse(file).release());
+}
+
+void lief_pe_binary_destroy(lief_pe_binary_t* binary) {
+  delete reinterpret_cast<Binary*>(binary);
+}
+
+lief_pe_binary_t* lief_pe_binary_from_legacy(Pe_Binary_t* binary) {
+  return binary != nullptr ? reinterpret_cast<lief_pe_binary_t*>(binary->handler) : nullptr;
+}
+
+// Binary
+// ======
+uint32_t lief_pe_binary_type(const lief_pe_binary_t* binary) {
+  return static_cast<uint32_t>(from(binary).type());
+}
+
+uint32_t lief_pe_binary_machine(const lief_pe_binary_t* binary) {
+  return static_cast<uint32_t>(from(binary).header().machine());
+}
+
+uint32_t lief_pe_binary_characteristics(const lief_pe_binary_t* binary) {
+  return from(binary).header().characteristics();
+}
+
+uint32_t lief_pe_binary_subsystem(const lief_pe_binary_t* binary) {
+  return static_cast<uint32_t>(from(binary).optional_header().subsystem());
+}
+
+uint64_t lief_pe_binary_entrypoint(const lief_pe_binary_t* binary) {
+  return from(binary).entrypoint();
+}
+
+uint64_t lief_pe_binary_imagebase(const lief_pe_binary_t* binary) {
+  return from(binary).imagebase();
+}
+
+size_t lief_pe_binary_sections_count(const lief_pe_binary_t* binary) {
+  return from(binary).sections().size();
+}
+
+size_t lief_pe_binary_data_directories_count(const lief_pe_binary_t* binary) {
+  return from(binary).data_directories().size();
+}
+
+size_t lief_pe_binary_imports_count(const lief_pe_binary_t* binary) {
+  return from(binary).imports().size();
+}
+
+const lief_pe_section_t*
+  lief_pe_binary_section_at(const lief_pe_binary_t* binary, size_t idx)
+{
+  return handle_at<lief_pe_section_t>(from(binary).sections(), idx);
+}
+
+const lief_pe_data_directory_t*
+  lief_pe_binary_data_directory_at(const lief_pe_binary_t* binary, size_t idx)
+{
+  return handle_at<lief_pe_data_directory_t>(from(binary).data_directories(), idx);
+}
+
+const lief_pe_import_t*
+  lief_pe_binary_import_at(const lief_pe_binary_t* binary, size_t idx)
+{
+  return handle_at<lief_pe_import_t>(from(binary).imports(), idx);
+}
+
+const lief_pe_section_t*
+  lief_pe_binary_get_section(const lief_pe_binary_t* binary, const char* name)
+{
+  if (name == nullptr) {
+    return nullptr;
+  }
+  return to_handle<lief_pe_section_t>(from(binary).get_section(name));
+}
+
+const lief_pe_import_t*
+  lief_pe_binary_get_import(const lief_pe_binary_t* binary, const char* name)
+{
+  if (name == nullptr) {
+    return nullptr;
+  }
+  return to_handle<lief_pe_import_t>(from(binary).get_import(name));
+}
+
+// Section
+// =======
+const char* lief_pe_section_name(const lief_pe_section_t* section) {
+  return from(section).fullname().c_str();
+}
+
+uint64_t lief_pe_section_virtual_address(const lief_pe_section_t* section) {
+  return from(section).virtual_address();
+}
+
+uint32_t lief_pe_section_virtual_size(const lief_pe_section_t* section) {
+  return from(section).virtual_size();
+}
+
+uint64_t lief_pe_section_offset(const lief_pe_section_t* section) {
+  return from(section).offset();
+}
+
+uint64_t lief_pe_section_size(const lief_pe_section_t* section) {
+  return from(section).size();
+}
+
+uint32_t lief_pe_section_characteristics(const lief_pe_section_t* section) {
+  return from(section).characteristics();
+}
+
+double lief_pe_section_entropy(const lief_pe_section_t* section) {
+  return from(section).entropy();
+}
+
+const uint8_t* lief_pe_section_content(const lief_pe_section_t* section, size_t* size) {
+  return content_of(from(section), size);
+}
+
+// Data directory
+// ==============
+uint32_t lief_pe_data_directory_type(const lief_pe_data_directory_t* dir) {
+  return static_cast<uint32_t>(from(dir).type());
+}
+
+uint32_t lief_pe_data_directory_rva(const lief_pe_data_directory_t* dir) {
+  return from(dir).RVA();
+}
+
+uint32_t lief_pe_data_directory_size(const lief_pe_data_directory_t* dir) {
+  return from(dir).size();
+}
+
+// Import
+// ======
+const char* lief_pe_import_name(const lief_pe_import_t* import) {
+  return from(import).name().c_str();
+}
+
+uint32_t lief_pe_import_forwarder_chain(const lief_pe_import_t* import) {
+  return from(import).forwarder_chain();
+}
+
+uint32_t lief_pe_import_timedatestamp(const lief_pe_import_t* import) {
+  return from(import).timedatestamp();
+}
+
+uint32_t lief_pe_import_address_table_rva(const lief_pe_import_t* import) {
+  return from(import).import_address_table_rva();
+}
+
+uint32_t lief_pe_import_lookup_table_rva(const lief_pe_import_t* import) {
+  return from(import).import_lookup_table_rva();
+}
+
+size_t lief_pe_import_entries_count(const lief_pe_import_t* import) {
+  return from(import).entries().size();
+}
+
+const lief_pe_import_entry_t*
+  lief_pe_import_entry_at(const lief_pe_import_t* import, size_t idx)
+{
+  return handle_at<lief_pe_import_entry_t>(from(import).entries(), idx);
+}
+
+// Import entry
+// ============
+const char* lief_pe_import_entry_name(const lief_pe_import_entry_t* entry) {
+  return from(entry).name().c_str();
+}
+
+bool lief_pe_import_entry_is_ordinal(const lief_pe_import_entry_t* entry) {
+  return from(entry).is_ordinal();
+}
+
+uint16_t lief_pe_import_entry_ordinal(const lief_pe_import_entry_t* entry) {
+  return from(entry).ordinal();
+}
+
+uint16_t lief_pe_import_entry_hint(const lief_pe_import_entry_t* entry) {
+  return from(entry).hint();
+}
+
+uint64_t lief_pe_import_entry_iat_value(const lief_pe_import_entry_t* entry) {
+  return from(entry).iat_value();
+}
+
+uint64_t lief_pe_import_entry_iat_address(const lief_pe_import_entry_t* entry) {
+  return from(entry).iat_address();
+}
@@ -0,0 +1,55 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_C_API_HANDLE_HPP
+#define LIEF_C_API_HANDLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "LIEF/span.hpp"
+
+// Helpers shared by the handle-based API (LIEF/<FORMAT>/handle.h) in which
+// the C handles are opaque aliases of the C++ objects.
+namespace LIEF {
+namespace c_api {
+
+template<class H, class T>
+inline const H* to_handle(const T* obj) {
+  return reinterpret_cast<const H*>(obj);
+}
+
+/// Borrow the idx-th element of a LIEF iterator or return nullptr
+template<class H, class It>
+inline const H* handle_at(It it, size_t idx) {
+  if (idx >= it.size()) {
+    return nullptr;
+  }
+  return to_handle<H>(&it[idx]);
+}
+
+/// Borrow the content of `obj` and write its size in `size` (if not null)
+template<class T>
+inline const uint8_t* content_of(const T& obj, size_t* size) {
+  span<const uint8_t> content = obj.content();
+  if (size != nullptr) {
+    *size = content.size();
+  }
+  return content.empty() ? nullptr : content.data();
+}
+
+}
+}
+#endif
@@ -22,5 +22,6 @@
 #include "LIEF/ELF/Header.h"
 #include "LIEF/ELF/DynamicEntry.h"
 #include "LIEF/ELF/utils.h"
+#include "LIEF/ELF/handle.h"
 
 #endif
@@ -0,0 +1,145 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_C_ELF_HANDLE_H
+#define LIEF_C_ELF_HANDLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "LIEF/visibility.h"
+#include "LIEF/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Handle-based API over LIEF::ELF::Binary
+ *
+ * Contrary to elf_parse() which eagerly converts all the sections, segments,
+ * symbols and dynamic entries into C structures, the handles of this API are
+ * opaque references to the C++ objects. Nothing is allocated when accessing
+ * an object or a field and the returned pointers (handles, strings, content)
+ * are borrowed from the binary: they are valid until
+ * lief_elf_binary_destroy() is called.
+ */
+typedef struct lief_elf_binary_t        lief_elf_binary_t;
+typedef struct lief_elf_section_t       lief_elf_section_t;
+typedef struct lief_elf_segment_t       lief_elf_segment_t;
+typedef struct lief_elf_symbol_t        lief_elf_symbol_t;
+typedef struct lief_elf_dynamic_entry_t lief_elf_dynamic_entry_t;
+
+struct Elf_Binary_t;
+
+/** Wrapper for LIEF::ELF::Parser::parse. Return NULL on error */
+LIEF_API lief_elf_binary_t* lief_elf_parse(const char* file);
+
+LIEF_API void lief_elf_binary_destroy(lief_elf_binary_t* binary);
+
+/** Handle associated with a binary created by elf_parse() (owned by the latter) */
+LIEF_API lief_elf_binary_t* lief_elf_binary_from_legacy(struct Elf_Binary_t* binary);
+
+/* Binary
+ * ====== */
+LIEF_API uint32_t    lief_elf_binary_type(const lief_elf_binary_t* binary);
+LIEF_API uint32_t    lief_elf_binary_file_type(const lief_elf_binary_t* binary);
+LIEF_API uint32_t    lief_elf_binary_machine_type(const lief_elf_binary_t* binary);
+LIEF_API uint64_t    lief_elf_binary_entrypoint(const lief_elf_binary_t* binary);
+LIEF_API uint64_t    lief_elf_binary_imagebase(const lief_elf_binary_t* binary);
+
+/** Interpreter (e.g. ``/lib64/ld-linux-x86-64.so.2``) or NULL */
+LIEF_API const char* lief_elf_binary_interpreter(const lief_elf_binary_t* binary);
+
+LIEF_API size_t lief_elf_binary_sections_count(const lief_elf_binary_t* binary);
+LIEF_API size_t lief_elf_binary_segments_count(const lief_elf_binary_t* binary);
+LIEF_API size_t lief_elf_binary_dynamic_symbols_count(const lief_elf_binary_t* binary);
+LIEF_API size_t lief_elf_binary_symtab_symbols_count(const lief_elf_binary_t* binary);
+LIEF_API size_t lief_elf_binary_dynamic_entries_count(const lief_elf_binary_t* binary);
+
+/** Accessors by index. They return NULL if the index is out of range */
+LIEF_API const lief_elf_section_t*
+  lief_elf_binary_section_at(const lief_elf_binary_t* binary, size_t idx);
+
+LIEF_API const lief_elf_segment_t*
+  lief_elf_binary_segment_at(const lief_elf_binary_t* binary, size_t idx);
+
+LIEF_API const lief_elf_symbol_t*
+  lief_elf_binary_dynamic_symbol_at(const lief_elf_binary_t* binary, size_t idx);
+
+LIEF_API const lief_elf_symbol_t*
+  lief_elf_binary_symtab_symbol_at(const lief_elf_binary_t* binary, size_t idx);
+
+LIEF_API const lief_elf_dynamic_entry_t*
+  lief_elf_binary_dynamic_entry_at(const lief_elf_binary_t* binary, size_t idx);
+
+/** Section with the given name or NULL */
+LIEF_API const lief_elf_section_t*
+  lief_elf_binary_get_section(const lief_elf_binary_t* binary, const char* name);
+
+/* Section
+ * ======= */
+LIEF_API const char* lief_elf_section_name(const lief_elf_section_t* section);
+LIEF_API uint32_t    lief_elf_section_type(const lief_elf_section_t* section);
+LIEF_API uint64_t    lief_elf_section_flags(const lief_elf_section_t* section);
+LIEF_API uint64_t    lief_elf_section_virtual_address(const lief_elf_section_t* section);
+LIEF_API uint64_t    lief_elf_section_offset(const lief_elf_section_t* section);
+LIEF_API uint64_t    lief_elf_section_size(const lief_elf_section_t* section);
+LIEF_API uint32_t    lief_elf_section_link(const lief_elf_section_t* section);
+LIEF_API uint32_t    lief_elf_section_info(const lief_elf_section_t* section);
+LIEF_API uint64_t    lief_elf_section_alignment(const lief_elf_section_t* section);
+LIEF_API uint64_t    lief_elf_section_entry_size(const lief_elf_section_t* section);
+LIEF_API double      lief_elf_section_entropy(const lief_elf_section_t* section);
+
+/** Content of the section. Its size is written in ``size`` if not NULL */
+LIEF_API const uint8_t*
+  lief_elf_section_content(const lief_elf_section_t* section, size_t* size);
+
+/* Segment
+ * ======= */
+LIEF_API uint32_t lief_elf_segment_type(const lief_elf_segment_t* segment);
+LIEF_API uint32_t lief_elf_segment_flags(const lief_elf_segment_t* segment);
+LIEF_API uint64_t lief_elf_segment_virtual_address(const lief_elf_segment_t* segment);
+LIEF_API uint64_t lief_elf_segment_virtual_size(const lief_elf_segment_t* segment);
+LIEF_API uint64_t lief_elf_segment_offset(const lief_elf_segment_t* segment);
+LIEF_API uint64_t lief_elf_segment_alignment(const lief_elf_segment_t* segment);
+
+/** Content of the segment. Its size is written in ``size`` if not NULL */
+LIEF_API const uint8_t*
+  lief_elf_segment_content(const lief_elf_segment_t* segment, size_t* size);
+
+/* Symbol
+ * ====== */
+LIEF_API const char* lief_elf_symbol_name(const lief_elf_symbol_t* symbol);
+LIEF_API uint32_t    lief_elf_symbol_type(const lief_elf_symbol_t* symbol);
+LIEF_API uint32_t    lief_elf_symbol_binding(const lief_elf_symbol_t* symbol);
+LIEF_API uint8_t     lief_elf_symbol_information(const lief_elf_symbol_t* symbol);
+LIEF_API uint8_t     lief_elf_symbol_other(const lief_elf_symbol_t* symbol);
+LIEF_API uint16_t    lief_elf_symbol_shndx(const lief_elf_symbol_t* symbol);
+LIEF_API uint64_t    lief_elf_symbol_value(const lief_elf_symbol_t* symbol);
+LIEF_API uint64_t    lief_elf_symbol_size(const lief_elf_symbol_t* symbol);
+LIEF_API bool        lief_elf_symbol_is_exported(const lief_elf_symbol_t* symbol);
+LIEF_API bool        lief_elf_symbol_is_imported(const lief_elf_symbol_t* symbol);
+
+/* Dynamic entry
+ * ============= */
+LIEF_API uint64_t lief_elf_dynamic_entry_tag(const lief_elf_dynamic_entry_t* entry);
+LIEF_API uint64_t lief_elf_dynamic_entry_value(const lief_elf_dynamic_entry_t* entry);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -22,4 +22,5 @@
 #include "LIEF/MachO/Section.h"
 #include "LIEF/MachO/LoadCommand.h"
 #include "LIEF/MachO/Header.h"
+#include "LIEF/MachO/handle.h"
 #endif
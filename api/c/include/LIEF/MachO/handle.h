@@ -0,0 +1,152 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_C_MACHO_HANDLE_H
+#define LIEF_C_MACHO_HANDLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "LIEF/visibility.h"
+#include "LIEF/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Handle-based API over LIEF::MachO::FatBinary and LIEF::MachO::Binary
+ *
+ * The handles are opaque references to the C++ objects: contrary to
+ * macho_parse(), nothing is converted or allocated when accessing an object.
+ * The returned pointers (handles, strings, content) are borrowed from the
+ * fat binary and are valid until lief_macho_fat_binary_destroy() is called.
+ */
+typedef struct lief_macho_fat_binary_t lief_macho_fat_binary_t;
+typedef struct lief_macho_binary_t     lief_macho_binary_t;
+typedef struct lief_macho_command_t    lief_macho_command_t;
+typedef struct lief_macho_segment_t    lief_macho_segment_t;
+typedef struct lief_macho_section_t    lief_macho_section_t;
+typedef struct lief_macho_symbol_t     lief_macho_symbol_t;
+
+struct Macho_Binary_t;
+
+/** Wrapper for LIEF::MachO::Parser::parse. Return NULL on error */
+LIEF_API lief_macho_fat_binary_t* lief_macho_parse(const char* file);
+
+LIEF_API void lief_macho_fat_binary_destroy(lief_macho_fat_binary_t* fat);
+
+/** Number of binaries embedded in the fat binary (1 for a regular Mach-O) */
+LIEF_API size_t lief_macho_fat_binary_size(const lief_macho_fat_binary_t* fat);
+
+LIEF_API const lief_macho_binary_t*
+  lief_macho_fat_binary_at(const lief_macho_fat_binary_t* fat, size_t idx);
+
+/** Handle associated with a binary created by macho_parse() (owned by the latter) */
+LIEF_API const lief_macho_binary_t*
+  lief_macho_binary_from_legacy(const struct Macho_Binary_t* binary);
+
+/* Binary
+ * ====== */
+LIEF_API uint32_t lief_macho_binary_magic(const lief_macho_binary_t* binary);
+LIEF_API uint32_t lief_macho_binary_cpu_type(const lief_macho_binary_t* binary);
+LIEF_API uint32_t lief_macho_binary_cpu_subtype(const lief_macho_binary_t* binary);
+LIEF_API uint32_t lief_macho_binary_file_type(const lief_macho_binary_t* binary);
+LIEF_API uint32_t lief_macho_binary_flags(const lief_macho_binary_t* binary);
+LIEF_API uint64_t lief_macho_binary_entrypoint(const lief_macho_binary_t* binary);
+LIEF_API uint64_t lief_macho_binary_imagebase(const lief_macho_binary_t* binary);
+
+LIEF_API size_t lief_macho_binary_commands_count(const lief_macho_binary_t* binary);
+LIEF_API size_t lief_macho_binary_segments_count(const lief_macho_binary_t* binary);
+LIEF_API size_t lief_macho_binary_sections_count(const lief_macho_binary_t* binary);
+LIEF_API size_t lief_macho_binary_symbols_count(const lief_macho_binary_t* binary);
+
+/** Accessors by index. They return NULL if the index is out of range */
+LIEF_API const lief_macho_command_t*
+  lief_macho_binary_command_at(const lief_macho_binary_t* binary, size_t idx);
+
+LIEF_API const lief_macho_segment_t*
+  lief_macho_binary_segment_at(const lief_macho_binary_t* binary, size_t idx);
+
+LIEF_API const lief_macho_section_t*
+  lief_macho_binary_section_at(const lief_macho_binary_t* binary, size_t idx);
+
+LIEF_API const lief_macho_symbol_t*
+  lief_macho_binary_symbol_at(const lief_macho_binary_t* binary, size_t idx);
+
+/** Segment/section/symbol with the given name or NULL */
+LIEF_API const lief_macho_segment_t*
+  lief_macho_binary_get_segment(const lief_macho_binary_t* binary, const char* name);
+
+LIEF_API const lief_macho_section_t*
+  lief_macho_binary_get_section(const lief_macho_binary_t* binary, const char* name);
+
+LIEF_API const lief_macho_symbol_t*
+  lief_macho_binary_get_symbol(const lief_macho_binary_t* binary, const char* name);
+
+/* Load command
+ * ============ */
+LIEF_API uint32_t lief_macho_command_type(const lief_macho_command_t* cmd);
+LIEF_API uint32_t lief_macho_command_size(const lief_macho_command_t* cmd);
+LIEF_API uint64_t lief_macho_command_offset(const lief_macho_command_t* cmd);
+
+/** Raw data of the command. Its size is written in ``size`` if not NULL */
+LIEF_API const uint8_t*
+  lief_macho_command_data(const lief_macho_command_t* cmd, size_t* size);
+
+/* Segment
+ * ======= */
+LIEF_API const char* lief_macho_segment_name(const lief_macho_segment_t* segment);
+LIEF_API uint64_t    lief_macho_segment_virtual_address(const lief_macho_segment_t* segment);
+LIEF_API uint64_t    lief_macho_segment_virtual_size(const lief_macho_segment_t* segment);
+LIEF_API uint64_t    lief_macho_segment_file_offset(const lief_macho_segment_t* segment);
+LIEF_API uint64_t    lief_macho_segment_file_size(const lief_macho_segment_t* segment);
+LIEF_API uint32_t    lief_macho_segment_max_protection(const lief_macho_segment_t* segment);
+LIEF_API uint32_t    lief_macho_segment_init_protection(const lief_macho_segment_t* segment);
+LIEF_API uint32_t    lief_macho_segment_flags(const lief_macho_segment_t* segment);
+
+/** Content of the segment. Its size is written in ``size`` if not NULL */
+LIEF_API const uint8_t*
+  lief_macho_segment_content(const lief_macho_segment_t* segment, size_t* size);
+
+/* Section
+ * ======= */
+LIEF_API const char* lief_macho_section_name(const lief_macho_section_t* section);
+LIEF_API const char* lief_macho_section_segment_name(const lief_macho_section_t* section);
+LIEF_API uint64_t    lief_macho_section_virtual_address(const lief_macho_section_t* section);
+LIEF_API uint64_t    lief_macho_section_offset(const lief_macho_section_t* section);
+LIEF_API uint64_t    lief_macho_section_size(const lief_macho_section_t* section);
+LIEF_API uint32_t    lief_macho_section_alignment(const lief_macho_section_t* section);
+LIEF_API uint32_t    lief_macho_section_type(const lief_macho_section_t* section);
+LIEF_API uint32_t    lief_macho_section_flags(const lief_macho_section_t* section);
+LIEF_API double      lief_macho_section_entropy(const lief_macho_section_t* section);
+
+/** Content of the section. Its size is written in ``size`` if not NULL */
+LIEF_API const uint8_t*
+  lief_macho_section_content(const lief_macho_section_t* section, size_t* size);
+
+/* Symbol
+ * ====== */
+LIEF_API const char* lief_macho_symbol_name(const lief_macho_symbol_t* symbol);
+LIEF_API uint8_t     lief_macho_symbol_type(const lief_macho_symbol_t* symbol);
+LIEF_API uint8_t     lief_macho_symbol_numberof_sections(const lief_macho_symbol_t* symbol);
+LIEF_API uint16_t    lief_macho_symbol_description(const lief_macho_symbol_t* symbol);
+LIEF_API uint64_t    lief_macho_symbol_value(const lief_macho_symbol_t* symbol);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
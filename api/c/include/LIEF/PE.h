@@ -17,4 +17,5 @@
 #define C_LIEF_PE_H_
 
 #include "LIEF/PE/Binary.h"
+#include "LIEF/PE/handle.h"
 #endif
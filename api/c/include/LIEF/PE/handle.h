@@ -0,0 +1,129 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_C_PE_HANDLE_H
+#define LIEF_C_PE_HANDLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "LIEF/visibility.h"
+#include "LIEF/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Handle-based API over LIEF::PE::Binary
+ *
+ * The handles are opaque references to the C++ objects: contrary to
+ * pe_parse(), nothing is converted or allocated when accessing an object.
+ * The returned pointers (handles, strings, content) are borrowed from the
+ * binary and are valid until lief_pe_binary_destroy() is called.
+ */
+typedef struct lief_pe_binary_t         lief_pe_binary_t;
+typedef struct lief_pe_section_t        lief_pe_section_t;
+typedef struct lief_pe_data_directory_t lief_pe_data_directory_t;
+typedef struct lief_pe_import_t         lief_pe_import_t;
+typedef struct lief_pe_import_entry_t   lief_pe_import_entry_t;
+
+struct Pe_Binary_t;
+
+/** Wrapper for LIEF::PE::Parser::parse. Return NULL on error */
+LIEF_API lief_pe_binary_t* lief_pe_parse(const char* file);
+
+LIEF_API void lief_pe_binary_destroy(lief_pe_binary_t* binary);
+
+/** Handle associated with a binary created by pe_parse() (owned by the latter) */
+LIEF_API lief_pe_binary_t* lief_pe_binary_from_legacy(struct Pe_Binary_t* binary);
+
+/* Binary
+ * ====== */
+LIEF_API uint32_t lief_pe_binary_type(const lief_pe_binary_t* binary);
+LIEF_API uint32_t lief_pe_binary_machine(const lief_pe_binary_t* binary);
+LIEF_API uint32_t lief_pe_binary_characteristics(const lief_pe_binary_t* binary);
+LIEF_API uint32_t lief_pe_binary_subsystem(const lief_pe_binary_t* binary);
+LIEF_API uint64_t lief_pe_binary_entrypoint(const lief_pe_binary_t* binary);
+LIEF_API uint64_t lief_pe_binary_imagebase(const lief_pe_binary_t* binary);
+
+LIEF_API size_t lief_pe_binary_sections_count(const lief_pe_binary_t* binary);
+LIEF_API size_t lief_pe_binary_data_directories_count(const lief_pe_binary_t* binary);
+LIEF_API size_t lief_pe_binary_imports_count(const lief_pe_binary_t* binary);
+
+/** Accessors by index. They return NULL if the index is out of range */
+LIEF_API const lief_pe_section_t*
+  lief_pe_binary_section_at(const lief_pe_binary_t* binary, size_t idx);
+
+LIEF_API const lief_pe_data_directory_t*
+  lief_pe_binary_data_directory_at(const lief_pe_binary_t* binary, size_t idx);
+
+LIEF_API const lief_pe_import_t*
+  lief_pe_binary_import_at(const lief_pe_binary_t* binary, size_t idx);
+
+/** Section with the given name or NULL */
+LIEF_API const lief_pe_section_t*
+  lief_pe_binary_get_section(const lief_pe_binary_t* binary, const char* name);
+
+/** Import (library) with the given name or NULL */
+LIEF_API const lief_pe_import_t*
+  lief_pe_binary_get_import(const lief_pe_binary_t* binary, const char* name);
+
+/* Section
+ * ======= */
+LIEF_API const char* lief_pe_section_name(const lief_pe_section_t* section);
+LIEF_API uint64_t    lief_pe_section_virtual_address(const lief_pe_section_t* section);
+LIEF_API uint32_t    lief_pe_section_virtual_size(const lief_pe_section_t* section);
+LIEF_API uint64_t    lief_pe_section_offset(const lief_pe_section_t* section);
+LIEF_API uint64_t    lief_pe_section_size(const lief_pe_section_t* section);
+LIEF_API uint32_t    lief_pe_section_characteristics(const lief_pe_section_t* section);
+LIEF_API double      lief_pe_section_entropy(const lief_pe_section_t* section);
+
+/** Content of the section. Its size is written in ``size`` if not NULL */
+LIEF_API const uint8_t*
+  lief_pe_section_content(const lief_pe_section_t* section, size_t* size);
+
+/* Data directory
+ * ============== */
+LIEF_API uint32_t lief_pe_data_directory_type(const lief_pe_data_directory_t* dir);
+LIEF_API uint32_t lief_pe_data_directory_rva(const lief_pe_data_directory_t* dir);
+LIEF_API uint32_t lief_pe_data_directory_size(const lief_pe_data_directory_t* dir);
+
+/* Import
+ * ====== */
+LIEF_API const char* lief_pe_import_name(const lief_pe_import_t* import);
+LIEF_API uint32_t    lief_pe_import_forwarder_chain(const lief_pe_import_t* import);
+LIEF_API uint32_t    lief_pe_import_timedatestamp(const lief_pe_import_t* import);
+LIEF_API uint32_t    lief_pe_import_address_table_rva(const lief_pe_import_t* import);
+LIEF_API uint32_t    lief_pe_import_lookup_table_rva(const lief_pe_import_t* import);
+LIEF_API size_t      lief_pe_import_entries_count(const lief_pe_import_t* import);
+
+LIEF_API const lief_pe_import_entry_t*
+  lief_pe_import_entry_at(const lief_pe_import_t* import, size_t idx);
+
+/* Import entry
+ * ============ */
+LIEF_API const char* lief_pe_import_entry_name(const lief_pe_import_entry_t* entry);
+LIEF_API bool        lief_pe_import_entry_is_ordinal(const lief_pe_import_entry_t* entry);
+LIEF_API uint16_t    lief_pe_import_entry_ordinal(const lief_pe_import_entry_t* entry);
+LIEF_API uint16_t    lief_pe_import_entry_hint(const lief_pe_import_entry_t* entry);
+LIEF_API uint64_t    lief_pe_import_entry_iat_value(const lief_pe_import_entry_t* entry);
+LIEF_API uint64_t    lief_pe_import_entry_iat_address(const lief_pe_import_entry_t* entry);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
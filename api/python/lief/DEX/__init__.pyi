@@ -318,6 +318,55 @@ class Header(lief.Object):
 
     def __str__(self) -> str: ...
 
+class Instruction:
+    class KIND(enum.Enum):
+        INSTRUCTION = 0
+
+        PACKED_SWITCH_PAYLOAD = 1
+
+        SPARSE_SWITCH_PAYLOAD = 2
+
+        FILL_ARRAY_DATA_PAYLOAD = 3
+
+    @property
+    def kind(self) -> Instruction.KIND: ...
+
+    @property
+    def pc(self) -> int: ...
+
+    @property
+    def opcode(self) -> int: ...
+
+    @property
+    def format(self) -> int: ...
+
+    @property
+    def raw(self) -> memoryview: ...
+
+    @property
+    def vA(self) -> int: ...
+
+    @property
+    def vB(self) -> int: ...
+
+    @property
+    def vC(self) -> int: ...
+
+    @property
+    def vH(self) -> int: ...
+
+    @property
+    def vB_wide(self) -> int: ...
+
+    @property
+    def args(self) -> list[int]: ...
+
+    @property
+    def size(self) -> int: ...
+
+    @property
+    def is_payload(self) -> bool: ...
+
 class MapItem(lief.Object):
     class TYPES(enum.Enum):
         @staticmethod
@@ -420,6 +469,9 @@ class Method(lief.Object):
     @property
     def bytecode(self) -> list[int]: ...
 
+    @property
+    def instructions(self) -> Iterator[Instruction]: ...
+
     @property
     def is_virtual(self) -> bool: ...
 
@@ -438,6 +490,21 @@ class Method(lief.Object):
 
     def __str__(self) -> str: ...
 
+class ParserConfig:
+    def __init__(self) -> None: ...
+
+    class_filters: list[str]
+
+    parse_fields: bool
+
+    parse_code: bool
+
+    def accept_class(self, descriptor: str) -> bool: ...
+
+    default_conf: ParserConfig = ...
+
+    def __str__(self) -> str: ...
+
 class Prototype(lief.Object):
     class it_params:
         def __getitem__(self, arg: int, /) -> Type: ...
@@ -503,13 +570,15 @@ class Type(lief.Object):
     def __str__(self) -> str: ...
 
 @overload
-def parse(filename: str) -> Optional[File]: ...
+def parse(filename: str, config: ParserConfig = ...) -> Optional[File]: ...
 
 @overload
-def parse(raw: Sequence[int], name: str = '') -> Optional[File]: ...
+def parse(raw: Sequence[int], name: str = '', config: ParserConfig = ...) -> Optional[File]: ...
 
 @overload
-def parse(obj: Union[io.IOBase | os.PathLike], name: str = '') -> Optional[File]: ...
+def parse(obj: Union[io.IOBase | os.PathLike], name: str = '', config: ParserConfig = ...) -> Optional[File]: ...
+
+def parse_all(raws: Sequence[bytes], names: Sequence[str] = [], config: ParserConfig = ...) -> list[Optional[File]]: ...
 
 @overload
 def version(file: str) -> int: ...
@@ -1,4 +1,5 @@
 from collections.abc import Iterable, Mapping, Sequence
+import collections.abc
 import enum
 import io
 import os
@@ -591,6 +592,12 @@ class Binary(lief.Binary):
     @property
     def relocations(self) -> Binary.it_relocations: ... # type: ignore
 
+    def symbols_table(self) -> dict: ...
+
+    def relocations_table(self) -> dict: ...
+
+    def sections_table(self) -> dict: ...
+
     @property
     def symbols_version(self) -> Binary.it_symbols_version: ...
 
@@ -899,6 +906,10 @@ class Builder:
 
         coredump_notes: bool
 
+        gnu_hash_maskwords: int
+
+        gnu_hash_shift2: int
+
     def build(self) -> None: ...
 
     config: Builder.config_t
@@ -1429,6 +1440,59 @@ class CorePrStatus(Note):
 
     def __str__(self) -> str: ...
 
+class CoreReader:
+    class it_const_segments:
+        def __getitem__(self, arg: int, /) -> Segment: ...
+
+        def __len__(self) -> int: ...
+
+        def __iter__(self) -> CoreReader.it_const_segments: ...
+
+        def __next__(self) -> Segment: ...
+
+    class it_const_notes:
+        def __getitem__(self, arg: int, /) -> Note: ...
+
+        def __len__(self) -> int: ...
+
+        def __iter__(self) -> CoreReader.it_const_notes: ...
+
+        def __next__(self) -> Note: ...
+
+    @staticmethod
+    def parse(filename: str) -> Optional[CoreReader]: ...
+
+    @property
+    def header(self) -> Header: ...
+
+    @property
+    def segments(self) -> CoreReader.it_const_segments: ...
+
+    @property
+    def notes(self) -> CoreReader.it_const_notes: ...
+
+    @property
+    def threads(self) -> list[CorePrStatus]: ...
+
+    @property
+    def process_info(self) -> Optional[CorePrPsInfo]: ...
+
+    @property
+    def mapped_files(self) -> Optional[CoreFile]: ...
+
+    @property
+    def auxv(self) -> Optional[CoreAuxv]: ...
+
+    @property
+    def siginfo(self) -> Optional[CoreSigInfo]: ...
+
+    @property
+    def memory_size(self) -> int: ...
+
+    def segment_from_virtual_address(self, address: int) -> Optional[Segment]: ...
+
+    def read_memory(self, address: int, size: int) -> Optional[bytes]: ...
+
 class CoreSigInfo(Note):
     signo: Optional[int]
 
@@ -5218,6 +5282,11 @@ class Symbol(lief.Symbol):
     @property
     def demangled_name(self) -> str: ...
 
+    @property
+    def gnu_hash(self) -> int: ...
+
+    def sysv_hash(self, elf_class: Header.CLASS) -> int: ...
+
     type: Symbol.TYPE
 
     binding: Symbol.BINDING
@@ -5515,6 +5584,9 @@ class X86ISA(NoteGnuProperty.Property):
 @overload
 def parse(buffer: bytes, config: ParserConfig = ...) -> Optional[Binary]: ...
 
+@overload
+def parse(buffer: collections.abc.Buffer, config: ParserConfig = ...) -> Optional[Binary]: ...
+
 @overload
 def parse(filename: str, config: ParserConfig = ...) -> Optional[Binary]: ...
 
@@ -5523,3 +5595,56 @@ def parse(raw: Sequence[int], config: ParserConfig = ...) -> Optional[Binary]: .
 
 @overload
 def parse(obj: Union[io.IOBase | os.PathLike], config: ParserConfig = ...) -> Optional[Binary]: ...
+
+@overload
+def quick_info(filename: str) -> Union[quick_info_t, lief.lief_errors]: ...
+
+@overload
+def quick_info(buffer: bytes) -> Union[quick_info_t, lief.lief_errors]: ...
+
+class quick_info_t:
+    class property_t:
+        @property
+        def type(self) -> int: ...
+
+        @property
+        def value(self) -> int: ...
+
+    @property
+    def cls(self) -> Header.CLASS: ...
+
+    @property
+    def endianness(self) -> Header.ELF_DATA: ...
+
+    @property
+    def file_type(self) -> Header.FILE_TYPE: ...
+
+    @property
+    def machine(self) -> ARCH: ...
+
+    @property
+    def entrypoint(self) -> int: ...
+
+    @property
+    def interpreter(self) -> str: ...
+
+    @property
+    def soname(self) -> str: ...
+
+    @property
+    def rpath(self) -> str: ...
+
+    @property
+    def runpath(self) -> str: ...
+
+    @property
+    def needed(self) -> list[str]: ...
+
+    @property
+    def build_id(self) -> bytes: ...
+
+    @property
+    def properties(self) -> list[quick_info_t.property_t]: ...
+
+    @property
+    def has_dynamic(self) -> bool: ...
@@ -1,4 +1,5 @@
 from collections.abc import Sequence
+import collections.abc
 import enum
 import io
 import lief.MachO
@@ -176,6 +177,12 @@ class Binary(lief.Binary):
     @property
     def relocations(self) -> Binary.it_relocations: ... # type: ignore
 
+    def symbols_table(self) -> dict: ...
+
+    def relocations_table(self) -> dict: ...
+
+    def sections_table(self) -> dict: ...
+
     @property
     def segments(self) -> Binary.it_segments: ...
 
@@ -2723,6 +2730,9 @@ class it_data_in_code_entries:
 @overload
 def parse(buffer: bytes, config: ParserConfig = ...) -> Optional[FatBinary]: ...
 
+@overload
+def parse(buffer: collections.abc.Buffer, config: ParserConfig = ...) -> Optional[FatBinary]: ...
+
 @overload
 def parse(filename: str, config: ParserConfig = ...) -> Optional[FatBinary]: ...
 
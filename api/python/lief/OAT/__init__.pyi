@@ -67,6 +67,8 @@ class Binary(lief.ELF.Binary):
     @overload
     def get_class(self, class_index: int) -> Class: ...
 
+    def get_method(self, class_name: str, method_name: str) -> Optional[Method]: ...
+
     @property
     def dex2dex_json_info(self) -> str: ...
 
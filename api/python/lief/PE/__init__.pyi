@@ -1,4 +1,5 @@
 from collections.abc import Callable, Sequence
+import collections.abc
 import enum
 import io
 import lief.PE
@@ -773,6 +774,12 @@ class Binary(lief.Binary):
     @property
     def relocations(self) -> DynamicFixupGeneric.it_relocations: ... # type: ignore
 
+    def symbols_table(self) -> dict: ...
+
+    def relocations_table(self) -> dict: ...
+
+    def sections_table(self) -> dict: ...
+
     def add_relocation(self, relocation: Relocation) -> Relocation: ...
 
     def remove_all_relocations(self) -> None: ...
@@ -804,6 +811,9 @@ class Binary(lief.Binary):
     @property
     def resources_manager(self) -> Union[ResourcesManager, lief.lief_errors]: ...
 
+    @property
+    def resources_view(self) -> Union[ResourceDirectoryView, lief.lief_errors]: ...
+
     @property
     def resources(self) -> ResourceNode: ...
 
@@ -1723,6 +1733,30 @@ class ExDllCharacteristics(Debug):
     @property
     def ex_characteristics_list(self) -> list[ExDllCharacteristics.CHARACTERISTICS]: ...
 
+class ExceptionIndex:
+    @overload
+    @staticmethod
+    def parse(filename: str, config: ParserConfig = ...) -> Optional[ExceptionIndex]: ...
+
+    @overload
+    @staticmethod
+    def parse(buffer: bytes, config: ParserConfig = ...) -> Optional[ExceptionIndex]: ...
+
+    @property
+    def binary(self) -> Binary: ...
+
+    def find_exception(self, rva: int) -> Optional[ExceptionInfo]: ...
+
+    cache_size: int
+
+    @property
+    def cache_hits(self) -> int: ...
+
+    @property
+    def cache_misses(self) -> int: ...
+
+    def __len__(self) -> int: ...
+
 class ExceptionInfo:
     class ARCH(enum.Enum):
         UNKNOWN = 0
@@ -3543,6 +3577,79 @@ class ResourceIcon(lief.Object):
 
     def __str__(self) -> str: ...
 
+class ResourceDirectoryView:
+    class data_t:
+        @property
+        def rva(self) -> int: ...
+
+        @property
+        def code_page(self) -> int: ...
+
+        @property
+        def reserved(self) -> int: ...
+
+        @property
+        def content(self) -> memoryview: ...
+
+    class Entry:
+        @property
+        def id(self) -> int: ...
+
+        @property
+        def has_name(self) -> bool: ...
+
+        @property
+        def name(self) -> str: ...
+
+        @property
+        def is_directory(self) -> bool: ...
+
+        @property
+        def is_data(self) -> bool: ...
+
+        @property
+        def directory(self) -> Union[ResourceDirectoryView, lief.lief_errors]: ...
+
+        @property
+        def data(self) -> Union[ResourceDirectoryView.data_t, lief.lief_errors]: ...
+
+    @property
+    def characteristics(self) -> int: ...
+
+    @property
+    def time_date_stamp(self) -> int: ...
+
+    @property
+    def major_version(self) -> int: ...
+
+    @property
+    def minor_version(self) -> int: ...
+
+    @property
+    def numberof_name_entries(self) -> int: ...
+
+    @property
+    def numberof_id_entries(self) -> int: ...
+
+    @property
+    def depth(self) -> int: ...
+
+    def at(self, idx: int) -> Union[ResourceDirectoryView.Entry, lief.lief_errors]: ...
+
+    @overload
+    def find(self, id: int) -> Union[ResourceDirectoryView.Entry, lief.lief_errors]: ...
+
+    @overload
+    def find(self, name: str) -> Union[ResourceDirectoryView.Entry, lief.lief_errors]: ...
+
+    @overload
+    def lookup(self, type: int, id: int, lang: int) -> Union[ResourceDirectoryView.data_t, lief.lief_errors]: ...
+
+    @overload
+    def lookup(self, type: int, id: int) -> Union[ResourceDirectoryView.data_t, lief.lief_errors]: ...
+
+    def __len__(self) -> int: ...
+
 class ResourceNode(lief.Object):
     class it_childs:
         def __getitem__(self, arg: int, /) -> ResourceNode: ...
@@ -3580,6 +3687,8 @@ class ResourceNode(lief.Object):
     @overload
     def delete_child(self, id: int) -> None: ...
 
+    def find_child(self, id: int) -> Optional[ResourceNode]: ...
+
     @property
     def depth(self) -> int: ...
 
@@ -3961,6 +4070,12 @@ class ResourcesManager(lief.Object):
 
     def get_node_type(self, type: ResourcesManager.TYPE) -> ResourceNode: ...
 
+    @overload
+    def find(self, type: ResourcesManager.TYPE, id: int, lang: int) -> Optional[ResourceData]: ...
+
+    @overload
+    def find(self, type: ResourcesManager.TYPE, id: int) -> Optional[ResourceData]: ...
+
     def print(self, max_depth: int = 0) -> str: ...
 
     def __str__(self) -> str: ...
@@ -4774,6 +4889,60 @@ class VolatileMetadata:
 
 def check_layout(binary: Binary) -> tuple[bool, str]: ...
 
+def fingerprint(binary: Binary, options: fingerprint_options_t = ...) -> fingerprint_t: ...
+
+class fingerprint_options_t:
+    def __init__(self) -> None: ...
+
+    imphash: bool
+
+    imphash_pefile: bool
+
+    rich_header_hash: bool
+
+    authentihash: list[ALGORITHMS]
+
+    section_hashes: bool
+
+    section_entropy: bool
+
+    checksum: bool
+
+class fingerprint_t:
+    class section_t:
+        @property
+        def name(self) -> str: ...
+
+        @property
+        def virtual_address(self) -> int: ...
+
+        @property
+        def md5(self) -> bytes: ...
+
+        @property
+        def sha256(self) -> bytes: ...
+
+        @property
+        def entropy(self) -> float: ...
+
+    @property
+    def imphash(self) -> str: ...
+
+    @property
+    def imphash_pefile(self) -> str: ...
+
+    @property
+    def rich_header_hash(self) -> bytes: ...
+
+    @property
+    def authentihash(self) -> dict[ALGORITHMS, bytes]: ...
+
+    @property
+    def checksum(self) -> int: ...
+
+    @property
+    def sections(self) -> list[fingerprint_t.section_t]: ...
+
 def get_imphash(binary: Binary, mode: IMPHASH_MODE = IMPHASH_MODE.DEFAULT) -> str: ...
 
 @overload
@@ -4787,6 +4956,9 @@ def oid_to_string(arg: str, /) -> str: ...
 @overload
 def parse(buffer: bytes, config: ParserConfig = ...) -> Optional[Binary]: ...
 
+@overload
+def parse(buffer: collections.abc.Buffer, config: ParserConfig = ...) -> Optional[Binary]: ...
+
 @overload
 def parse(filename: str, config: ParserConfig = ...) -> Optional[Binary]: ...
 
@@ -4903,6 +5075,37 @@ class x509(lief.Object):
 
         DECIPHER_ONLY = 8
 
+    class cache_stats_t:
+        @property
+        def certificates(self) -> int: ...
+
+        @property
+        def verifications(self) -> int: ...
+
+        @property
+        def hits(self) -> int: ...
+
+        @property
+        def misses(self) -> int: ...
+
+        @property
+        def verify_hits(self) -> int: ...
+
+        @property
+        def verify_misses(self) -> int: ...
+
+    @staticmethod
+    def enable_cache(enabled: bool = True, max_size: int = 512) -> None: ...
+
+    @staticmethod
+    def is_cache_enabled() -> bool: ...
+
+    @staticmethod
+    def clear_cache() -> None: ...
+
+    @staticmethod
+    def cache_stats() -> x509.cache_stats_t: ...
+
     @overload
     @staticmethod
     def parse(path: str) -> list[x509]: ...
@@ -1,4 +1,5 @@
 from collections.abc import Sequence
+import enum
 import io
 import os
 from typing import Iterator, Optional, Union, overload
@@ -13,6 +14,12 @@ class File(lief.Object):
     @property
     def dex_files(self) -> lief.OAT.Binary.it_dex_files: ...
 
+    @property
+    def checksums(self) -> list[int]: ...
+
+    @property
+    def verifier_deps(self) -> VerifierDeps: ...
+
     @property
     def dex2dex_json_info(self) -> str: ...
 
@@ -39,13 +46,70 @@ class Header(lief.Object):
 
     def __str__(self) -> str: ...
 
+class ParserConfig:
+    def __init__(self) -> None: ...
+
+    parse_dex_files: bool
+
+    parse_verifier_deps: bool
+
+    parse_quickening_info: bool
+
+    default_conf: ParserConfig = ...
+
+    def __str__(self) -> str: ...
+
+class VerifierDeps:
+    class KIND(enum.Enum):
+        ASSIGNABLE_TYPE = 0
+
+        UNASSIGNABLE_TYPE = 1
+
+        CLASS = 2
+
+        FIELD = 3
+
+        DIRECT_METHOD = 4
+
+        VIRTUAL_METHOD = 5
+
+        INTERFACE_METHOD = 6
+
+        UNVERIFIED_CLASS = 7
+
+    class record_t:
+        @property
+        def kind(self) -> VerifierDeps.KIND: ...
+
+        @property
+        def dex_idx(self) -> int: ...
+
+        @property
+        def values(self) -> list[int]: ...
+
+        def __str__(self) -> str: ...
+
+    @property
+    def records(self) -> Iterator[VerifierDeps.record_t]: ...
+
+    def strings(self, dex_idx: int) -> list[str]: ...
+
+    @property
+    def consumed_size(self) -> Union[int, lief.lief_errors]: ...
+
+    @property
+    def content(self) -> memoryview: ...
+
+    @property
+    def nb_dex_files(self) -> int: ...
+
 def android_version(vdex_version: int) -> lief.Android.ANDROID_VERSIONS: ...
 
 @overload
-def parse(filename: str) -> Optional[File]: ...
+def parse(filename: str, config: ParserConfig = ...) -> Optional[File]: ...
 
 @overload
-def parse(obj: Union[io.IOBase | os.PathLike], name: str = '') -> Optional[File]: ...
+def parse(obj: Union[io.IOBase | os.PathLike], name: str = '', config: ParserConfig = ...) -> Optional[File]: ...
 
 @overload
 def version(file: str) -> int: ...
@@ -1,4 +1,5 @@
 from collections.abc import Sequence
+import collections.abc
 import enum
 import io
 import lief
@@ -370,6 +371,148 @@ class PLATFORMS(enum.Enum):
 
     OSX = 5
 
+class ParseCache:
+    def __init__(self, directory: str) -> None: ...
+
+    class symbol_t:
+        @property
+        def name(self) -> str: ...
+
+        @property
+        def value(self) -> int: ...
+
+        @property
+        def size(self) -> int: ...
+
+    class relocation_t:
+        @property
+        def address(self) -> int: ...
+
+        @property
+        def size(self) -> int: ...
+
+        @property
+        def type(self) -> int: ...
+
+        @property
+        def symbol(self) -> str: ...
+
+    class import_t:
+        @property
+        def name(self) -> str: ...
+
+        @property
+        def library(self) -> str: ...
+
+        @property
+        def address(self) -> int: ...
+
+    class export_t:
+        @property
+        def name(self) -> str: ...
+
+        @property
+        def address(self) -> int: ...
+
+    class Entry:
+        @property
+        def from_cache(self) -> bool: ...
+
+        @property
+        def format(self) -> Binary.FORMATS: ...
+
+        @property
+        def architecture(self) -> Header.ARCHITECTURES: ...
+
+        @property
+        def entrypoint(self) -> int: ...
+
+        @property
+        def imagebase(self) -> int: ...
+
+        @property
+        def is_pie(self) -> bool: ...
+
+        @property
+        def nb_symbols(self) -> int: ...
+
+        @property
+        def nb_relocations(self) -> int: ...
+
+        @property
+        def nb_imports(self) -> int: ...
+
+        @property
+        def nb_exports(self) -> int: ...
+
+        @property
+        def nb_libraries(self) -> int: ...
+
+        def symbol_at(self, idx: int) -> Optional[ParseCache.symbol_t]: ...
+
+        def relocation_at(self, idx: int) -> Optional[ParseCache.relocation_t]: ...
+
+        def import_at(self, idx: int) -> Optional[ParseCache.import_t]: ...
+
+        def export_at(self, idx: int) -> Optional[ParseCache.export_t]: ...
+
+        def library_at(self, idx: int) -> Optional[str]: ...
+
+        def find_export(self, name: str) -> Union[ParseCache.export_t, lief_errors]: ...
+
+        def find_import(self, name: str) -> Union[ParseCache.import_t, lief_errors]: ...
+
+    @staticmethod
+    def default_dir() -> str: ...
+
+    @property
+    def directory(self) -> str: ...
+
+    @overload
+    def open(self, path: str) -> Optional[ParseCache.Entry]: ...
+
+    @overload
+    def open(self, path: str, config: ELF.ParserConfig) -> Optional[ParseCache.Entry]: ...
+
+    @overload
+    def open(self, path: str, config: PE.ParserConfig) -> Optional[ParseCache.Entry]: ...
+
+    @overload
+    def open(self, path: str, config: MachO.ParserConfig) -> Optional[ParseCache.Entry]: ...
+
+class PatchSet:
+    def __init__(self) -> None: ...
+
+    class conflict_t:
+        @property
+        def address(self) -> int: ...
+
+        @property
+        def size(self) -> int: ...
+
+    @overload
+    def add(self, address: int, patch_value: Sequence[int]) -> PatchSet: ...
+
+    @overload
+    def add(self, address: int, patch_value: int, size: int = 8) -> PatchSet: ...
+
+    def apply(self, binary: Binary, va_type: Binary.VA_TYPES = Binary.VA_TYPES.AUTO) -> ok_error_t: ...
+
+    def rollback(self, binary: Binary) -> ok_error_t: ...
+
+    def clear(self) -> None: ...
+
+    @property
+    def is_applied(self) -> bool: ...
+
+    @property
+    def conflicts(self) -> list[PatchSet.conflict_t]: ...
+
+    @property
+    def unresolved(self) -> list[int]: ...
+
+    def __len__(self) -> int: ...
+
 class Relocation(Object):
     address: int
 
@@ -547,9 +690,45 @@ class ok_error_t:
 class ok_t:
     def __bool__(self) -> bool: ...
 
+class FILE_FORMATS(enum.Enum):
+    UNKNOWN = 0
+
+    ELF = 1
+
+    PE = 2
+
+    COFF = 3
+
+    MACHO = 4
+
+    MACHO_FAT = 5
+
+    OAT = 6
+
+    DEX = 7
+
+    VDEX = 8
+
+    ART = 9
+
+@overload
+def identify(raw: bytes) -> FILE_FORMATS: ...
+
+@overload
+def identify(buffer: collections.abc.Buffer) -> FILE_FORMATS: ...
+
+@overload
+def identify(filepath: str) -> FILE_FORMATS: ...
+
+@overload
+def identify(obj: Union[io.IOBase | os.PathLike]) -> FILE_FORMATS: ...
+
 @overload
 def parse(raw: bytes) -> Optional[Binary]: ...
 
+@overload
+def parse(buffer: collections.abc.Buffer) -> Optional[Binary]: ...
+
 @overload
 def parse(filepath: str) -> Optional[Binary]: ...
 
@@ -5,6 +5,64 @@ from . import parameters as parameters, types as types
 import lief
 
 
+class AddressIndex:
+    class config_t:
+        def __init__(self) -> None: ...
+
+        eager: bool
+
+        cache_path: str
+
+    class function_t:
+        @property
+        def name(self) -> str: ...
+
+        @property
+        def linkage_name(self) -> str: ...
+
+        @property
+        def address(self) -> int: ...
+
+        @property
+        def size(self) -> int: ...
+
+    class line_t:
+        @property
+        def address(self) -> int: ...
+
+        @property
+        def file(self) -> str: ...
+
+        @property
+        def line(self) -> int: ...
+
+        @property
+        def column(self) -> int: ...
+
+    @staticmethod
+    def from_binary(binary: lief.Binary, config: AddressIndex.config_t = ...) -> Optional[AddressIndex]: ...
+
+    @staticmethod
+    def parse(path: str, config: AddressIndex.config_t = ...) -> Optional[AddressIndex]: ...
+
+    def find_function(self, address: int) -> Union[AddressIndex.function_t, lief.lief_errors]: ...
+
+    def line_for(self, address: int) -> Union[AddressIndex.line_t, lief.lief_errors]: ...
+
+    def save(self, path: str) -> Union[lief.ok_t, lief.lief_errors]: ...
+
+    @property
+    def nb_units(self) -> int: ...
+
+    @property
+    def nb_ranges(self) -> int: ...
+
+    @property
+    def has_aranges(self) -> bool: ...
+
+    @property
+    def from_cache(self) -> bool: ...
+
 class CompilationUnit:
     class Language:
         class LANG(enum.Enum):
@@ -21,6 +21,8 @@
 #include "LIEF/Abstract/Section.hpp"
 #include "LIEF/Abstract/Symbol.hpp"
 #include "LIEF/Abstract/Parser.hpp"
+#include "LIEF/Abstract/ParseCache.hpp"
+#include "LIEF/Abstract/PatchSet.hpp"
 #include "LIEF/Abstract/Relocation.hpp"
 #include "LIEF/Abstract/Function.hpp"
 #include "LIEF/Abstract/DebugInfo.hpp"
@@ -35,6 +37,8 @@ void init_objects(nb::module_& m) {
   CREATE(Section, m);
   CREATE(Symbol, m);
   CREATE(Parser, m);
+  CREATE(ParseCache, m);
+  CREATE(PatchSet, m);
   CREATE(Relocation, m);
   CREATE(Function, m);
   CREATE(DebugInfo, m);
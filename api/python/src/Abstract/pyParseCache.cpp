@@ -0,0 +1,188 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Abstract/init.hpp"
+#include "pyLIEF.hpp"
+#include "pyErr.hpp"
+
+#include <nanobind/stl/unique_ptr.h>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/string_view.h>
+
+#include "LIEF/Abstract/ParseCache.hpp"
+#include "LIEF/ELF/ParserConfig.hpp"
+#include "LIEF/PE/ParserConfig.hpp"
+#include "LIEF/MachO/ParserConfig.hpp"
+
+namespace LIEF::py {
+
+template<>
+void create<ParseCache>(nb::module_& m) {
+  using Entry = ParseCache::Entry;
+  using symbol_t = ParseCache::symbol_t;
+  using relocation_t = ParseCache::relocation_t;
+  using import_t = ParseCache::import_t;
+  using export_t = ParseCache::export_t;
+
+  nb::class_<ParseCache> cache(m, "ParseCache",
+    R"delim(
+    On-disk cache of the symbols, relocations, imports and exports of ELF,
+    PE and Mach-O binaries.
+
+    The entries are identified by a hash of the content of the binary and by
+    the parser configuration. When an entry exists, the binary is not parsed:
+    the cache file is mapped in memory and its records are decoded when they
+    are accessed.
+
+    .. code-block:: python
+
+      cache = lief.ParseCache(lief.ParseCache.default_dir())
+      libc = cache.open("/usr/lib/libc.so.6")
+      malloc = libc.find_export("malloc")
+      print(libc.from_cache, hex(malloc.address))
+
+    The cache only stores a summary of the binary: :func:`lief.parse` must
+    still be used to inspect or modify the other structures.
+    )delim"_doc);
+
+  nb::class_<symbol_t>(cache, "symbol_t")
+    .def_ro("name", &symbol_t::name)
+    .def_ro("value", &symbol_t::value)
+    .def_ro("size", &symbol_t::size);
+
+  nb::class_<relocation_t>(cache, "relocation_t")
+    .def_ro("address", &relocation_t::address)
+    .def_ro("size", &relocation_t::size, "Size of the relocation in bits"_doc)
+    .def_ro("type", &relocation_t::type,
+            "Format-specific type of the relocation"_doc)
+    .def_ro("symbol", &relocation_t::symbol,
+            "Name of the symbol associated with the relocation (if any)"_doc);
+
+  nb::class_<import_t>(cache, "import_t",
+    R"delim(
+    Symbol imported from a library and the address where it is bound
+    (GOT/PLT slot for ELF, RVA of the IAT entry for PE, binding for Mach-O)
+    )delim"_doc)
+    .def_ro("name", &import_t::name)
+    .def_ro("library", &import_t::library,
+            "Library from which the symbol is imported (empty for ELF)"_doc)
+    .def_ro("address", &import_t::address);
+
+  nb::class_<export_t>(cache, "export_t")
+    .def_ro("name", &export_t::name)
+    .def_ro("address", &export_t::address);
+
+  nb::class_<Entry>(cache, "Entry", "Cached summary of a binary"_doc)
+    .def_prop_ro("from_cache", &Entry::from_cache,
+        "True if the entry has been loaded from the cache (i.e. the binary has not been parsed)"_doc)
+    .def_prop_ro("format", &Entry::format)
+    .def_prop_ro("architecture", &Entry::architecture)
+    .def_prop_ro("entrypoint", &Entry::entrypoint)
+    .def_prop_ro("imagebase", &Entry::imagebase)
+    .def_prop_ro("is_pie", &Entry::is_pie)
+    .def_prop_ro("nb_symbols", &Entry::nb_symbols)
+    .def_prop_ro("nb_relocations", &Entry::nb_relocations)
+    .def_prop_ro("nb_imports", &Entry::nb_imports)
+    .def_prop_ro("nb_exports", &Entry::nb_exports)
+    .def_prop_ro("nb_libraries", &Entry::nb_libraries)
+
+    .def("symbol_at",
+        [] (const Entry& self, size_t idx) -> nb::object {
+          if (idx >= self.nb_symbols()) {
+            return nb::none();
+          }
+          return nb::cast(self.symbol_at(idx));
+        }, "idx"_a, nb::keep_alive<0, 1>())
+
+    .def("relocation_at",
+        [] (const Entry& self, size_t idx) -> nb::object {
+          if (idx >= self.nb_relocations()) {
+            return nb::none();
+          }
+          return nb::cast(self.relocation_at(idx));
+        }, "idx"_a, nb::keep_alive<0, 1>())
+
+    .def("import_at",
+        [] (const Entry& self, size_t idx) -> nb::object {
+          if (idx >= self.nb_imports()) {
+            return nb::none();
+          }
+          return nb::cast(self.import_at(idx));
+        }, "idx"_a, nb::keep_alive<0, 1>())
+
+    .def("export_at",
+        [] (const Entry& self, size_t idx) -> nb::object {
+          if (idx >= self.nb_exports()) {
+            return nb::none();
+          }
+          return nb::cast(self.export_at(idx));
+        }, "idx"_a, nb::keep_alive<0, 1>())
+
+    .def("library_at",
+        [] (const Entry& self, size_t idx) -> nb::object {
+          if (idx >= self.nb_libraries()) {
+            return nb::none();
+          }
+          return nb::cast(self.library_at(idx));
+        }, "idx"_a)
+
+    .def("find_export",
+        [] (const Entry& self, std::string_view name) {
+          return error_or(&Entry::find_export, self, name);
+        }, "Return the exported symbol with the given name"_doc, "name"_a,
+        nb::keep_alive<0, 1>())
+
+    .def("find_import",
+        [] (const Entry& self, std::string_view name) {
+          return error_or(&Entry::find_import, self, name);
+        }, "Return the imported symbol with the given name"_doc, "name"_a,
+        nb::keep_alive<0, 1>());
+
+  cache
+    .def(nb::init<std::string>(),
+        R"delim(
+        Create a cache that stores its entries in the given directory. The
+        directory is created on the first write if it does not exist.
+        )delim"_doc, "directory"_a)
+
+    .def_static("default_dir", &ParseCache::default_dir,
+        R"delim(
+        Default directory of the cache: ``LIEF_CACHE_DIR`` if this environment
+        variable is set, otherwise ``${XDG_CACHE_HOME}/lief`` or
+        ``~/.cache/lief`` (``%LOCALAPPDATA%\lief`` on Windows).
+        )delim"_doc)
+
+    .def_prop_ro("directory", &ParseCache::directory)
+
+    .def("open", nb::overload_cast<const std::string&>(&ParseCache::open, nb::const_),
+        R"delim(
+        Return the cached summary of the binary located at the given path.
+        The binary is parsed with the default configuration of its format if
+        the cache does not contain an entry for this file.
+        )delim"_doc, "path"_a)
+
+    .def("open",
+        nb::overload_cast<const std::string&, const ELF::ParserConfig&>(&ParseCache::open, nb::const_),
+        "path"_a, "config"_a)
+
+    .def("open",
+        nb::overload_cast<const std::string&, const PE::ParserConfig&>(&ParseCache::open, nb::const_),
+        "path"_a, "config"_a)
+
+    .def("open",
+        nb::overload_cast<const std::string&, const MachO::ParserConfig&>(&ParseCache::open, nb::const_),
+        "path"_a, "config"_a);
+}
+}
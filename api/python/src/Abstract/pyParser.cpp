@@ -17,6 +17,7 @@
 #include "pyLIEF.hpp"
 #include "pyIOStream.hpp"
 #include "pyutils.hpp"
+#include "typing/Buffer.hpp"
 #include "typing/InputParser.hpp"
 
 #include <nanobind/stl/unique_ptr.h>
@@ -31,6 +32,77 @@ namespace LIEF::py {
 
 template<>
 void create<Parser>(nb::module_& m) {
+# define ENTRY(X) .value(to_string(FILE_FORMATS::X), FILE_FORMATS::X)
+  nb::enum_<FILE_FORMATS>(m, "FILE_FORMATS",
+    "File formats that can be identified by :func:`lief.identify`"_doc)
+    ENTRY(UNKNOWN)
+    ENTRY(ELF)
+    ENTRY(PE)
+    ENTRY(COFF)
+    ENTRY(MACHO)
+    ENTRY(MACHO_FAT)
+    ENTRY(OAT)
+    ENTRY(DEX)
+    ENTRY(VDEX)
+    ENTRY(ART)
+  ;
+# undef ENTRY
+
+  m.def("identify",
+      [] (nb::bytes bytes) {
+        SpanStream strm(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+        return identify(strm);
+      },
+      R"delim(
+      Identify the format of the given bytes without parsing them.
+      )delim"_doc, "raw"_a);
+
+  m.def("identify",
+      [] (typing::Buffer buffer) {
+        std::unique_ptr<PyBufferStream> strm = PyBufferStream::from_python(buffer);
+        if (strm == nullptr) {
+          return FILE_FORMATS::UNKNOWN;
+        }
+        return identify(*strm);
+      },
+      R"delim(
+      Identify the format of an object that implements the buffer protocol
+      (``memoryview``, ``mmap.mmap``, ...) without copying it.
+      )delim"_doc, "buffer"_a);
+
+  m.def("identify", nb::overload_cast<const std::string&>(&identify),
+      R"delim(
+      Identify the format of the given file without parsing it.
+
+      Only the first bytes of the file are read which makes this function
+      suitable to filter a large number of files:
+
+      .. code-block:: python
+
+        for path in pathlib.Path("/usr/lib").rglob("*"):
+            if lief.identify(str(path)) == lief.FILE_FORMATS.ELF:
+                ...
+      )delim"_doc, "filepath"_a);
+
+  m.def("identify",
+      [] (typing::InputParser generic) {
+        if (auto path_str = path_to_str(generic)) {
+          return identify(*path_str);
+        }
+
+        if (auto stream = PyIOStream::from_python(generic)) {
+          return identify(*stream);
+        }
+
+        logging::log(logging::LEVEL::ERR,
+                     "LIEF identify interface does not support Python object: " +
+                     type2str(generic));
+        return FILE_FORMATS::UNKNOWN;
+      },
+      R"delim(
+      Identify the format of the given Python object (path or ``io`` object)
+      )delim"_doc, "obj"_a);
+
 
   m.def("parse",
       [] (nb::bytes bytes) {
@@ -48,6 +120,26 @@ void create<Parser>(nb::module_& m) {
       depending on the given binary format.
       )delim"_doc, "raw"_a, nb::rv_policy::take_ownership);
 
+  m.def("parse",
+      [] (typing::Buffer buffer) -> std::unique_ptr<LIEF::Binary> {
+        std::unique_ptr<PyBufferStream> strm = PyBufferStream::from_python(buffer);
+        if (strm == nullptr) {
+          return nullptr;
+        }
+        return Parser::parse(std::move(strm));
+      },
+      R"delim(
+      Parse a binary from an object that implements the buffer protocol
+      (``memoryview``, ``mmap.mmap``, NumPy arrays, ...) without copying it.
+      The returned object is either:
+
+      - :class:`lief.ELF.Binary`
+      - :class:`lief.PE.Binary`
+      - :class:`lief.MachO.Binary`
+
+      depending on the given binary format.
+      )delim"_doc, "buffer"_a, nb::rv_policy::take_ownership);
+
   m.def("parse", nb::overload_cast<const std::string&>(&Parser::parse),
       R"delim(
       Parse a binary from the given file path and return either:
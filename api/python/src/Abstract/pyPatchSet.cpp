@@ -0,0 +1,104 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Abstract/init.hpp"
+#include "pyLIEF.hpp"
+#include "pyErr.hpp"
+
+#include <nanobind/stl/vector.h>
+
+#include "LIEF/Abstract/PatchSet.hpp"
+
+namespace LIEF::py {
+
+template<>
+void create<PatchSet>(nb::module_& m) {
+  using conflict_t = PatchSet::conflict_t;
+
+  nb::class_<PatchSet> patches(m, "PatchSet",
+    R"delim(
+    Batch of patches applied on an ELF, PE or Mach-O binary in one go.
+
+    The patches are only recorded by :meth:`~.add`. When they are applied,
+    they are sorted by address so that the patches located in the same
+    segment (section for PE) share the same lookup.
+
+    .. code-block:: python
+
+      patches = lief.PatchSet()
+      for callsite in callsites:
+          patches.add(callsite, [0x90] * 5)
+
+      if not patches.apply(binary):
+          print(patches.conflicts, patches.unresolved)
+
+    :meth:`~.apply` is atomic: the binary is only modified if **all** the
+    patches can be applied. The bytes overwritten by a successful
+    :meth:`~.apply` can be restored with :meth:`~.rollback`.
+    )delim"_doc);
+
+  nb::class_<conflict_t>(patches, "conflict_t",
+    "Range of addresses written by two patches with different bytes"_doc)
+    .def_ro("address", &conflict_t::address)
+    .def_ro("size", &conflict_t::size);
+
+  patches
+    .def(nb::init<>())
+
+    .def("add",
+        nb::overload_cast<uint64_t, const std::vector<uint8_t>&>(&PatchSet::add),
+        R"delim(
+        Record the bytes to write at the given address. The binary is not
+        modified until :meth:`~.apply` is called.
+        )delim"_doc, "address"_a, "patch_value"_a, nb::rv_policy::reference_internal)
+
+    .def("add",
+        nb::overload_cast<uint64_t, uint64_t, size_t>(&PatchSet::add),
+        R"delim(
+        Record an integer of ``size`` bytes (1, 2, 4 or 8) to write at the
+        given address.
+        )delim"_doc, "address"_a, "patch_value"_a, "size"_a = 8,
+        nb::rv_policy::reference_internal)
+
+    .def("apply", &PatchSet::apply,
+        R"delim(
+        Apply the recorded patches on the given binary.
+
+        Nothing is written if two patches write different bytes at the same
+        address (see :attr:`~.conflicts`) or if a patch is not fully located
+        in a segment (section for PE) of the binary (see :attr:`~.unresolved`).
+        )delim"_doc, "binary"_a, "va_type"_a = Binary::VA_TYPES::AUTO)
+
+    .def("rollback", &PatchSet::rollback,
+        R"delim(
+        Restore the bytes overwritten by the last successful :meth:`~.apply`
+        on the given binary.
+        )delim"_doc, "binary"_a)
+
+    .def("clear", &PatchSet::clear,
+        "Remove the recorded patches and the saved bytes"_doc)
+
+    .def_prop_ro("is_applied", &PatchSet::is_applied,
+        "True if the patches are applied (i.e. :meth:`~.rollback` can be called)"_doc)
+
+    .def_prop_ro("conflicts", &PatchSet::conflicts,
+        "Conflicts found by the last :meth:`~.apply`"_doc)
+
+    .def_prop_ro("unresolved", &PatchSet::unresolved,
+        "Addresses of the (merged) patches that can't be resolved by the last :meth:`~.apply`"_doc)
+
+    .def("__len__", &PatchSet::size);
+}
+}
@@ -78,7 +78,12 @@ void create<Section>(nb::module_& m) {
     .def_prop_rw("content",
         nb::overload_cast<>(&Section::content, nb::const_),
         nb::overload_cast<const std::vector<uint8_t>&>(&Section::content),
-        "Section's content"_doc)
+        R"delim(
+        Section's content as a read-only ``memoryview`` (no copy).
+
+        The view keeps the section (and hence its binary) alive but it must
+        not be used after a modification of the binary's layout.
+        )delim"_doc, nb::for_getter(nb::keep_alive<0, 1>()))
 
     .def_prop_ro("entropy",
         &Section::entropy,
@@ -17,6 +17,7 @@
 #include "DEX/init.hpp"
 
 #include "LIEF/DEX/Parser.hpp"
+#include "LIEF/DEX/ParserConfig.hpp"
 #include "LIEF/DEX/File.hpp"
 #include "LIEF/DEX/Header.hpp"
 #include "LIEF/DEX/Class.hpp"
@@ -27,16 +28,19 @@
 #include "LIEF/DEX/MapList.hpp"
 #include "LIEF/DEX/MapItem.hpp"
 #include "LIEF/DEX/CodeInfo.hpp"
+#include "LIEF/DEX/instructions.hpp"
 
 #define CREATE(X,Y) create<X>(Y)
 
 namespace LIEF::DEX::py {
 void init_objects(nb::module_& m) {
+  CREATE(ParserConfig, m);
   CREATE(Parser, m);
   CREATE(File, m);
   CREATE(Header, m);
   CREATE(Class, m);
   CREATE(Method, m);
+  CREATE(Instruction, m);
   CREATE(Field, m);
   CREATE(Prototype, m);
   CREATE(Type, m);
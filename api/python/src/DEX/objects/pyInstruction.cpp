@@ -0,0 +1,80 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LIEF/DEX/instructions.hpp"
+
+#include "DEX/pyDEX.hpp"
+#include "nanobind/extra/stl/lief_span.h"
+
+#include <vector>
+#include <nanobind/stl/vector.h>
+
+namespace LIEF::DEX::py {
+
+template<>
+void create<Instruction>(nb::module_& m) {
+  nb::class_<Instruction> inst(m, "Instruction",
+    R"delim(
+    Dalvik instruction (or payload) decoded by :attr:`lief.DEX.Method.instructions`.
+
+    The operands follow the naming of the Dalvik formats (e.g. ``B|A|op CCCC``
+    for ``22t``). The signed operands (literals and branch offsets) are
+    sign-extended.
+    )delim"_doc);
+
+  nb::enum_<Instruction::KIND>(inst, "KIND")
+    .value("INSTRUCTION", Instruction::KIND::INSTRUCTION)
+    .value("PACKED_SWITCH_PAYLOAD", Instruction::KIND::PACKED_SWITCH_PAYLOAD)
+    .value("SPARSE_SWITCH_PAYLOAD", Instruction::KIND::SPARSE_SWITCH_PAYLOAD)
+    .value("FILL_ARRAY_DATA_PAYLOAD", Instruction::KIND::FILL_ARRAY_DATA_PAYLOAD);
+
+  inst
+    .def_ro("kind", &Instruction::kind, "Kind of the instruction"_doc)
+    .def_ro("pc", &Instruction::pc,
+        "Offset of the instruction in 16-bit code units (``dex_pc``)"_doc)
+    .def_prop_ro("opcode",
+        [] (const Instruction& self) {
+          return static_cast<uint32_t>(self.opcode);
+        }, "Dalvik opcode"_doc)
+    .def_prop_ro("format",
+        [] (const Instruction& self) {
+          return static_cast<uint32_t>(self.format);
+        }, "Format of the instruction (``INST_FORMATS``)"_doc)
+    .def_prop_ro("raw",
+        [] (const Instruction& self) {
+          return self.raw;
+        }, "Raw encoding of the instruction (including the data of the payloads)"_doc)
+    .def_ro("vA", &Instruction::vA,
+        "First operand (register, literal, branch offset or argument count)"_doc)
+    .def_ro("vB", &Instruction::vB,
+        "Second operand (register, literal, index or branch offset)"_doc)
+    .def_ro("vC", &Instruction::vC,
+        "Third operand (register, literal, index or branch offset)"_doc)
+    .def_ro("vH", &Instruction::vH,
+        "Prototype index of the ``45cc`` and ``4rcc`` formats"_doc)
+    .def_ro("vB_wide", &Instruction::vB_wide,
+        "Wide literal of the ``51l``, ``31i`` and ``21h`` formats"_doc)
+    .def_prop_ro("args",
+        [] (const Instruction& self) {
+          const size_t count = self.vA < 5 ? self.vA : 5;
+          return std::vector<uint8_t>(self.args, self.args + count);
+        }, "Registers of the ``35c``, ``35ms``, ``35mi`` and ``45cc`` formats"_doc)
+    .def_prop_ro("size", &Instruction::size,
+        "Size of the instruction in bytes"_doc)
+    .def_prop_ro("is_payload", &Instruction::is_payload,
+        "True if the instruction is a switch or an array payload"_doc);
+}
+
+}
@@ -22,6 +22,7 @@
 #include <sstream>
 #include <nanobind/stl/string.h>
 #include <nanobind/stl/vector.h>
+#include <nanobind/make_iterator.h>
 
 namespace LIEF::DEX::py {
 
@@ -44,8 +45,23 @@ void create<Method>(nb::module_& m) {
     .def_prop_ro("code_offset", nb::overload_cast<>(&Method::code_offset, nb::const_),
         "Offset to the Dalvik Bytecode"_doc)
 
-    .def_prop_ro("bytecode", nb::overload_cast<>(&Method::bytecode, nb::const_),
-        "Dalvik Bytecode as a list of bytes"_doc)
+    .def_prop_ro("bytecode",
+        [] (const Method& self) {
+          Method::bytecode_t bytecode = self.bytecode();
+          return std::vector<uint8_t>(bytecode.begin(), bytecode.end());
+        }, "Dalvik Bytecode as a list of bytes"_doc)
+
+    .def_prop_ro("instructions",
+        [] (const Method& self) {
+          it_instructions insts = self.instructions();
+          return nb::make_iterator<nb::rv_policy::copy>(
+              nb::type<Method>(), "it_instructions", insts.begin(), insts.end());
+        }, nb::keep_alive<0, 1>(),
+        R"delim(
+        Iterator over the decoded :class:`~lief.DEX.Instruction` of the
+        bytecode. The switch and array payloads are exposed as
+        pseudo-instructions (:attr:`lief.DEX.Instruction.is_payload`).
+        )delim"_doc)
 
     .def_prop_ro("is_virtual", &Method::is_virtual,
         "True if the method is a virtual (not **private**, **static**, **final**, **constructor**)"_doc)
@@ -37,33 +37,54 @@ void create<Parser>(nb::module_& m) {
   using namespace LIEF::py;
 
   m.def("parse",
-    static_cast<std::unique_ptr<File> (*) (const std::string&)>(&Parser::parse),
+    static_cast<std::unique_ptr<File> (*) (const std::string&, const ParserConfig&)>(&Parser::parse),
     "Parse the given filename and return a " RST_CLASS_REF(lief.DEX.File) " object"_doc,
-    "filename"_a,
+    "filename"_a, "config"_a = ParserConfig::default_conf(),
     nb::rv_policy::take_ownership);
 
   m.def("parse",
-    static_cast<std::unique_ptr<File>(*)(std::vector<uint8_t>, const std::string&)>(&Parser::parse),
+    static_cast<std::unique_ptr<File>(*)(std::vector<uint8_t>, const std::string&, const ParserConfig&)>(&Parser::parse),
     "Parse the given raw data and return a " RST_CLASS_REF(lief.DEX.File) " object"_doc,
-    "raw"_a, "name"_a = "",
+    "raw"_a, "name"_a = "", "config"_a = ParserConfig::default_conf(),
     nb::rv_policy::take_ownership);
 
   m.def("parse",
-    [] (typing::InputParser obj, const std::string& name) -> std::unique_ptr<File> {
+    [] (typing::InputParser obj, const std::string& name, const ParserConfig& config) -> std::unique_ptr<File> {
       if (auto path_str = path_to_str(obj)) {
-        return DEX::Parser::parse(std::move(*path_str));
+        return DEX::Parser::parse(std::move(*path_str), config);
       }
 
       if (auto stream = PyIOStream::from_python(obj)) {
         auto ptr = std::make_unique<PyIOStream>(std::move(*stream));
-        return DEX::Parser::parse(stream->content(), name);
+        return DEX::Parser::parse(stream->content(), name, config);
       }
 
       logging::log(logging::LEVEL::ERR,
                    "LIEF parser interface does not support Python object: " +
                    type2str(obj));
       return nullptr;
-    }, "obj"_a, "name"_a = "",
+    }, "obj"_a, "name"_a = "", "config"_a = ParserConfig::default_conf(),
     nb::rv_policy::take_ownership);
+
+  m.def("parse_all",
+    [] (const std::vector<nb::bytes>& raws, const std::vector<std::string>& names,
+        const ParserConfig& config) {
+      std::vector<span<const uint8_t>> dex_files;
+      dex_files.reserve(raws.size());
+      for (const nb::bytes& raw : raws) {
+        dex_files.emplace_back(reinterpret_cast<const uint8_t*>(raw.data()), raw.size());
+      }
+      return Parser::parse_all(dex_files, names, config);
+    },
+    R"delim(
+    Parse concurrently the given DEX files (e.g. the ``classes.dex``,
+    ``classes2.dex``, ... of an APK) and return a list of
+    :class:`~lief.DEX.File` in the same order. An entry is None if the
+    associated buffer is not a valid DEX file.
+
+    If ``names`` is not provided, the files are named ``classes.dex``,
+    ``classes2.dex``, ...
+    )delim"_doc, "raws"_a, "names"_a = std::vector<std::string>{},
+    "config"_a = ParserConfig::default_conf());
 }
 }
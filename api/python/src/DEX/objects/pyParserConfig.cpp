@@ -0,0 +1,81 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <sstream>
+#include <string>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/vector.h>
+
+#include "LIEF/DEX/ParserConfig.hpp"
+
+#include "DEX/pyDEX.hpp"
+
+namespace LIEF::DEX::py {
+
+template<>
+void create<ParserConfig>(nb::module_& m) {
+
+  nb::class_<ParserConfig>(m, "ParserConfig",
+      R"delim(
+      This class is used to tweak the DEX Parser (:func:`lief.DEX.parse`).
+
+      The ID tables (strings, types, prototypes, fields and methods) are always
+      parsed such as the indexes remain consistent. These options only control
+      which ``class_data_item`` are decoded:
+
+      .. code-block:: python
+
+        config = lief.DEX.ParserConfig()
+        config.class_filters = ["Lcom/vendor/sdk/"]
+        config.parse_fields = False
+
+        dex = lief.DEX.parse("classes.dex", config=config)
+      )delim"_doc)
+
+    .def(nb::init<>())
+    .def_rw("class_filters", &ParserConfig::class_filters,
+      R"doc(
+      Only decode the content (fields, methods, code) of the classes whose
+      descriptor starts with one of these prefixes (e.g. ``Lcom/vendor/sdk/``).
+      The Java notation is also accepted (e.g. ``com.vendor.sdk.``).
+
+      A filter is in the descriptor notation if it starts with ``[``, or if it
+      starts with ``L`` and contains a ``/`` or ends with ``;``
+      (e.g. ``LMain;``). Otherwise it is a Java name: ``LegacyApp`` matches
+      ``LLegacyApp...``.
+
+      The other classes are still created but their fields and methods are
+      only resolved from the ID tables (no access flags, no code).
+      If empty, all the classes are decoded.
+      )doc"_doc)
+
+    .def_rw("parse_fields", &ParserConfig::parse_fields,
+            "Decode the fields (access flags) of the classes"_doc)
+
+    .def_rw("parse_code", &ParserConfig::parse_code,
+            "Decode the methods' code items (:class:`~lief.DEX.CodeInfo` and bytecode)"_doc)
+
+    .def("accept_class", &ParserConfig::accept_class,
+         "Check if the content of the class with the given descriptor should be decoded"_doc,
+         "descriptor"_a)
+
+    .def_prop_ro_static("default_conf",
+      [] (const nb::object& /* self */) { return ParserConfig::default_conf(); },
+      "Default configuration"_doc)
+
+    LIEF_DEFAULT_STR(ParserConfig);
+}
+
+}
@@ -0,0 +1,112 @@
+#include "LIEF/Abstract/Binary.hpp"
+#include "LIEF/DWARF/AddressIndex.hpp"
+#include "DWARF/pyDwarf.hpp"
+#include "pyErr.hpp"
+
+#include <nanobind/stl/unique_ptr.h>
+#include <nanobind/stl/string.h>
+
+namespace LIEF::dwarf::py {
+template<>
+void create<dw::AddressIndex>(nb::module_& m) {
+  using namespace LIEF::py;
+  using config_t = dw::AddressIndex::config_t;
+  using function_t = dw::AddressIndex::function_t;
+  using line_t = dw::AddressIndex::line_t;
+
+  nb::class_<dw::AddressIndex> index(m, "AddressIndex",
+    R"doc(
+    Address-indexed view over the DWARF information of a binary.
+
+    Contrary to :class:`~.DebugInfo`, this index does not build the tree of
+    DIEs: it resolves an address into its function and its source location.
+    The subprograms and the line program of a compilation unit are decoded
+    on the first lookup that hits the unit.
+
+    .. code-block:: python
+
+      index = lief.dwarf.AddressIndex.parse("libfoo.so")
+      func = index.find_function(0x1139)
+      line = index.line_for(0x1139)
+      print(func.name, line.file, line.line)
+
+    This index works with the regular (non-extended) version of LIEF.
+    )doc"_doc
+  );
+
+  nb::class_<config_t>(index, "config_t",
+    "Configuration of the index"_doc)
+    .def(nb::init<>())
+    .def_rw("eager", &config_t::eager,
+      R"doc(
+      Decode the subprograms of all the compilation units when creating the
+      index (using several threads) instead of decoding them lazily.
+      )doc"_doc)
+    .def_rw("cache_path", &config_t::cache_path,
+      R"doc(
+      If not empty, path of an on-disk cache for the index. The index is
+      loaded from this file if it matches the binary, otherwise it is built
+      and saved in this file.
+
+      The binary is identified by its build-id (ELF), ``LC_UUID`` (Mach-O)
+      or PDB GUID (PE) along with the sizes of the DWARF sections. If the
+      binary does not embed such an identifier, the SHA-256 of the DWARF
+      sections is used instead.
+      )doc"_doc);
+
+  nb::class_<function_t>(index, "function_t",
+    "Function that contains a given address"_doc)
+    .def_ro("name", &function_t::name)
+    .def_ro("linkage_name", &function_t::linkage_name)
+    .def_ro("address", &function_t::address,
+      "Start address of the range of the function that contains the address"_doc)
+    .def_ro("size", &function_t::size, "Size of this range"_doc);
+
+  nb::class_<line_t>(index, "line_t",
+    "Source location associated with a given address"_doc)
+    .def_ro("address", &line_t::address,
+      "Address of the line table entry that covers the address"_doc)
+    .def_ro("file", &line_t::file)
+    .def_ro("line", &line_t::line)
+    .def_ro("column", &line_t::column);
+
+  index
+    .def_static("from_binary",
+        nb::overload_cast<const LIEF::Binary&, const config_t&>(&dw::AddressIndex::from_binary),
+        R"doc(
+        Create an index over the DWARF sections of the given binary.
+        The binary must outlive the index.
+        )doc"_doc, "binary"_a, "config"_a = config_t(), nb::keep_alive<0, 1>())
+
+    .def_static("parse",
+        nb::overload_cast<const std::string&, const config_t&>(&dw::AddressIndex::parse),
+        "Parse the binary located at the given path and index its DWARF information"_doc,
+        "path"_a, "config"_a = config_t())
+
+    .def("find_function",
+        [] (const dw::AddressIndex& self, uint64_t address) {
+          return error_or(&dw::AddressIndex::find_function, self, address);
+        }, "Return the function that contains the given address"_doc, "address"_a)
+
+    .def("line_for",
+        [] (const dw::AddressIndex& self, uint64_t address) {
+          return error_or(&dw::AddressIndex::line_for, self, address);
+        }, "Return the source location of the given address"_doc, "address"_a)
+
+    .def("save", &dw::AddressIndex::save,
+        "Serialize the index in the given file"_doc, "path"_a)
+
+    .def_prop_ro("nb_units", &dw::AddressIndex::nb_units,
+        "Number of compilation units"_doc)
+
+    .def_prop_ro("nb_ranges", &dw::AddressIndex::nb_ranges,
+        "Number of address ranges in the table of the compilation units"_doc)
+
+    .def_prop_ro("has_aranges", &dw::AddressIndex::has_aranges,
+        "True if the ranges of the units come from ``.debug_aranges``"_doc)
+
+    .def_prop_ro("from_cache", &dw::AddressIndex::from_cache,
+        "True if the index has been loaded from the on-disk cache"_doc);
+}
+
+}
@@ -21,6 +21,7 @@
 #include <nanobind/stl/vector.h>
 
 #include "LIEF/ELF/Builder.hpp"
+#include "LIEF/ELF/CoreReader.hpp"
 #include "LIEF/ELF/DynamicEntry.hpp"
 #include "LIEF/ELF/DynamicEntryArray.hpp"
 #include "LIEF/ELF/DynamicEntryFlags.hpp"
@@ -31,6 +32,7 @@
 #include "LIEF/ELF/GnuHash.hpp"
 #include "LIEF/ELF/Header.hpp"
 #include "LIEF/ELF/Parser.hpp"
+#include "LIEF/ELF/quick_info.hpp"
 #include "LIEF/ELF/Relocation.hpp"
 #include "LIEF/ELF/Section.hpp"
 #include "LIEF/ELF/Segment.hpp"
@@ -95,8 +97,10 @@ void init_objects(nb::module_& m) {
   CREATE(GnuHash, m);
   CREATE(SysvHash, m);
   CREATE(Builder, m);
+  CREATE(quick_info_t, m);
 
   init_notes(m);
+  CREATE(CoreReader, m);
 }
 
 inline void init_utils(nb::module_&) {
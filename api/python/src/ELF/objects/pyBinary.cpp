@@ -45,12 +45,125 @@
 #include "LIEF/ELF/SysvHash.hpp"
 
 #include "pyIterator.hpp"
+#include "pyColumns.hpp"
 #include "pyErr.hpp"
 #include "pySafeString.hpp"
 
 namespace LIEF::ELF::py {
 using namespace LIEF::py;
 
+static nb::dict symbols_table(const Binary& bin) {
+  const size_t nb_symbols = bin.dynamic_symbols().size() +
+                            bin.symtab_symbols().size();
+  string_column_t name(nb_symbols);
+  column_t<uint64_t> value(nb_symbols);
+  column_t<uint64_t> size(nb_symbols);
+  column_t<uint8_t> type(nb_symbols);
+  column_t<uint8_t> binding(nb_symbols);
+  column_t<uint8_t> visibility(nb_symbols);
+  column_t<uint16_t> shndx(nb_symbols);
+  column_t<uint8_t> is_dynamic(nb_symbols);
+
+  auto add = [&] (const Symbol& sym, bool dynamic) {
+    name.push_back(sym.name());
+    value.push_back(sym.value());
+    size.push_back(sym.size());
+    type.push_back((uint8_t)sym.type());
+    binding.push_back((uint8_t)sym.binding());
+    visibility.push_back((uint8_t)sym.visibility());
+    shndx.push_back(sym.shndx());
+    is_dynamic.push_back(dynamic);
+  };
+
+  for (const Symbol& sym : bin.dynamic_symbols()) {
+    add(sym, /*dynamic=*/true);
+  }
+
+  for (const Symbol& sym : bin.symtab_symbols()) {
+    add(sym, /*dynamic=*/false);
+  }
+
+  nb::dict table;
+  add_column(table, "name", std::move(name));
+  add_column(table, "value", std::move(value));
+  add_column(table, "size", std::move(size));
+  add_column(table, "type", std::move(type));
+  add_column(table, "binding", std::move(binding));
+  add_column(table, "visibility", std::move(visibility));
+  add_column(table, "shndx", std::move(shndx));
+  add_column(table, "is_dynamic", std::move(is_dynamic));
+  return table;
+}
+
+static nb::dict relocations_table(const Binary& bin) {
+  const size_t nb_relocations = bin.relocations().size();
+  column_t<uint64_t> address(nb_relocations);
+  column_t<uint32_t> type(nb_relocations);
+  column_t<int64_t> addend(nb_relocations);
+  column_t<uint32_t> info(nb_relocations);
+  column_t<uint8_t> purpose(nb_relocations);
+  string_column_t symbol(nb_relocations);
+
+  for (const Relocation& reloc : bin.relocations()) {
+    address.push_back(reloc.address());
+    type.push_back(uint64_t(reloc.type()) & Relocation::R_MASK);
+    addend.push_back(reloc.addend());
+    info.push_back(reloc.info());
+    purpose.push_back((uint8_t)reloc.purpose());
+    const Symbol* sym = reloc.symbol();
+    symbol.push_back(sym != nullptr ? sym->name() : "");
+  }
+
+  nb::dict table;
+  add_column(table, "address", std::move(address));
+  add_column(table, "type", std::move(type));
+  add_column(table, "addend", std::move(addend));
+  add_column(table, "info", std::move(info));
+  add_column(table, "purpose", std::move(purpose));
+  add_column(table, "symbol", std::move(symbol));
+  return table;
+}
+
+static nb::dict sections_table(const Binary& bin) {
+  const size_t nb_sections = bin.sections().size();
+  string_column_t name(nb_sections);
+  column_t<uint32_t> type(nb_sections);
+  column_t<uint64_t> flags(nb_sections);
+  column_t<uint64_t> virtual_address(nb_sections);
+  column_t<uint64_t> offset(nb_sections);
+  column_t<uint64_t> size(nb_sections);
+  column_t<uint64_t> alignment(nb_sections);
+  column_t<uint64_t> entry_size(nb_sections);
+  column_t<uint32_t> link(nb_sections);
+  column_t<uint64_t> information(nb_sections);
+
+  for (const Section& section : bin.sections()) {
+    name.push_back(section.name());
+    type.push_back(Section::to_value(section.type()));
+    flags.push_back(section.flags());
+    virtual_address.push_back(section.virtual_address());
+    offset.push_back(section.file_offset());
+    size.push_back(section.size());
+    alignment.push_back(section.alignment());
+    entry_size.push_back(section.entry_size());
+    link.push_back(section.link());
+    information.push_back(section.information());
+  }
+
+  nb::dict table;
+  add_column(table, "name", std::move(name));
+  add_column(table, "type", std::move(type));
+  add_column(table, "flags", std::move(flags));
+  add_column(table, "virtual_address", std::move(virtual_address));
+  add_column(table, "offset", std::move(offset));
+  add_column(table, "size", std::move(size));
+  add_column(table, "alignment", std::move(alignment));
+  add_column(table, "entry_size", std::move(entry_size));
+  add_column(table, "link", std::move(link));
+  add_column(table, "information", std::move(information));
+  return table;
+}
+
 template<>
 void create<Binary>(nb::module_& m) {
   nb::class_<Binary, LIEF::Binary> bin(m, "Binary",
@@ -215,6 +328,35 @@ void create<Binary>(nb::module_& m) {
         "Return an iterator over **all** " RST_CLASS_REF(lief.ELF.Relocation) ""_doc,
         nb::keep_alive<0, 1>())
 
+    .def("symbols_table", &symbols_table,
+        R"delim(
+        Return the (static and dynamic) symbols as a dictionary of NumPy arrays
+        (one array per attribute) which is filled without creating a Python
+        object per symbol:
+
+        - ``name_offsets``/``name_data``: names in Arrow's string layout
+        - ``value``, ``size``, ``type``, ``binding``, ``visibility``, ``shndx``
+        - ``is_dynamic``: 1 if the symbol comes from ``.dynsym``
+
+        ``type``, ``binding`` and ``visibility`` are the raw ``STT_``,
+        ``STB_`` and ``STV_`` values. This function requires NumPy.
+        )delim"_doc)
+
+    .def("relocations_table", &relocations_table,
+        R"delim(
+        Same as :meth:`~.symbols_table` for **all** the relocations with the
+        columns: ``address``, ``type`` (raw ``R_xxx`` value), ``addend``,
+        ``info``, ``purpose`` and ``symbol_offsets``/``symbol_data``.
+        )delim"_doc)
+
+    .def("sections_table", &sections_table,
+        R"delim(
+        Same as :meth:`~.symbols_table` for the sections with the columns:
+        ``name_offsets``/``name_data``, ``type`` (raw ``SHT_`` value),
+        ``flags``, ``virtual_address``, ``offset``, ``size``, ``alignment``,
+        ``entry_size``, ``link`` and ``information``.
+        )delim"_doc)
+
     .def_prop_ro("symbols_version",
         nb::overload_cast<>(&Binary::symbols_version),
         "Return an iterator " RST_CLASS_REF(lief.ELF.SymbolVersion) ""_doc,
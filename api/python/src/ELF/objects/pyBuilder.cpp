@@ -54,7 +54,13 @@ void create<Builder>(nb::module_& m) {
     .def_rw("sym_verneed",     &Builder::config_t::sym_verneed, "Rebuild :attr:`~lief.ELF.DynamicEntry.TAG.VERNEED`"_doc)
     .def_rw("sym_versym",      &Builder::config_t::sym_versym, "Rebuild :attr:`~lief.ELF.DynamicEntry.TAG.VERSYM`"_doc)
     .def_rw("symtab",          &Builder::config_t::symtab, "Rebuild :attr:`~lief.ELF.DynamicEntry.TAG.SYMTAB`"_doc)
-    .def_rw("coredump_notes",  &Builder::config_t::coredump_notes, "Rebuild the Coredump notes"_doc);
+    .def_rw("coredump_notes",  &Builder::config_t::coredump_notes, "Rebuild the Coredump notes"_doc)
+    .def_rw("gnu_hash_maskwords", &Builder::config_t::gnu_hash_maskwords,
+            "Number of bloom filter words of the rebuilt :attr:`~lief.ELF.DynamicEntry.TAG.GNU_HASH` "
+            "(rounded up to a power of 2). 0 keeps the original value"_doc)
+    .def_rw("gnu_hash_shift2", &Builder::config_t::gnu_hash_shift2,
+            "Bloom filter shift of the rebuilt :attr:`~lief.ELF.DynamicEntry.TAG.GNU_HASH`. "
+            "It must be lower than 32. 0 keeps the original value"_doc);
 
   builder
     .def(nb::init<Binary&>(),
@@ -0,0 +1,107 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ELF/pyELF.hpp"
+
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/vector.h>
+#include <nanobind/stl/unique_ptr.h>
+
+#include "LIEF/ELF/CoreReader.hpp"
+#include "LIEF/ELF/Segment.hpp"
+#include "LIEF/ELF/Note.hpp"
+#include "LIEF/ELF/NoteDetails/core/CorePrStatus.hpp"
+#include "LIEF/ELF/NoteDetails/core/CorePrPsInfo.hpp"
+#include "LIEF/ELF/NoteDetails/core/CoreFile.hpp"
+#include "LIEF/ELF/NoteDetails/core/CoreAuxv.hpp"
+#include "LIEF/ELF/NoteDetails/core/CoreSigInfo.hpp"
+
+#include "pyIterator.hpp"
+
+namespace LIEF::ELF::py {
+
+template<>
+void create<CoreReader>(nb::module_& m) {
+  nb::class_<CoreReader> reader(m, "CoreReader",
+    R"delim(
+    Streaming reader for (large) ELF core files.
+
+    Contrary to :func:`lief.ELF.parse`, only the ELF header, the program headers
+    and the notes are parsed. The memory image of the process is read on
+    demand with :meth:`~lief.ELF.CoreReader.read_memory`.
+    )delim"_doc);
+
+  init_ref_iterator<CoreReader::it_const_segments>(reader, "it_const_segments");
+  init_ref_iterator<CoreReader::it_const_notes>(reader, "it_const_notes");
+
+  reader
+    .def_static("parse", nb::overload_cast<const std::string&>(&CoreReader::parse),
+        "Open the core file located at the given path"_doc,
+        "filename"_a)
+
+    .def_prop_ro("header", &CoreReader::header,
+        "ELF header of the core file"_doc,
+        nb::rv_policy::reference_internal)
+
+    .def_prop_ro("segments", &CoreReader::segments,
+        "Program headers of the core file (without content)"_doc,
+        nb::keep_alive<0, 1>())
+
+    .def_prop_ro("notes", &CoreReader::notes,
+        "Notes from all the ``PT_NOTE`` segments"_doc,
+        nb::keep_alive<0, 1>())
+
+    .def_prop_ro("threads", &CoreReader::threads,
+        "Status of the threads (``NT_PRSTATUS``)"_doc,
+        nb::rv_policy::reference_internal)
+
+    .def_prop_ro("process_info", &CoreReader::process_info,
+        "Process information (``NT_PRPSINFO``) or None if not present"_doc,
+        nb::rv_policy::reference_internal)
+
+    .def_prop_ro("mapped_files", &CoreReader::mapped_files,
+        "Files mapped in the process (``NT_FILE``) or None if not present"_doc,
+        nb::rv_policy::reference_internal)
+
+    .def_prop_ro("auxv", &CoreReader::auxv,
+        "Auxiliary vector (``NT_AUXV``) or None if not present"_doc,
+        nb::rv_policy::reference_internal)
+
+    .def_prop_ro("siginfo", &CoreReader::siginfo,
+        "Signal information (``NT_SIGINFO``) or None if not present"_doc,
+        nb::rv_policy::reference_internal)
+
+    .def_prop_ro("memory_size", &CoreReader::memory_size,
+        "Total size of the memory described by the ``PT_LOAD`` segments"_doc)
+
+    .def("segment_from_virtual_address", &CoreReader::segment_from_virtual_address,
+        "Return the ``PT_LOAD`` segment that contains the given address or None"_doc,
+        "address"_a, nb::rv_policy::reference_internal)
+
+    .def("read_memory",
+        [] (const CoreReader& self, uint64_t address, uint64_t size) -> nb::object {
+          auto content = self.read_memory(address, size);
+          if (!content) {
+            return nb::none();
+          }
+          return nb::bytes(reinterpret_cast<const char*>(content->data()),
+                           content->size());
+        },
+        R"delim(
+        Read ``size`` bytes of the process memory at the given virtual address.
+        It returns None if a part of the range is not mapped in the core.
+        )delim"_doc, "address"_a, "size"_a);
+}
+}
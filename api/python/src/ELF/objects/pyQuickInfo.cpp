@@ -0,0 +1,104 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ELF/pyELF.hpp"
+#include "pyErr.hpp"
+#include "nanobind/utils.hpp"
+
+#include "LIEF/ELF/quick_info.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
+
+#include <string>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/vector.h>
+
+namespace LIEF::ELF::py {
+
+template<>
+void create<quick_info_t>(nb::module_& m) {
+  using namespace LIEF::py;
+
+  nb::class_<quick_info_t> info(m, "quick_info_t",
+    R"delim(
+    Information decoded by :func:`~lief.ELF.quick_info` without parsing the
+    whole binary.
+    )delim"_doc);
+
+  nb::class_<quick_info_t::property_t>(info, "property_t",
+      "Raw entry of the ``NT_GNU_PROPERTY_TYPE_0`` note"_doc)
+    .def_ro("type", &quick_info_t::property_t::type,
+            "Raw type of the property (e.g. ``0xc0000002``)"_doc)
+    .def_ro("value", &quick_info_t::property_t::value,
+            "Value of the property if it is 4 or 8 bytes wide, 0 otherwise"_doc);
+
+  info
+    .def_ro("cls", &quick_info_t::cls)
+    .def_ro("endianness", &quick_info_t::endianness)
+    .def_ro("file_type", &quick_info_t::file_type)
+    .def_ro("machine", &quick_info_t::machine)
+    .def_ro("entrypoint", &quick_info_t::entrypoint)
+    .def_ro("interpreter", &quick_info_t::interpreter,
+            "Path of the interpreter (``PT_INTERP``)"_doc)
+    .def_ro("soname", &quick_info_t::soname, "``DT_SONAME``"_doc)
+    .def_ro("rpath", &quick_info_t::rpath, "``DT_RPATH``"_doc)
+    .def_ro("runpath", &quick_info_t::runpath, "``DT_RUNPATH``"_doc)
+    .def_ro("needed", &quick_info_t::needed,
+            "``DT_NEEDED`` entries in the order of the dynamic table"_doc)
+    .def_prop_ro("build_id",
+        [] (const quick_info_t& self) {
+          return nb::to_bytes(self.build_id);
+        }, "Content of the ``NT_GNU_BUILD_ID`` note"_doc)
+    .def_ro("properties", &quick_info_t::properties,
+            "Entries of the ``NT_GNU_PROPERTY_TYPE_0`` note"_doc)
+    .def_ro("has_dynamic", &quick_info_t::has_dynamic,
+            "True if the binary has a ``PT_DYNAMIC`` segment"_doc);
+
+  m.def("quick_info",
+      [] (const std::string& filename) {
+        return error_or(
+          static_cast<result<quick_info_t>(*)(const std::string&)>(&quick_info),
+          filename);
+      },
+      R"delim(
+      Decode, from the program headers, the dynamic segment and the notes,
+      the architecture, the type, the interpreter, the ``DT_NEEDED``,
+      ``DT_SONAME``, ``DT_RPATH/DT_RUNPATH`` entries, the build-id and the GNU
+      properties of the given ELF file.
+
+      Contrary to :func:`lief.ELF.parse`, only these structures are read
+      from the file. This function is intended to inventory a large number
+      of files:
+
+      .. code-block:: python
+
+        for path in pathlib.Path("/usr/lib").rglob("*.so*"):
+            info = lief.ELF.quick_info(str(path))
+            if isinstance(info, lief.lief_errors):
+                continue
+            print(path, info.soname, info.needed)
+      )delim"_doc, "filename"_a);
+
+  m.def("quick_info",
+      [] (nb::bytes bytes) {
+        SpanStream stream(reinterpret_cast<const uint8_t*>(bytes.data()),
+                          bytes.size());
+        return error_or(
+          static_cast<result<quick_info_t>(*)(BinaryStream&)>(&quick_info),
+          stream);
+      },
+      "Same as above for the given raw bytes"_doc, "buffer"_a);
+}
+
+}
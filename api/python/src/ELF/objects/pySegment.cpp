@@ -175,7 +175,8 @@ void create<Segment>(nb::module_& m) {
     .def_prop_rw("content",
         nb::overload_cast<>(&Segment::content, nb::const_),
         nb::overload_cast<std::vector<uint8_t>>(&Segment::content),
-        "The raw data associated with this segment."_doc)
+        "The raw data associated with this segment as a read-only ``memoryview`` (no copy)"_doc,
+        nb::for_getter(nb::keep_alive<0, 1>()))
 
     .def("add", &Segment::add,
         "Add the given flag to the list of :attr:`~lief.ELF.Segment.flags`"_doc,
@@ -72,6 +72,13 @@ void create<Symbol>(nb::module_& m) {
         &Symbol::demangled_name,
         "Symbol's name demangled or an empty string if the demangling is not possible/failed"_doc)
 
+    .def_prop_ro("gnu_hash", &Symbol::gnu_hash,
+        "GNU hash (``DT_GNU_HASH``) of the symbol's name"_doc)
+
+    .def("sysv_hash", &Symbol::sysv_hash,
+        "SYSV hash (``DT_HASH``) of the symbol's name for the given ELF class"_doc,
+        "elf_class"_a)
+
     .def_prop_rw("type",
         nb::overload_cast<>(&Symbol::type, nb::const_),
         nb::overload_cast<Symbol::TYPE>(&Symbol::type),
@@ -65,11 +65,103 @@
 #include "pyErr.hpp"
 #include "MachO/pyMachO.hpp"
 #include "pyIterator.hpp"
+#include "pyColumns.hpp"
 
 namespace LIEF::MachO::py {
+using namespace LIEF::py;
+
+static nb::dict symbols_table(const Binary& bin) {
+  const size_t nb_symbols = bin.symbols().size();
+  string_column_t name(nb_symbols);
+  column_t<uint64_t> value(nb_symbols);
+  column_t<uint8_t> type(nb_symbols);
+  column_t<uint8_t> numberof_sections(nb_symbols);
+  column_t<uint16_t> description(nb_symbols);
+  column_t<uint8_t> category(nb_symbols);
+
+  for (const Symbol& sym : bin.symbols()) {
+    name.push_back(sym.name());
+    value.push_back(sym.value());
+    type.push_back(sym.raw_type());
+    numberof_sections.push_back(sym.numberof_sections());
+    description.push_back(sym.description());
+    category.push_back((uint8_t)sym.category());
+  }
+
+  nb::dict table;
+  add_column(table, "name", std::move(name));
+  add_column(table, "value", std::move(value));
+  add_column(table, "type", std::move(type));
+  add_column(table, "numberof_sections", std::move(numberof_sections));
+  add_column(table, "description", std::move(description));
+  add_column(table, "category", std::move(category));
+  return table;
+}
+
+static nb::dict relocations_table(const Binary& bin) {
+  // Binary::relocations() collects the relocations on each call
+  Binary::it_const_relocations relocations = bin.relocations();
+  const size_t nb_relocations = relocations.size();
+  column_t<uint64_t> address(nb_relocations);
+  column_t<uint8_t> type(nb_relocations);
+  column_t<uint8_t> size(nb_relocations);
+  column_t<uint8_t> is_pc_relative(nb_relocations);
+  column_t<uint8_t> origin(nb_relocations);
+  string_column_t symbol(nb_relocations);
+
+  for (const Relocation& reloc : relocations) {
+    address.push_back(reloc.address());
+    type.push_back(reloc.type());
+    size.push_back(reloc.size());
+    is_pc_relative.push_back(reloc.is_pc_relative());
+    origin.push_back((uint8_t)reloc.origin());
+    const Symbol* sym = reloc.symbol();
+    symbol.push_back(sym != nullptr ? sym->name() : "");
+  }
+
+  nb::dict table;
+  add_column(table, "address", std::move(address));
+  add_column(table, "type", std::move(type));
+  add_column(table, "size", std::move(size));
+  add_column(table, "is_pc_relative", std::move(is_pc_relative));
+  add_column(table, "origin", std::move(origin));
+  add_column(table, "symbol", std::move(symbol));
+  return table;
+}
+
+static nb::dict sections_table(const Binary& bin) {
+  const size_t nb_sections = bin.sections().size();
+  string_column_t name(nb_sections);
+  string_column_t segment_name(nb_sections);
+  column_t<uint64_t> address(nb_sections);
+  column_t<uint64_t> offset(nb_sections);
+  column_t<uint64_t> size(nb_sections);
+  column_t<uint32_t> alignment(nb_sections);
+  column_t<uint32_t> flags(nb_sections);
+
+  for (const Section& section : bin.sections()) {
+    name.push_back(section.name());
+    segment_name.push_back(section.segment_name());
+    address.push_back(section.address());
+    offset.push_back(section.offset());
+    size.push_back(section.size());
+    alignment.push_back(section.alignment());
+    flags.push_back(section.raw_flags());
+  }
+
+  nb::dict table;
+  add_column(table, "name", std::move(name));
+  add_column(table, "segment_name", std::move(segment_name));
+  add_column(table, "address", std::move(address));
+  add_column(table, "offset", std::move(offset));
+  add_column(table, "size", std::move(size));
+  add_column(table, "alignment", std::move(alignment));
+  add_column(table, "flags", std::move(flags));
+  return table;
+}
+
 template<>
 void create<Binary>(nb::module_& m) {
-  using namespace LIEF::py;
 
   nb::class_<Binary, LIEF::Binary> bin(m, "Binary",
       R"delim(
@@ -110,6 +202,32 @@ void create<Binary>(nb::module_& m) {
         "Return an iterator over binary's " RST_CLASS_REF(lief.MachO.Relocation) ""_doc,
         nb::keep_alive<0, 1>())
 
+    .def("symbols_table", &symbols_table,
+        R"delim(
+        Return the symbols as a dictionary of NumPy arrays (one array per
+        attribute) which is filled without creating a Python object per symbol:
+
+        - ``name_offsets``/``name_data``: names in Arrow's string layout
+        - ``value``, ``type`` (raw ``n_type``), ``numberof_sections``,
+          ``description`` and ``category``
+
+        This function requires NumPy.
+        )delim"_doc)
+
+    .def("relocations_table", &relocations_table,
+        R"delim(
+        Same as :meth:`~.symbols_table` for the relocations with the columns:
+        ``address``, ``type`` (raw value), ``size``, ``is_pc_relative``,
+        ``origin`` and ``symbol_offsets``/``symbol_data``.
+        )delim"_doc)
+
+    .def("sections_table", &sections_table,
+        R"delim(
+        Same as :meth:`~.symbols_table` for the sections with the columns:
+        ``name_offsets``/``name_data``, ``segment_name_offsets``/``segment_name_data``,
+        ``address``, ``offset``, ``size``, ``alignment`` and ``flags`` (raw value).
+        )delim"_doc)
+
     .def_prop_ro("segments",
         nb::overload_cast<>(&Binary::segments),
         "Return an iterator over the binary's " RST_CLASS_REF(lief.MachO.SegmentCommand) ""_doc,
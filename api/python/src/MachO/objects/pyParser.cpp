@@ -19,6 +19,7 @@
 #include <nanobind/stl/string.h>
 #include <nanobind/stl/vector.h>
 
+#include "typing/Buffer.hpp"
 #include "typing/InputParser.hpp"
 #include "pyutils.hpp"
 #include "pyIOStream.hpp"
@@ -49,6 +50,23 @@ void create<Parser>(nb::module_& m) {
     )delim"_doc, "buffer"_a, "config"_a = ParserConfig::deep(),
     nb::rv_policy::take_ownership);
 
+  m.def("parse",
+    [] (typing::Buffer buffer, const ParserConfig& config) -> std::unique_ptr<FatBinary> {
+      std::unique_ptr<PyBufferStream> strm = PyBufferStream::from_python(buffer);
+      if (strm == nullptr) {
+        return nullptr;
+      }
+      return Parser::parse(std::move(strm), config);
+    },
+    R"delim(
+    Parse the Mach-O binary from an object that implements the buffer protocol
+    (``memoryview``, ``mmap.mmap``, NumPy arrays, ...) and return a :class:`~lief.MachO.FatBinary` object.
+
+    Contrary to the ``list[int]`` and ``io`` inputs, the content is not copied
+    before being parsed. The object must not be modified during the parsing.
+    )delim"_doc, "buffer"_a, "config"_a = ParserConfig::deep(),
+    nb::rv_policy::take_ownership);
+
   m.def("parse",
     nb::overload_cast<const std::string&, const ParserConfig&>(&LIEF::MachO::Parser::parse),
     R"delim(
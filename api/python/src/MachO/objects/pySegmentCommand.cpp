@@ -132,7 +132,8 @@ void create<SegmentCommand>(nb::module_& m) {
     .def_prop_rw("content",
         nb::overload_cast<>(&SegmentCommand::content, nb::const_),
         nb::overload_cast<SegmentCommand::content_t>(&SegmentCommand::content),
-        "Segment's content"_doc)
+        "Segment's content as a read-only ``memoryview`` (no copy)"_doc,
+        nb::for_getter(nb::keep_alive<0, 1>()))
 
     .def_prop_rw("flags",
         nb::overload_cast<>(&SegmentCommand::flags, nb::const_),
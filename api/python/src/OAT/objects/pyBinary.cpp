@@ -77,6 +77,17 @@ void create<Binary>(nb::module_& m) {
         "Return the " RST_CLASS_REF(lief.OAT.Class) " from its **index**"_doc,
         "class_index"_a, nb::rv_policy::reference_internal)
 
+    .def("get_method",
+        nb::overload_cast<const std::string&, const std::string&>(&Binary::get_method),
+        R"delim(
+        Return the compiled :class:`~lief.OAT.Method` with the given name in the
+        given class (or None if it can't be found).
+
+        Contrary to :attr:`~lief.OAT.Binary.methods`, only the class of the
+        method is decoded.
+        )delim"_doc,
+        "class_name"_a, "method_name"_a, nb::rv_policy::reference_internal)
+
     .def_prop_ro("dex2dex_json_info", &Binary::dex2dex_json_info)
     LIEF_DEFAULT_STR(Binary);
 }
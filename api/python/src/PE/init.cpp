@@ -25,6 +25,7 @@
 #include "LIEF/PE/ParserConfig.hpp"
 #include "LIEF/PE/RelocationEntry.hpp"
 #include "LIEF/PE/COFFString.hpp"
+#include "LIEF/PE/ExceptionIndex.hpp"
 #include "LIEF/PE/ExceptionInfo.hpp"
 #include "LIEF/PE/RichHeader.hpp"
 #include "LIEF/PE/TLS.hpp"
@@ -52,6 +53,7 @@ void init_resources(nb::module_& m) {
   CREATE(ResourceNode, m);
   CREATE(ResourceData, m);
   CREATE(ResourceDirectory, m);
+  CREATE(ResourceDirectoryView, m);
   CREATE(ResourceVersion, m);
   CREATE(ResourceStringTable, m);
   CREATE(ResourceStringFileInfo, m);
@@ -139,6 +141,7 @@ void init_objects(nb::module_& m) {
     init_load_configs(m);
   }
   CREATE(Binary, m);
+  CREATE(ExceptionIndex, m);
   CREATE(Builder, m);
   CREATE(Factory, m);
 }
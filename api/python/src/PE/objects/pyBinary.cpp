@@ -33,6 +33,7 @@
 
 #include "pyErr.hpp"
 #include "pyIterator.hpp"
+#include "pyColumns.hpp"
 #include "nanobind/extra/stl/lief_span.h"
 #include "nanobind/utils.hpp"
 
@@ -41,10 +42,88 @@
 #include <nanobind/stl/unique_ptr.h>
 
 namespace LIEF::PE::py {
+using namespace LIEF::py;
+
+static nb::dict symbols_table(const Binary& bin) {
+  const size_t nb_symbols = bin.symbols().size();
+  string_column_t name(nb_symbols);
+  column_t<uint64_t> value(nb_symbols);
+  column_t<int16_t> section_idx(nb_symbols);
+  column_t<uint16_t> type(nb_symbols);
+  column_t<uint8_t> storage_class(nb_symbols);
+
+  for (const Symbol& sym : bin.symbols()) {
+    name.push_back(sym.name());
+    value.push_back(sym.value());
+    section_idx.push_back(sym.section_idx());
+    type.push_back(sym.type());
+    storage_class.push_back((uint8_t)sym.storage_class());
+  }
+
+  nb::dict table;
+  add_column(table, "name", std::move(name));
+  add_column(table, "value", std::move(value));
+  add_column(table, "section_idx", std::move(section_idx));
+  add_column(table, "type", std::move(type));
+  add_column(table, "storage_class", std::move(storage_class));
+  return table;
+}
+
+static nb::dict relocations_table(const Binary& bin) {
+  size_t nb_entries = 0;
+  for (const Relocation& reloc : bin.relocations()) {
+    nb_entries += reloc.entries().size();
+  }
+
+  column_t<uint64_t> address(nb_entries);
+  column_t<uint8_t> type(nb_entries);
+  column_t<uint32_t> block(nb_entries);
+
+  for (const Relocation& reloc : bin.relocations()) {
+    for (const RelocationEntry& entry : reloc.entries()) {
+      address.push_back(entry.address());
+      type.push_back(entry.data() >> 12);
+      block.push_back(reloc.virtual_address());
+    }
+  }
+
+  nb::dict table;
+  add_column(table, "address", std::move(address));
+  add_column(table, "type", std::move(type));
+  add_column(table, "block", std::move(block));
+  return table;
+}
+
+static nb::dict sections_table(const Binary& bin) {
+  const size_t nb_sections = bin.sections().size();
+  string_column_t name(nb_sections);
+  column_t<uint64_t> virtual_address(nb_sections);
+  column_t<uint32_t> virtual_size(nb_sections);
+  column_t<uint32_t> offset(nb_sections);
+  column_t<uint32_t> size(nb_sections);
+  column_t<uint32_t> characteristics(nb_sections);
+
+  for (const Section& section : bin.sections()) {
+    name.push_back(section.name());
+    virtual_address.push_back(section.virtual_address());
+    virtual_size.push_back(section.virtual_size());
+    offset.push_back(section.pointerto_raw_data());
+    size.push_back(section.sizeof_raw_data());
+    characteristics.push_back(section.characteristics());
+  }
+
+  nb::dict table;
+  add_column(table, "name", std::move(name));
+  add_column(table, "virtual_address", std::move(virtual_address));
+  add_column(table, "virtual_size", std::move(virtual_size));
+  add_column(table, "offset", std::move(offset));
+  add_column(table, "size", std::move(size));
+  add_column(table, "characteristics", std::move(characteristics));
+  return table;
+}
 
 template<>
 void create<Binary>(nb::module_& m) {
-  using namespace LIEF::py;
 
   nb::class_<Binary, LIEF::Binary> bin(m, "Binary",
       R"delim(
@@ -327,6 +406,31 @@ void create<Binary>(nb::module_& m) {
         "Return an iterator over the " RST_CLASS_REF(lief.PE.Relocation) ""_doc,
         nb::keep_alive<0, 1>())
 
+    .def("symbols_table", &symbols_table,
+        R"delim(
+        Return the COFF symbols as a dictionary of NumPy arrays (one array per
+        attribute) which is filled without creating a Python object per symbol:
+
+        - ``name_offsets``/``name_data``: names in Arrow's string layout
+        - ``value``, ``section_idx``, ``type``, ``storage_class`` (raw values)
+
+        This function requires NumPy.
+        )delim"_doc)
+
+    .def("relocations_table", &relocations_table,
+        R"delim(
+        Same as :meth:`~.symbols_table` for the base relocations (flattened)
+        with the columns: ``address`` (RVA), ``type`` (raw ``IMAGE_REL_BASED_``
+        value) and ``block`` (RVA of the relocation block).
+        )delim"_doc)
+
+    .def("sections_table", &sections_table,
+        R"delim(
+        Same as :meth:`~.symbols_table` for the sections with the columns:
+        ``name_offsets``/``name_data``, ``virtual_address`` (RVA),
+        ``virtual_size``, ``offset``, ``size`` and ``characteristics``.
+        )delim"_doc)
+
     .def("add_relocation",
         &Binary::add_relocation,
         "Add a " RST_CLASS_REF(lief.PE.Relocation) " to the binary"_doc,
@@ -391,6 +495,16 @@ void create<Binary>(nb::module_& m) {
         },
         "Return the " RST_CLASS_REF(lief.PE.ResourcesManager) " to manage resources"_doc)
 
+    .def_prop_ro("resources_view",
+        [] (const Binary& self) {
+          return error_or(&Binary::resources_view, self);
+        },
+        R"delim(
+        Return a lazy :class:`~lief.PE.ResourceDirectoryView` on the root
+        directory of the resources. It does not require the resource tree
+        to be parsed (:attr:`lief.PE.ParserConfig.parse_rsrc`).
+        )delim"_doc, nb::keep_alive<0, 1>())
+
     .def_prop_ro("resources",
         nb::overload_cast<>(&Binary::resources),
         "Return the " RST_CLASS_REF(lief.PE.ResourceNode) " tree or None if not not present"_doc,
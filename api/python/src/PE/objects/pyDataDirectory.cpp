@@ -72,7 +72,8 @@ void create<DataDirectory>(nb::module_& m) {
         nb::rv_policy::reference_internal)
 
     .def_prop_ro("content", nb::overload_cast<>(&DataDirectory::content, nb::const_),
-        "Raw content (bytes) referenced by this data directory"_doc)
+        "Raw content referenced by this data directory as a read-only ``memoryview`` (no copy)"_doc,
+        nb::keep_alive<0, 1>())
 
     .def_prop_ro("type",
         &DataDirectory::type,
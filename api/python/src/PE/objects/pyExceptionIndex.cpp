@@ -0,0 +1,94 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "PE/pyPE.hpp"
+
+#include <string>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/unique_ptr.h>
+#include <nanobind/stl/shared_ptr.h>
+
+#include "LIEF/BinaryStream/VectorStream.hpp"
+
+#include "LIEF/PE/ExceptionIndex.hpp"
+#include "LIEF/PE/ExceptionInfo.hpp"
+#include "LIEF/PE/Binary.hpp"
+
+namespace LIEF::PE::py {
+
+template<>
+void create<ExceptionIndex>(nb::module_& m) {
+  nb::class_<ExceptionIndex> index(m, "ExceptionIndex",
+    R"delim(
+    Lazy index over the exception table (``.pdata``) of a PE binary.
+
+    Contrary to :attr:`lief.PE.ParserConfig.parse_exceptions`, the entries
+    are not decoded upfront: :meth:`~lief.PE.ExceptionIndex.find_exception`
+    binary-searches the (sorted) table and only decodes the entry that
+    contains the given RVA. The decoded entries are kept in a LRU cache.
+
+    .. code-block:: python
+
+      index = lief.PE.ExceptionIndex.parse("ntoskrnl.exe")
+      func = index.find_exception(0x20fcb4)
+      print(func.unwind_info)
+    )delim"_doc);
+
+  index
+    .def_static("parse",
+        nb::overload_cast<const std::string&, const ParserConfig&>(&ExceptionIndex::parse),
+        "Parse the PE located at the given path and index its exception table"_doc,
+        "filename"_a, "config"_a = ParserConfig::default_conf())
+
+    .def_static("parse",
+        [] (nb::bytes bytes, const ParserConfig& config) {
+          std::vector<uint8_t> raw(bytes.size());
+          std::copy_n(reinterpret_cast<const uint8_t*>(bytes.data()), raw.size(),
+                      raw.begin());
+          return ExceptionIndex::parse(
+              std::make_unique<VectorStream>(std::move(raw)), config);
+        },
+        "Parse the PE from the given bytes and index its exception table"_doc,
+        "buffer"_a, "config"_a = ParserConfig::default_conf())
+
+    .def_prop_ro("binary", &ExceptionIndex::binary,
+        "The " RST_CLASS_REF(lief.PE.Binary) " associated with this index"_doc,
+        nb::rv_policy::reference_internal)
+
+    .def("find_exception", &ExceptionIndex::find_exception,
+        R"delim(
+        Return the :class:`~lief.PE.ExceptionInfo` of the function that
+        contains the given RVA or None if the RVA is not covered by the
+        exception table.
+
+        The returned object remains valid when the entry is evicted from the
+        cache.
+        )delim"_doc, "rva"_a, nb::keep_alive<0, 1>())
+
+    .def_prop_rw("cache_size",
+        nb::overload_cast<>(&ExceptionIndex::cache_size, nb::const_),
+        nb::overload_cast<size_t>(&ExceptionIndex::cache_size),
+        "Maximum number of decoded entries kept in the cache"_doc)
+
+    .def_prop_ro("cache_hits", &ExceptionIndex::cache_hits,
+        "Number of lookups that have been served from the cache"_doc)
+
+    .def_prop_ro("cache_misses", &ExceptionIndex::cache_misses,
+        "Number of lookups that required to decode an entry"_doc)
+
+    .def("__len__", &ExceptionIndex::size);
+}
+
+}
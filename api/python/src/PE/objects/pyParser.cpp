@@ -22,6 +22,7 @@
 #include <nanobind/stl/vector.h>
 #include <nanobind/stl/unique_ptr.h>
 
+#include "typing/Buffer.hpp"
 #include "typing/InputParser.hpp"
 #include "pyutils.hpp"
 #include "pyIOStream.hpp"
@@ -53,6 +54,23 @@ void create<Parser>(nb::module_& m) {
     )delim"_doc, "buffer"_a, "config"_a = ParserConfig::default_conf(),
     nb::rv_policy::take_ownership);
 
+  m.def("parse",
+    [] (typing::Buffer buffer, const ParserConfig& config) -> std::unique_ptr<Binary> {
+      std::unique_ptr<PyBufferStream> strm = PyBufferStream::from_python(buffer);
+      if (strm == nullptr) {
+        return nullptr;
+      }
+      return Parser::parse(std::move(strm), config);
+    },
+    R"delim(
+    Parse the PE binary from an object that implements the buffer protocol
+    (``memoryview``, ``mmap.mmap``, NumPy arrays, ...) and return a :class:`lief.PE.Binary` object.
+
+    Contrary to the ``list[int]`` and ``io`` inputs, the content is not copied
+    before being parsed. The object must not be modified during the parsing.
+    )delim"_doc, "buffer"_a, "config"_a = ParserConfig::default_conf(),
+    nb::rv_policy::take_ownership);
+
   m.def("parse",
     static_cast<std::unique_ptr<Binary>(*)(const std::string&, const ParserConfig&)>(&Parser::parse),
     "Parse the PE binary from the given **file path** and return a " RST_CLASS_REF(lief.PE.Binary) " object"_doc,
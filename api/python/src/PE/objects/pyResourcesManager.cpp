@@ -20,6 +20,7 @@
 
 #include "LIEF/PE/ResourcesManager.hpp"
 #include "LIEF/PE/ResourceNode.hpp"
+#include "LIEF/PE/ResourceData.hpp"
 #include "enums_wrapper.hpp"
 
 #include <string>
@@ -165,6 +166,25 @@ void create<ResourcesManager>(nb::module_& m) {
       "type"_a,
       nb::rv_policy::reference_internal)
 
+    .def("find",
+      nb::overload_cast<ResourcesManager::TYPE, uint32_t, uint32_t>(&ResourcesManager::find, nb::const_),
+      R"delim(
+      Return the :class:`~lief.PE.ResourceData` of the resource identified by
+      its type, its ID and its language (e.g. ``0x409`` for ``en-US``) or None
+      if not found.
+      )delim"_doc,
+      "type"_a, "id"_a, "lang"_a,
+      nb::rv_policy::reference_internal)
+
+    .def("find",
+      nb::overload_cast<ResourcesManager::TYPE, uint32_t>(&ResourcesManager::find, nb::const_),
+      R"delim(
+      Return the :class:`~lief.PE.ResourceData` of the resource identified by
+      its type and its ID (first language available) or None if not found.
+      )delim"_doc,
+      "type"_a, "id"_a,
+      nb::rv_policy::reference_internal)
+
     .def("print", &ResourcesManager::print,
          "Print the current resource tree",
          "max_depth"_a = 0)
@@ -0,0 +1,141 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "PE/pyPE.hpp"
+#include "pyErr.hpp"
+#include "nanobind/extra/stl/lief_span.h"
+#include "nanobind/extra/stl/u16string.h"
+
+#include "LIEF/PE/ResourceDirectoryView.hpp"
+
+#include <string>
+#include <nanobind/stl/string.h>
+
+namespace LIEF::PE::py {
+
+template<>
+void create<ResourceDirectoryView>(nb::module_& m) {
+  using namespace LIEF::py;
+  using Entry = ResourceDirectoryView::Entry;
+  using data_t = ResourceDirectoryView::data_t;
+
+  nb::class_<ResourceDirectoryView> view(m, "ResourceDirectoryView",
+    R"delim(
+    Read-only and lazy view over a resource directory of a PE binary.
+
+    Contrary to :class:`~lief.PE.ResourceNode`, the entries are decoded when
+    they are accessed and the payloads are not copied. This view can be used
+    with :attr:`lief.PE.ParserConfig.parse_rsrc` set to ``False``:
+
+    .. code-block:: python
+
+      config = lief.PE.ParserConfig()
+      config.parse_rsrc = False
+
+      pe = lief.PE.parse("setup.exe", config)
+      root = pe.resources_view
+      manifest = root.lookup(lief.PE.ResourcesManager.TYPE.MANIFEST.value, 1)
+      print(bytes(manifest.content))
+
+    The views reference the memory of the :class:`~lief.PE.Binary`
+    from which they are created.
+    )delim"_doc);
+
+  nb::class_<data_t>(view, "data_t",
+    "Leaf of the resource tree (``IMAGE_RESOURCE_DATA_ENTRY``)"_doc)
+    .def_ro("rva", &data_t::rva, "RVA of the payload"_doc)
+    .def_ro("code_page", &data_t::code_page,
+            "Code page used to decode the payload"_doc)
+    .def_ro("reserved", &data_t::reserved, "Reserved value (should be 0)"_doc)
+    .def_prop_ro("content",
+        [] (const data_t& self) {
+          return self.content;
+        }, "Payload of the resource (without copy)"_doc, nb::keep_alive<0, 1>());
+
+  nb::class_<Entry>(view, "Entry",
+    "Entry of a resource directory (``IMAGE_RESOURCE_DIRECTORY_ENTRY``)"_doc)
+    .def_prop_ro("id", &Entry::id, "Raw ID of the entry"_doc)
+    .def_prop_ro("has_name", &Entry::has_name,
+        "True if the entry is identified by a name instead of an ID"_doc)
+    .def_prop_ro("name", &Entry::utf8_name, "Name of the entry"_doc)
+    .def_prop_ro("is_directory", &Entry::is_directory,
+        "True if the entry references a sub-directory"_doc)
+    .def_prop_ro("is_data", &Entry::is_data,
+        "True if the entry references a leaf"_doc)
+    .def_prop_ro("directory",
+        [] (const Entry& self) {
+          return error_or(&Entry::directory, self);
+        }, "Sub-directory referenced by this entry"_doc, nb::keep_alive<0, 1>())
+    .def_prop_ro("data",
+        [] (const Entry& self) {
+          return error_or(&Entry::data, self);
+        }, "Leaf referenced by this entry"_doc, nb::keep_alive<0, 1>());
+
+  view
+    .def_prop_ro("characteristics", &ResourceDirectoryView::characteristics)
+    .def_prop_ro("time_date_stamp", &ResourceDirectoryView::time_date_stamp)
+    .def_prop_ro("major_version", &ResourceDirectoryView::major_version)
+    .def_prop_ro("minor_version", &ResourceDirectoryView::minor_version)
+    .def_prop_ro("numberof_name_entries", &ResourceDirectoryView::numberof_name_entries)
+    .def_prop_ro("numberof_id_entries", &ResourceDirectoryView::numberof_id_entries)
+    .def_prop_ro("depth", &ResourceDirectoryView::depth,
+        "Depth of this directory in the tree (0 for the root)"_doc)
+
+    .def("at",
+        [] (const ResourceDirectoryView& self, size_t idx) {
+          return error_or(&ResourceDirectoryView::at, self, idx);
+        }, "Return the entry at the given index"_doc, "idx"_a,
+        nb::keep_alive<0, 1>())
+
+    .def("find",
+        [] (const ResourceDirectoryView& self, uint32_t id) {
+          return error_or(
+            nb::overload_cast<uint32_t>(&ResourceDirectoryView::find, nb::const_),
+            self, id);
+        }, "Find the entry with the given ID (binary search, linear scan if the directory is not sorted)"_doc, "id"_a,
+        nb::keep_alive<0, 1>())
+
+    .def("find",
+        [] (const ResourceDirectoryView& self, const std::u16string& name) {
+          return error_or(
+            nb::overload_cast<const std::u16string&>(&ResourceDirectoryView::find, nb::const_),
+            self, name);
+        }, "Find the entry with the given name (binary search, linear scan if the directory is not sorted)"_doc, "name"_a,
+        nb::keep_alive<0, 1>())
+
+    .def("lookup",
+        [] (const ResourceDirectoryView& self, uint32_t type, uint32_t id, uint32_t lang) {
+          return error_or(
+            nb::overload_cast<uint32_t, uint32_t, uint32_t>(&ResourceDirectoryView::lookup, nb::const_),
+            self, type, id, lang);
+        },
+        R"delim(
+        Typed lookup of the resource identified by its type, its ID and its
+        language. This function must be called on the root directory.
+        )delim"_doc, "type"_a, "id"_a, "lang"_a, nb::keep_alive<0, 1>())
+
+    .def("lookup",
+        [] (const ResourceDirectoryView& self, uint32_t type, uint32_t id) {
+          return error_or(
+            nb::overload_cast<uint32_t, uint32_t>(&ResourceDirectoryView::lookup, nb::const_),
+            self, type, id);
+        },
+        R"delim(
+        Same as above but return the first language available for the resource
+        )delim"_doc, "type"_a, "id"_a, nb::keep_alive<0, 1>())
+
+    .def("__len__", &ResourceDirectoryView::size);
+}
+}
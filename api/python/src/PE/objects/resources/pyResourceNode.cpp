@@ -107,6 +107,15 @@ void create<ResourceNode>(nb::module_& m) {
       )doc"_doc, "id"_a
     )
 
+    .def("find_child",
+      nb::overload_cast<uint32_t>(&ResourceNode::find_child),
+      R"doc(
+      Find the child with the given :attr:`~.ResourceNode.id` or return None
+      if not found. The lookup is a binary search when the children are
+      sorted as required by the PE format, and a linear scan otherwise.
+      )doc"_doc, "id"_a, nb::rv_policy::reference_internal
+    )
+
     .def_prop_ro("depth", &ResourceNode::depth,
       "Current depth of the node in the resource tree"_doc
     )
@@ -79,7 +79,55 @@ void create<x509>(nb::module_& m) {
     .value("ENCIPHER_ONLY",     x509::KEY_USAGE::ENCIPHER_ONLY,      "In **association with** KEY_AGREEMENT (otherwise the meaning is undefined), the key is only used for enciphering data while performing key agreement"_doc)
     .value("DECIPHER_ONLY",     x509::KEY_USAGE::DECIPHER_ONLY,      "In **association with** KEY_AGREEMENT (otherwise the meaning is undefined), the key is only used for deciphering data while performing key agreement"_doc);
 
+  nb::class_<x509::cache_stats_t>(cls_x509, "cache_stats_t",
+      "Statistics of the process-wide certificates cache"_doc)
+    .def_ro("certificates", &x509::cache_stats_t::certificates,
+            "Number of certificates currently in the cache"_doc)
+    .def_ro("verifications", &x509::cache_stats_t::verifications,
+            "Number of verification results currently in the cache"_doc)
+    .def_ro("hits", &x509::cache_stats_t::hits,
+            "Number of certificates that have been served from the cache"_doc)
+    .def_ro("misses", &x509::cache_stats_t::misses,
+            "Number of certificates that had to be parsed"_doc)
+    .def_ro("verify_hits", &x509::cache_stats_t::verify_hits,
+            "Number of verifications served from the cache"_doc)
+    .def_ro("verify_misses", &x509::cache_stats_t::verify_misses,
+            "Number of verifications that had to be computed"_doc);
+
   cls_x509
+    .def_static("enable_cache", &x509::enable_cache,
+        R"delim(
+        Enable (or disable) the process-wide cache of certificates.
+
+        When enabled, a certificate already parsed (e.g. the Microsoft's chain)
+        is shared instead of being parsed again and the results of
+        :meth:`~lief.PE.x509.verify` and :meth:`~lief.PE.x509.is_trusted_by`
+        are memoized. The cache keeps at most ``max_size`` certificates.
+
+        .. code-block:: python
+
+          lief.PE.x509.enable_cache()
+          for path in corpus:
+              pe = lief.PE.parse(path)
+              pe.verify_signature()
+          print(lief.PE.x509.cache_stats().hits)
+
+        .. warning::
+
+          The memoized verification results are not re-evaluated if a
+          certificate expires while the cache is enabled.
+        )delim"_doc,
+        "enabled"_a = true, "max_size"_a = x509::DEFAULT_CACHE_SIZE)
+
+    .def_static("is_cache_enabled", &x509::is_cache_enabled,
+        "Whether the process-wide cache of certificates is enabled"_doc)
+
+    .def_static("clear_cache", &x509::clear_cache,
+        "Drop the content of the cache and reset its statistics"_doc)
+
+    .def_static("cache_stats", &x509::cache_stats,
+        "Statistics of the cache"_doc)
+
     .def_static("parse",
         nb::overload_cast<const std::string&>(&x509::parse),
         "Parse " RST_CLASS_REF(lief.PE.x509) " certificate(s) from a file path given in the first parameter.\n"
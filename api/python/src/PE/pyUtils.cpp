@@ -15,8 +15,10 @@
  */
 #include "PE/pyPE.hpp"
 #include "pyErr.hpp"
+#include "nanobind/utils.hpp"
 
 #include "LIEF/PE/utils.hpp"
+#include "LIEF/PE/fingerprint.hpp"
 #include "LIEF/PE/Import.hpp"
 #include "LIEF/PE/Binary.hpp"
 
@@ -105,6 +107,81 @@ void init_utils(nb::module_& m) {
       "imp"_a, "strict"_a = false, "use_std"_a = false,
       nb::rv_policy::copy);
 
+  nb::class_<fingerprint_options_t>(m, "fingerprint_options_t",
+      "Digests to compute with :func:`~lief.PE.fingerprint`"_doc)
+    .def(nb::init<>())
+    .def_rw("imphash", &fingerprint_options_t::imphash,
+            "Compute the imphash with :attr:`~lief.PE.IMPHASH_MODE.LIEF`"_doc)
+    .def_rw("imphash_pefile", &fingerprint_options_t::imphash_pefile,
+            "Compute the imphash with :attr:`~lief.PE.IMPHASH_MODE.PEFILE`"_doc)
+    .def_rw("rich_header_hash", &fingerprint_options_t::rich_header_hash,
+            "Compute the MD5 of the (decoded) rich header"_doc)
+    .def_rw("authentihash", &fingerprint_options_t::authentihash,
+            "Algorithms for which the authentihash is computed"_doc)
+    .def_rw("section_hashes", &fingerprint_options_t::section_hashes,
+            "Compute the MD5 and the SHA-256 of the sections' content"_doc)
+    .def_rw("section_entropy", &fingerprint_options_t::section_entropy,
+            "Compute the entropy of the sections' content"_doc)
+    .def_rw("checksum", &fingerprint_options_t::checksum,
+            "Compute the checksum of the binary"_doc);
+
+  nb::class_<fingerprint_t> fp(m, "fingerprint_t",
+      R"delim(
+      Digests computed by :func:`~lief.PE.fingerprint`. The digests that are
+      not requested (or that can't be computed) are empty.
+      )delim"_doc);
+
+  nb::class_<fingerprint_t::section_t>(fp, "section_t",
+      "Digests of a section"_doc)
+    .def_ro("name", &fingerprint_t::section_t::name)
+    .def_ro("virtual_address", &fingerprint_t::section_t::virtual_address)
+    .def_prop_ro("md5",
+        [] (const fingerprint_t::section_t& self) {
+          return nb::to_bytes(self.md5);
+        })
+    .def_prop_ro("sha256",
+        [] (const fingerprint_t::section_t& self) {
+          return nb::to_bytes(self.sha256);
+        })
+    .def_ro("entropy", &fingerprint_t::section_t::entropy);
+
+  fp
+    .def_ro("imphash", &fingerprint_t::imphash)
+    .def_ro("imphash_pefile", &fingerprint_t::imphash_pefile)
+    .def_prop_ro("rich_header_hash",
+        [] (const fingerprint_t& self) {
+          return nb::to_bytes(self.rich_header_hash);
+        })
+    .def_prop_ro("authentihash",
+        [] (const fingerprint_t& self) {
+          nb::dict out;
+          for (const auto& [algo, digest] : self.authentihash) {
+            out[nb::cast(algo)] = nb::to_bytes(digest);
+          }
+          return out;
+        }, "Authentihash for each requested algorithm"_doc)
+    .def_ro("checksum", &fingerprint_t::checksum)
+    .def_ro("sections", &fingerprint_t::sections);
+
+  m.def("fingerprint", &fingerprint,
+      R"delim(
+      Compute, in a single call, the digests commonly used to identify a PE
+      binary (imphash, rich header hash, authentihash, sections hashes,
+      checksum, entropy).
+
+      Contrary to calling the individual functions, the authentihash of all
+      the requested algorithms is computed in one pass over the binary and the
+      independent digests are computed concurrently.
+
+      .. code-block:: python
+
+        opt = lief.PE.fingerprint_options_t()
+        opt.authentihash = [lief.PE.ALGORITHMS.SHA_1, lief.PE.ALGORITHMS.SHA_256]
+        fp = lief.PE.fingerprint(pe, opt)
+        print(fp.imphash, fp.authentihash[lief.PE.ALGORITHMS.SHA_256].hex())
+      )delim"_doc,
+      "binary"_a, "options"_a = fingerprint_options_t());
+
   m.def("check_layout", [] (const Binary& bin) -> std::pair<bool, std::string> {
     std::string error;
     if (!check_layout(bin, &error)) {
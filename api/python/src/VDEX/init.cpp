@@ -17,6 +17,8 @@
 #include "VDEX/init.hpp"
 
 #include <LIEF/VDEX/Parser.hpp>
+#include <LIEF/VDEX/ParserConfig.hpp>
+#include <LIEF/VDEX/VerifierDeps.hpp>
 #include <LIEF/VDEX/File.hpp>
 #include <LIEF/VDEX/Header.hpp>
 
@@ -25,7 +27,9 @@
 namespace LIEF::VDEX::py {
 
 inline void init_objects(nb::module_& m) {
+  CREATE(ParserConfig, m);
   CREATE(Parser, m);
+  CREATE(VerifierDeps, m);
   CREATE(File, m);
   CREATE(Header, m);
 }
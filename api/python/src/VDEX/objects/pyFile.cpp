@@ -22,6 +22,7 @@
 
 #include <sstream>
 #include <nanobind/stl/string.h>
+#include <nanobind/stl/vector.h>
 
 namespace LIEF::VDEX::py {
 template<>
@@ -50,6 +51,13 @@ void create<File>(nb::module_& m) {
         "Return an iterator over " RST_CLASS_REF(lief.DEX.File) ""_doc,
         nb::keep_alive<0, 1>())
 
+    .def_prop_ro("checksums", &File::checksums,
+        "Checksums of the DEX files (as stored in the VDEX file)"_doc)
+
+    .def_prop_ro("verifier_deps", &File::verifier_deps,
+        "Lazy view over the verifier dependencies (" RST_CLASS_REF(lief.VDEX.VerifierDeps) ")"_doc,
+        nb::keep_alive<0, 1>())
+
     .def_prop_ro("dex2dex_json_info", &File::dex2dex_json_info)
 
     LIEF_DEFAULT_STR(File);
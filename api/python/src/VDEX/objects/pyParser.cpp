@@ -34,26 +34,29 @@ template<>
 void create<Parser>(nb::module_& m) {
   using namespace LIEF::py;
 
-  m.def("parse", nb::overload_cast<const std::string&>(&Parser::parse),
+  m.def("parse", nb::overload_cast<const std::string&, const ParserConfig&>(&Parser::parse),
     "Parse the given filename and return a " RST_CLASS_REF(lief.VDEX.File) " object"_doc,
-    "filename"_a, nb::rv_policy::take_ownership);
+    "filename"_a, "config"_a = ParserConfig::default_conf(),
+    nb::rv_policy::take_ownership);
 
   m.def("parse",
-      [] (typing::InputParser obj, const std::string& name) -> std::unique_ptr<File> {
+      [] (typing::InputParser obj, const std::string& name,
+          const ParserConfig& config) -> std::unique_ptr<File>
+      {
         if (auto path_str = path_to_str(obj)) {
-          return Parser::parse(std::move(*path_str));
+          return Parser::parse(std::move(*path_str), config);
         }
 
         if (auto stream = PyIOStream::from_python(obj)) {
           auto ptr = std::make_unique<PyIOStream>(std::move(*stream));
-          return Parser::parse(stream->content(), name);
+          return Parser::parse(stream->content(), name, config);
         }
         logging::log(logging::LEVEL::ERR,
                      "LIEF parser interface does not support Python object: " +
                      type2str(obj));
         return nullptr;
       },
-      "obj"_a, "name"_a = "",
+      "obj"_a, "name"_a = "", "config"_a = ParserConfig::default_conf(),
       nb::rv_policy::take_ownership);
 }
 }
@@ -0,0 +1,65 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <sstream>
+#include <string>
+#include <nanobind/stl/string.h>
+
+#include "LIEF/VDEX/ParserConfig.hpp"
+
+#include "VDEX/pyVDEX.hpp"
+
+namespace LIEF::VDEX::py {
+
+template<>
+void create<ParserConfig>(nb::module_& m) {
+  nb::class_<ParserConfig>(m, "ParserConfig",
+      R"delim(
+      This class is used to tweak the VDEX Parser (:func:`lief.VDEX.parse`).
+
+      For instance, to only access the checksums and the verifier dependencies
+      of a VDEX file:
+
+      .. code-block:: python
+
+        config = lief.VDEX.ParserConfig()
+        config.parse_dex_files = False
+        config.parse_quickening_info = False
+
+        vdex = lief.VDEX.parse("base.vdex", config=config)
+      )delim"_doc)
+
+    .def(nb::init<>())
+    .def_rw("parse_dex_files", &ParserConfig::parse_dex_files,
+            "Parse the DEX files embedded in the VDEX file"_doc)
+
+    .def_rw("parse_verifier_deps", &ParserConfig::parse_verifier_deps,
+            R"doc(
+            Keep the verifier dependencies such as they can be iterated with
+            :attr:`lief.VDEX.File.verifier_deps`. The records are decoded on
+            demand.
+            )doc"_doc)
+
+    .def_rw("parse_quickening_info", &ParserConfig::parse_quickening_info,
+            "Decode the quickening info and attach it to the DEX methods (requires ``parse_dex_files``)"_doc)
+
+    .def_prop_ro_static("default_conf",
+      [] (const nb::object& /* self */) { return ParserConfig::default_conf(); },
+      "Default configuration"_doc)
+
+    LIEF_DEFAULT_STR(ParserConfig);
+}
+
+}
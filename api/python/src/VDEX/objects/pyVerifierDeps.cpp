@@ -0,0 +1,109 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LIEF/VDEX/VerifierDeps.hpp"
+
+#include "VDEX/pyVDEX.hpp"
+#include "pyErr.hpp"
+#include "nanobind/extra/stl/lief_span.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <nanobind/make_iterator.h>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/vector.h>
+
+namespace LIEF::VDEX::py {
+
+template<>
+void create<VerifierDeps>(nb::module_& m) {
+  using record_t = VerifierDeps::record_t;
+
+  nb::class_<VerifierDeps> deps(m, "VerifierDeps",
+    R"delim(
+    Lazy view over the verifier dependencies of a VDEX file
+    (:attr:`lief.VDEX.File.verifier_deps`).
+
+    The records are decoded from the ULEB128 stream while iterating:
+
+    .. code-block:: python
+
+      vdex = lief.VDEX.parse("base.vdex")
+      for record in vdex.verifier_deps.records:
+          if record.kind == lief.VDEX.VerifierDeps.KIND.UNVERIFIED_CLASS:
+              print(record.dex_idx, record.values[0])
+    )delim"_doc);
+
+  nb::enum_<VerifierDeps::KIND>(deps, "KIND")
+    .value("ASSIGNABLE_TYPE", VerifierDeps::KIND::ASSIGNABLE_TYPE)
+    .value("UNASSIGNABLE_TYPE", VerifierDeps::KIND::UNASSIGNABLE_TYPE)
+    .value("CLASS", VerifierDeps::KIND::CLASS)
+    .value("FIELD", VerifierDeps::KIND::FIELD)
+    .value("DIRECT_METHOD", VerifierDeps::KIND::DIRECT_METHOD)
+    .value("VIRTUAL_METHOD", VerifierDeps::KIND::VIRTUAL_METHOD)
+    .value("INTERFACE_METHOD", VerifierDeps::KIND::INTERFACE_METHOD)
+    .value("UNVERIFIED_CLASS", VerifierDeps::KIND::UNVERIFIED_CLASS);
+
+  nb::class_<record_t>(deps, "record_t",
+    R"delim(
+    Record of the verifier dependencies. The meaning of the values depends on
+    its kind:
+
+    - ``ASSIGNABLE_TYPE``, ``UNASSIGNABLE_TYPE``: string index of the
+      destination and string index of the source.
+    - ``CLASS``: type index and access flags.
+    - ``FIELD``, ``*_METHOD``: field/method index, access flags and string
+      index of the declaring class.
+    - ``UNVERIFIED_CLASS``: type index.
+    )delim"_doc)
+    .def_ro("kind", &record_t::kind, "Kind of the record"_doc)
+    .def_ro("dex_idx", &record_t::dex_idx, "Index of the DEX file in the VDEX"_doc)
+    .def_prop_ro("values",
+        [] (const record_t& self) {
+          return std::vector<uint32_t>(self.values.begin(),
+                                       self.values.begin() + self.size());
+        }, "Values of the record"_doc)
+    LIEF_DEFAULT_STR(record_t);
+
+  deps
+    .def_prop_ro("records",
+        [] (const VerifierDeps& self) {
+          VerifierDeps::it_records records = self.records();
+          return nb::make_iterator<nb::rv_policy::copy>(
+              nb::type<VerifierDeps>(), "it_records", records.begin(), records.end());
+        }, nb::keep_alive<0, 1>(),
+        "Iterator over the records of all the DEX files"_doc)
+
+    .def("strings", &VerifierDeps::strings,
+         "Extra strings (i.e. not present in the DEX file) of the DEX file at the given index"_doc,
+         "dex_idx"_a)
+
+    .def_prop_ro("consumed_size",
+        [] (const VerifierDeps& self) {
+          return LIEF::py::error_or(&VerifierDeps::consumed_size, self);
+        },
+        R"delim(
+        Number of bytes of :attr:`~.content` used by the dependencies of all
+        the DEX files or an error if the stream is corrupted
+        )delim"_doc)
+
+    .def_prop_ro("content", &VerifierDeps::content,
+        "Raw content of the verifier dependencies"_doc, nb::keep_alive<0, 1>())
+
+    .def_prop_ro("nb_dex_files", &VerifierDeps::nb_dex_files);
+}
+
+}
@@ -0,0 +1,87 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PY_LIEF_COLUMNS_H
+#define PY_LIEF_COLUMNS_H
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
+
+namespace nb = nanobind;
+
+namespace LIEF::py {
+
+/// Column of a table exported with to_numpy(). The storage is reserved
+/// upfront so that filling the column does not re-allocate.
+template<class T>
+class column_t : public std::vector<T> {
+  public:
+  explicit column_t(size_t capacity) {
+    this->reserve(capacity);
+  }
+};
+
+/// Column of strings which follows Arrow's layout: the strings are
+/// concatenated in a single buffer and the i-th string is located at
+/// `[offsets[i], offsets[i + 1])`
+class string_column_t {
+  public:
+  explicit string_column_t(size_t capacity) {
+    offsets.reserve(capacity + 1);
+    offsets.push_back(0);
+  }
+
+  void push_back(std::string_view str) {
+    data.insert(data.end(), str.begin(), str.end());
+    offsets.push_back((int64_t)data.size());
+  }
+
+  std::vector<int64_t> offsets;
+  std::vector<uint8_t> data;
+};
+
+/// Transfer the ownership of the given values to a 1-D NumPy array (no copy)
+template<class T>
+nb::object to_numpy(std::vector<T>&& values) {
+  using array_t = nb::ndarray<nb::numpy, T, nb::ndim<1>>;
+  auto* storage = new std::vector<T>(std::move(values));
+  // Make sure that the data pointer is valid for empty columns
+  storage->reserve(1);
+
+  nb::capsule owner(storage, [] (void* ptr) noexcept {
+    delete static_cast<std::vector<T>*>(ptr);
+  });
+  return nb::cast(array_t(storage->data(), {storage->size()}, owner));
+}
+
+/// Add the column `name` to the given table
+template<class T>
+void add_column(nb::dict& table, const char* name, std::vector<T>&& values) {
+  table[name] = to_numpy(std::move(values));
+}
+
+/// Add the string column `name` as two arrays: `<name>_offsets` (int64) and
+/// `<name>_data` (uint8)
+inline void add_column(nb::dict& table, const char* name, string_column_t&& column) {
+  const std::string prefix = name;
+  table[(prefix + "_offsets").c_str()] = to_numpy(std::move(column.offsets));
+  table[(prefix + "_data").c_str()] = to_numpy(std::move(column.data));
+}
+
+}
+#endif
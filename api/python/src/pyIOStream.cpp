@@ -74,4 +74,26 @@ PyIOStream::PyIOStream(nb::object io, std::vector<uint8_t> data) :
 
 
 PyIOStream::~PyIOStream() = default;
+
+std::unique_ptr<PyBufferStream> PyBufferStream::from_python(nb::handle object) {
+  Py_buffer view;
+  // PyBUF_SIMPLE: the memory must be contiguous but it can be read-only
+  if (PyObject_GetBuffer(object.ptr(), &view, PyBUF_SIMPLE) != 0) {
+    PyErr_Clear();
+    logging::log(logging::LEVEL::ERR,
+        "Can't access the (contiguous) buffer of: " + type2str(nb::borrow(object)));
+    return nullptr;
+  }
+  return std::unique_ptr<PyBufferStream>(new PyBufferStream(view));
+}
+
+PyBufferStream::PyBufferStream(const Py_buffer& view) :
+  SpanStream(static_cast<const uint8_t*>(view.buf), view.len),
+  view_(view)
+{}
+
+PyBufferStream::~PyBufferStream() {
+  nb::gil_scoped_acquire guard;
+  PyBuffer_Release(&view_);
+}
 }
@@ -16,10 +16,12 @@
 #ifndef LIEF_PY_IO_STREAM_H
 #define LIEF_PY_IO_STREAM_H
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "LIEF/errors.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
 #include "LIEF/BinaryStream/VectorStream.hpp"
 #include "pyLIEF.hpp"
 
@@ -41,6 +43,24 @@ class PyIOStream : public VectorStream {
   PyIOStream(nb::object io, std::vector<uint8_t> data);
   nb::object io_;
 };
+
+/// Stream over the memory of a Python object that implements the buffer
+/// protocol (memoryview, mmap, NumPy arrays, ...). Contrary to PyIOStream,
+/// the content is not copied: the object is kept alive (and its buffer
+/// locked) until the stream is destroyed.
+class PyBufferStream : public SpanStream {
+  public:
+  static std::unique_ptr<PyBufferStream> from_python(nb::handle object);
+
+  PyBufferStream(const PyBufferStream&) = delete;
+  PyBufferStream& operator=(const PyBufferStream&) = delete;
+
+  ~PyBufferStream() override;
+
+  protected:
+  PyBufferStream(const Py_buffer& view);
+  Py_buffer view_;
+};
 }
 
 #endif
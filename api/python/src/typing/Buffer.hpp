@@ -0,0 +1,33 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PY_LIEF_TYPING_BUFFER_H
+#define PY_LIEF_TYPING_BUFFER_H
+#include "typing.hpp"
+
+namespace LIEF::py::typing {
+/// Python object which implements the buffer protocol
+/// (bytes, bytearray, memoryview, mmap, NumPy arrays, ...)
+struct Buffer : public nanobind::object {
+  LIEF_PY_DEFAULT_CTOR(Buffer, nanobind::object);
+
+  NB_OBJECT_DEFAULT(Buffer, object, "collections.abc.Buffer", check)
+
+  static bool check(handle h) {
+    return PyObject_CheckBuffer(h.ptr()) != 0;
+  }
+};
+}
+#endif
@@ -0,0 +1,50 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include <LIEF/LIEF.h>
+
+/* Same as elf_reader.c but with the handle-based API which does not
+ * convert the whole binary into C structures */
+int main(int argc, char **argv) {
+  size_t i, nb_sections, nb_symbols;
+  const char* interpreter;
+  lief_elf_binary_t* elf;
+
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s <elf binary>\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  elf = lief_elf_parse(argv[1]);
+  if (elf == NULL) {
+    return EXIT_FAILURE;
+  }
+
+  interpreter = lief_elf_binary_interpreter(elf);
+  fprintf(stdout, "Interpreter: %s\n", interpreter != NULL ? interpreter : "<none>");
+  fprintf(stdout, "Entrypoint: 0x%" PRIx64 "\n", lief_elf_binary_entrypoint(elf));
+
+  fprintf(stdout, "Sections\n");
+  fprintf(stdout, "========\n");
+  nb_sections = lief_elf_binary_sections_count(elf);
+  for (i = 0; i < nb_sections; ++i) {
+    const lief_elf_section_t* section = lief_elf_binary_section_at(elf, i);
+    fprintf(stdout, "%-20s 0x%010" PRIx64 " 0x%06" PRIx64 "\n",
+            lief_elf_section_name(section),
+            lief_elf_section_virtual_address(section),
+            lief_elf_section_size(section));
+  }
+
+  fprintf(stdout, "Dynamic symbols\n");
+  fprintf(stdout, "===============\n");
+  nb_symbols = lief_elf_binary_dynamic_symbols_count(elf);
+  for (i = 0; i < nb_symbols; ++i) {
+    const lief_elf_symbol_t* symbol = lief_elf_binary_dynamic_symbol_at(elf, i);
+    fprintf(stdout, "%-30s 0x%010" PRIx64 "\n",
+            lief_elf_symbol_name(symbol), lief_elf_symbol_value(symbol));
+  }
+
+  lief_elf_binary_destroy(elf);
+  return EXIT_SUCCESS;
+}
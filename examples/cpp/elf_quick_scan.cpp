@@ -0,0 +1,134 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ftw.h>
+#include <sys/stat.h>
+
+#include <LIEF/ELF.hpp>
+#include <LIEF/BinaryStream/FileStream.hpp>
+#include <LIEF/logging.hpp>
+
+// Inventory the ELF files of a directory (/usr by default) with
+// LIEF::ELF::quick_info and compare with the full parser (--parse).
+//
+// Usage: elf_quick_scan [--parse] [--threads N] [directory]
+
+static std::vector<std::string> FILES;
+
+static int collect(const char* path, const struct stat* st, int type, struct FTW*) {
+  if (type == FTW_F && S_ISREG(st->st_mode) && st->st_size > 0) {
+    FILES.emplace_back(path);
+  }
+  return 0;
+}
+
+struct stats_t {
+  size_t nb_elf = 0;
+  size_t nb_needed = 0;
+  size_t nb_build_id = 0;
+};
+
+static void quick_scan(std::atomic<size_t>& next, stats_t& stats) {
+  // Reused across the files
+  LIEF::ELF::quick_info_t info;
+  for (size_t i = next++; i < FILES.size(); i = next++) {
+    auto stream = LIEF::FileStream::from_file(FILES[i]);
+    if (!stream || !LIEF::ELF::quick_info(*stream, info)) {
+      continue;
+    }
+    ++stats.nb_elf;
+    stats.nb_needed += info.needed.size();
+    stats.nb_build_id += info.build_id.empty() ? 0 : 1;
+  }
+}
+
+static void full_scan(std::atomic<size_t>& next, stats_t& stats) {
+  for (size_t i = next++; i < FILES.size(); i = next++) {
+    if (!LIEF::ELF::is_elf(FILES[i])) {
+      continue;
+    }
+    std::unique_ptr<LIEF::ELF::Binary> elf = LIEF::ELF::Parser::parse(FILES[i]);
+    if (elf == nullptr) {
+      continue;
+    }
+    ++stats.nb_elf;
+    stats.nb_needed += elf->imported_libraries().size();
+    stats.nb_build_id += elf->get(LIEF::ELF::Note::TYPE::GNU_BUILD_ID) != nullptr ? 1 : 0;
+  }
+}
+
+int main(int argc, char** argv) {
+  LIEF::logging::disable();
+
+  std::string directory = "/usr";
+  size_t nb_threads = std::thread::hardware_concurrency();
+  bool parse = false;
+
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--parse") == 0) {
+      parse = true;
+    } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      nb_threads = std::stoul(argv[++i]);
+    } else {
+      directory = argv[i];
+    }
+  }
+  nb_threads = std::max<size_t>(nb_threads, 1);
+
+  if (nftw(directory.c_str(), &collect, 64, FTW_PHYS) != 0) {
+    std::cerr << "Can't walk '" << directory << "'\n";
+    return EXIT_FAILURE;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+
+  std::atomic<size_t> next(0);
+  std::vector<stats_t> stats(nb_threads);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < nb_threads; ++i) {
+    threads.emplace_back(parse ? &full_scan : &quick_scan,
+                         std::ref(next), std::ref(stats[i]));
+  }
+
+  stats_t total;
+  for (size_t i = 0; i < nb_threads; ++i) {
+    threads[i].join();
+    total.nb_elf      += stats[i].nb_elf;
+    total.nb_needed   += stats[i].nb_needed;
+    total.nb_build_id += stats[i].nb_build_id;
+  }
+
+  const auto end = std::chrono::steady_clock::now();
+  const double elapsed = std::chrono::duration<double>(end - start).count();
+
+  std::cout << (parse ? "[ELF::Parser]     " : "[ELF::quick_info] ")
+            << FILES.size() << " files, " << total.nb_elf << " ELF, "
+            << total.nb_needed << " DT_NEEDED, "
+            << total.nb_build_id << " build-id ("
+            << nb_threads << " threads)\n"
+            << "Time: " << elapsed << "s ("
+            << static_cast<size_t>(FILES.size() / elapsed) << " files/s)\n";
+  return EXIT_SUCCESS;
+}
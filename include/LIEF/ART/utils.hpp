@@ -27,8 +27,12 @@
 #include "LIEF/visibility.h"
 
 namespace LIEF {
+class BinaryStream;
 namespace ART {
 
+/// Check if the given stream starts with an ART header
+LIEF_API bool is_art(BinaryStream& stream);
+
 /// Check if the given file is an ART one.
 LIEF_API bool is_art(const std::string& file);
 
@@ -18,6 +18,8 @@
 
 #include <LIEF/Abstract/Binary.hpp>
 #include <LIEF/Abstract/Parser.hpp>
+#include <LIEF/Abstract/ParseCache.hpp>
+#include <LIEF/Abstract/PatchSet.hpp>
 #include <LIEF/Abstract/Relocation.hpp>
 #include <LIEF/Abstract/Function.hpp>
 #include <LIEF/Abstract/Symbol.hpp>
@@ -47,6 +47,7 @@ class Engine;
 /// Abstract binary that exposes an uniform API for the
 /// different executable file formats
 class LIEF_API Binary : public Object {
+  friend class PatchSet;
   public:
 
   /// Type of a virtual address
@@ -376,6 +377,21 @@ class LIEF_API Binary : public Object {
   virtual functions_t  get_abstract_exported_functions() const = 0;
   virtual functions_t  get_abstract_imported_functions() const = 0;
   virtual std::vector<std::string> get_abstract_imported_libraries() const = 0;
+
+  /// Writable content of the segment (or the section for PE) that contains
+  /// the given address
+  struct content_region_t {
+    /// Address of the first byte of the content. It is expressed in the same
+    /// kind of address (RVA or VA) as the address used for the lookup.
+    uint64_t address = 0;
+    span<uint8_t> content;
+  };
+
+  /// Resolve the content in which Binary::patch_address() writes for the
+  /// given address. It is used by PatchSet to share a lookup between the
+  /// patches located in the same segment.
+  virtual result<content_region_t> get_content_region(uint64_t address,
+                                                      VA_TYPES addr_type) = 0;
 };
 
 LIEF_API const char* to_string(Binary::VA_TYPES e);
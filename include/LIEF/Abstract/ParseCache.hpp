@@ -0,0 +1,227 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_ABSTRACT_PARSE_CACHE_H
+#define LIEF_ABSTRACT_PARSE_CACHE_H
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "LIEF/visibility.h"
+#include "LIEF/errors.hpp"
+#include "LIEF/span.hpp"
+#include "LIEF/Abstract/Binary.hpp"
+#include "LIEF/Abstract/Header.hpp"
+
+namespace LIEF {
+
+namespace ELF {
+struct ParserConfig;
+}
+
+namespace PE {
+struct ParserConfig;
+}
+
+namespace MachO {
+struct ParserConfig;
+}
+
+namespace details {
+class MappedFile;
+}
+
+/// On-disk cache of the symbols, relocations, imports and exports of ELF,
+/// PE and Mach-O binaries.
+///
+/// The entries are stored in a directory and are identified by the SHA-256 of
+/// the content of the binary and by the parser configuration. When an entry
+/// exists, the binary is not parsed: the cache file is mapped in memory and
+/// its records are decoded when they are accessed. Otherwise, the binary is
+/// parsed and the entry is written for the next open().
+///
+/// ```cpp
+/// LIEF::ParseCache cache(LIEF::ParseCache::default_dir());
+/// std::unique_ptr<LIEF::ParseCache::Entry> libc = cache.open("/usr/lib/libc.so.6");
+/// for (size_t i = 0; i < libc->nb_exports(); ++i) {
+///   LIEF::ParseCache::export_t exp = libc->export_at(i);
+/// }
+/// ```
+///
+/// The cache only stores a summary of the binary: the full object model
+/// (e.g. LIEF::ELF::Binary) must still be parsed to inspect or modify the
+/// other structures.
+class LIEF_API ParseCache {
+  public:
+  /// Version of the format of the cache entries. The entries written with
+  /// another version are ignored (and overwritten).
+  static constexpr uint32_t VERSION = 2;
+
+  struct symbol_t {
+    std::string_view name;
+    uint64_t value = 0;
+    uint64_t size = 0;
+  };
+
+  struct relocation_t {
+    uint64_t address = 0;
+
+    /// Size of the relocation in bits
+    uint32_t size = 0;
+
+    /// Format-specific type of the relocation (e.g. ELF::Relocation::TYPE)
+    uint32_t type = 0;
+
+    /// Name of the symbol associated with the relocation (if any)
+    std::string_view symbol;
+  };
+
+  /// Symbol imported from a library and the address where it is bound
+  /// (GOT/PLT slot for ELF, RVA of the IAT entry for PE, binding for Mach-O)
+  struct import_t {
+    std::string_view name;
+
+    /// Library from which the symbol is imported. It is empty for ELF
+    /// binaries since the dynamic loader resolves the symbols in the
+    /// global scope.
+    std::string_view library;
+    uint64_t address = 0;
+  };
+
+  struct export_t {
+    std::string_view name;
+    uint64_t address = 0;
+  };
+
+  /// Cached summary of a binary
+  class LIEF_API Entry {
+    public:
+    friend class ParseCache;
+
+    Entry(const Entry&) = delete;
+    Entry& operator=(const Entry&) = delete;
+
+    ~Entry();
+
+    /// True if the entry has been loaded from the cache (i.e. the binary
+    /// has not been parsed)
+    bool from_cache() const {
+      return from_cache_;
+    }
+
+    Binary::FORMATS format() const;
+    Header::ARCHITECTURES architecture() const;
+    uint64_t entrypoint() const;
+    uint64_t imagebase() const;
+    bool is_pie() const;
+
+    size_t nb_symbols() const;
+    size_t nb_relocations() const;
+    size_t nb_imports() const;
+    size_t nb_exports() const;
+    size_t nb_libraries() const;
+
+    /// Symbol at the given index. The index must be lower than nb_symbols()
+    symbol_t symbol_at(size_t idx) const;
+    relocation_t relocation_at(size_t idx) const;
+    import_t import_at(size_t idx) const;
+    export_t export_at(size_t idx) const;
+    std::string_view library_at(size_t idx) const;
+
+    /// Return the exported symbol with the given name
+    result<export_t> find_export(std::string_view name) const;
+
+    /// Return the imported symbol with the given name
+    result<import_t> find_import(std::string_view name) const;
+
+    /// Raw content of the entry as it is stored in the cache
+    span<const uint8_t> raw() const {
+      return raw_;
+    }
+
+    private:
+    LIEF_LOCAL Entry() = default;
+    LIEF_LOCAL std::string_view string(uint32_t offset, uint32_t size) const;
+    template<class T>
+    LIEF_LOCAL T record(size_t table, size_t idx) const;
+
+    span<const uint8_t> raw_;
+    std::unique_ptr<details::MappedFile> mapping_;
+    std::vector<uint8_t> buffer_;
+    bool from_cache_ = false;
+  };
+
+  /// Create a cache that stores its entries in the given directory. The
+  /// directory is created on the first write if it does not exist.
+  ParseCache(std::string dir) :
+    dir_(std::move(dir))
+  {}
+
+  /// Default directory of the cache:
+  ///
+  /// 1. `LIEF_CACHE_DIR` if this environment variable is set
+  /// 2. `${XDG_CACHE_HOME}/lief` (Linux/macOS) or `%LOCALAPPDATA%\lief`
+  ///    (Windows)
+  /// 3. `$HOME/.cache/lief` (Linux/macOS) or `%USERPROFILE%\.lief` (Windows)
+  ///
+  /// An empty string is returned if none of these variables is set.
+  static std::string default_dir();
+
+  /// Directory in which the entries are stored
+  const std::string& directory() const {
+    return dir_;
+  }
+
+  /// Return the cached summary of the binary located at the given path. The
+  /// binary is parsed with the default configuration of its format if the
+  /// cache does not contain an entry for this file.
+  ///
+  /// Return a nullptr if the file can't be read or parsed.
+  std::unique_ptr<Entry> open(const std::string& path) const;
+
+  /// Same as above for an ELF binary parsed with the given configuration
+  std::unique_ptr<Entry> open(const std::string& path,
+                              const ELF::ParserConfig& config) const;
+
+  /// Same as above for a PE binary parsed with the given configuration
+  std::unique_ptr<Entry> open(const std::string& path,
+                              const PE::ParserConfig& config) const;
+
+  /// Same as above for a Mach-O binary parsed with the given configuration.
+  /// For a fat binary, the entry is associated with its last architecture
+  /// (as LIEF::Parser::parse does).
+  std::unique_ptr<Entry> open(const std::string& path,
+                              const MachO::ParserConfig& config) const;
+
+  /// Serialize the summary of an already-parsed binary. The result can be
+  /// read back with from_raw().
+  static std::vector<uint8_t> serialize(const Binary& bin);
+
+  /// Create an entry from a raw buffer created by serialize() or read from
+  /// the cache directory. The buffer is copied.
+  static std::unique_ptr<Entry> from_raw(span<const uint8_t> raw);
+
+  private:
+  template<class Config>
+  LIEF_LOCAL std::unique_ptr<Entry> open_impl(const std::string& path,
+                                              span<const uint8_t> content,
+                                              const Config& config) const;
+  std::string dir_;
+};
+
+}
+#endif
@@ -26,11 +26,46 @@ namespace LIEF {
 class BinaryStream;
 class Binary;
 
+/// File formats that can be identified by LIEF::identify
+enum class FILE_FORMATS {
+  UNKNOWN = 0,
+  ELF,
+  PE,
+  COFF,      ///< COFF object (regular or `/bigobj`)
+  MACHO,
+  MACHO_FAT, ///< Fat (universal) Mach-O
+  OAT,
+  DEX,
+  VDEX,
+  ART,
+};
+
+LIEF_API const char* to_string(FILE_FORMATS e);
+
+/// Identify the format of the given stream.
+///
+/// The identification relies on the checks of each format (ELF::is_elf,
+/// OAT::is_oat, PE::is_pe, MachO::is_macho, ...) which only read the first
+/// bytes of the stream (and a few headers for PE and OAT) so that it can be
+/// used to quickly classify files without parsing them. The position of the
+/// stream is not modified. Only the formats enabled in the build are
+/// identified.
+LIEF_API FILE_FORMATS identify(BinaryStream& stream);
+
+/// Identify the format of the given file.
+LIEF_API FILE_FORMATS identify(const std::string& filename);
+
+/// Identify the format of the given raw data.
+LIEF_API FILE_FORMATS identify(const std::vector<uint8_t>& raw);
+
 /// Main interface to parse an executable regardless of its format
 class LIEF_API Parser {
   public:
   /// Construct an LIEF::Binary from the given filename
   ///
+  /// The file is opened once: its format is identified with LIEF::identify
+  /// and it is only read entirely if the format is supported.
+  ///
   /// @warning If the target file is a FAT Mach-O, it will return the **last** one
   /// @see LIEF::MachO::Parser::parse
   static std::unique_ptr<Binary> parse(const std::string& filename);
@@ -48,6 +83,10 @@ class LIEF_API Parser {
   /// @see LIEF::MachO::Parser::parse
   static std::unique_ptr<Binary> parse(std::unique_ptr<BinaryStream> stream);
 
+  /// Same as above but with a format already identified with LIEF::identify
+  static std::unique_ptr<Binary> parse(std::unique_ptr<BinaryStream> stream,
+                                       FILE_FORMATS format);
+
   protected:
   Parser(const std::string& file);
   uint64_t binary_size_  = 0;
@@ -0,0 +1,160 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_ABSTRACT_PATCH_SET_H
+#define LIEF_ABSTRACT_PATCH_SET_H
+#include <cstdint>
+#include <vector>
+
+#include "LIEF/visibility.h"
+#include "LIEF/errors.hpp"
+#include "LIEF/span.hpp"
+#include "LIEF/Abstract/Binary.hpp"
+
+namespace LIEF {
+
+/// Batch of patches applied on an ELF, PE or Mach-O binary in one go.
+///
+/// Binary::patch_address() resolves the segment (or the section for PE) of
+/// the address and looks up its content on every call. A PatchSet only
+/// records the patches and, when it is applied, sorts them by address so
+/// that the patches located in the same segment share the same lookup.
+///
+/// ```cpp
+/// LIEF::PatchSet patches;
+/// for (uint64_t callsite : callsites) {
+///   patches.add(callsite, {0x90, 0x90, 0x90, 0x90, 0x90});
+/// }
+/// if (!patches.apply(*bin)) {
+///   for (const LIEF::PatchSet::conflict_t& c : patches.conflicts()) { ... }
+/// }
+/// ```
+///
+/// apply() is atomic: the binary is only modified if **all** the patches can
+/// be applied. The bytes overwritten by a successful apply() are saved so
+/// that rollback() can restore them.
+class LIEF_API PatchSet {
+  public:
+  /// Range of addresses written by two patches with different bytes
+  struct conflict_t {
+    uint64_t address = 0;
+    uint64_t size = 0;
+  };
+
+  PatchSet() = default;
+
+  PatchSet(const PatchSet&) = default;
+  PatchSet& operator=(const PatchSet&) = default;
+
+  PatchSet(PatchSet&&) noexcept = default;
+  PatchSet& operator=(PatchSet&&) noexcept = default;
+
+  ~PatchSet() = default;
+
+  /// Record the bytes to write at the given address. The binary is not
+  /// modified until apply() is called.
+  PatchSet& add(uint64_t address, span<const uint8_t> bytes);
+
+  PatchSet& add(uint64_t address, const std::vector<uint8_t>& bytes) {
+    return add(address, span<const uint8_t>(bytes));
+  }
+
+  /// Record an integer of `size` bytes (1, 2, 4 or 8) to write at the given
+  /// address. As for Binary::patch_address(), the value is written with the
+  /// endianness of the host.
+  PatchSet& add(uint64_t address, uint64_t value, size_t size = sizeof(uint64_t));
+
+  /// Number of patches recorded with add()
+  size_t size() const {
+    return patches_.size();
+  }
+
+  bool empty() const {
+    return patches_.empty();
+  }
+
+  /// Remove the recorded patches and the saved bytes
+  void clear();
+
+  /// Apply the recorded patches on the given binary.
+  ///
+  /// Overlapping patches that write the same bytes are merged. Nothing is
+  /// written and an error is returned if:
+  ///
+  /// - Two patches write different bytes at the same address
+  ///   (lief_errors::corrupted, see conflicts())
+  /// - A patch is not fully located in the content of a segment (section for
+  ///   PE) of the binary (lief_errors::not_found, see unresolved())
+  ///
+  /// @param[in] bin        Binary to patch
+  /// @param[in] addr_type  Kind of the addresses as in Binary::patch_address()
+  ok_error_t apply(Binary& bin, Binary::VA_TYPES addr_type = Binary::VA_TYPES::AUTO);
+
+  /// Restore the bytes overwritten by the last successful apply() on the
+  /// given binary. The recorded patches are kept and can be applied again.
+  ok_error_t rollback(Binary& bin);
+
+  /// True if the patches are applied (i.e. rollback() can be called)
+  bool is_applied() const {
+    return applied_;
+  }
+
+  /// Conflicts found by the last apply()
+  const std::vector<conflict_t>& conflicts() const {
+    return conflicts_;
+  }
+
+  /// Addresses of the (merged) patches that can't be resolved by the last
+  /// apply()
+  const std::vector<uint64_t>& unresolved() const {
+    return unresolved_;
+  }
+
+  private:
+  struct patch_t {
+    uint64_t address = 0;
+    /// Offset of the bytes in the associated buffer
+    uint64_t offset = 0;
+    uint64_t size = 0;
+  };
+
+  /// Sort and merge the recorded patches into merged_. The conflicts are
+  /// reported in conflicts_.
+  LIEF_LOCAL std::vector<patch_t> merge();
+
+  /// Resolve the content of the binary that is covered by the given
+  /// (sorted) patches. The patches that can't be resolved are reported in
+  /// unresolved_.
+  LIEF_LOCAL std::vector<span<uint8_t>> resolve(Binary& bin,
+                                                const std::vector<patch_t>& patches);
+
+  /// Bytes of the patches recorded with add()
+  std::vector<uint8_t> data_;
+  std::vector<patch_t> patches_;
+
+  /// Merged patches written by the last apply() and their bytes (merged_)
+  /// along with the original content of the binary (backup_)
+  std::vector<patch_t> written_;
+  std::vector<uint8_t> merged_;
+  std::vector<uint8_t> backup_;
+  Binary::VA_TYPES addr_type_ = Binary::VA_TYPES::AUTO;
+  bool applied_ = false;
+
+  std::vector<conflict_t> conflicts_;
+  std::vector<uint64_t> unresolved_;
+};
+
+}
+#endif
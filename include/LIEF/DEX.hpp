@@ -19,6 +19,7 @@
 
 #if defined(LIEF_DEX_SUPPORT)
 #include "LIEF/DEX/Parser.hpp"
+#include "LIEF/DEX/ParserConfig.hpp"
 #include "LIEF/DEX/utils.hpp"
 #include "LIEF/DEX/File.hpp"
 #include "LIEF/DEX/Class.hpp"
@@ -35,6 +35,10 @@ class Type;
 class Prototype;
 class Field;
 
+namespace details {
+class StringPool;
+}
+
 /// Class that represents a DEX file
 class LIEF_API File : public Object {
   friend class Parser;
@@ -117,6 +121,9 @@ class LIEF_API File : public Object {
   it_fields fields();
 
   /// String pool
+  ///
+  /// The strings are decoded on the first call. This function is
+  /// thread-safe.
   it_const_strings strings() const;
   it_strings strings();
 
@@ -149,6 +156,10 @@ class LIEF_API File : public Object {
 
   void add_class(std::unique_ptr<Class> cls);
 
+  const details::StringPool& string_pool() const {
+    return *string_pool_;
+  }
+
   static void deoptimize_nop(uint8_t* inst_ptr, uint32_t value);
   static void deoptimize_return(uint8_t* inst_ptr, uint32_t value);
   static void deoptimize_invoke_virtual(uint8_t* inst_ptr, uint32_t value, OPCODES new_inst);
@@ -161,13 +172,16 @@ class LIEF_API File : public Object {
   classes_t    classes_;
   methods_t    methods_;
   fields_t     fields_;
-  strings_t    strings_;
+  // Decoded from the string pool on the first call to strings() (guarded by
+  // details::StringPool::strings_once)
+  mutable strings_t strings_;
   types_t      types_;
   prototypes_t prototypes_;
   MapList      map_;
 
   classes_list_t class_list_;
   std::vector<uint8_t> original_data_;
+  std::unique_ptr<details::StringPool> string_pool_;
 };
 
 }
@@ -21,10 +21,12 @@
 
 #include "LIEF/visibility.h"
 #include "LIEF/Object.hpp"
+#include "LIEF/span.hpp"
 
 #include "LIEF/DEX/enums.hpp"
 #include "LIEF/DEX/CodeInfo.hpp"
 #include "LIEF/DEX/deopt.hpp"
+#include "LIEF/DEX/instructions.hpp"
 
 namespace LIEF {
 namespace DEX {
@@ -39,7 +41,7 @@ class LIEF_API Method : public Object {
   using access_flags_list_t = std::vector<ACCESS_FLAGS>;
 
   public:
-  using bytecode_t = std::vector<uint8_t>;
+  using bytecode_t = span<const uint8_t>;
   Method();
   Method(std::string name, Class* parent = nullptr);
 
@@ -60,8 +62,16 @@ class LIEF_API Method : public Object {
   /// Offset to the Dalvik Bytecode
   uint64_t code_offset() const;
 
-  /// Dalvik Bytecode as bytes
-  const bytecode_t& bytecode() const;
+  /// Dalvik Bytecode as bytes. The bytecode is not copied and references
+  /// the content of the DEX::File that owns this method.
+  bytecode_t bytecode() const {
+    return bytecode_;
+  }
+
+  /// Iterator over the decoded instructions of the bytecode
+  it_instructions instructions() const {
+    return DEX::instructions(bytecode_);
+  }
 
   /// Index in the DEX Methods pool
   size_t index() const;
@@ -105,7 +115,7 @@ class LIEF_API Method : public Object {
   bool is_virtual_ = false;
 
   uint64_t code_offset_ = 0;
-  std::vector<uint8_t> bytecode_;
+  bytecode_t bytecode_;
 
   CodeInfo code_info_;
 
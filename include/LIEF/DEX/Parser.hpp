@@ -19,13 +19,14 @@
 #include <memory>
 #include <vector>
 #include <string>
-#include <unordered_map>
 
 #include "LIEF/visibility.h"
+#include "LIEF/span.hpp"
 #include "LIEF/DEX/types.hpp"
+#include "LIEF/DEX/ParserConfig.hpp"
 
 namespace LIEF {
-class VectorStream;
+class SpanStream;
 
 namespace DEX {
 class Class;
@@ -39,8 +40,29 @@ class LIEF_API Parser {
   public:
 
   /// Parse the DEX file from the file path given in parameter
-  static std::unique_ptr<File> parse(const std::string& file);
-  static std::unique_ptr<File> parse(std::vector<uint8_t> data, const std::string& name = "");
+  static std::unique_ptr<File> parse(const std::string& file,
+                                     const ParserConfig& config = ParserConfig::default_conf());
+  static std::unique_ptr<File> parse(std::vector<uint8_t> data, const std::string& name = "",
+                                     const ParserConfig& config = ParserConfig::default_conf());
+
+  /// Parse the DEX file from the given buffer. The buffer is copied once in
+  /// the resulting File.
+  static std::unique_ptr<File> parse(span<const uint8_t> data, const std::string& name = "",
+                                     const ParserConfig& config = ParserConfig::default_conf());
+
+  /// Parse a multi-dex set (e.g. the `classesN.dex` files of an APK or the
+  /// DEX files embedded in a VDEX/OAT container).
+  ///
+  /// The files are parsed concurrently and returned in the order of
+  /// `dex_files`. An entry is a `nullptr` if the corresponding buffer is
+  /// not a valid DEX file.
+  ///
+  /// If `names` is empty, the files are named `classes.dex`, `classes2.dex`,
+  /// ... according to their index.
+  static std::vector<std::unique_ptr<File>>
+    parse_all(const std::vector<span<const uint8_t>>& dex_files,
+              const std::vector<std::string>& names = {},
+              const ParserConfig& config = ParserConfig::default_conf());
 
   Parser& operator=(const Parser& copy) = delete;
   Parser(const Parser& copy)            = delete;
@@ -100,23 +122,45 @@ class LIEF_API Parser {
 
   void resolve_types();
 
+  /// Class associated with the given `type_id`. For an array, this is the
+  /// class of its elements. If the class is not defined in the DEX file,
+  /// an external class is created.
+  Class* resolve_class(uint32_t type_idx);
+
+  /// Return the class with the given name or create an external one
+  Class* get_or_create_class(const std::string& name);
+
+  /// Binary search of the `type_id` associated with the given descriptor
+  uint32_t find_type(const std::string& descriptor) const;
+
+  /// Descriptor (e.g. `Ljava/lang/String;`) of the given `type_id`
+  std::string type_descriptor(uint32_t type_idx) const;
+
   std::unique_ptr<File> file_;
+  ParserConfig config_;
+
+  // string_id of the descriptor of each type_id ('parse_types')
+  std::vector<uint32_t> type_descriptors_;
 
-  // Map of inheritance relationship when parsing classes ('parse_classes')
-  // The key is the parent class name of the value
-  std::unordered_multimap<std::string, Class*> inheritance_;
+  // Class associated with each type_id. The classes defined in the DEX
+  // file are registered in 'parse_classes' while the external ones are
+  // created when resolving the references.
+  std::vector<Class*> type_classes_;
 
-  // Map of method/class relationship when parsing methods ('parse_methods')
-  // The key is the Class name in which the method is defined
-  std::unordered_multimap<std::string, Method*> class_method_map_;
+  // Inheritance relationship when parsing classes ('parse_classes'):
+  // (type_id of the parent class, child)
+  std::vector<std::pair<uint32_t, Class*>> inheritance_;
 
-  // Map of field/class relationship when parsing fields ('parse_fields')
-  // The key is the Class name in which the field is defined
-  std::unordered_multimap<std::string, Field*> class_field_map_;
+  // Method/class relationship when parsing methods ('parse_methods'):
+  // (type_id of the class in which the method is defined, method)
+  std::vector<std::pair<uint32_t, Method*>> class_method_map_;
 
-  std::unordered_multimap<std::string, Type*> class_type_map_;
+  // Field/class relationship when parsing fields ('parse_fields'):
+  // (type_id of the class in which the field is defined, field)
+  std::vector<std::pair<uint32_t, Field*>> class_field_map_;
 
-  std::unique_ptr<VectorStream> stream_;
+  // Stream over File::original_data_
+  std::unique_ptr<SpanStream> stream_;
 };
 
 } // namespace DEX
@@ -0,0 +1,72 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_DEX_PARSER_CONFIG_H
+#define LIEF_DEX_PARSER_CONFIG_H
+#include <string>
+#include <vector>
+#include <ostream>
+#include "LIEF/visibility.h"
+
+namespace LIEF {
+namespace DEX {
+
+/// This structure is used to tweak the DEX Parser (DEX::Parser)
+///
+/// The ID tables (strings, types, prototypes, fields and methods) are always
+/// parsed such as the indexes remain consistent. These options only control
+/// which `class_data_item` are decoded.
+struct LIEF_API ParserConfig {
+  static const ParserConfig& default_conf() {
+    static const ParserConfig DEFAULT;
+    return DEFAULT;
+  }
+
+  /// Only decode the content (fields, methods, code) of the classes whose
+  /// descriptor starts with one of these prefixes (e.g. `Lcom/vendor/sdk/`).
+  /// The Java notation is also accepted (e.g. `com.vendor.sdk.`).
+  ///
+  /// A filter is in the descriptor notation if it starts with `[`, or if it
+  /// starts with `L` and contains a `/` or ends with `;` (e.g. `LMain;`).
+  /// Otherwise it is a Java name: `LegacyApp` matches `LLegacyApp...`.
+  ///
+  /// The other classes are still created but their fields and methods are
+  /// only resolved from the ID tables (no access flags, no code).
+  /// If empty, all the classes are decoded.
+  std::vector<std::string> class_filters;
+
+  /// Decode the fields (access flags) of the classes
+  bool parse_fields = true;
+
+  /// Decode the methods' code items (DEX::CodeInfo and bytecode)
+  bool parse_code = true;
+
+  /// Check if the content of the class with the given descriptor
+  /// (e.g. `Lcom/vendor/sdk/Main;`) should be decoded
+  bool accept_class(const std::string& descriptor) const;
+
+  std::string to_string() const;
+
+  LIEF_API friend
+    std::ostream& operator<<(std::ostream& os, const ParserConfig& config)
+  {
+    os << config.to_string();
+    return os;
+  }
+};
+
+}
+}
+#endif
@@ -17,7 +17,10 @@
 #define LIEF_DEX_INSTRUCTIONS_H
 #include "LIEF/visibility.h"
 #include "LIEF/types.hpp"
+#include "LIEF/span.hpp"
+#include "LIEF/iterators.hpp"
 #include <cstddef>
+#include <iterator>
 
 namespace LIEF {
 namespace DEX {
@@ -349,6 +352,142 @@ LIEF_API bool is_switch_array(const uint8_t* ptr, const uint8_t* end);
 
 LIEF_API size_t switch_array_size(const uint8_t* ptr, const uint8_t* end);
 
+/// Dalvik instruction (or payload) decoded by InstructionIterator.
+///
+/// The operands follow the naming of the Dalvik formats
+/// (e.g. `B|A|op CCCC` for `22t`). The signed operands (literals and branch
+/// offsets) are sign-extended.
+struct LIEF_API Instruction {
+  enum class KIND : uint8_t {
+    /// Regular instruction
+    INSTRUCTION = 0,
+
+    /// `packed-switch-payload` pseudo-instruction
+    PACKED_SWITCH_PAYLOAD,
+
+    /// `sparse-switch-payload` pseudo-instruction
+    SPARSE_SWITCH_PAYLOAD,
+
+    /// `fill-array-data-payload` pseudo-instruction
+    FILL_ARRAY_DATA_PAYLOAD,
+  };
+
+  /// Kind of the instruction
+  KIND kind = KIND::INSTRUCTION;
+
+  /// Offset of the instruction in 16-bit code units (`dex_pc`)
+  uint32_t pc = 0;
+
+  OPCODES opcode = OPCODES::OP_NOP;
+  INST_FORMATS format = INST_FORMATS::F_00x;
+
+  /// Raw encoding of the instruction (including the data of the payloads)
+  span<const uint8_t> raw;
+
+  /// First operand (register, literal, branch offset or argument count)
+  uint32_t vA = 0;
+
+  /// Second operand (register, literal, index or branch offset)
+  uint32_t vB = 0;
+
+  /// Third operand (register, literal, index or branch offset)
+  uint32_t vC = 0;
+
+  /// Prototype index of the `45cc` and `4rcc` formats
+  uint32_t vH = 0;
+
+  /// Wide literal of the `51l`, `31i` and `21h` formats
+  uint64_t vB_wide = 0;
+
+  /// Registers of the `35c`, `35ms`, `35mi` and `45cc` formats. The number
+  /// of registers is given by vA.
+  uint8_t args[5] = {0, 0, 0, 0, 0};
+
+  /// Size of the instruction in bytes
+  size_t size() const {
+    return raw.size();
+  }
+
+  /// True if the instruction is a switch or an array payload
+  bool is_payload() const {
+    return kind != KIND::INSTRUCTION;
+  }
+};
+
+/// Forward iterator over the instructions of a Dalvik bytecode.
+///
+/// The instructions are decoded with lookup tables while iterating and the
+/// switch/array payloads are exposed as pseudo-instructions so that they are
+/// not decoded as regular instructions. The iteration stops on an unknown
+/// opcode or a truncated instruction.
+class LIEF_API InstructionIterator {
+  public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = Instruction;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const Instruction*;
+  using reference = const Instruction&;
+
+  InstructionIterator() = default;
+
+  /// Iterator on the first instruction of the given bytecode
+  InstructionIterator(span<const uint8_t> bytecode) :
+    bytecode_(bytecode)
+  {
+    decode();
+  }
+
+  /// Iterator on the end of the given bytecode
+  static InstructionIterator end(span<const uint8_t> bytecode) {
+    InstructionIterator it;
+    it.bytecode_ = bytecode;
+    it.pos_ = bytecode.size();
+    return it;
+  }
+
+  reference operator*() const {
+    return inst_;
+  }
+
+  pointer operator->() const {
+    return &inst_;
+  }
+
+  InstructionIterator& operator++() {
+    pos_ += inst_.size();
+    decode();
+    return *this;
+  }
+
+  InstructionIterator operator++(int) {
+    InstructionIterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  friend bool operator==(const InstructionIterator& lhs, const InstructionIterator& rhs) {
+    return lhs.bytecode_.data() == rhs.bytecode_.data() && lhs.pos_ == rhs.pos_;
+  }
+
+  friend bool operator!=(const InstructionIterator& lhs, const InstructionIterator& rhs) {
+    return !(lhs == rhs);
+  }
+
+  private:
+  void decode();
+
+  span<const uint8_t> bytecode_;
+  size_t pos_ = 0;
+  Instruction inst_;
+};
+
+using it_instructions = iterator_range<InstructionIterator>;
+
+/// Iterate over the instructions of the given Dalvik bytecode
+inline it_instructions instructions(span<const uint8_t> bytecode) {
+  return {InstructionIterator(bytecode), InstructionIterator::end(bytecode)};
+}
+
 } // Namespace LIEF
 } // Namespace DEX
 
@@ -28,6 +28,9 @@ namespace LIEF {
 class BinaryStream;
 namespace DEX {
 
+/// Check if the given stream starts with a DEX header
+LIEF_API bool is_dex(BinaryStream& stream);
+
 /// Check if the given file is a DEX.
 LIEF_API bool is_dex(const std::string& file);
 
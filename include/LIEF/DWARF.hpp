@@ -25,5 +25,6 @@
 #include "LIEF/DWARF/Type.hpp"
 #include "LIEF/DWARF/types.hpp"
 #include "LIEF/DWARF/Parameter.hpp"
+#include "LIEF/DWARF/AddressIndex.hpp"
 
 #endif
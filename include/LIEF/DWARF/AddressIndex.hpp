@@ -0,0 +1,149 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_DWARF_ADDRESS_INDEX_H
+#define LIEF_DWARF_ADDRESS_INDEX_H
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "LIEF/visibility.h"
+#include "LIEF/errors.hpp"
+
+namespace LIEF {
+class Binary;
+
+namespace dwarf {
+
+namespace details {
+class AddressIndex;
+}
+
+/// Address-indexed view over the DWARF information of an ELF, PE or Mach-O
+/// binary.
+///
+/// Contrary to DebugInfo, this index does not build the tree of DIEs. It
+/// only resolves an address into the function (`DW_TAG_subprogram`) and the
+/// source location (`.debug_line`) that contain it:
+///
+/// - At creation, it builds a sorted table of the address ranges covered by
+///   the compilation units from `.debug_aranges` or, for the units that are
+///   not described in this section, from the `DW_AT_low_pc/high_pc/ranges`
+///   of the unit DIE.
+/// - The subprograms and the line program of a compilation unit are decoded
+///   on the first lookup that hits this unit.
+///
+/// Strings (function names) are not copied until they are returned by
+/// find_function(), therefore the index references the content of the
+/// binary which must outlive the index (unless the index has been created
+/// with parse()).
+///
+/// Lookups are thread-safe.
+///
+/// DWARF 2 to 5 are supported (including DWARF64 and split DWARF skeleton
+/// units) but compressed debug sections (`SHF_COMPRESSED`) and supplementary
+/// object files (`.gnu_debugaltlink`) are not.
+class LIEF_API AddressIndex {
+  public:
+  struct config_t {
+    /// Decode the subprograms of all the compilation units when creating the
+    /// index (using several threads) instead of decoding them lazily.
+    bool eager = false;
+
+    /// If not empty, path of an on-disk cache for the index. The index is
+    /// loaded from this file if it matches the binary, otherwise the index is
+    /// built and saved in this file.
+    ///
+    /// The binary is identified by its build-id (ELF), `LC_UUID` (Mach-O) or
+    /// PDB GUID (PE) along with the sizes of the DWARF sections. If the binary
+    /// does not embed such an identifier, the SHA-256 of the DWARF sections
+    /// is used instead.
+    std::string cache_path;
+  };
+
+  /// Function (`DW_TAG_subprogram`) that contains a given address
+  struct function_t {
+    std::string name;
+    std::string linkage_name;
+
+    /// Start address of the range of the function that contains the address.
+    /// A function can be split into several ranges (e.g. hot/cold splitting).
+    uint64_t address = 0;
+
+    /// Size of this range
+    uint64_t size = 0;
+  };
+
+  /// Source location associated with a given address
+  struct line_t {
+    /// Address of the line table entry that covers the address
+    uint64_t address = 0;
+    std::string file;
+    uint32_t line = 0;
+    uint32_t column = 0;
+  };
+
+  /// Create an index over the DWARF sections of the given binary.
+  ///
+  /// Return a nullptr if the binary does not embed DWARF information.
+  static std::unique_ptr<AddressIndex> from_binary(const Binary& bin,
+                                                   const config_t& config);
+
+  static std::unique_ptr<AddressIndex> from_binary(const Binary& bin);
+
+  /// Parse the binary located at the given path and index its DWARF
+  /// information. The index owns the binary.
+  static std::unique_ptr<AddressIndex> parse(const std::string& path,
+                                             const config_t& config);
+
+  static std::unique_ptr<AddressIndex> parse(const std::string& path);
+
+  AddressIndex(const AddressIndex&) = delete;
+  AddressIndex& operator=(const AddressIndex&) = delete;
+
+  ~AddressIndex();
+
+  /// Return the function that contains the given address
+  result<function_t> find_function(uint64_t address) const;
+
+  /// Return the source location of the given address
+  result<line_t> line_for(uint64_t address) const;
+
+  /// Serialize the index (the ranges of the compilation units and the
+  /// subprograms that have been decoded) in the given file
+  ok_error_t save(const std::string& path) const;
+
+  /// Number of compilation units
+  size_t nb_units() const;
+
+  /// Number of address ranges in the table of the compilation units
+  size_t nb_ranges() const;
+
+  /// True if the ranges of the units come from `.debug_aranges`
+  bool has_aranges() const;
+
+  /// True if the index has been loaded from the on-disk cache
+  bool from_cache() const;
+
+  private:
+  LIEF_LOCAL AddressIndex(std::unique_ptr<details::AddressIndex> impl);
+
+  std::unique_ptr<details::AddressIndex> impl_;
+  std::unique_ptr<Binary> owned_;
+};
+
+}
+}
+#endif
@@ -20,6 +20,7 @@
 #if defined(LIEF_ELF_SUPPORT)
 #include "LIEF/ELF/hash.hpp"
 #include "LIEF/ELF/utils.hpp"
+#include "LIEF/ELF/quick_info.hpp"
 #include "LIEF/ELF/enums.hpp"
 
 #include "LIEF/ELF/Parser.hpp"
@@ -28,6 +29,7 @@
 #include "LIEF/ELF/Binary.hpp"
 #include "LIEF/ELF/Segment.hpp"
 #include "LIEF/ELF/Builder.hpp"
+#include "LIEF/ELF/CoreReader.hpp"
 #include "LIEF/ELF/EnumToString.hpp"
 #include "LIEF/ELF/Relocation.hpp"
 #include "LIEF/ELF/DynamicEntryArray.hpp"
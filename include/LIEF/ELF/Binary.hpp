@@ -54,6 +54,7 @@ class SymbolVersionRequirement;
 class DynamicEntryLibrary;
 class SysvHash;
 struct sizing_info_t;
+struct compact_relocations_t;
 
 /// Class which represents an ELF binary
 class LIEF_API Binary : public LIEF::Binary {
@@ -400,13 +401,8 @@ class LIEF_API Binary : public LIEF::Binary {
   it_const_object_relocations object_relocations() const;
 
   /// Return **all** relocations present in the binary
-  it_relocations relocations() {
-    return relocations_;
-  }
-
-  it_const_relocations relocations() const {
-    return relocations_;
-  }
+  it_relocations relocations();
+  it_const_relocations relocations() const;
 
   /// Return relocation associated with the given address.
   /// It returns a ``nullptr`` if it is not found
@@ -1045,6 +1041,8 @@ class LIEF_API Binary : public LIEF::Binary {
   LIEF_LOCAL std::vector<std::string> get_abstract_imported_libraries() const override;
   LIEF_LOCAL LIEF::Binary::symbols_t     get_abstract_symbols() override;
   LIEF_LOCAL LIEF::Binary::relocations_t get_abstract_relocations() override;
+  LIEF_LOCAL result<LIEF::Binary::content_region_t>
+    get_content_region(uint64_t address, LIEF::Binary::VA_TYPES addr_type) override;
 
   template<ELF::ARCH ARCH>
   LIEF_LOCAL void patch_relocations(uint64_t from, uint64_t shift);
@@ -1081,6 +1079,11 @@ class LIEF_API Binary : public LIEF::Binary {
 
   std::vector<Symbol*> symtab_dyn_symbols() const;
 
+  /// Convert the relocations stored in compact_relocations_ into
+  /// Relocation objects (no-op if they are already materialized).
+  /// This function is thread-safe.
+  LIEF_LOCAL void materialize_relocations() const;
+
   LIEF_LOCAL std::string shstrtab_name() const;
   LIEF_LOCAL Section* add_frame_section(const Section& sec);
 
@@ -1093,7 +1096,7 @@ class LIEF_API Binary : public LIEF::Binary {
   dynamic_entries_t dynamic_entries_;
   symbols_t dynamic_symbols_;
   symbols_t symtab_symbols_;
-  relocations_t relocations_;
+  mutable relocations_t relocations_;
   symbols_version_t symbol_version_table_;
   symbols_version_requirement_t symbol_version_requirements_;
   symbols_version_definition_t  symbol_version_definition_;
@@ -1106,6 +1109,7 @@ class LIEF_API Binary : public LIEF::Binary {
   std::string interpreter_;
   std::vector<uint8_t> overlay_;
   std::unique_ptr<sizing_info_t> sizing_info_;
+  mutable std::unique_ptr<compact_relocations_t> compact_relocations_;
 };
 
 }
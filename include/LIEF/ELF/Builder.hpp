@@ -73,6 +73,14 @@ class LIEF_API Builder {
     bool symtab          = true;  /// Rebuild DT_SYMTAB
     bool coredump_notes  = true;  /// Rebuild the Coredump notes
     bool force_relocate  = false; /// Force to relocating all the ELF structures that are supported by LIEF (mostly for testing)
+
+    /// Number of bloom filter words of the rebuilt DT_GNU_HASH (rounded up to a power of 2).
+    /// 0 keeps the value of the original table
+    uint32_t gnu_hash_maskwords = 0;
+
+    /// Bloom filter shift of the rebuilt DT_GNU_HASH. It must be lower than 32
+    /// (the size of the hash values). 0 keeps the value of the original table
+    uint32_t gnu_hash_shift2 = 0;
   };
 
   Builder(Binary& binary);
@@ -0,0 +1,149 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_ELF_CORE_READER_H
+#define LIEF_ELF_CORE_READER_H
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "LIEF/visibility.h"
+#include "LIEF/errors.hpp"
+#include "LIEF/iterators.hpp"
+#include "LIEF/span.hpp"
+
+#include "LIEF/ELF/Header.hpp"
+
+namespace LIEF {
+class BinaryStream;
+
+namespace ELF {
+class Segment;
+class Note;
+class CorePrStatus;
+class CorePrPsInfo;
+class CoreFile;
+class CoreAuxv;
+class CoreSigInfo;
+
+/// Streaming reader for ELF core files.
+///
+/// Core files can be tens of gigabytes large while the information needed
+/// for triaging a crash (threads, registers, mapped files, ...) is located in
+/// the `PT_NOTE` segments. Contrary to ELF::Parser, this reader only parses
+/// the ELF header, the program headers and the notes. The content of the
+/// `PT_LOAD` segments (the memory image of the process) is never loaded:
+/// it is read on demand from the file with read_memory().
+///
+/// Since the file is accessed lazily, the reader keeps the underlying stream
+/// open for its whole lifetime. read_memory() is not thread-safe.
+class LIEF_API CoreReader {
+  public:
+  using segments_t = std::vector<std::unique_ptr<Segment>>;
+  using it_const_segments = const_ref_iterator<const segments_t&, const Segment*>;
+
+  using notes_t = std::vector<std::unique_ptr<Note>>;
+  using it_const_notes = const_ref_iterator<const notes_t&, const Note*>;
+
+  /// Open the core file located at the given path
+  static std::unique_ptr<CoreReader> parse(const std::string& file);
+
+  /// Read the core file from the given stream
+  static std::unique_ptr<CoreReader> parse(std::unique_ptr<BinaryStream> stream);
+
+  CoreReader(const CoreReader&) = delete;
+  CoreReader& operator=(const CoreReader&) = delete;
+
+  ~CoreReader();
+
+  /// ELF header of the core file
+  const Header& header() const {
+    return header_;
+  }
+
+  /// Program headers of the core file. The segments are not bound to any
+  /// content: use read_memory() to access the memory they describe.
+  it_const_segments segments() const {
+    return segments_;
+  }
+
+  /// Notes from all the `PT_NOTE` segments
+  it_const_notes notes() const {
+    return notes_;
+  }
+
+  /// Status of the threads (`NT_PRSTATUS`) in the order of the notes
+  std::vector<const CorePrStatus*> threads() const;
+
+  /// Process information (`NT_PRPSINFO`) or a nullptr if not present
+  const CorePrPsInfo* process_info() const;
+
+  /// Files mapped in the process (`NT_FILE`) or a nullptr if not present
+  const CoreFile* mapped_files() const;
+
+  /// Auxiliary vector (`NT_AUXV`) or a nullptr if not present
+  const CoreAuxv* auxv() const;
+
+  /// Signal information (`NT_SIGINFO`) or a nullptr if not present
+  const CoreSigInfo* siginfo() const;
+
+  /// Return the `PT_LOAD` segment that contains the given virtual address
+  /// or a nullptr if the address is not mapped in the core
+  const Segment* segment_from_virtual_address(uint64_t va) const;
+
+  /// Read `size` bytes of the process memory at the virtual address `va`.
+  ///
+  /// The range can span several contiguous `PT_LOAD` segments. Bytes that
+  /// are mapped but not present in the file (`p_filesz < p_memsz`) are read
+  /// as zeros. An error is returned if a part of the range is not mapped.
+  result<std::vector<uint8_t>> read_memory(uint64_t va, uint64_t size) const;
+
+  /// Same as read_memory() but read into the provided buffer
+  ok_error_t read_memory(uint64_t va, span<uint8_t> buffer) const;
+
+  /// Total size of the memory image described by the `PT_LOAD` segments
+  uint64_t memory_size() const;
+
+  private:
+  /// Entry of the index used to resolve a virtual address into a `PT_LOAD`
+  /// segment
+  struct memory_range_t {
+    uint64_t start = 0;
+    uint64_t end = 0;
+    const Segment* segment = nullptr;
+  };
+
+  CoreReader(std::unique_ptr<BinaryStream> stream);
+
+  template<class ELF_T>
+  LIEF_LOCAL ok_error_t parse_headers();
+
+  LIEF_LOCAL ok_error_t parse_notes(const Segment& segment);
+
+  LIEF_LOCAL const memory_range_t* find_range(uint64_t va) const;
+
+  template<class T>
+  LIEF_LOCAL const T* find_note() const;
+
+  std::unique_ptr<BinaryStream> stream_;
+  Header header_;
+  segments_t segments_;
+  notes_t notes_;
+  std::vector<memory_range_t> memory_index_;
+};
+
+}
+}
+#endif
@@ -34,6 +34,7 @@ class Parser;
 /// ELF `Elfxx_Ehdr` structure
 class LIEF_API Header : public Object {
   friend class Parser;
+  friend class CoreReader;
   public:
   using identity_t = std::array<uint8_t, 16>;
 
@@ -16,6 +16,8 @@
 #ifndef LIEF_ELF_PARSER_H
 #define LIEF_ELF_PARSER_H
 #include <unordered_map>
+#include <memory>
+#include <vector>
 
 #include "LIEF/visibility.h"
 #include "LIEF/utils.hpp"
@@ -203,11 +205,22 @@ class LIEF_API Parser : public LIEF::Parser {
   template<typename ELF_T>
   LIEF_LOCAL ok_error_t process_dynamic_table();
 
+  /// Parse the relocations of all the SHT_REL/SHT_RELA sections.
+  ///
+  /// Sections are decoded concurrently and merged in the order of the
+  /// section table.
+  template<typename ELF_T>
+  LIEF_LOCAL ok_error_t parse_sections_relocations();
+
   /// Parse relocations using LIEF::ELF::Section.
   /// Section relocations are usually found in object files
+  ///
+  /// This function does not modify the binary and can be called concurrently
+  /// for different sections. The relocations are appended to @p relocations.
   template<typename ELF_T, typename REL_T>
   LIEF_LOCAL ok_error_t
-    parse_section_relocations(const Section& section);
+    parse_section_relocations(const Section& section, span<const uint8_t> content,
+                              std::vector<std::unique_ptr<Relocation>>& relocations) const;
 
   /// Parse SymbolVersionRequirement
   ///
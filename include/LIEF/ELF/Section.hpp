@@ -34,6 +34,7 @@ namespace ELF {
 
 namespace DataHandler {
 class Handler;
+class Node;
 }
 
 class Segment;
@@ -379,6 +380,7 @@ class LIEF_API Section : public LIEF::Section {
   segments_t segments_;
   bool is_frame_ = false;
   DataHandler::Handler* datahandler_ = nullptr;
+  DataHandler::Node* node_ = nullptr; // Owned by datahandler_
   std::vector<uint8_t> content_c_;
 };
 
@@ -37,6 +37,7 @@ class SpanStream;
 namespace ELF {
 namespace DataHandler {
 class Handler;
+class Node;
 }
 
 class Parser;
@@ -48,6 +49,7 @@ class Builder;
 class LIEF_API Segment : public Object {
 
   friend class Parser;
+  friend class CoreReader;
   friend class Section;
   friend class Binary;
   friend class Builder;
@@ -314,6 +316,7 @@ class LIEF_API Segment : public Object {
   uint64_t handler_size_ = 0;
   sections_t sections_;
   DataHandler::Handler* datahandler_ = nullptr;
+  DataHandler::Node* node_ = nullptr; // Owned by datahandler_
   std::vector<uint8_t>  content_c_;
 };
 
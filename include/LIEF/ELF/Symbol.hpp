@@ -23,6 +23,7 @@
 #include "LIEF/visibility.h"
 #include "LIEF/Abstract/Symbol.hpp"
 #include "LIEF/ELF/enums.hpp"
+#include "LIEF/ELF/Header.hpp"
 
 namespace LIEF {
 namespace ELF {
@@ -194,6 +195,35 @@ class LIEF_API Symbol : public LIEF::Symbol {
   /// Symbol's unmangled name. If not available, it returns an empty string
   std::string demangled_name() const;
 
+  using LIEF::Symbol::name;
+
+  /// Mutable reference to the symbol's name.
+  ///
+  /// Since the name can be modified through this reference at any time,
+  /// the hashes of this symbol are no longer cached once it has been
+  /// returned (see gnu_hash()). Prefer the setter to change the name.
+  std::string& name() override {
+    hash_flags_ = NAME_EXPOSED;
+    return name_;
+  }
+
+  void name(std::string name) override {
+    hash_flags_ &= NAME_EXPOSED;
+    name_ = std::move(name);
+  }
+
+  /// GNU hash (`DT_GNU_HASH`) of the symbol's name.
+  ///
+  /// The value is computed on the first call and cached until the name
+  /// is changed with the setter. It is not cached if a mutable reference on
+  /// the name has been returned.
+  uint32_t gnu_hash() const;
+
+  /// SYSV hash (`DT_HASH`) of the symbol's name for the given ELF class.
+  ///
+  /// The value is cached as for gnu_hash()
+  uint32_t sysv_hash(Header::CLASS cls) const;
+
   void type(TYPE type) {
     type_ = type;
   }
@@ -266,6 +296,16 @@ class LIEF_API Symbol : public LIEF::Symbol {
   Section* section_ = nullptr;
   SymbolVersion* symbol_version_ = nullptr;
   ARCH arch_ = ARCH::NONE;
+
+  enum HASH_FLAGS : uint8_t {
+    HAS_GNU_HASH  = 1 << 0,
+    HAS_SYSV_HASH = 1 << 1,
+    SYSV_HASH_64  = 1 << 2,
+    NAME_EXPOSED  = 1 << 3, // The hashes can't be cached (see name())
+  };
+  mutable uint32_t gnu_hash_  = 0;
+  mutable uint32_t sysv_hash_ = 0;
+  mutable uint8_t  hash_flags_ = 0;
 };
 
 LIEF_API const char* to_string(Symbol::BINDING binding);
@@ -0,0 +1,112 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_ELF_QUICK_INFO_H
+#define LIEF_ELF_QUICK_INFO_H
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "LIEF/errors.hpp"
+#include "LIEF/visibility.h"
+#include "LIEF/ELF/enums.hpp"
+#include "LIEF/ELF/Header.hpp"
+
+namespace LIEF {
+class BinaryStream;
+
+namespace ELF {
+
+/// Information decoded by LIEF::ELF::quick_info
+struct LIEF_API quick_info_t {
+  /// Raw `GNU_PROPERTY_*` entry of the `NT_GNU_PROPERTY_TYPE_0` note
+  struct LIEF_API property_t {
+    /// Raw type (e.g. `GNU_PROPERTY_X86_FEATURE_1_AND = 0xc0000002`)
+    uint32_t type = 0;
+
+    /// Value of the property if it is 4 or 8 bytes wide (which is the case
+    /// for the `*_AND`, `*_OR` and `STACK_SIZE` properties), 0 otherwise
+    uint64_t value = 0;
+  };
+
+  Header::CLASS cls = Header::CLASS::NONE;
+  Header::ELF_DATA endianness = Header::ELF_DATA::NONE;
+  Header::FILE_TYPE file_type = Header::FILE_TYPE::NONE;
+  ARCH machine = ARCH::NONE;
+  uint64_t entrypoint = 0;
+
+  /// Path of the interpreter (`PT_INTERP`)
+  std::string interpreter;
+
+  /// `DT_SONAME`
+  std::string soname;
+
+  /// `DT_RPATH`
+  std::string rpath;
+
+  /// `DT_RUNPATH`
+  std::string runpath;
+
+  /// `DT_NEEDED` entries in the order of the dynamic table
+  std::vector<std::string> needed;
+
+  /// Content of the `NT_GNU_BUILD_ID` note
+  std::vector<uint8_t> build_id;
+
+  /// Entries of the `NT_GNU_PROPERTY_TYPE_0` note
+  std::vector<property_t> properties;
+
+  /// True if the binary has a `PT_DYNAMIC` segment
+  bool has_dynamic = false;
+
+  /// Reset the information while keeping the capacity of the containers so
+  /// that the same object can be reused to scan several files
+  void clear();
+};
+
+/// Decode, from the program headers, the dynamic segment and the notes, the
+/// information commonly used to inventory ELF files: architecture, type,
+/// interpreter, `DT_NEEDED`, `DT_SONAME`, `DT_RPATH/DT_RUNPATH`, build-id and
+/// GNU properties.
+///
+/// Contrary to LIEF::ELF::Parser, this function does not create a Binary
+/// (nor its sections, segments, ...) and it only reads the bytes of the
+/// structures above. Therefore, it can be used on a FileStream to scan a
+/// large number of files without loading them.
+///
+/// The section table is not used: the information of binaries whose program
+/// headers are corrupted may be incomplete.
+///
+/// \code{.cpp}
+/// ELF::quick_info_t info;
+/// for (const std::string& path : paths) {
+///   auto stream = FileStream::from_file(path);
+///   if (stream && ELF::quick_info(*stream, info)) {
+///     std::cout << path << ": " << info.soname << '\n';
+///   }
+/// }
+/// \endcode
+LIEF_API ok_error_t quick_info(BinaryStream& stream, quick_info_t& info);
+
+/// Same as above but returning a new quick_info_t
+LIEF_API result<quick_info_t> quick_info(BinaryStream& stream);
+
+/// Same as above for the file located at the given path. Only the structures
+/// mentioned above are read from the file.
+LIEF_API result<quick_info_t> quick_info(const std::string& path);
+
+}
+}
+#endif
@@ -999,6 +999,8 @@ class LIEF_API Binary : public LIEF::Binary  {
   LIEF_LOCAL LIEF::Binary::functions_t get_abstract_exported_functions() const override;
   LIEF_LOCAL LIEF::Binary::functions_t get_abstract_imported_functions() const override;
   LIEF_LOCAL std::vector<std::string> get_abstract_imported_libraries() const override;
+  LIEF_LOCAL result<LIEF::Binary::content_region_t>
+    get_content_region(uint64_t address, LIEF::Binary::VA_TYPES addr_type) override;
 
   /// Check that a gap between the load command table and
   /// the first section is at least \p size bytes.
@@ -41,6 +41,9 @@ LIEF_API bool is_macho(const std::vector<uint8_t>& raw);
 /// Check if the given file is a FAT Mach-O
 LIEF_API bool is_fat(const std::string& file);
 
+/// Check if the given stream starts with a FAT Mach-O header
+LIEF_API bool is_fat(BinaryStream& stream);
+
 /// Check if the given Mach-O is 64-bits
 LIEF_API bool is_64(const std::string& file);
 
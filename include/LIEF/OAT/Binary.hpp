@@ -19,6 +19,7 @@
 
 #include "LIEF/visibility.h"
 
+#include "LIEF/span.hpp"
 #include "LIEF/ELF/Binary.hpp"
 #include "LIEF/OAT/Header.hpp"
 #include "LIEF/DEX/deopt.hpp"
@@ -78,6 +79,14 @@ class LIEF_API Binary : public ELF::Binary {
   it_const_oat_dex_files oat_dex_files() const;
 
   /// Iterator over LIEF::OAT::Class
+  ///
+  /// The OAT classes are decoded on demand: the first call to this function
+  /// decodes all the classes (and their methods) that have not already been
+  /// decoded by get_class() or get_method().
+  ///
+  /// The on-demand decoding is thread-safe: the const functions of this
+  /// class can be called concurrently. Modifying the classes or the methods
+  /// while other threads access them is not.
   it_const_classes classes() const;
   it_classes classes();
 
@@ -87,6 +96,9 @@ class LIEF_API Binary : public ELF::Binary {
 
   /// Return the LIEF::OAT::Class with the given name or
   /// a nullptr if the class can't be found
+  ///
+  /// If the class is not already decoded, it is resolved with the type lookup
+  /// table of the OAT DEX files and only this class is decoded.
   const Class* get_class(const std::string& class_name) const;
 
   Class* get_class(const std::string& class_name);
@@ -101,6 +113,15 @@ class LIEF_API Binary : public ELF::Binary {
   it_const_methods methods() const;
   it_methods methods();
 
+  /// Return the compiled LIEF::OAT::Method with the given name in the given
+  /// class or a nullptr if it can't be found.
+  ///
+  /// Only the class of the method is decoded (c.f. get_class())
+  const Method* get_method(const std::string& class_name,
+                           const std::string& method_name) const;
+
+  Method* get_method(const std::string& class_name, const std::string& method_name);
+
   dex2dex_info_t dex2dex_info() const;
 
   std::string dex2dex_json_info();
@@ -120,16 +141,34 @@ class LIEF_API Binary : public ELF::Binary {
   LIEF_API friend std::ostream& operator<<(std::ostream& os, const Binary& binary);
 
   private:
+  struct classes_state_t;
+
   Binary();
-  void add_class(std::unique_ptr<Class> cls);
+
+  /// Content of the `oatdata` and `oatexec` regions
+  span<const uint8_t> oat_image() const;
+
+  const DEX::Class* lookup_class(const DexFile& oat_dex_file,
+                                 const std::string& descriptor) const;
+  Class* decode_class(const DexFile& oat_dex_file, const DEX::Class& cls) const;
+  void decode_classes() const;
 
   Header header_;
-  methods_t methods_;
   dex_files_t dex_files_;
   oat_dex_files_t oat_dex_files_;
 
-  classes_t classes_;
-  classes_list_t classes_list_;
+  // The classes and the methods are decoded on demand. The decoding is
+  // serialized by classes_state_
+  mutable methods_t methods_;
+  mutable classes_t classes_;
+  mutable classes_list_t classes_list_;
+
+  bool lazy_classes_ = false;
+  std::unique_ptr<classes_state_t> classes_state_;
+
+  // Copy of the `oatdata` and `oatexec` regions used to decode the classes
+  // (independent of the modifications on the ELF's content)
+  std::vector<uint8_t> oat_image_;
 
   // For OAT > 79
   std::unique_ptr<VDEX::File> vdex_;
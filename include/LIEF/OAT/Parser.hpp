@@ -36,6 +36,7 @@ class Class;
 
 /// Class to parse an OAT file to produce an OAT::Binary
 class LIEF_API Parser : public ELF::Parser {
+  friend class Binary;
   public:
   /// Parse an OAT file
   static std::unique_ptr<Binary> parse(const std::string& oat_file);
@@ -64,6 +65,8 @@ class LIEF_API Parser : public ELF::Parser {
   template<typename OAT_T>
   void parse_binary();
 
+  void parse_oat_image();
+
   template<typename OAT_T>
   void parse_header();
 
@@ -79,8 +82,19 @@ class LIEF_API Parser : public ELF::Parser {
   template<typename OAT_T>
   void parse_oat_classes();
 
+  /// Decode the OAT class located at the given offset of the OAT image.
+  /// This function is used by OAT::Binary to decode the classes on demand.
+  static std::unique_ptr<Class> parse_oat_class(const Binary& oat, const DEX::Class& dex_class,
+                                                uint32_t offset);
+
+  template<typename OAT_T>
+  static std::unique_ptr<Class> parse_oat_class(const Binary& oat, const DEX::Class& dex_class,
+                                                uint32_t offset);
+
   template<typename OAT_T>
-  void parse_oat_methods(uint64_t methods_offsets, Class& clazz, const DEX::Class& dex_class);
+  static void parse_oat_methods(const Binary& oat, BinaryStream& stream,
+                                uint64_t methods_offsets, Class& clazz,
+                                const DEX::Class& dex_class);
 
   void init();
 
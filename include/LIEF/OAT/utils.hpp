@@ -26,6 +26,7 @@
 #include "LIEF/platforms/android.hpp"
 
 namespace LIEF {
+class BinaryStream;
 namespace ELF {
 class Binary;
 }
@@ -40,6 +41,13 @@ LIEF_API bool is_oat(const std::string& file);
 /// Check if the given raw data is an OAT one.
 LIEF_API bool is_oat(const std::vector<uint8_t>& raw);
 
+/// Check if the given stream is an OAT one.
+///
+/// Contrary to is_oat(const LIEF::ELF::Binary&), this function does not parse
+/// the ELF file: it only reads the section headers, the dynamic symbols and
+/// the OAT magic.
+LIEF_API bool is_oat(BinaryStream& stream);
+
 /// Return the OAT version of the given file
 LIEF_API oat_version_t version(const std::string& file);
 
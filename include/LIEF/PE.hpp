@@ -31,6 +31,7 @@
 #include "LIEF/PE/DelayImportEntry.hpp"
 #include "LIEF/PE/DataDirectory.hpp"
 #include "LIEF/PE/ResourcesManager.hpp"
+#include "LIEF/PE/ResourceDirectoryView.hpp"
 #include "LIEF/PE/ResourceData.hpp"
 #include "LIEF/PE/ResourceNode.hpp"
 #include "LIEF/PE/ResourceDirectory.hpp"
@@ -61,6 +62,7 @@
 #include "LIEF/PE/CodeIntegrity.hpp"
 #include "LIEF/PE/COFFString.hpp"
 #include "LIEF/PE/Factory.hpp"
+#include "LIEF/PE/ExceptionIndex.hpp"
 #include "LIEF/PE/ExceptionInfo.hpp"
 #include "LIEF/PE/exceptions_info/RuntimeFunctionAArch64.hpp"
 #include "LIEF/PE/exceptions_info/AArch64/PackedFunction.hpp"
@@ -94,6 +96,7 @@
 #include "LIEF/PE/enums.hpp"
 #include "LIEF/PE/EnumToString.hpp"
 #include "LIEF/PE/utils.hpp"
+#include "LIEF/PE/fingerprint.hpp"
 
 #endif
 
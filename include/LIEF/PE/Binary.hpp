@@ -25,6 +25,7 @@
 #include "LIEF/PE/DataDirectory.hpp"
 #include "LIEF/PE/Builder.hpp"
 #include "LIEF/PE/ResourcesManager.hpp"
+#include "LIEF/PE/ResourceDirectoryView.hpp"
 #include "LIEF/PE/COFFString.hpp"
 #include "LIEF/PE/ExceptionInfo.hpp"
 #include "LIEF/PE/signature/Signature.hpp"
@@ -359,6 +360,11 @@ class LIEF_API Binary : public LIEF::Binary {
   /// parameter
   std::vector<uint8_t> authentihash(ALGORITHMS algo) const;
 
+  /// Compute the authentihash for each of the given algorithms with a single
+  /// pass over the binary. The digests are returned in the order of `algos`
+  /// and an unsupported algorithm produces an empty digest.
+  std::vector<std::vector<uint8_t>> authentihash(const std::vector<ALGORITHMS>& algos) const;
+
   /// Return the Export object
   Export* get_export() {
     return export_.get();
@@ -423,6 +429,13 @@ class LIEF_API Binary : public LIEF::Binary {
   /// Return the ResourcesManager (class to manage resources more easily than the tree one)
   result<ResourcesManager> resources_manager() const;
 
+  /// Return a lazy view on the root directory of the resources.
+  ///
+  /// Contrary to resources(), this view does not require the resource tree
+  /// to be parsed (cf. ParserConfig::parse_rsrc) and the payloads are not
+  /// copied.
+  result<ResourceDirectoryView> resources_view() const;
+
   /// Return binary's section from its name.
   /// If the secion can't be found, return a nullptr
   ///
@@ -904,6 +917,8 @@ class LIEF_API Binary : public LIEF::Binary {
   LIEF::Binary::functions_t get_abstract_exported_functions() const override;
   LIEF::Binary::functions_t get_abstract_imported_functions() const override;
   std::vector<std::string> get_abstract_imported_libraries() const override;
+  result<LIEF::Binary::content_region_t>
+    get_content_region(uint64_t address, LIEF::Binary::VA_TYPES addr_type) override;
 
   void update_lookup_address_table_offset();
   void update_iat();
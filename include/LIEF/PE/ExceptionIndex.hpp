@@ -0,0 +1,140 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_PE_EXCEPTION_INDEX_H
+#define LIEF_PE_EXCEPTION_INDEX_H
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "LIEF/visibility.h"
+#include "LIEF/span.hpp"
+
+#include "LIEF/PE/Parser.hpp"
+#include "LIEF/PE/ParserConfig.hpp"
+
+namespace LIEF {
+class BinaryStream;
+
+namespace PE {
+class Binary;
+class ExceptionInfo;
+
+/// Lazy index over the exception table (`.pdata`) of a PE binary.
+///
+/// ParserConfig::parse_exceptions decodes **all** the `RUNTIME_FUNCTION`
+/// entries with their unwind information which is expensive for large
+/// binaries. This index only relies on the fact that the entries of the
+/// exception table are sorted by their start address: find_exception()
+/// binary-searches the raw table and decodes (RuntimeFunctionX64 or
+/// RuntimeFunctionAArch64) the entry that contains the given RVA.
+///
+/// Decoded entries are kept in a LRU cache of cache_size() entries.
+/// The additional table used by ARM64EC binaries (CHPE metadata) is not
+/// indexed.
+///
+/// This class is not thread-safe.
+class LIEF_API ExceptionIndex {
+  public:
+  static constexpr size_t DEFAULT_CACHE_SIZE = 256;
+
+  /// Maximum number of chained unwind info that are resolved for an entry
+  static constexpr size_t MAX_CHAIN_DEPTH = 32;
+
+  /// Parse the PE located at the given path and index its exception table.
+  ///
+  /// ParserConfig::parse_exceptions is ignored.
+  static std::unique_ptr<ExceptionIndex>
+    parse(const std::string& file,
+          const ParserConfig& config = ParserConfig::default_conf());
+
+  /// Parse the PE from the given stream and index its exception table
+  static std::unique_ptr<ExceptionIndex>
+    parse(std::unique_ptr<BinaryStream> stream,
+          const ParserConfig& config = ParserConfig::default_conf());
+
+  ExceptionIndex(const ExceptionIndex&) = delete;
+  ExceptionIndex& operator=(const ExceptionIndex&) = delete;
+
+  ~ExceptionIndex();
+
+  /// The PE binary associated with this index
+  const Binary& binary() const;
+
+  /// Number of entries in the exception table
+  size_t size() const {
+    return nb_entries_;
+  }
+
+  /// Return the exception info of the function that contains the given RVA
+  /// or a nullptr if the RVA is not covered by the exception table.
+  ///
+  /// The ownership of the returned entry is shared with the cache: it
+  /// remains valid even if it is later evicted from the cache.
+  std::shared_ptr<ExceptionInfo> find_exception(uint32_t rva);
+
+  /// Maximum number of decoded entries kept in the cache
+  size_t cache_size() const {
+    return cache_size_;
+  }
+
+  /// Change the maximum number of decoded entries kept in the cache.
+  /// A value of 0 is clamped to 1.
+  void cache_size(size_t size);
+
+  /// Number of lookups that have been served from the cache
+  size_t cache_hits() const {
+    return hits_;
+  }
+
+  /// Number of lookups that required to decode an entry
+  size_t cache_misses() const {
+    return misses_;
+  }
+
+  private:
+  struct entry_t {
+    uint32_t index = 0;
+    std::unique_ptr<ExceptionInfo> info;
+    /// Owner of the functions referenced by the chained unwind info
+    std::vector<std::unique_ptr<ExceptionInfo>> chain;
+  };
+  using lru_t = std::list<std::shared_ptr<entry_t>>;
+
+  ExceptionIndex(std::unique_ptr<BinaryStream> stream);
+
+  LIEF_LOCAL uint32_t rva_start(size_t index) const;
+  LIEF_LOCAL std::shared_ptr<entry_t> decode(uint32_t index);
+  LIEF_LOCAL std::unique_ptr<ExceptionInfo> decode_entry(uint32_t index);
+  LIEF_LOCAL void resolve_chains(entry_t& entry);
+  LIEF_LOCAL void evict();
+
+  Parser parser_;
+  span<const uint8_t> pdata_;
+  size_t entry_size_ = 0;
+  size_t nb_entries_ = 0;
+
+  lru_t lru_;
+  std::unordered_map<uint32_t, lru_t::iterator> cache_;
+  size_t cache_size_ = DEFAULT_CACHE_SIZE;
+  size_t hits_ = 0;
+  size_t misses_ = 0;
+};
+
+}
+}
+#endif
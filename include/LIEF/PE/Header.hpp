@@ -151,6 +151,9 @@ class LIEF_API Header : public Object {
     return false;
   }
 
+  /// True if the given value is one of the MACHINE_TYPES (except UNKNOWN)
+  static bool is_known_machine(MACHINE_TYPES ty);
+
   enum class CHARACTERISTICS {
     NONE                    = 0x0000,
     RELOCS_STRIPPED         = 0x0001, /**< The file does not contain base relocations and must be loaded at its preferred base. If this cannot be done, the loader will error.*/
@@ -50,6 +50,7 @@ struct pe_debug;
 /// Main interface to parse PE binaries. In particular the **static** functions:
 /// Parser::parse should be used to get a LIEF::PE::Binary
 class LIEF_API Parser : public LIEF::Parser {
+  friend class ExceptionIndex;
   public:
 
   /// Maximum size of the data read
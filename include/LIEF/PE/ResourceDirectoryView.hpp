@@ -0,0 +1,214 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_PE_RESOURCE_DIRECTORY_VIEW_H
+#define LIEF_PE_RESOURCE_DIRECTORY_VIEW_H
+#include <string>
+#include <cstdint>
+
+#include "LIEF/visibility.h"
+#include "LIEF/errors.hpp"
+#include "LIEF/span.hpp"
+
+namespace LIEF {
+namespace PE {
+class Binary;
+
+/// Read-only and lazy view over a resource directory
+/// (`IMAGE_RESOURCE_DIRECTORY`) of a PE binary.
+///
+/// Contrary to ResourceNode, the view does not build the resource tree:
+/// the entries of a directory are decoded when they are accessed and the
+/// resources' payloads are exposed as spans on the binary's content
+/// (no copy). Following the PE specifications, the entries identified by an
+/// ID are sorted which allows a `O(log n)` lookup with find(). Directories
+/// that do not follow this order are looked up with a linear scan.
+///
+/// This view can be used with ParserConfig::parse_rsrc turned off to access
+/// the resources of large binaries. The views reference the memory of the
+/// Binary from which they are created: the binary must outlive them.
+class LIEF_API ResourceDirectoryView {
+  private:
+  /// Memory in which the tree is located
+  struct context_t {
+    /// Content starting at the root directory
+    span<const uint8_t> base;
+    /// Binary used to resolve the RVA of the payloads (can be a nullptr)
+    const Binary* pe = nullptr;
+    /// RVA of the root directory
+    uint32_t rva = 0;
+  };
+
+  public:
+  /// Maximum depth of the tree that can be reached with Entry::directory().
+  /// This prevents infinite recursions on corrupted (looping) trees.
+  static constexpr uint32_t MAX_DEPTH = 16;
+
+  /// Leaf of the resource tree (`IMAGE_RESOURCE_DATA_ENTRY`)
+  struct LIEF_API data_t {
+    /// RVA of the payload
+    uint32_t rva = 0;
+
+    /// Code page used to decode the payload
+    uint32_t code_page = 0;
+
+    /// Reserved value (should be 0)
+    uint32_t reserved = 0;
+
+    /// Payload of the resource. It could be smaller than the size
+    /// specified in the data entry if the payload is truncated.
+    span<const uint8_t> content;
+  };
+
+  /// Entry of a resource directory (`IMAGE_RESOURCE_DIRECTORY_ENTRY`)
+  class LIEF_API Entry {
+    public:
+    friend class ResourceDirectoryView;
+
+    /// Raw ID of the entry. If the entry is named, the high bit is set and
+    /// the lower bits are the offset of the name.
+    uint32_t id() const {
+      return id_;
+    }
+
+    /// True if the entry is identified by a name instead of an ID
+    bool has_name() const {
+      return (id_ & 0x80000000) != 0;
+    }
+
+    /// Name of the entry (decoded on demand) or an empty string
+    std::u16string name() const;
+
+    /// Name of the entry as an UTF-8 string
+    std::string utf8_name() const;
+
+    /// True if the entry references a sub-directory
+    bool is_directory() const {
+      return (offset_ & 0x80000000) != 0;
+    }
+
+    /// True if the entry references a leaf (ResourceDirectoryView::data_t)
+    bool is_data() const {
+      return !is_directory();
+    }
+
+    /// Sub-directory referenced by this entry
+    result<ResourceDirectoryView> directory() const;
+
+    /// Leaf referenced by this entry
+    result<data_t> data() const;
+
+    private:
+    Entry(const context_t& ctx, uint32_t depth, uint32_t id, uint32_t offset) :
+      ctx_(ctx),
+      depth_(depth),
+      id_(id),
+      offset_(offset)
+    {}
+
+    context_t ctx_;
+    uint32_t depth_ = 0;
+    uint32_t id_ = 0;
+    uint32_t offset_ = 0;
+  };
+
+  /// Create a view on the root directory of the resources of the given
+  /// binary.
+  static result<ResourceDirectoryView> from(const Binary& pe);
+
+  /// Create a view on the root directory of a standalone resource tree.
+  /// `rva` is the RVA of the tree and is used to resolve the payloads.
+  static result<ResourceDirectoryView> from(span<const uint8_t> tree, uint32_t rva);
+
+  uint32_t characteristics() const {
+    return characteristics_;
+  }
+
+  uint32_t time_date_stamp() const {
+    return time_date_stamp_;
+  }
+
+  uint16_t major_version() const {
+    return major_version_;
+  }
+
+  uint16_t minor_version() const {
+    return minor_version_;
+  }
+
+  uint16_t numberof_name_entries() const {
+    return numberof_name_entries_;
+  }
+
+  uint16_t numberof_id_entries() const {
+    return numberof_id_entries_;
+  }
+
+  /// Number of entries in this directory
+  size_t size() const {
+    return size_;
+  }
+
+  /// Depth of this directory in the tree (0 for the root)
+  uint32_t depth() const {
+    return depth_;
+  }
+
+  /// Return the entry at the given index. Named entries come first.
+  result<Entry> at(size_t idx) const;
+
+  /// Find the entry with the given ID (binary search with a linear scan
+  /// fallback for unsorted directories)
+  result<Entry> find(uint32_t id) const;
+
+  /// Find the entry with the given name (same as above)
+  result<Entry> find(const std::u16string& name) const;
+
+  /// Typed lookup of the resource identified by its type (e.g.
+  /// ResourcesManager::TYPE::MANIFEST), its ID and its language. This
+  /// function must be called on the root directory.
+  result<data_t> lookup(uint32_t type, uint32_t id, uint32_t lang) const;
+
+  /// Same as above but return the first language available for the resource
+  result<data_t> lookup(uint32_t type, uint32_t id) const;
+
+  private:
+  ResourceDirectoryView(const context_t& ctx, uint32_t offset, uint32_t depth) :
+    ctx_(ctx),
+    offset_(offset),
+    depth_(depth)
+  {}
+
+  LIEF_LOCAL static result<ResourceDirectoryView>
+    create(const context_t& ctx, uint32_t offset, uint32_t depth);
+
+  LIEF_LOCAL Entry entry_at(size_t idx) const;
+
+  context_t ctx_;
+  uint32_t offset_ = 0;
+  uint32_t depth_ = 0;
+
+  uint32_t characteristics_ = 0;
+  uint32_t time_date_stamp_ = 0;
+  uint16_t major_version_ = 0;
+  uint16_t minor_version_ = 0;
+  uint16_t numberof_name_entries_ = 0;
+  uint16_t numberof_id_entries_ = 0;
+  size_t size_ = 0;
+};
+
+}
+}
+#endif
@@ -181,6 +181,19 @@ class LIEF_API ResourceNode : public Object {
   /// Delete the given node from the node's children
   void delete_child(const ResourceNode& node);
 
+  /// Find the child identified by the given ID or return a nullptr.
+  ///
+  /// The child is looked up with a binary search when the children follow
+  /// the order of the PE format (named entries first, then the ID entries in
+  /// ascending order). Otherwise (e.g. malformed binary), it falls back on a
+  /// linear scan.
+  const ResourceNode* find_child(uint32_t id) const;
+
+  ResourceNode* find_child(uint32_t id) {
+    return const_cast<ResourceNode*>(
+      static_cast<const ResourceNode*>(this)->find_child(id));
+  }
+
   void accept(Visitor& visitor) const override;
 
   template<class T>
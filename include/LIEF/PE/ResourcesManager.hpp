@@ -33,6 +33,7 @@ class VectorStream;
 
 namespace PE {
 class ResourceNode;
+class ResourceData;
 
 /// The Resource Manager provides an enhanced API to manipulate the resource tree.
 class LIEF_API ResourcesManager : public Object {
@@ -132,6 +133,15 @@ class LIEF_API ResourcesManager : public Object {
   }
   const ResourceNode* get_node_type(TYPE type) const;
 
+  /// Return the data node of the resource identified by its type, its ID and
+  /// its language (e.g. `0x409` for `en-US`) or a nullptr if not found.
+  ///
+  /// Each level of the tree is looked up with a binary search.
+  const ResourceData* find(TYPE type, uint32_t id, uint32_t lang) const;
+
+  /// Same as above but return the first language available for the resource
+  const ResourceData* find(TYPE type, uint32_t id) const;
+
   /// List of TYPE present in the resources
   std::vector<TYPE> get_types() const;
 
@@ -0,0 +1,112 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_PE_FINGERPRINT_H
+#define LIEF_PE_FINGERPRINT_H
+#include <map>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+#include "LIEF/PE/enums.hpp"
+#include "LIEF/visibility.h"
+
+namespace LIEF {
+namespace PE {
+class Binary;
+
+/// Digests to compute with LIEF::PE::fingerprint
+struct LIEF_API fingerprint_options_t {
+  /// Compute the imphash with IMPHASH_MODE::LIEF
+  bool imphash = true;
+
+  /// Compute the imphash with IMPHASH_MODE::PEFILE
+  bool imphash_pefile = false;
+
+  /// Compute the MD5 of the (decoded) rich header
+  bool rich_header_hash = true;
+
+  /// Algorithms for which the authentihash is computed
+  std::vector<ALGORITHMS> authentihash = {ALGORITHMS::SHA_256};
+
+  /// Compute the MD5 and the SHA-256 of the sections' content
+  bool section_hashes = true;
+
+  /// Compute the entropy of the sections' content
+  bool section_entropy = true;
+
+  /// Compute the checksum of the binary (cf. Binary::compute_checksum)
+  bool checksum = true;
+};
+
+/// Digests computed by LIEF::PE::fingerprint. The digests that are not
+/// requested (or that can't be computed) are left empty.
+struct LIEF_API fingerprint_t {
+  struct LIEF_API section_t {
+    /// Name of the section
+    std::string name;
+
+    /// RVA of the section
+    uint32_t virtual_address = 0;
+
+    /// MD5 of the section's content
+    std::vector<uint8_t> md5;
+
+    /// SHA-256 of the section's content
+    std::vector<uint8_t> sha256;
+
+    /// Shannon entropy of the section's content
+    double entropy = 0.0;
+  };
+
+  /// Imphash as computed by get_imphash() with IMPHASH_MODE::LIEF
+  std::string imphash;
+
+  /// Imphash as computed by get_imphash() with IMPHASH_MODE::PEFILE
+  std::string imphash_pefile;
+
+  /// MD5 of the decoded rich header (cf. RichHeader::hash)
+  std::vector<uint8_t> rich_header_hash;
+
+  /// Authentihash for each requested algorithm
+  std::map<ALGORITHMS, std::vector<uint8_t>> authentihash;
+
+  /// Checksum computed by Binary::compute_checksum
+  uint32_t checksum = 0;
+
+  /// Digests of the sections in the order of Binary::sections
+  std::vector<section_t> sections;
+};
+
+/// Compute, in a single call, the digests commonly used to identify a PE
+/// binary (imphash, rich header hash, authentihash, sections hashes,
+/// checksum, entropy).
+///
+/// Contrary to calling the individual functions, the authentihash of
+/// all the requested algorithms is computed in one pass over the binary,
+/// the hashes and the entropy of a section are computed in one pass over its
+/// content and the independent digests are computed concurrently.
+///
+/// \code{.cpp}
+/// fingerprint_options_t opt;
+/// opt.authentihash = {ALGORITHMS::SHA_1, ALGORITHMS::SHA_256};
+/// fingerprint_t fp = PE::fingerprint(*pe, opt);
+/// \endcode
+LIEF_API fingerprint_t fingerprint(const Binary& binary,
+                                   const fingerprint_options_t& options = fingerprint_options_t());
+
+}
+}
+#endif
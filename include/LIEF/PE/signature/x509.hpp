@@ -58,6 +58,55 @@ class LIEF_API x509 : public Object {
   /// Parse x509 certificate(s) from raw blob
   static certificates_t parse(const std::vector<uint8_t>& content);
 
+  /// Default maximum number of certificates kept by the cache
+  static constexpr size_t DEFAULT_CACHE_SIZE = 512;
+
+  /// Statistics of the process-wide certificates cache
+  struct LIEF_API cache_stats_t {
+    /// Number of certificates currently in the cache
+    size_t certificates = 0;
+
+    /// Number of verification results currently in the cache
+    size_t verifications = 0;
+
+    /// Number of certificates that have been served from the cache
+    size_t hits = 0;
+
+    /// Number of certificates that had to be parsed
+    size_t misses = 0;
+
+    /// Number of verifications (verify(), is_trusted_by()) served from the cache
+    size_t verify_hits = 0;
+
+    /// Number of verifications that had to be computed
+    size_t verify_misses = 0;
+  };
+
+  /// Enable (or disable) the process-wide cache of certificates.
+  ///
+  /// When enabled, the certificates embedded in the PKCS #7 signatures are
+  /// identified by the SHA-256 of their DER encoding and a certificate
+  /// already parsed (e.g. the Microsoft's chain) is shared instead of being
+  /// parsed again. The results of verify() and is_trusted_by() are also
+  /// memoized.
+  ///
+  /// The cache is thread-safe and keeps at most `max_size` certificates
+  /// (and `4 * max_size` verification results), the least recently used
+  /// entries being evicted first. Disabling the cache drops its content.
+  ///
+  /// @warning The memoized verification results are not re-evaluated if a
+  /// certificate expires while the cache is enabled.
+  static void enable_cache(bool enabled = true, size_t max_size = DEFAULT_CACHE_SIZE);
+
+  /// Whether the process-wide cache of certificates is enabled
+  static bool is_cache_enabled();
+
+  /// Drop the content of the cache and reset its statistics
+  static void clear_cache();
+
+  /// Statistics of the cache
+  static cache_stats_t cache_stats();
+
   /// Return True if ``before`` is *before* than ``after``. False otherwise
   static bool check_time(const date_t& before, const date_t& after);
 
@@ -187,7 +236,11 @@ class LIEF_API x509 : public Object {
 
   private:
   x509();
-  mbedtls_x509_crt* x509_cert_ = nullptr;
+  x509(std::shared_ptr<mbedtls_x509_crt> crt);
+
+  /// The underlying certificate is shared among the copies of this object
+  /// and with the cache. It must not be modified once created.
+  std::shared_ptr<mbedtls_x509_crt> x509_cert_;
 
 };
 
@@ -24,8 +24,10 @@
 #endif
 #include "LIEF/DEX.hpp"
 #include "LIEF/VDEX/Parser.hpp"
+#include "LIEF/VDEX/ParserConfig.hpp"
 #include "LIEF/VDEX/utils.hpp"
 #include "LIEF/VDEX/File.hpp"
+#include "LIEF/VDEX/VerifierDeps.hpp"
 #endif
 
 #endif
@@ -19,6 +19,7 @@
 
 #include "LIEF/VDEX/Header.hpp"
 #include "LIEF/VDEX/type_traits.hpp"
+#include "LIEF/VDEX/VerifierDeps.hpp"
 
 #include "LIEF/visibility.h"
 #include "LIEF/Object.hpp"
@@ -59,6 +60,16 @@ class LIEF_API File : public Object {
   it_dex_files       dex_files();
   it_const_dex_files dex_files() const;
 
+  /// Checksums of the DEX files (as stored in the VDEX file)
+  const std::vector<uint32_t>& checksums() const {
+    return checksums_;
+  }
+
+  /// Lazy view over the verifier dependencies
+  VerifierDeps verifier_deps() const {
+    return {verifier_deps_, header_.nb_dex_files()};
+  }
+
   dex2dex_info_t dex2dex_info() const;
 
   std::string dex2dex_json_info();
@@ -75,6 +86,8 @@ class LIEF_API File : public Object {
 
   Header header_;
   dex_files_t dex_files_;
+  std::vector<uint32_t> checksums_;
+  std::vector<uint8_t> verifier_deps_;
 };
 
 }
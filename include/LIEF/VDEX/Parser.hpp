@@ -21,6 +21,7 @@
 #include <string>
 
 #include "LIEF/VDEX/type_traits.hpp"
+#include "LIEF/VDEX/ParserConfig.hpp"
 #include "LIEF/visibility.h"
 
 namespace LIEF {
@@ -31,17 +32,20 @@ class File;
 /// Class which parse an VDEX file and transform into a VDEX::File object
 class LIEF_API Parser {
   public:
-  static std::unique_ptr<File> parse(const std::string& file);
+  static std::unique_ptr<File> parse(const std::string& file,
+                                     const ParserConfig& config = ParserConfig::default_conf());
   static std::unique_ptr<File> parse(const std::vector<uint8_t>& data,
-                                     const std::string& name = "");
+                                     const std::string& name = "",
+                                     const ParserConfig& config = ParserConfig::default_conf());
 
   Parser& operator=(const Parser& copy) = delete;
   Parser(const Parser& copy)            = delete;
 
   private:
   Parser();
-  Parser(const std::string& file);
-  Parser(const std::vector<uint8_t>& data, const std::string& name);
+  Parser(const std::string& file, const ParserConfig& config);
+  Parser(const std::vector<uint8_t>& data, const std::string& name,
+         const ParserConfig& config);
   virtual ~Parser();
 
   void init(const std::string& name, vdex_version_t version);
@@ -66,6 +70,7 @@ class LIEF_API Parser {
 
   LIEF::VDEX::File* file_ = nullptr;
   std::unique_ptr<VectorStream> stream_;
+  ParserConfig config_;
 };
 
 } // namespace VDEX
@@ -0,0 +1,55 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_VDEX_PARSER_CONFIG_H
+#define LIEF_VDEX_PARSER_CONFIG_H
+#include <string>
+#include <ostream>
+#include "LIEF/visibility.h"
+
+namespace LIEF {
+namespace VDEX {
+
+/// This structure is used to tweak the VDEX Parser (VDEX::Parser)
+struct LIEF_API ParserConfig {
+  static const ParserConfig& default_conf() {
+    static const ParserConfig DEFAULT;
+    return DEFAULT;
+  }
+
+  /// Parse the DEX files embedded in the VDEX file
+  bool parse_dex_files = true;
+
+  /// Keep the verifier dependencies such as they can be iterated with
+  /// File::verifier_deps(). The records are decoded on demand.
+  bool parse_verifier_deps = true;
+
+  /// Decode the quickening info and attach it to the DEX methods
+  /// (requires parse_dex_files)
+  bool parse_quickening_info = true;
+
+  std::string to_string() const;
+
+  LIEF_API friend
+    std::ostream& operator<<(std::ostream& os, const ParserConfig& config)
+  {
+    os << config.to_string();
+    return os;
+  }
+};
+
+}
+}
+#endif
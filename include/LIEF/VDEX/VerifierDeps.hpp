@@ -0,0 +1,199 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_VDEX_VERIFIER_DEPS_H
+#define LIEF_VDEX_VERIFIER_DEPS_H
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "LIEF/visibility.h"
+#include "LIEF/errors.hpp"
+#include "LIEF/span.hpp"
+#include "LIEF/iterators.hpp"
+
+namespace LIEF {
+namespace VDEX {
+
+/// Lazy view over the verifier dependencies (`verifier_deps` section) of a
+/// VDEX file.
+///
+/// The dependencies are stored as a stream of ULEB128 values. For each DEX
+/// file, this stream contains the extra strings (i.e. not present in the DEX
+/// file) followed by sets of records:
+///
+/// 1. The assignable types
+/// 2. The unassignable types
+/// 3. The resolved classes
+/// 4. The resolved fields
+/// 5. The resolved direct, virtual and interface methods
+/// 6. The unverified classes
+///
+/// The records are decoded while iterating (no allocation) and the view
+/// references the memory of its VDEX::File.
+class LIEF_API VerifierDeps {
+  public:
+  enum class KIND : uint32_t {
+    ASSIGNABLE_TYPE = 0,
+    UNASSIGNABLE_TYPE,
+    CLASS,
+    FIELD,
+    DIRECT_METHOD,
+    VIRTUAL_METHOD,
+    INTERFACE_METHOD,
+    UNVERIFIED_CLASS,
+  };
+
+  /// Record of the verifier dependencies. The meaning of the values depends
+  /// on its kind:
+  ///
+  /// - ASSIGNABLE_TYPE, UNASSIGNABLE_TYPE: string index of the destination
+  ///   and string index of the source.
+  /// - CLASS: type index and access flags.
+  /// - FIELD, *_METHOD: field/method index, access flags and string index of
+  ///   the declaring class.
+  /// - UNVERIFIED_CLASS: type index.
+  ///
+  /// The string indexes that are greater or equal to the number of strings
+  /// of the DEX file reference the extra strings (c.f. VerifierDeps::strings).
+  struct LIEF_API record_t {
+    KIND kind = KIND::ASSIGNABLE_TYPE;
+
+    /// Index of the DEX file in the VDEX
+    uint32_t dex_idx = 0;
+
+    std::array<uint32_t, 3> values = {0, 0, 0};
+
+    /// Number of values used by the record's kind
+    uint32_t size() const;
+
+    std::string to_string() const;
+
+    LIEF_API friend std::ostream& operator<<(std::ostream& os, const record_t& record) {
+      os << record.to_string();
+      return os;
+    }
+  };
+
+  /// Forward iterator that decodes the records from the ULEB128 stream
+  class LIEF_API Iterator {
+    public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = record_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const record_t*;
+    using reference = const record_t&;
+
+    Iterator() = default;
+
+    /// Iterator on the first record of the given verifier dependencies
+    Iterator(span<const uint8_t> content, uint32_t nb_dex_files);
+
+    /// Iterator on the end of the given verifier dependencies
+    static Iterator end(span<const uint8_t> content) {
+      Iterator it;
+      it.content_ = content;
+      it.pos_ = END;
+      return it;
+    }
+
+    reference operator*() const {
+      return record_;
+    }
+
+    pointer operator->() const {
+      return &record_;
+    }
+
+    Iterator& operator++() {
+      next();
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) {
+      return lhs.content_.data() == rhs.content_.data() && lhs.pos_ == rhs.pos_;
+    }
+
+    friend bool operator!=(const Iterator& lhs, const Iterator& rhs) {
+      return !(lhs == rhs);
+    }
+
+    private:
+    static constexpr size_t END = static_cast<size_t>(-1);
+
+    void next();
+    void stop() {
+      pos_ = END;
+    }
+
+    span<const uint8_t> content_;
+    size_t pos_ = 0;
+    uint32_t nb_dex_files_ = 0;
+
+    // Number of records left in the current set
+    uint32_t remaining_ = 0;
+    // True if the next value of the stream is the beginning of a DEX file
+    bool new_dex_ = true;
+    record_t record_;
+  };
+
+  using it_records = iterator_range<Iterator>;
+
+  VerifierDeps() = default;
+  VerifierDeps(span<const uint8_t> content, uint32_t nb_dex_files) :
+    content_(content),
+    nb_dex_files_(nb_dex_files)
+  {}
+
+  /// Iterator over the records of all the DEX files
+  it_records records() const {
+    return {Iterator(content_, nb_dex_files_), Iterator::end(content_)};
+  }
+
+  /// Extra strings of the DEX file at the given index
+  std::vector<std::string> strings(uint32_t dex_idx) const;
+
+  /// Number of bytes of content() used by the dependencies of all the DEX
+  /// files or an error if the stream is corrupted
+  result<uint64_t> consumed_size() const;
+
+  /// Raw content of the verifier dependencies
+  span<const uint8_t> content() const {
+    return content_;
+  }
+
+  uint32_t nb_dex_files() const {
+    return nb_dex_files_;
+  }
+
+  private:
+  span<const uint8_t> content_;
+  uint32_t nb_dex_files_ = 0;
+};
+
+LIEF_API const char* to_string(VerifierDeps::KIND kind);
+
+}
+}
+#endif
@@ -27,8 +27,12 @@
 #include "LIEF/visibility.h"
 
 namespace LIEF {
+class BinaryStream;
 namespace VDEX {
 
+/// Check if the given stream starts with a VDEX header
+LIEF_API bool is_vdex(BinaryStream& stream);
+
 /// Check if the given file is an VDEX one.
 LIEF_API bool is_vdex(const std::string& file);
 
@@ -0,0 +1,39 @@
+#include <LIEF/LIEF.hpp>
+#include <chrono>
+#include <iostream>
+
+// Decode all the instructions of all the methods of the given DEX file
+int main(int argc, const char** argv) {
+  if (argc != 2) {
+    std::cerr << "Usage: " << argv[0] << " <dex>" << '\n';
+    return EXIT_FAILURE;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  std::unique_ptr<LIEF::DEX::File> dex = LIEF::DEX::Parser::parse(argv[1]);
+  if (dex == nullptr) {
+    return EXIT_FAILURE;
+  }
+  const auto parsed = std::chrono::steady_clock::now();
+
+  size_t nb_methods = 0;
+  size_t nb_instructions = 0;
+  size_t nb_payloads = 0;
+  size_t checksum = 0;
+  for (const LIEF::DEX::Method& method : dex->methods()) {
+    ++nb_methods;
+    for (const LIEF::DEX::Instruction& inst : method.instructions()) {
+      ++nb_instructions;
+      nb_payloads += inst.is_payload() ? 1 : 0;
+      checksum += inst.opcode + inst.vA + inst.vB + inst.vC;
+    }
+  }
+  const auto decoded = std::chrono::steady_clock::now();
+
+  using ms = std::chrono::milliseconds;
+  std::cout << "Parsing:  " << std::chrono::duration_cast<ms>(parsed - start).count() << "ms\n"
+            << "Decoding: " << std::chrono::duration_cast<ms>(decoded - parsed).count() << "ms\n"
+            << "Methods: " << nb_methods << ", instructions: " << nb_instructions
+            << ", payloads: " << nb_payloads << " (" << checksum << ")\n";
+  return EXIT_SUCCESS;
+}
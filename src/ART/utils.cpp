@@ -23,7 +23,7 @@
 namespace LIEF {
 namespace ART {
 
-inline bool is_art(BinaryStream& stream) {
+bool is_art(BinaryStream& stream) {
   using magic_t = std::array<char, sizeof(details::art_magic)>;
   if (auto magic_res = stream.peek<magic_t>(0)) {
     const auto magic = *magic_res;
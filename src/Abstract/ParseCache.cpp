@@ -0,0 +1,849 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+#include "logging.hpp"
+#include "hash_stream.hpp"
+#include "string_table.hpp"
+#include "MappedFile.hpp"
+
+#include "LIEF/config.h"
+#include "LIEF/Abstract/ParseCache.hpp"
+#include "LIEF/Abstract/Parser.hpp"
+#include "LIEF/Abstract/Relocation.hpp"
+#include "LIEF/Abstract/Symbol.hpp"
+#include "LIEF/Abstract/Function.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
+#include "LIEF/iostream.hpp"
+
+#if defined(LIEF_ELF_SUPPORT)
+#include "LIEF/ELF/Binary.hpp"
+#include "LIEF/ELF/Parser.hpp"
+#include "LIEF/ELF/ParserConfig.hpp"
+#include "LIEF/ELF/Relocation.hpp"
+#include "LIEF/ELF/Symbol.hpp"
+#endif
+
+#if defined(LIEF_PE_SUPPORT)
+#include "LIEF/PE/Binary.hpp"
+#include "LIEF/PE/Parser.hpp"
+#include "LIEF/PE/ParserConfig.hpp"
+#include "LIEF/PE/Import.hpp"
+#include "LIEF/PE/ImportEntry.hpp"
+#include "LIEF/PE/RelocationEntry.hpp"
+#endif
+
+#if defined(LIEF_MACHO_SUPPORT)
+#include "LIEF/MachO/Binary.hpp"
+#include "LIEF/MachO/BindingInfo.hpp"
+#include "LIEF/MachO/DylibCommand.hpp"
+#include "LIEF/MachO/FatBinary.hpp"
+#include "LIEF/MachO/Parser.hpp"
+#include "LIEF/MachO/ParserConfig.hpp"
+#include "LIEF/MachO/Relocation.hpp"
+#include "LIEF/MachO/Symbol.hpp"
+#endif
+
+#if defined(_WIN32)
+#include <direct.h>
+#include <process.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace LIEF {
+namespace details {
+
+// Layout of a cache entry:
+//
+//   cache_header_t
+//   symbol_rec_t[]
+//   relocation_rec_t[]
+//   import_rec_t[]
+//   export_rec_t[]
+//   str_rec_t[]      (libraries)
+//   string table     (NUL-terminated strings)
+//
+// The values are stored in the host's endianness as the entries are not
+// meant to be shared across hosts. The records are trivial types so that
+// they can be written with vector_iostream::write<T>.
+static constexpr uint64_t CACHE_MAGIC = 0x484341434645494c; // LIEFCACH
+
+enum CACHE_TABLE : size_t {
+  TABLE_SYMBOLS = 0,
+  TABLE_RELOCATIONS,
+  TABLE_IMPORTS,
+  TABLE_EXPORTS,
+  TABLE_LIBRARIES,
+  TABLE_STRINGS, ///< The count is the size of the table in bytes
+  NB_TABLES,
+};
+
+struct table_t {
+  uint64_t offset;
+  uint64_t count;
+};
+
+using digest_t = std::array<uint8_t, 32>; // SHA-256
+
+struct cache_header_t {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t format;
+  digest_t content_digest;
+  uint64_t content_size;
+  uint64_t config_key;
+  uint32_t architecture;
+  uint32_t is_pie;
+  uint64_t entrypoint;
+  uint64_t imagebase;
+  table_t tables[NB_TABLES];
+};
+
+struct str_rec_t {
+  uint32_t offset;
+  uint32_t size;
+};
+
+struct symbol_rec_t {
+  str_rec_t name;
+  uint64_t value;
+  uint64_t size;
+};
+
+struct relocation_rec_t {
+  uint64_t address;
+  uint32_t size;
+  uint32_t type;
+  str_rec_t symbol;
+};
+
+struct import_rec_t {
+  str_rec_t name;
+  str_rec_t library;
+  uint64_t address;
+};
+
+struct export_rec_t {
+  str_rec_t name;
+  uint64_t address;
+};
+
+static constexpr size_t RECORD_SIZES[NB_TABLES] = {
+  sizeof(symbol_rec_t), sizeof(relocation_rec_t), sizeof(import_rec_t),
+  sizeof(export_rec_t), sizeof(str_rec_t), 1,
+};
+
+static cache_header_t read_header(span<const uint8_t> raw) {
+  cache_header_t hdr;
+  std::memcpy(&hdr, raw.data(), sizeof(hdr));
+  return hdr;
+}
+
+// Check that the tables of the entry are in the bounds of the buffer so that
+// the records can be accessed without further checks
+static bool is_valid(span<const uint8_t> raw) {
+  if (raw.size() < sizeof(cache_header_t)) {
+    return false;
+  }
+  const cache_header_t hdr = read_header(raw);
+  if (hdr.magic != CACHE_MAGIC || hdr.version != ParseCache::VERSION) {
+    return false;
+  }
+
+  for (size_t i = 0; i < NB_TABLES; ++i) {
+    const table_t& table = hdr.tables[i];
+    if (table.offset > raw.size() ||
+        table.count > (raw.size() - table.offset) / RECORD_SIZES[i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// SHA-256 of the content of a binary. A (non-cryptographic) 64-bit hash
+// would make it possible to craft a binary that collides with a cached one.
+static digest_t content_digest(span<const uint8_t> content) {
+  hashstream hs(hashstream::HASH::SHA256);
+  hs.write(content.data(), content.size());
+  const std::vector<uint8_t>& raw = hs.raw();
+  digest_t digest{};
+  std::copy_n(raw.begin(), std::min(raw.size(), digest.size()), digest.begin());
+  return digest;
+}
+
+#if defined(LIEF_ELF_SUPPORT)
+static uint64_t config_key(const ELF::ParserConfig& config) {
+  return (uint64_t)Binary::FORMATS::ELF << 56 |
+         (uint64_t)config.count_mtd << 8 |
+         (uint64_t)config.parse_relocations     << 0 |
+         (uint64_t)config.parse_dyn_symbols     << 1 |
+         (uint64_t)config.parse_symtab_symbols  << 2 |
+         (uint64_t)config.parse_symbol_versions << 3 |
+         (uint64_t)config.parse_notes           << 4 |
+         (uint64_t)config.parse_overlay         << 5;
+}
+
+static std::unique_ptr<Binary> parse(span<const uint8_t> content,
+                                     const ELF::ParserConfig& config)
+{
+  return ELF::Parser::parse(std::make_unique<SpanStream>(content), config);
+}
+#endif
+
+#if defined(LIEF_PE_SUPPORT)
+static uint64_t config_key(const PE::ParserConfig& config) {
+  return (uint64_t)Binary::FORMATS::PE << 56 |
+         (uint64_t)config.parse_signature     << 0 |
+         (uint64_t)config.parse_exports       << 1 |
+         (uint64_t)config.parse_imports       << 2 |
+         (uint64_t)config.parse_rsrc          << 3 |
+         (uint64_t)config.parse_reloc         << 4 |
+         (uint64_t)config.parse_exceptions    << 5 |
+         (uint64_t)config.parse_arm64x_binary << 6;
+}
+
+static std::unique_ptr<Binary> parse(span<const uint8_t> content,
+                                     const PE::ParserConfig& config)
+{
+  return PE::Parser::parse(std::make_unique<SpanStream>(content), config);
+}
+#endif
+
+#if defined(LIEF_MACHO_SUPPORT)
+static uint64_t config_key(const MachO::ParserConfig& config) {
+  return (uint64_t)Binary::FORMATS::MACHO << 56 |
+         (uint64_t)config.parse_dyld_exports     << 0 |
+         (uint64_t)config.parse_dyld_bindings    << 1 |
+         (uint64_t)config.parse_dyld_rebases     << 2 |
+         (uint64_t)config.parse_overlay          << 3 |
+         (uint64_t)config.fix_from_memory        << 4 |
+         (uint64_t)config.from_dyld_shared_cache << 5;
+}
+
+static std::unique_ptr<Binary> parse(span<const uint8_t> content,
+                                     const MachO::ParserConfig& config)
+{
+  std::unique_ptr<MachO::FatBinary> fat =
+    MachO::Parser::parse(std::make_unique<SpanStream>(content), config);
+  if (fat == nullptr) {
+    return nullptr;
+  }
+  // Same as LIEF::Parser::parse: take the last binary of a fat binary
+  return fat->pop_back();
+}
+#endif
+
+static bool make_dir(const std::string& dir) {
+#if defined(_WIN32)
+  return _mkdir(dir.c_str()) == 0 || errno == EEXIST;
+#else
+  return mkdir(dir.c_str(), 0755) == 0 || errno == EEXIST;
+#endif
+}
+
+static uint64_t process_id() {
+#if defined(_WIN32)
+  return static_cast<uint64_t>(_getpid());
+#else
+  return static_cast<uint64_t>(getpid());
+#endif
+}
+
+// Write the entry in a temporary file which is then renamed so that a
+// concurrent open() never reads a partially-written entry. The name of the
+// temporary file is unique across the processes and threads sharing the
+// cache directory.
+static ok_error_t write_entry(const std::string& dir, const std::string& path,
+                              const std::vector<uint8_t>& raw)
+{
+  if (!make_dir(dir)) {
+    LIEF_WARN("Can't create the cache directory '{}'", dir);
+    return make_error_code(lief_errors::file_error);
+  }
+
+  const std::string tmp = fmt::format("{}.{:x}-{:x}.tmp", path, process_id(),
+      std::hash<std::thread::id>{}(std::this_thread::get_id()));
+  {
+    std::ofstream output(tmp, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!output) {
+      LIEF_WARN("Can't open '{}' for writing", tmp);
+      return make_error_code(lief_errors::file_error);
+    }
+    output.write(reinterpret_cast<const char*>(raw.data()), raw.size());
+    if (!output) {
+      LIEF_WARN("Can't write the cache entry '{}'", tmp);
+      std::remove(tmp.c_str());
+      return make_error_code(lief_errors::file_error);
+    }
+  }
+
+  if (std::rename(tmp.c_str(), path.c_str()) != 0) {
+    std::remove(path.c_str());
+    if (std::rename(tmp.c_str(), path.c_str()) != 0) {
+      LIEF_WARN("Can't move the cache entry to '{}'", path);
+      std::remove(tmp.c_str());
+      return make_error_code(lief_errors::file_error);
+    }
+  }
+  return ok();
+}
+
+
+// Format-specific type and symbol of a relocation
+static void relocation_info(const Binary& bin, const Relocation& reloc,
+                            ParseCache::relocation_t& info)
+{
+  switch (bin.format()) {
+#if defined(LIEF_ELF_SUPPORT)
+    case Binary::FORMATS::ELF:
+      {
+        const auto& elf_reloc = static_cast<const ELF::Relocation&>(reloc);
+        info.type = static_cast<uint32_t>(elf_reloc.type());
+        if (const ELF::Symbol* sym = elf_reloc.symbol()) {
+          info.symbol = sym->name();
+        }
+        return;
+      }
+#endif
+
+#if defined(LIEF_PE_SUPPORT)
+    case Binary::FORMATS::PE:
+      {
+        const auto& pe_reloc = static_cast<const PE::RelocationEntry&>(reloc);
+        info.type = static_cast<uint32_t>(pe_reloc.type());
+        return;
+      }
+#endif
+
+#if defined(LIEF_MACHO_SUPPORT)
+    case Binary::FORMATS::MACHO:
+      {
+        const auto& macho_reloc = static_cast<const MachO::Relocation&>(reloc);
+        info.type = macho_reloc.type();
+        if (const MachO::Symbol* sym = macho_reloc.symbol()) {
+          info.symbol = sym->name();
+        }
+        return;
+      }
+#endif
+
+    default:
+      return;
+  }
+}
+
+static void collect_imports(const Binary& bin,
+                            std::vector<ParseCache::import_t>& imports)
+{
+  switch (bin.format()) {
+#if defined(LIEF_ELF_SUPPORT)
+    case Binary::FORMATS::ELF:
+      {
+        for (const ELF::Relocation& reloc : static_cast<const ELF::Binary&>(bin).relocations()) {
+          const ELF::Symbol* sym = reloc.symbol();
+          if (sym == nullptr || !sym->is_imported()) {
+            continue;
+          }
+          ParseCache::import_t& imp = imports.emplace_back();
+          imp.name = sym->name();
+          imp.address = reloc.address();
+        }
+        return;
+      }
+#endif
+
+#if defined(LIEF_PE_SUPPORT)
+    case Binary::FORMATS::PE:
+      {
+        for (const PE::Import& import : static_cast<const PE::Binary&>(bin).imports()) {
+          for (const PE::ImportEntry& entry : import.entries()) {
+            ParseCache::import_t& imp = imports.emplace_back();
+            imp.name = entry.name();
+            imp.library = import.name();
+            imp.address = entry.iat_address();
+          }
+        }
+        return;
+      }
+#endif
+
+#if defined(LIEF_MACHO_SUPPORT)
+    case Binary::FORMATS::MACHO:
+      {
+        for (const MachO::BindingInfo& binding : static_cast<const MachO::Binary&>(bin).bindings()) {
+          ParseCache::import_t& imp = imports.emplace_back();
+          if (const MachO::Symbol* sym = binding.symbol()) {
+            imp.name = sym->name();
+          }
+          if (const MachO::DylibCommand* lib = binding.library()) {
+            imp.library = lib->name();
+          }
+          imp.address = binding.address();
+        }
+        return;
+      }
+#endif
+
+    default:
+      return;
+  }
+}
+
+static str_rec_t make_str(const StringTableBuilder::offsets_t& offsets,
+                          std::string_view str)
+{
+  str_rec_t rec{};
+  if (str.empty()) {
+    return rec;
+  }
+  if (auto it = offsets.find(str); it != offsets.end()) {
+    rec.offset = static_cast<uint32_t>(it->second);
+    rec.size = static_cast<uint32_t>(str.size());
+  }
+  return rec;
+}
+
+template<class T>
+static void write_table(vector_iostream& os, cache_header_t& hdr, CACHE_TABLE table,
+                        const std::vector<T>& records)
+{
+  hdr.tables[table].offset = static_cast<uint64_t>(os.tellp());
+  hdr.tables[table].count = records.size();
+  for (const T& rec : records) {
+    os.write(rec);
+  }
+}
+
+}
+
+std::vector<uint8_t> ParseCache::serialize(const Binary& bin) {
+  // The strings referenced by these objects must stay alive until the
+  // string table is built
+  const Binary::functions_t exported = bin.exported_functions();
+  const std::vector<std::string> libraries = bin.imported_libraries();
+
+  std::vector<symbol_t> symbols;
+  for (const Symbol& sym : bin.symbols()) {
+    symbol_t& info = symbols.emplace_back();
+    info.name  = sym.name();
+    info.value = sym.value();
+    info.size  = sym.size();
+  }
+
+  std::vector<relocation_t> relocations;
+  for (const Relocation& reloc : bin.relocations()) {
+    relocation_t& info = relocations.emplace_back();
+    info.address = reloc.address();
+    info.size    = static_cast<uint32_t>(reloc.size());
+    details::relocation_info(bin, reloc, info);
+  }
+
+  std::vector<import_t> imports;
+  details::collect_imports(bin, imports);
+
+  StringTableBuilder builder;
+  builder.reserve(symbols.size() + relocations.size() + 2 * imports.size() +
+                  exported.size() + libraries.size());
+  for (const symbol_t& sym : symbols) { builder.add(sym.name); }
+  for (const relocation_t& reloc : relocations) { builder.add(reloc.symbol); }
+  for (const import_t& imp : imports) {
+    builder.add(imp.name);
+    builder.add(imp.library);
+  }
+  for (const Function& func : exported) { builder.add(func.name()); }
+  for (const std::string& lib : libraries) { builder.add(lib); }
+
+  std::vector<uint8_t> strtab;
+  StringTableBuilder::offsets_t offsets;
+  builder.build(strtab, offsets, /*alignment=*/sizeof(uint64_t));
+
+  std::vector<details::symbol_rec_t> symbol_recs;
+  symbol_recs.reserve(symbols.size());
+  for (const symbol_t& sym : symbols) {
+    details::symbol_rec_t& rec = symbol_recs.emplace_back();
+    rec.name  = details::make_str(offsets, sym.name);
+    rec.value = sym.value;
+    rec.size  = sym.size;
+  }
+
+  std::vector<details::relocation_rec_t> relocation_recs;
+  relocation_recs.reserve(relocations.size());
+  for (const relocation_t& reloc : relocations) {
+    details::relocation_rec_t& rec = relocation_recs.emplace_back();
+    rec.address = reloc.address;
+    rec.size    = reloc.size;
+    rec.type    = reloc.type;
+    rec.symbol  = details::make_str(offsets, reloc.symbol);
+  }
+
+  std::vector<details::import_rec_t> import_recs;
+  import_recs.reserve(imports.size());
+  for (const import_t& imp : imports) {
+    details::import_rec_t& rec = import_recs.emplace_back();
+    rec.name    = details::make_str(offsets, imp.name);
+    rec.library = details::make_str(offsets, imp.library);
+    rec.address = imp.address;
+  }
+
+  std::vector<details::export_rec_t> export_recs;
+  export_recs.reserve(exported.size());
+  for (const Function& func : exported) {
+    details::export_rec_t& rec = export_recs.emplace_back();
+    rec.name    = details::make_str(offsets, func.name());
+    rec.address = func.address();
+  }
+
+  std::vector<details::str_rec_t> library_recs;
+  library_recs.reserve(libraries.size());
+  for (const std::string& lib : libraries) {
+    library_recs.push_back(details::make_str(offsets, lib));
+  }
+
+  const Header header = bin.header();
+  details::cache_header_t hdr{};
+  hdr.magic        = details::CACHE_MAGIC;
+  hdr.version      = VERSION;
+  hdr.format       = static_cast<uint32_t>(bin.format());
+  hdr.architecture = static_cast<uint32_t>(header.architecture());
+  hdr.is_pie       = bin.is_pie() ? 1 : 0;
+  hdr.entrypoint   = bin.entrypoint();
+  hdr.imagebase    = bin.imagebase();
+
+  vector_iostream os;
+  os.reserve(sizeof(hdr) + symbol_recs.size() * sizeof(details::symbol_rec_t) +
+             relocation_recs.size() * sizeof(details::relocation_rec_t) +
+             import_recs.size() * sizeof(details::import_rec_t) +
+             export_recs.size() * sizeof(details::export_rec_t) +
+             library_recs.size() * sizeof(details::str_rec_t) + strtab.size());
+  os.write(hdr);
+  details::write_table(os, hdr, details::TABLE_SYMBOLS, symbol_recs);
+  details::write_table(os, hdr, details::TABLE_RELOCATIONS, relocation_recs);
+  details::write_table(os, hdr, details::TABLE_IMPORTS, import_recs);
+  details::write_table(os, hdr, details::TABLE_EXPORTS, export_recs);
+  details::write_table(os, hdr, details::TABLE_LIBRARIES, library_recs);
+  hdr.tables[details::TABLE_STRINGS].offset = static_cast<uint64_t>(os.tellp());
+  hdr.tables[details::TABLE_STRINGS].count = strtab.size();
+  os.write(strtab);
+  os.seekp(0);
+  os.write(hdr);
+
+  std::vector<uint8_t> raw;
+  os.move(raw);
+  return raw;
+}
+
+// ----------------------------------------------------------------------------
+// Entry
+// ----------------------------------------------------------------------------
+ParseCache::Entry::~Entry() = default;
+
+template<class T>
+T ParseCache::Entry::record(size_t table, size_t idx) const {
+  const details::cache_header_t hdr = details::read_header(raw_);
+  T rec;
+  std::memcpy(&rec, raw_.data() + hdr.tables[table].offset + idx * sizeof(T),
+              sizeof(T));
+  return rec;
+}
+
+std::string_view ParseCache::Entry::string(uint32_t offset, uint32_t size) const {
+  const details::table_t strings =
+    details::read_header(raw_).tables[details::TABLE_STRINGS];
+  if ((uint64_t)offset + size > strings.count) {
+    return {};
+  }
+  return {reinterpret_cast<const char*>(raw_.data() + strings.offset + offset), size};
+}
+
+Binary::FORMATS ParseCache::Entry::format() const {
+  return static_cast<Binary::FORMATS>(details::read_header(raw_).format);
+}
+
+Header::ARCHITECTURES ParseCache::Entry::architecture() const {
+  return static_cast<Header::ARCHITECTURES>(details::read_header(raw_).architecture);
+}
+
+uint64_t ParseCache::Entry::entrypoint() const {
+  return details::read_header(raw_).entrypoint;
+}
+
+uint64_t ParseCache::Entry::imagebase() const {
+  return details::read_header(raw_).imagebase;
+}
+
+bool ParseCache::Entry::is_pie() const {
+  return details::read_header(raw_).is_pie != 0;
+}
+
+size_t ParseCache::Entry::nb_symbols() const {
+  return details::read_header(raw_).tables[details::TABLE_SYMBOLS].count;
+}
+
+size_t ParseCache::Entry::nb_relocations() const {
+  return details::read_header(raw_).tables[details::TABLE_RELOCATIONS].count;
+}
+
+size_t ParseCache::Entry::nb_imports() const {
+  return details::read_header(raw_).tables[details::TABLE_IMPORTS].count;
+}
+
+size_t ParseCache::Entry::nb_exports() const {
+  return details::read_header(raw_).tables[details::TABLE_EXPORTS].count;
+}
+
+size_t ParseCache::Entry::nb_libraries() const {
+  return details::read_header(raw_).tables[details::TABLE_LIBRARIES].count;
+}
+
+ParseCache::symbol_t ParseCache::Entry::symbol_at(size_t idx) const {
+  const auto rec = record<details::symbol_rec_t>(details::TABLE_SYMBOLS, idx);
+  symbol_t sym;
+  sym.name  = string(rec.name.offset, rec.name.size);
+  sym.value = rec.value;
+  sym.size  = rec.size;
+  return sym;
+}
+
+ParseCache::relocation_t ParseCache::Entry::relocation_at(size_t idx) const {
+  const auto rec = record<details::relocation_rec_t>(details::TABLE_RELOCATIONS, idx);
+  relocation_t reloc;
+  reloc.address = rec.address;
+  reloc.size    = rec.size;
+  reloc.type    = rec.type;
+  reloc.symbol  = string(rec.symbol.offset, rec.symbol.size);
+  return reloc;
+}
+
+ParseCache::import_t ParseCache::Entry::import_at(size_t idx) const {
+  const auto rec = record<details::import_rec_t>(details::TABLE_IMPORTS, idx);
+  import_t imp;
+  imp.name    = string(rec.name.offset, rec.name.size);
+  imp.library = string(rec.library.offset, rec.library.size);
+  imp.address = rec.address;
+  return imp;
+}
+
+ParseCache::export_t ParseCache::Entry::export_at(size_t idx) const {
+  const auto rec = record<details::export_rec_t>(details::TABLE_EXPORTS, idx);
+  export_t exp;
+  exp.name    = string(rec.name.offset, rec.name.size);
+  exp.address = rec.address;
+  return exp;
+}
+
+std::string_view ParseCache::Entry::library_at(size_t idx) const {
+  const auto rec = record<details::str_rec_t>(details::TABLE_LIBRARIES, idx);
+  return string(rec.offset, rec.size);
+}
+
+result<ParseCache::export_t> ParseCache::Entry::find_export(std::string_view name) const {
+  for (size_t i = 0, n = nb_exports(); i < n; ++i) {
+    const auto rec = record<details::export_rec_t>(details::TABLE_EXPORTS, i);
+    if (string(rec.name.offset, rec.name.size) == name) {
+      return export_at(i);
+    }
+  }
+  return make_error_code(lief_errors::not_found);
+}
+
+result<ParseCache::import_t> ParseCache::Entry::find_import(std::string_view name) const {
+  for (size_t i = 0, n = nb_imports(); i < n; ++i) {
+    const auto rec = record<details::import_rec_t>(details::TABLE_IMPORTS, i);
+    if (string(rec.name.offset, rec.name.size) == name) {
+      return import_at(i);
+    }
+  }
+  return make_error_code(lief_errors::not_found);
+}
+
+// ----------------------------------------------------------------------------
+// ParseCache
+// ----------------------------------------------------------------------------
+std::string ParseCache::default_dir() {
+  if (const char* dir = std::getenv("LIEF_CACHE_DIR"); dir != nullptr && *dir != '\0') {
+    return dir;
+  }
+#if defined(_WIN32)
+  if (const char* dir = std::getenv("LOCALAPPDATA"); dir != nullptr && *dir != '\0') {
+    return std::string(dir) + "\\lief";
+  }
+  if (const char* dir = std::getenv("USERPROFILE"); dir != nullptr && *dir != '\0') {
+    return std::string(dir) + "\\.lief";
+  }
+#else
+  if (const char* dir = std::getenv("XDG_CACHE_HOME"); dir != nullptr && *dir != '\0') {
+    return std::string(dir) + "/lief";
+  }
+  if (const char* dir = std::getenv("HOME"); dir != nullptr && *dir != '\0') {
+    // The parent directory (~/.cache) is not created by make_dir()
+    if (details::make_dir(std::string(dir) + "/.cache")) {
+      return std::string(dir) + "/.cache/lief";
+    }
+  }
+#endif
+  return "";
+}
+
+std::unique_ptr<ParseCache::Entry> ParseCache::open(const std::string& path) const {
+  std::unique_ptr<details::MappedFile> file = details::MappedFile::open(path);
+  if (file == nullptr) {
+    LIEF_ERR("Can't open '{}'", path);
+    return nullptr;
+  }
+
+  SpanStream stream(file->content());
+  const FILE_FORMATS format = identify(stream);
+  switch (format) {
+#if defined(LIEF_ELF_SUPPORT)
+    case FILE_FORMATS::ELF:
+      return open_impl(path, file->content(), ELF::ParserConfig::all());
+#endif
+
+#if defined(LIEF_PE_SUPPORT)
+    case FILE_FORMATS::PE:
+      return open_impl(path, file->content(), PE::ParserConfig::default_conf());
+#endif
+
+#if defined(LIEF_MACHO_SUPPORT)
+    case FILE_FORMATS::MACHO:
+    case FILE_FORMATS::MACHO_FAT:
+      return open_impl(path, file->content(), MachO::ParserConfig::deep());
+#endif
+
+    case FILE_FORMATS::UNKNOWN:
+      LIEF_ERR("Unknown format");
+      return nullptr;
+
+    default:
+      LIEF_ERR("{} files can't be cached", to_string(format));
+      return nullptr;
+  }
+}
+
+std::unique_ptr<ParseCache::Entry>
+  ParseCache::open(const std::string& path, const ELF::ParserConfig& config) const
+{
+#if defined(LIEF_ELF_SUPPORT)
+  std::unique_ptr<details::MappedFile> file = details::MappedFile::open(path);
+  if (file == nullptr) {
+    LIEF_ERR("Can't open '{}'", path);
+    return nullptr;
+  }
+  return open_impl(path, file->content(), config);
+#else
+  LIEF_ERR("ELF is not supported by this build of LIEF");
+  return nullptr;
+#endif
+}
+
+std::unique_ptr<ParseCache::Entry>
+  ParseCache::open(const std::string& path, const PE::ParserConfig& config) const
+{
+#if defined(LIEF_PE_SUPPORT)
+  std::unique_ptr<details::MappedFile> file = details::MappedFile::open(path);
+  if (file == nullptr) {
+    LIEF_ERR("Can't open '{}'", path);
+    return nullptr;
+  }
+  return open_impl(path, file->content(), config);
+#else
+  LIEF_ERR("PE is not supported by this build of LIEF");
+  return nullptr;
+#endif
+}
+
+std::unique_ptr<ParseCache::Entry>
+  ParseCache::open(const std::string& path, const MachO::ParserConfig& config) const
+{
+#if defined(LIEF_MACHO_SUPPORT)
+  std::unique_ptr<details::MappedFile> file = details::MappedFile::open(path);
+  if (file == nullptr) {
+    LIEF_ERR("Can't open '{}'", path);
+    return nullptr;
+  }
+  return open_impl(path, file->content(), config);
+#else
+  LIEF_ERR("Mach-O is not supported by this build of LIEF");
+  return nullptr;
+#endif
+}
+
+template<class Config>
+std::unique_ptr<ParseCache::Entry>
+  ParseCache::open_impl(const std::string& path, span<const uint8_t> content,
+                        const Config& config) const
+{
+  const details::digest_t digest = details::content_digest(content);
+  const uint64_t key = details::config_key(config);
+  const std::string entry_path = dir_.empty() ? "" :
+    fmt::format("{}/{:02x}-{:016x}.lief", dir_, fmt::join(digest, ""), key);
+
+  std::unique_ptr<Entry> entry(new Entry());
+  if (!entry_path.empty()) {
+    if (auto cached = details::MappedFile::open(entry_path)) {
+      span<const uint8_t> raw = cached->content();
+      if (details::is_valid(raw)) {
+        const details::cache_header_t hdr = details::read_header(raw);
+        if (hdr.content_digest == digest && hdr.content_size == content.size() &&
+            hdr.config_key == key)
+        {
+          entry->raw_ = raw;
+          entry->mapping_ = std::move(cached);
+          entry->from_cache_ = true;
+          return entry;
+        }
+      }
+      LIEF_DEBUG("Stale cache entry: '{}'", entry_path);
+    }
+  }
+
+  std::unique_ptr<Binary> bin = details::parse(content, config);
+  if (bin == nullptr) {
+    LIEF_ERR("Can't parse '{}'", path);
+    return nullptr;
+  }
+
+  entry->buffer_ = serialize(*bin);
+  details::cache_header_t hdr = details::read_header(entry->buffer_);
+  hdr.content_digest = digest;
+  hdr.content_size = content.size();
+  hdr.config_key = key;
+  std::memcpy(entry->buffer_.data(), &hdr, sizeof(hdr));
+  entry->raw_ = entry->buffer_;
+
+  if (!entry_path.empty()) {
+    details::write_entry(dir_, entry_path, entry->buffer_);
+  }
+  return entry;
+}
+
+std::unique_ptr<ParseCache::Entry> ParseCache::from_raw(span<const uint8_t> raw) {
+  if (!details::is_valid(raw)) {
+    return nullptr;
+  }
+  std::unique_ptr<Entry> entry(new Entry());
+  entry->buffer_.assign(raw.begin(), raw.end());
+  entry->raw_ = entry->buffer_;
+  return entry;
+}
+}
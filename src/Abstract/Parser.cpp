@@ -14,12 +14,18 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <array>
 #include <fstream>
 
 #include "logging.hpp"
+#include "frozen.hpp"
 #include "LIEF/Abstract/Parser.hpp"
 #include "LIEF/Abstract/Binary.hpp"
 #include "LIEF/BinaryStream/BinaryStream.hpp"
+#include "LIEF/BinaryStream/FileStream.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
+#include "LIEF/BinaryStream/VectorStream.hpp"
 
 
 #if defined(LIEF_OAT_SUPPORT)
@@ -39,6 +45,8 @@
 #include "LIEF/PE/Parser.hpp"
 #include "LIEF/PE/Binary.hpp"
 #include "LIEF/PE/AuxiliarySymbol.hpp"
+#include "LIEF/PE/Header.hpp"
+#include "PE/Structures.hpp"
 #endif
 
 #if defined(LIEF_MACHO_SUPPORT)
@@ -48,113 +56,224 @@
 #include "LIEF/MachO/Binary.hpp"
 #endif
 
+#if defined(LIEF_DEX_SUPPORT)
+#include "LIEF/DEX/utils.hpp"
+#endif
+
+#if defined(LIEF_VDEX_SUPPORT)
+#include "LIEF/VDEX/utils.hpp"
+#endif
+
+#if defined(LIEF_ART_SUPPORT)
+#include "LIEF/ART/utils.hpp"
+#endif
+
 
 
 namespace LIEF {
-Parser::~Parser() = default;
-Parser::Parser() = default;
 
-std::unique_ptr<Binary> Parser::parse(const std::string& filename) {
+#if defined(LIEF_PE_SUPPORT)
+// COFF objects don't have a magic: check that the regular file header
+// (IMAGE_FILE_HEADER) or the `/bigobj` header is consistent.
+static bool is_coff(BinaryStream& stream) {
+  const uint64_t file_size = stream.size();
+  auto machine     = stream.peek<uint16_t>(0);
+  auto nb_sections = stream.peek<uint16_t>(2);
+  auto symtab      = stream.peek<uint32_t>(8);
+  auto sizeof_opt  = stream.peek<uint16_t>(16);
+  if (machine && nb_sections && symtab && sizeof_opt &&
+      PE::Header::is_known_machine(PE::Header::MACHINE_TYPES(*machine)) &&
+      *nb_sections > 0 && *sizeof_opt == 0 && *symtab < file_size &&
+      20 + *nb_sections * 40ull <= file_size)
+  {
+    return true;
+  }
+
+  using bigobj_magic_t = std::array<char, sizeof(PE::details::BigObjMagic)>;
+  auto sig1    = stream.peek<uint16_t>(0);
+  auto sig2    = stream.peek<uint16_t>(2);
+  auto version = stream.peek<uint16_t>(4);
+  auto magic   = stream.peek<bigobj_magic_t>(12);
+  return sig1 && sig2 && version && magic &&
+         *sig1 == 0 && *sig2 == 0xFFFF && *version >= 2 &&
+         std::equal(magic->begin(), magic->end(),
+                    std::begin(PE::details::BigObjMagic));
+}
+#endif
 
+FILE_FORMATS identify(BinaryStream& stream) {
+#if defined(LIEF_ELF_SUPPORT)
+  if (ELF::is_elf(stream)) {
 #if defined(LIEF_OAT_SUPPORT)
-  if (OAT::is_oat(filename)) {
-    return OAT::Parser::parse(filename);
+    if (OAT::is_oat(stream)) {
+      return FILE_FORMATS::OAT;
+    }
+#endif
+    return FILE_FORMATS::ELF;
   }
 #endif
 
-#if defined(LIEF_ELF_SUPPORT)
-  if (ELF::is_elf(filename)) {
-    return ELF::Parser::parse(filename);
+#if defined(LIEF_DEX_SUPPORT)
+  if (DEX::is_dex(stream)) {
+    return FILE_FORMATS::DEX;
   }
 #endif
 
+#if defined(LIEF_VDEX_SUPPORT)
+  if (VDEX::is_vdex(stream)) {
+    return FILE_FORMATS::VDEX;
+  }
+#endif
 
-#if defined(LIEF_PE_SUPPORT)
-  if (PE::is_pe(filename)) {
-     return PE::Parser::parse(filename);
+#if defined(LIEF_ART_SUPPORT)
+  if (ART::is_art(stream)) {
+    return FILE_FORMATS::ART;
   }
 #endif
 
 #if defined(LIEF_MACHO_SUPPORT)
-  if (MachO::is_macho(filename)) {
-    // For fat binary we take the last one...
-    std::unique_ptr<MachO::FatBinary> fat = MachO::Parser::parse(filename);
-    if (fat != nullptr) {
-      return fat->pop_back();
-    }
-    return nullptr;
+  if (MachO::is_macho(stream)) {
+    return MachO::is_fat(stream) ? FILE_FORMATS::MACHO_FAT : FILE_FORMATS::MACHO;
   }
 #endif
 
-  LIEF_ERR("Unknown format");
-  return nullptr;
-}
-
-std::unique_ptr<Binary> Parser::parse(const std::vector<uint8_t>& raw) {
+#if defined(LIEF_PE_SUPPORT)
+  if (PE::is_pe(stream)) {
+    return FILE_FORMATS::PE;
+  }
 
-#if defined(LIEF_OAT_SUPPORT)
-  if (OAT::is_oat(raw)) {
-    return OAT::Parser::parse(raw);
+  if (is_coff(stream)) {
+    return FILE_FORMATS::COFF;
   }
 #endif
 
-#if defined(LIEF_ELF_SUPPORT)
-  if (ELF::is_elf(raw)) {
-    return ELF::Parser::parse(raw);
+  return FILE_FORMATS::UNKNOWN;
+}
+
+FILE_FORMATS identify(const std::string& filename) {
+  if (auto stream = FileStream::from_file(filename)) {
+    return identify(*stream);
   }
-#endif
+  return FILE_FORMATS::UNKNOWN;
+}
 
+FILE_FORMATS identify(const std::vector<uint8_t>& raw) {
+  SpanStream stream(raw);
+  return identify(stream);
+}
 
-#if defined(LIEF_PE_SUPPORT)
-  if (PE::is_pe(raw)) {
-     return PE::Parser::parse(raw);
+const char* to_string(FILE_FORMATS e) {
+  #define ENTRY(X) std::pair(FILE_FORMATS::X, #X)
+  STRING_MAP enums2str {
+    ENTRY(UNKNOWN),
+    ENTRY(ELF),
+    ENTRY(PE),
+    ENTRY(COFF),
+    ENTRY(MACHO),
+    ENTRY(MACHO_FAT),
+    ENTRY(OAT),
+    ENTRY(DEX),
+    ENTRY(VDEX),
+    ENTRY(ART),
+  };
+  #undef ENTRY
+
+  if (auto it = enums2str.find(e); it != enums2str.end()) {
+    return it->second;
   }
-#endif
 
-#if defined(LIEF_MACHO_SUPPORT)
-  if (MachO::is_macho(raw)) {
-    // For fat binary we take the last one...
-    std::unique_ptr<MachO::FatBinary> fat = MachO::Parser::parse(raw);
-    if (fat != nullptr) {
-      return fat->pop_back();
-    }
+  return "UNKNOWN";
+}
+
+Parser::~Parser() = default;
+Parser::Parser() = default;
+
+std::unique_ptr<Binary> Parser::parse(const std::string& filename) {
+  auto file = FileStream::from_file(filename);
+  if (!file) {
     return nullptr;
   }
-#endif
 
-  LIEF_ERR("Unknown format");
-  return nullptr;
+  const FILE_FORMATS format = identify(*file);
+  if (format == FILE_FORMATS::UNKNOWN) {
+    LIEF_ERR("Unknown format");
+    return nullptr;
+  }
 
+  // The parsers require a stream that supports read_at() so the file is
+  // loaded in memory, from the handle that has been opened for the
+  // identification.
+  return parse(std::make_unique<VectorStream>(file->content()), format);
 }
 
-std::unique_ptr<Binary> Parser::parse(std::unique_ptr<BinaryStream> stream) {
+std::unique_ptr<Binary> Parser::parse(const std::vector<uint8_t>& raw) {
+  return parse(std::make_unique<VectorStream>(raw));
+}
 
-#if defined(LIEF_ELF_SUPPORT)
-  if (ELF::is_elf(*stream)) {
-    return ELF::Parser::parse(std::move(stream));
+std::unique_ptr<Binary> Parser::parse(std::unique_ptr<BinaryStream> stream) {
+  if (stream == nullptr) {
+    return nullptr;
   }
+  const FILE_FORMATS format = identify(*stream);
+  return parse(std::move(stream), format);
+}
+
+std::unique_ptr<Binary> Parser::parse(std::unique_ptr<BinaryStream> stream,
+                                      FILE_FORMATS format)
+{
+  switch (format) {
+#if defined(LIEF_OAT_SUPPORT)
+    case FILE_FORMATS::OAT:
+      {
+        std::vector<uint8_t> raw;
+        if (VectorStream::classof(*stream)) {
+          raw = std::move(static_cast<VectorStream&>(*stream).move_content());
+        } else if (!stream->peek_data(raw, 0, stream->size())) {
+          LIEF_ERR("Can't read the OAT file");
+          return nullptr;
+        }
+        return OAT::Parser::parse(std::move(raw));
+      }
 #endif
 
+#if defined(LIEF_ELF_SUPPORT)
+    case FILE_FORMATS::ELF:
+      return ELF::Parser::parse(std::move(stream));
+#endif
 
 #if defined(LIEF_PE_SUPPORT)
-  if (PE::is_pe(*stream)) {
-     return PE::Parser::parse(std::move(stream));
-  }
+    case FILE_FORMATS::PE:
+      return PE::Parser::parse(std::move(stream));
 #endif
 
 #if defined(LIEF_MACHO_SUPPORT)
-  if (MachO::is_macho(*stream)) {
-    // For fat binary we take the last one...
-    std::unique_ptr<MachO::FatBinary> fat = MachO::Parser::parse(std::move(stream));
-    if (fat != nullptr) {
-      return fat->pop_back();
-    }
-    return nullptr;
-  }
+    case FILE_FORMATS::MACHO:
+    case FILE_FORMATS::MACHO_FAT:
+      {
+        // For fat binary we take the last one...
+        std::unique_ptr<MachO::FatBinary> fat = MachO::Parser::parse(std::move(stream));
+        if (fat != nullptr) {
+          return fat->pop_back();
+        }
+        return nullptr;
+      }
 #endif
 
-  LIEF_ERR("Unknown format");
-  return nullptr;
+    case FILE_FORMATS::COFF:
+    case FILE_FORMATS::DEX:
+    case FILE_FORMATS::VDEX:
+    case FILE_FORMATS::ART:
+      LIEF_ERR("{} files can't be parsed as a LIEF::Binary", to_string(format));
+      return nullptr;
+
+    case FILE_FORMATS::UNKNOWN:
+      LIEF_ERR("Unknown format");
+      return nullptr;
+
+    default:
+      LIEF_ERR("{} is not supported by this build of LIEF", to_string(format));
+      return nullptr;
+  }
 }
 
 Parser::Parser(const std::string& filename) {
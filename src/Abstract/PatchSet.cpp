@@ -0,0 +1,235 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstring>
+
+#include "logging.hpp"
+
+#include "LIEF/Abstract/PatchSet.hpp"
+
+namespace LIEF {
+
+PatchSet& PatchSet::add(uint64_t address, span<const uint8_t> bytes) {
+  if (bytes.empty()) {
+    return *this;
+  }
+
+  if (address + bytes.size() < address) {
+    LIEF_ERR("The patch at 0x{:x} ({} bytes) overflows the address space",
+             address, bytes.size());
+    return *this;
+  }
+
+  patches_.push_back({address, data_.size(), bytes.size()});
+  data_.insert(data_.end(), bytes.begin(), bytes.end());
+  return *this;
+}
+
+PatchSet& PatchSet::add(uint64_t address, uint64_t value, size_t size) {
+  uint8_t raw[sizeof(uint64_t)] = {0};
+  switch (size) {
+    case sizeof(uint8_t):
+      {
+        auto X = static_cast<uint8_t>(value);
+        memcpy(raw, &X, sizeof(uint8_t));
+        break;
+      }
+
+    case sizeof(uint16_t):
+      {
+        auto X = static_cast<uint16_t>(value);
+        memcpy(raw, &X, sizeof(uint16_t));
+        break;
+      }
+
+    case sizeof(uint32_t):
+      {
+        auto X = static_cast<uint32_t>(value);
+        memcpy(raw, &X, sizeof(uint32_t));
+        break;
+      }
+
+    case sizeof(uint64_t):
+      {
+        memcpy(raw, &value, sizeof(uint64_t));
+        break;
+      }
+
+    default:
+      {
+        LIEF_ERR("The provided size ({}) does not match the size of an integer", size);
+        return *this;
+      }
+  }
+  return add(address, span<const uint8_t>(raw, size));
+}
+
+void PatchSet::clear() {
+  data_.clear();
+  patches_.clear();
+  written_.clear();
+  merged_.clear();
+  backup_.clear();
+  conflicts_.clear();
+  unresolved_.clear();
+  applied_ = false;
+}
+
+std::vector<PatchSet::patch_t> PatchSet::merge() {
+  merged_.clear();
+  conflicts_.clear();
+
+  // Stable sort so that the conflicts are reported with respect to the
+  // patch that has been added first
+  const auto cmp = [] (const patch_t& lhs, const patch_t& rhs) {
+    return lhs.address < rhs.address;
+  };
+
+  std::vector<patch_t> sorted = patches_;
+  if (!std::is_sorted(sorted.begin(), sorted.end(), cmp)) {
+    std::stable_sort(sorted.begin(), sorted.end(), cmp);
+  }
+
+  // The runs are stored contiguously in merged_ so that the last run can be
+  // extended by appending the bytes of the patches that overlap it.
+  // Adjacent patches are not merged as they can be located on both sides of
+  // a region boundary (e.g. two contiguous PE sections).
+  std::vector<patch_t> runs;
+  for (const patch_t& patch : sorted) {
+    const uint8_t* bytes = data_.data() + patch.offset;
+    if (runs.empty() || patch.address >= runs.back().address + runs.back().size) {
+      runs.push_back({patch.address, merged_.size(), patch.size});
+      merged_.insert(merged_.end(), bytes, bytes + patch.size);
+      continue;
+    }
+
+    patch_t& run = runs.back();
+    const uint64_t run_end = run.address + run.size;
+    const uint64_t overlap = std::min(run_end, patch.address + patch.size) - patch.address;
+    const uint8_t* current = merged_.data() + run.offset + (patch.address - run.address);
+
+    if (std::memcmp(current, bytes, overlap) != 0) {
+      LIEF_DEBUG("Conflict at 0x{:x} ({} bytes)", patch.address, overlap);
+      conflicts_.push_back({patch.address, overlap});
+    }
+
+    if (overlap < patch.size) {
+      merged_.insert(merged_.end(), bytes + overlap, bytes + patch.size);
+      run.size += patch.size - overlap;
+    }
+  }
+  return runs;
+}
+
+std::vector<span<uint8_t>> PatchSet::resolve(Binary& bin,
+                                             const std::vector<patch_t>& patches)
+{
+  unresolved_.clear();
+  std::vector<span<uint8_t>> targets;
+  targets.reserve(patches.size());
+
+  // The patches are sorted by address: the region resolved for a patch is
+  // reused for the next ones as long as they start in this region
+  Binary::content_region_t region;
+  for (const patch_t& patch : patches) {
+    const bool in_region = region.address <= patch.address &&
+                           patch.address - region.address < region.content.size();
+    if (!in_region) {
+      auto res = bin.get_content_region(patch.address, addr_type_);
+      if (!res) {
+        LIEF_DEBUG("Can't resolve the patch at 0x{:x}", patch.address);
+        unresolved_.push_back(patch.address);
+        continue;
+      }
+      region = *res;
+    }
+
+    const uint64_t offset = patch.address - region.address;
+    if (offset > region.content.size() || patch.size > region.content.size() - offset) {
+      LIEF_DEBUG("The patch at 0x{:x} ({} bytes) is out of bounds (limit: 0x{:x})",
+                 patch.address, patch.size, region.address + region.content.size());
+      unresolved_.push_back(patch.address);
+      continue;
+    }
+    targets.push_back(region.content.subspan(offset, patch.size));
+  }
+  return targets;
+}
+
+ok_error_t PatchSet::apply(Binary& bin, Binary::VA_TYPES addr_type) {
+  if (applied_) {
+    LIEF_ERR("The patches are already applied (rollback() must be called first)");
+    return make_error_code(lief_errors::not_supported);
+  }
+
+  addr_type_ = addr_type;
+  unresolved_.clear();
+
+  std::vector<patch_t> patches = merge();
+  if (!conflicts_.empty()) {
+    LIEF_ERR("{} conflict(s) between the patches (first at 0x{:x})",
+             conflicts_.size(), conflicts_.front().address);
+    return make_error_code(lief_errors::corrupted);
+  }
+
+  // Resolve all the patches before writing so that the binary is not
+  // modified if one of them can't be applied
+  std::vector<span<uint8_t>> targets = resolve(bin, patches);
+  if (!unresolved_.empty()) {
+    LIEF_ERR("{} patch(es) can't be resolved (first at 0x{:x})",
+             unresolved_.size(), unresolved_.front());
+    return make_error_code(lief_errors::not_found);
+  }
+
+  backup_.resize(merged_.size());
+  for (size_t i = 0; i < patches.size(); ++i) {
+    const patch_t& patch = patches[i];
+    span<uint8_t> target = targets[i];
+    std::memcpy(backup_.data() + patch.offset, target.data(), patch.size);
+    std::memcpy(target.data(), merged_.data() + patch.offset, patch.size);
+  }
+
+  LIEF_DEBUG("{} patches applied ({} after merging)", patches_.size(), patches.size());
+  written_ = std::move(patches);
+  applied_ = true;
+  return ok();
+}
+
+ok_error_t PatchSet::rollback(Binary& bin) {
+  if (!applied_) {
+    LIEF_ERR("The patches are not applied");
+    return make_error_code(lief_errors::not_found);
+  }
+
+  std::vector<span<uint8_t>> targets = resolve(bin, written_);
+  if (!unresolved_.empty()) {
+    LIEF_ERR("The patched content at 0x{:x} can't be resolved", unresolved_.front());
+    return make_error_code(lief_errors::not_found);
+  }
+
+  for (size_t i = 0; i < written_.size(); ++i) {
+    const patch_t& patch = written_[i];
+    std::memcpy(targets[i].data(), backup_.data() + patch.offset, patch.size);
+  }
+
+  written_.clear();
+  merged_.clear();
+  backup_.clear();
+  applied_ = false;
+  return ok();
+}
+
+}
@@ -27,6 +27,7 @@
 #include "LIEF/DEX/Type.hpp"
 #include "LIEF/DEX/Field.hpp"
 #include "DEX/Structures.hpp"
+#include "DEX/StringPool.hpp"
 
 #if defined(LIEF_JSON_SUPPORT)
 #include "visitors/json.hpp"
@@ -36,7 +37,8 @@ namespace LIEF {
 namespace DEX {
 
 File::File() :
-  name_{"classes.dex"}
+  name_{"classes.dex"},
+  string_pool_{std::make_unique<details::StringPool>()}
 {}
 File::~File() = default;
 
@@ -481,10 +483,19 @@ File::it_fields File::fields() {
 }
 
 File::it_const_strings File::strings() const {
+  details::StringPool& pool = *string_pool_;
+  std::call_once(pool.strings_once, [&] {
+    strings_.clear();
+    strings_.reserve(pool.size());
+    for (size_t i = 0; i < pool.size(); ++i) {
+      strings_.push_back(std::make_unique<std::string>(pool.get(i)));
+    }
+  });
   return strings_;
 }
 
 File::it_strings File::strings() {
+  static_cast<const File*>(this)->strings();
   return strings_;
 }
 
@@ -47,10 +47,6 @@ uint64_t Method::code_offset() const {
   return code_offset_;
 }
 
-const Method::bytecode_t& Method::bytecode() const {
-  return bytecode_;
-}
-
 bool Method::has_class() const {
   return parent_ != nullptr;
 }
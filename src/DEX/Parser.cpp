@@ -18,15 +18,21 @@
 
 #include "logging.hpp"
 
-#include <LIEF/BinaryStream/VectorStream.hpp>
+#include "LIEF/BinaryStream/VectorStream.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
 
 #include "LIEF/DEX/Parser.hpp"
 #include "LIEF/DEX/File.hpp"
 #include "LIEF/DEX/Type.hpp"
+#include "LIEF/DEX/Class.hpp"
+#include "LIEF/DEX/Method.hpp"
+#include "LIEF/DEX/Field.hpp"
 #include "LIEF/DEX/utils.hpp"
 #include "DEX/Structures.hpp"
+#include "DEX/StringPool.hpp"
 
 #include "Parser.tcc"
+#include "parallel.hpp"
 
 namespace LIEF {
 namespace DEX {
@@ -34,18 +40,27 @@ namespace DEX {
 Parser::~Parser() = default;
 Parser::Parser()  = default;
 
-std::unique_ptr<File> Parser::parse(const std::string& filename) {
+std::unique_ptr<File> Parser::parse(const std::string& filename,
+                                    const ParserConfig& config)
+{
   if (!is_dex(filename)) {
     LIEF_ERR("'{}' is not a DEX File", filename);
     return nullptr;
   }
   Parser parser{filename};
-  dex_version_t version = DEX::version(filename);
+  if (parser.stream_ == nullptr) {
+    return nullptr;
+  }
+  dex_version_t version = DEX::version(*parser.stream_);
+  parser.stream_->setpos(0);
+  parser.config_ = config;
   parser.init(filename, version);
   return std::move(parser.file_);
 }
 
-std::unique_ptr<File> Parser::parse(std::vector<uint8_t> data, const std::string& name) {
+std::unique_ptr<File> Parser::parse(std::vector<uint8_t> data, const std::string& name,
+                                    const ParserConfig& config)
+{
   if (!is_dex(data)) {
     LIEF_ERR("'{}' is not a DEX File", name);
     return nullptr;
@@ -53,15 +68,54 @@ std::unique_ptr<File> Parser::parse(std::vector<uint8_t> data, const std::string
   dex_version_t version = DEX::version(data);
 
   Parser parser{std::move(data)};
+  parser.config_ = config;
   parser.init(name, version);
   return std::move(parser.file_);
 }
 
+std::unique_ptr<File> Parser::parse(span<const uint8_t> data, const std::string& name,
+                                    const ParserConfig& config)
+{
+  SpanStream stream(data);
+  dex_version_t version = DEX::version(stream);
+  if (version == 0) {
+    LIEF_ERR("'{}' is not a DEX File", name);
+    return nullptr;
+  }
+
+  Parser parser{std::vector<uint8_t>(data.begin(), data.end())};
+  parser.config_ = config;
+  parser.init(name, version);
+  return std::move(parser.file_);
+}
+
+std::vector<std::unique_ptr<File>>
+  Parser::parse_all(const std::vector<span<const uint8_t>>& dex_files,
+                    const std::vector<std::string>& names,
+                    const ParserConfig& config)
+{
+  std::vector<std::unique_ptr<File>> files(dex_files.size());
+  parallel_for(dex_files.size(), [&] (size_t i) {
+    std::string name;
+    if (i < names.size()) {
+      name = names[i];
+    } else {
+      name = i == 0 ? "classes.dex" : "classes" + std::to_string(i + 1) + ".dex";
+    }
+    if (std::unique_ptr<File> file = parse(dex_files[i], name, config)) {
+      file->name(name);
+      files[i] = std::move(file);
+    }
+  });
+  return files;
+}
 
 Parser::Parser(std::vector<uint8_t> data) :
-  file_{new File{}},
-  stream_{std::make_unique<VectorStream>(std::move(data))}
-{}
+  file_{new File{}}
+{
+  file_->original_data_ = std::move(data);
+  stream_ = std::make_unique<SpanStream>(file_->original_data_);
+}
 
 Parser::Parser(const std::string& file) :
   file_{new File{}}
@@ -70,7 +124,8 @@ Parser::Parser(const std::string& file) :
   if (!stream) {
     LIEF_ERR("Can't create the stream");
   } else {
-    stream_ = std::make_unique<VectorStream>(std::move(*stream));
+    file_->original_data_ = stream->move_content();
+    stream_ = std::make_unique<SpanStream>(file_->original_data_);
   }
 }
 
@@ -98,75 +153,119 @@ void Parser::init(const std::string& name, dex_version_t version) {
 void Parser::resolve_inheritance() {
   LIEF_DEBUG("Resolving inheritance relationship for #{:d} classes", inheritance_.size());
 
-  for (const std::pair<const std::string, Class*>& p : inheritance_) {
-    const std::string& parent_name = p.first;
-    Class* child = p.second;
-
-    const auto it_inner_class = file_->classes_.find(parent_name);
-    if (it_inner_class == std::end(file_->classes_)) {
-      auto external_class = std::make_unique<Class>(parent_name);
-      child->parent_ = external_class.get();
-      file_->add_class(std::move(external_class));
-    } else {
-      child->parent_ = it_inner_class->second;
-    }
+  for (const auto& [parent_idx, child] : inheritance_) {
+    // The root classes (e.g. java.lang.Object) are attached to a class
+    // with an empty name
+    child->parent_ = parent_idx == details::NO_INDEX ?
+                     get_or_create_class("") : resolve_class(parent_idx);
   }
 }
 
 void Parser::resolve_external_methods() {
   LIEF_DEBUG("Resolving external methods for #{:d} methods", class_method_map_.size());
 
-  for (const std::pair<const std::string, Method*>& p : class_method_map_) {
-    const std::string& clazz = p.first;
-    Method* method = p.second;
-
-    const auto it_inner_class = file_->classes_.find(clazz);
-    if (it_inner_class == std::end(file_->classes_)) {
-      auto cls = std::make_unique<Class>(clazz);
-      cls->methods_.push_back(method);
-      method->parent_ = cls.get();
-      file_->add_class(std::move(cls));
-    } else {
-      Class* cls = it_inner_class->second;
-      method->parent_ = cls;
-      cls->methods_.push_back(method);
+  for (const auto& [class_idx, method] : class_method_map_) {
+    // Already bound by the class_data_item of its class
+    if (method->parent_ != nullptr) {
+      continue;
     }
-
+    Class* cls = resolve_class(class_idx);
+    if (cls == nullptr) {
+      continue;
+    }
+    method->parent_ = cls;
+    cls->methods_.push_back(method);
   }
 }
 
 void Parser::resolve_external_fields() {
   LIEF_DEBUG("Resolving external fields for #{:d} fields", class_field_map_.size());
 
-  for (const std::pair<const std::string, Field*>& p : class_field_map_) {
-    const std::string& clazz = p.first;
-    Field* field = p.second;
+  for (const auto& [class_idx, field] : class_field_map_) {
+    if (field->parent_ != nullptr) {
+      continue;
+    }
+    Class* cls = resolve_class(class_idx);
+    if (cls == nullptr) {
+      continue;
+    }
+    field->parent_ = cls;
+    cls->fields_.push_back(field);
+  }
+}
 
-    const auto it_inner_class = file_->classes_.find(clazz);
-    if (it_inner_class == std::end(file_->classes_)) {
-      auto cls = std::make_unique<Class>(clazz);
-      cls->fields_.push_back(field);
-      field->parent_ = cls.get();
-      file_->add_class(std::move(cls));
-    } else {
-      Class* cls = it_inner_class->second;
-      field->parent_ = cls;
-      cls->fields_.push_back(field);
+void Parser::resolve_types() {
+  for (size_t i = 0; i < file_->types_.size(); ++i) {
+    Type& type = *file_->types_[i];
+    if (type.type() != Type::TYPES::CLASS &&
+        (type.type() != Type::TYPES::ARRAY ||
+         type.underlying_array_type().type() != Type::TYPES::CLASS))
+    {
+      continue;
     }
+    type.underlying_array_type().cls_ = resolve_class(i);
+  }
+}
 
+Class* Parser::resolve_class(uint32_t type_idx) {
+  if (type_idx >= type_classes_.size()) {
+    return nullptr;
   }
+
+  if (Class* cls = type_classes_[type_idx]) {
+    return cls;
+  }
+
+  std::string descriptor = type_descriptor(type_idx);
+  Class* cls = nullptr;
+  if (!descriptor.empty() && descriptor[0] == '[') {
+    // Arrays are bound to the class of their elements
+    descriptor = descriptor.substr(descriptor.find_last_of('[') + 1);
+    const uint32_t elt_idx = find_type(descriptor);
+    cls = elt_idx != details::NO_INDEX ? resolve_class(elt_idx) :
+                                         get_or_create_class(descriptor);
+  } else {
+    cls = get_or_create_class(descriptor);
+  }
+  type_classes_[type_idx] = cls;
+  return cls;
 }
 
-void Parser::resolve_types() {
-  for (const auto& p : class_type_map_) {
-    if(Class* cls = file_->get_class(p.first)) {
-      p.second->underlying_array_type().cls_ = cls;
+Class* Parser::get_or_create_class(const std::string& name) {
+  if (auto it = file_->classes_.find(name); it != file_->classes_.end()) {
+    return it->second;
+  }
+  auto external_class = std::make_unique<Class>(name);
+  Class* cls = external_class.get();
+  file_->add_class(std::move(external_class));
+  return cls;
+}
+
+uint32_t Parser::find_type(const std::string& descriptor) const {
+  // type_ids are sorted by string_id and string_ids are sorted by content
+  const details::StringPool& pool = file_->string_pool();
+  size_t lo = 0;
+  size_t hi = type_descriptors_.size();
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    const int cmp = pool.get(type_descriptors_[mid]).compare(descriptor);
+    if (cmp == 0) {
+      return mid;
+    }
+    if (cmp < 0) {
+      lo = mid + 1;
     } else {
-      auto new_cls = std::make_unique<Class>(p.first);
-      p.second->underlying_array_type().cls_ = new_cls.get();
-      file_->add_class(std::move(new_cls));
+      hi = mid;
     }
   }
+  return details::NO_INDEX;
+}
+
+std::string Parser::type_descriptor(uint32_t type_idx) const {
+  if (type_idx >= type_descriptors_.size()) {
+    return "";
+  }
+  return std::string(file_->string_pool().get(type_descriptors_[type_idx]));
 }
 
 
@@ -25,6 +25,7 @@
 #include "LIEF/DEX/Field.hpp"
 #include "LIEF/DEX/MapList.hpp"
 #include "DEX/Structures.hpp"
+#include "DEX/StringPool.hpp"
 
 #include "Header.tcc"
 
@@ -33,8 +34,6 @@ namespace DEX {
 
 template<typename DEX_T>
 void Parser::parse_file() {
-  file_->original_data_ = stream_->content();
-
   parse_header<DEX_T>();
   parse_map<DEX_T>();
   parse_strings<DEX_T>();
@@ -113,25 +112,8 @@ void Parser::parse_strings() {
     }
   }
 
-  file_->strings_.reserve(strings_location.second);
-  for (size_t i = 0; i < strings_location.second; ++i) {
-    auto string_offset = stream_->peek<uint32_t>(strings_location.first + i * sizeof(uint32_t));
-    if (!string_offset) {
-      break;
-    }
-    stream_->setpos(*string_offset);
-    size_t str_size = 0;
-    if (auto res = stream_->read_uleb128()) {
-      str_size = *res;
-    } else {
-      break;
-    }
-    auto string_value = stream_->read_mutf8(str_size);
-    if (!string_value) {
-      break;
-    }
-    file_->strings_.push_back(std::make_unique<std::string>(*string_value));
-  }
+  file_->string_pool_ = std::make_unique<details::StringPool>(
+      file_->original_data_, strings_location.first, strings_location.second);
 }
 
 template<typename DEX_T>
@@ -144,6 +126,8 @@ void Parser::parse_types() {
     return;
   }
 
+  const details::StringPool& pool = file_->string_pool();
+
   stream_->setpos(types_location.first);
   for (size_t i = 0; i < types_location.second; ++i) {
     auto descriptor_idx = stream_->read<uint32_t>();
@@ -151,33 +135,19 @@ void Parser::parse_types() {
       break;
     }
 
-    if (*descriptor_idx >= file_->strings_.size()) {
+    if (*descriptor_idx >= pool.size()) {
       break;
     }
-    std::unique_ptr<std::string>& descriptor_str = file_->strings_[*descriptor_idx];
-    auto type = std::make_unique<Type>(*descriptor_str);
-
-    if (type->type() == Type::TYPES::CLASS) {
-      class_type_map_.emplace(*descriptor_str, type.get());
-    }
-
-    else if (type->type() == Type::TYPES::ARRAY) {
-      const Type& array_type = type->underlying_array_type();
-      if (array_type.type() == Type::TYPES::CLASS) {
-        std::string mangled_name = *descriptor_str;
-        mangled_name = mangled_name.substr(mangled_name.find_last_of('[') + 1);
-        class_type_map_.emplace(mangled_name, type.get());
-      }
-    }
-
-    file_->types_.push_back(std::move(type));
+    type_descriptors_.push_back(*descriptor_idx);
+    file_->types_.push_back(std::make_unique<Type>(std::string(pool[*descriptor_idx])));
   }
+  type_classes_.resize(type_descriptors_.size(), nullptr);
 }
 
 template<typename DEX_T>
 void Parser::parse_fields() {
   Header::location_t fields_location = file_->header().fields();
-  Header::location_t types_location = file_->header().types();
+  const details::StringPool& pool = file_->string_pool();
 
   const uint64_t fields_offset = fields_location.first;
 
@@ -190,27 +160,12 @@ void Parser::parse_fields() {
     }
     const auto item = *res_item;
 
-    // Class name in which the field is defined
-    if (item.class_idx > types_location.second) {
+    // Class in which the field is defined
+    if (item.class_idx >= type_descriptors_.size()) {
       LIEF_WARN("Type index for field name is corrupted");
       continue;
     }
 
-    const auto class_name_idx = stream_->peek<uint32_t>(types_location.first + item.class_idx * sizeof(uint32_t));
-    if (!class_name_idx) {
-      continue;
-    }
-
-    if (*class_name_idx >= file_->strings_.size()) {
-      LIEF_WARN("String index for class name is corrupted");
-      continue;
-    }
-    std::string clazz = *file_->strings_[*class_name_idx];
-    if (!clazz.empty() && clazz[0] == '[') {
-      size_t pos = clazz.find_last_of('[');
-      clazz = clazz.substr(pos + 1);
-    }
-
     // Type
     // =======================
     if (item.type_idx >= file_->types_.size()) {
@@ -220,12 +175,12 @@ void Parser::parse_fields() {
     std::unique_ptr<Type>& type = file_->types_[item.type_idx];
 
     // Field Name
-    if (item.name_idx >= file_->strings_.size()) {
+    if (item.name_idx >= pool.size()) {
       LIEF_WARN("Name of field #{:d} is out of bound!", i);
       continue;
     }
 
-    std::string name = *file_->strings_[item.name_idx];
+    std::string name(pool[item.name_idx]);
     if (name.empty()) {
       LIEF_WARN("Empty field name");
     }
@@ -234,8 +189,8 @@ void Parser::parse_fields() {
     field->original_index_ = i;
     field->type_ = type.get();
 
-    if (!clazz.empty() && clazz[0] != '[') {
-      class_field_map_.emplace(clazz, field.get());
+    if (!pool[type_descriptors_[item.class_idx]].empty()) {
+      class_field_map_.emplace_back(item.class_idx, field.get());
     }
     file_->fields_.push_back(std::move(field));
   }
@@ -260,11 +215,10 @@ void Parser::parse_prototypes() {
     }
     const auto item = *res_item;
 
-    if (item.shorty_idx >= file_->strings_.size()) {
+    if (item.shorty_idx >= file_->string_pool().size()) {
       LIEF_WARN("prototype.shorty_idx corrupted ({:d})", item.shorty_idx);
       break;
     }
-    //std::string* shorty_str = file_->strings_[item.shorty_idx];
 
     // Type object that is returned
     if (item.return_type_idx >= file_->types_.size()) {
@@ -304,7 +258,7 @@ void Parser::parse_prototypes() {
 template<typename DEX_T>
 void Parser::parse_methods() {
   Header::location_t methods_location = file_->header().methods();
-  Header::location_t types_location = file_->header().types();
+  const details::StringPool& pool = file_->string_pool();
 
   const uint64_t methods_offset = methods_location.first;
 
@@ -317,29 +271,12 @@ void Parser::parse_methods() {
     }
     const auto item = *res_item;
 
-    // Class name in which the method is defined
-    if (item.class_idx > types_location.second) {
+    // Class in which the method is defined
+    if (item.class_idx >= type_descriptors_.size()) {
       LIEF_WARN("Type index for class name is corrupted");
       continue;
     }
-    const auto class_name_idx = stream_->peek<uint32_t>(types_location.first + item.class_idx * sizeof(uint32_t));
-    if (!class_name_idx) {
-      break;
-    }
-
-    if (*class_name_idx >= file_->strings_.size()) {
-      LIEF_WARN("String index for class name is corrupted");
-      continue;
-    }
-
-    std::string clazz = *file_->strings_[*class_name_idx];
-    if (!clazz.empty() && clazz[0] == '[') {
-      size_t pos = clazz.find_last_of('[');
-      clazz = clazz.substr(pos + 1);
-    }
-
-    //CHECK_EQ(clazz[0], 'L') << "Not supported class: " << clazz;
-
+    const bool has_class = !pool[type_descriptors_[item.class_idx]].empty();
 
     // Prototype
     // =======================
@@ -350,13 +287,13 @@ void Parser::parse_methods() {
     std::unique_ptr<Prototype>& pt = file_->prototypes_[item.proto_idx];
 
     // Method Name
-    if (item.name_idx >= file_->strings_.size()) {
+    if (item.name_idx >= pool.size()) {
       LIEF_WARN("Name of method #{:d} is out of bound!", i);
       continue;
     }
 
-    std::string name = *file_->strings_[item.name_idx];
-    if (clazz.empty()) {
+    std::string name(pool[item.name_idx]);
+    if (!has_class) {
       LIEF_WARN("Empty class name");
     }
 
@@ -367,8 +304,8 @@ void Parser::parse_methods() {
     method->original_index_ = i;
     method->prototype_ = pt.get();
 
-    if (!clazz.empty() && clazz[0] != '[') {
-      class_method_map_.emplace(clazz, method.get());
+    if (has_class) {
+      class_method_map_.emplace_back(item.class_idx, method.get());
     }
     file_->methods_.push_back(std::move(method));
   }
@@ -377,7 +314,7 @@ void Parser::parse_methods() {
 template<typename DEX_T>
 void Parser::parse_classes() {
   Header::location_t classes_location = file_->header().classes();
-  Header::location_t types_location = file_->header().types();
+  const details::StringPool& pool = file_->string_pool();
 
   const uint64_t classes_offset = classes_location.first;
 
@@ -391,55 +328,32 @@ void Parser::parse_classes() {
     const auto item = *res_item;
 
     // Get full class name
-    uint32_t type_idx = item.class_idx;
+    const uint32_t type_idx = item.class_idx;
 
     std::string name;
-    if (type_idx > types_location.second) {
+    if (type_idx >= type_descriptors_.size()) {
       LIEF_ERR("Type Corrupted");
     } else {
-      auto class_name_idx = stream_->peek<uint32_t>(types_location.first + type_idx * sizeof(uint32_t));
-      if (!class_name_idx) {
-        break;
-      }
-      if (*class_name_idx >= file_->strings_.size()) {
-        LIEF_WARN("String index for class name corrupted");
-      } else {
-        name = *file_->strings_[*class_name_idx];
-      }
+      name = type_descriptor(type_idx);
     }
 
-    // Get parent class name (if any)
-    std::string parent_name;
+    // Get parent class (if already parsed)
     Class* parent_ptr = nullptr;
     if (item.superclass_idx != details::NO_INDEX) {
-      if (item.superclass_idx > types_location.second) {
+      if (item.superclass_idx >= type_descriptors_.size()) {
         LIEF_WARN("Type index for super class name corrupted");
         continue;
       }
-      auto super_class_name_idx = stream_->peek<uint32_t>(types_location.first + item.superclass_idx * sizeof(uint32_t));
-      if (!super_class_name_idx) {
-        break;
-      }
-      if (*super_class_name_idx >= file_->strings_.size()) {
-        LIEF_WARN("String index for super class name corrupted");
-      } else {
-        parent_name = *file_->strings_[*super_class_name_idx];
-      }
-
-      // Check if already parsed the parent class
-      const auto it_parent = file_->classes_.find(parent_name);
-      if (it_parent != std::end(file_->classes_)) {
-        parent_ptr = it_parent->second;
-      }
+      parent_ptr = type_classes_[item.superclass_idx];
     }
 
     // Get Source filename (if any)
     std::string source_filename;
     if (item.source_file_idx != details::NO_INDEX) {
-      if (item.source_file_idx >= file_->strings_.size()) {
+      if (item.source_file_idx >= pool.size()) {
         LIEF_WARN("String index for source filename corrupted");
       } else {
-        source_filename = *file_->strings_[item.source_file_idx];
+        source_filename = pool[item.source_file_idx];
       }
     }
 
@@ -447,7 +361,11 @@ void Parser::parse_classes() {
     clazz->original_index_ = i;
     if (parent_ptr == nullptr) {
       // Register in inheritance map to be resolved later
-      inheritance_.emplace(parent_name, clazz.get());
+      inheritance_.emplace_back(item.superclass_idx, clazz.get());
+    }
+
+    if (type_idx < type_classes_.size() && type_classes_[type_idx] == nullptr) {
+      type_classes_[type_idx] = clazz.get();
     }
 
     Class& cls = *clazz;
@@ -459,7 +377,7 @@ void Parser::parse_classes() {
     }
 
     // Parse Class content
-    if (item.class_data_off > 0) {
+    if (item.class_data_off > 0 && config_.accept_class(cls.fullname())) {
       parse_class_data<DEX_T>(item.class_data_off, cls);
     }
 
@@ -524,6 +442,10 @@ void Parser::parse_class_data(uint32_t offset, Class& cls) {
       break;
     }
 
+    if (!config_.parse_fields) {
+      stream_->read_uleb128(); // access flags
+      continue;
+    }
     parse_field<DEX_T>(field_idx, cls, true);
   }
 
@@ -541,6 +463,10 @@ void Parser::parse_class_data(uint32_t offset, Class& cls) {
       break;
     }
 
+    if (!config_.parse_fields) {
+      stream_->read_uleb128(); // access flags
+      continue;
+    }
     parse_field<DEX_T>(field_idx, cls, false);
   }
 
@@ -604,15 +530,6 @@ void Parser::parse_field(size_t index, Class& cls, bool is_static) {
   field->access_flags_ = static_cast<uint32_t>(*access_flags);
   field->parent_ = &cls;
   cls.fields_.push_back(field.get());
-
-  const auto range = class_field_map_.equal_range(cls.fullname());
-  for (auto it = range.first; it != range.second;) {
-    if (it->second == field.get()) {
-      it = class_field_map_.erase(it);
-    } else {
-      ++it;
-    }
-  }
 }
 
 
@@ -646,16 +563,7 @@ void Parser::parse_method(size_t index, Class& cls, bool is_virtual) {
   method->parent_ = &cls;
   cls.methods_.push_back(method.get());
 
-  const auto range = class_method_map_.equal_range(cls.fullname());
-  for (auto it = range.first; it != range.second;) {
-    if (it->second == method.get()) {
-      it = class_method_map_.erase(it);
-    } else {
-      ++it;
-    }
-  }
-
-  if (*code_offset > 0) {
+  if (*code_offset > 0 && config_.parse_code) {
     parse_code_info<DEX_T>(*code_offset, *method);
   }
 }
@@ -672,7 +580,7 @@ void Parser::parse_code_info(uint32_t offset, Method& method) {
                                                       /* size   */ codeitem->insns_size * sizeof(uint16_t));
   method.code_offset_ = offset + sizeof(details::code_item);
   if (bytecode != nullptr) {
-    method.bytecode_ = {bytecode, bytecode + codeitem->insns_size * sizeof(uint16_t)};
+    method.bytecode_ = {bytecode, codeitem->insns_size * sizeof(uint16_t)};
   }
 }
 
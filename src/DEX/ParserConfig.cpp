@@ -0,0 +1,80 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LIEF/DEX/ParserConfig.hpp"
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/fmt/ranges.h>
+#include <sstream>
+
+namespace LIEF::DEX {
+
+// A Java name can't contain '/' or ';' so that `Lcom.foo` or `LegacyApp` are
+// (Java) package prefixes while `Lcom/foo/`, `LMain;` and `[I` are descriptors
+static bool is_descriptor(const std::string& filter) {
+  if (filter[0] == '[') {
+    return true;
+  }
+  return filter[0] == 'L' &&
+         (filter.find('/') != std::string::npos || filter.back() == ';');
+}
+
+bool ParserConfig::accept_class(const std::string& descriptor) const {
+  if (class_filters.empty()) {
+    return true;
+  }
+
+  for (const std::string& filter : class_filters) {
+    if (filter.empty()) {
+      return true;
+    }
+
+    if (is_descriptor(filter)) {
+      if (descriptor.compare(0, filter.size(), filter) == 0) {
+        return true;
+      }
+      continue;
+    }
+
+    // Java notation: com.vendor.sdk. matches Lcom/vendor/sdk/
+    if (descriptor.size() <= filter.size() || descriptor[0] != 'L') {
+      continue;
+    }
+    size_t i = 0;
+    for (; i < filter.size(); ++i) {
+      const char c = filter[i] == '.' ? '/' : filter[i];
+      if (descriptor[i + 1] != c) {
+        break;
+      }
+    }
+    if (i == filter.size()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string ParserConfig::to_string() const {
+  static constexpr auto WIDTH = 14;
+  using namespace fmt;
+  std::ostringstream os;
+  os << "ParserConfig {\n"
+     << format("  {:{}}: {}\n", "class_filters", WIDTH, join(class_filters, ", "))
+     << format("  {:{}}: {}\n", "parse_fields", WIDTH, parse_fields)
+     << format("  {:{}}: {}\n", "parse_code", WIDTH, parse_code)
+     << "}\n";
+  return os.str();
+}
+
+}
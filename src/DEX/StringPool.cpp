@@ -0,0 +1,95 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+
+#include "logging.hpp"
+
+#include "LIEF/BinaryStream/SpanStream.hpp"
+
+#include "DEX/StringPool.hpp"
+
+namespace LIEF {
+namespace DEX {
+namespace details {
+
+// Used for the (resolved) empty strings
+static constexpr char EMPTY[] = "";
+
+StringPool::StringPool(span<const uint8_t> content, uint32_t string_ids,
+                       uint32_t nb_strings) :
+  content_(content),
+  string_ids_(string_ids)
+{
+  // Only consider the string_id_item that are in the bounds of the content
+  const uint64_t max_strings = string_ids < content.size() ?
+    (content.size() - string_ids) / sizeof(uint32_t) : 0;
+  if (nb_strings > max_strings) {
+    LIEF_WARN("String pool is truncated ({} strings vs {})", nb_strings, max_strings);
+  }
+  entries_.resize(std::min<uint64_t>(nb_strings, max_strings));
+}
+
+std::string_view StringPool::decode(uint32_t idx) const {
+  entry_t& entry = entries_[idx];
+  entry.data = EMPTY;
+  entry.size = 0;
+
+  SpanStream stream(content_);
+  auto string_offset = stream.peek<uint32_t>(string_ids_ + idx * sizeof(uint32_t));
+  if (!string_offset) {
+    return {};
+  }
+
+  stream.setpos(*string_offset);
+  auto utf16_size = stream.read_uleb128();
+  if (!utf16_size) {
+    LIEF_DEBUG("String #{} is corrupted", idx);
+    return {};
+  }
+
+  // Fast path: the string is pure ASCII
+  const size_t start = stream.pos();
+  const size_t max_size = std::min<uint64_t>(*utf16_size, content_.size() - start);
+  const auto* raw = reinterpret_cast<const char*>(content_.data() + start);
+  size_t size = 0;
+  while (size < max_size && raw[size] != 0 &&
+         (static_cast<uint8_t>(raw[size]) & 0x80) == 0)
+  {
+    ++size;
+  }
+
+  const bool complete = size == *utf16_size || (size < max_size && raw[size] == 0);
+  if (complete) {
+    entry.data = raw;
+    entry.size = size;
+    return {raw, size};
+  }
+
+  // Slow path: MUTF-8 -> UTF-8
+  auto utf8 = stream.read_mutf8(*utf16_size);
+  if (!utf8) {
+    LIEF_DEBUG("String #{} is corrupted", idx);
+    return {};
+  }
+  const std::string& str = utf8_.emplace_back(std::move(*utf8));
+  entry.data = str.empty() ? EMPTY : str.data();
+  entry.size = str.size();
+  return {entry.data, entry.size};
+}
+
+}
+}
+}
@@ -0,0 +1,98 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_DEX_STRING_POOL_H
+#define LIEF_DEX_STRING_POOL_H
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "LIEF/span.hpp"
+
+namespace LIEF {
+namespace DEX {
+namespace details {
+
+/// String pool of a DEX file indexed by `string_id`.
+///
+/// The pool does not own the strings: it references the `string_data_item`
+/// of the DEX file's content which is already a contiguous arena of MUTF-8
+/// strings. The strings are decoded on the first access and, since most of
+/// them are pure ASCII (MUTF-8 and UTF-8 are then identical), the returned
+/// views point directly in the content. Only the strings that contain
+/// non-ASCII characters are converted into UTF-8 and stored in the pool.
+///
+/// The content referenced by the pool must outlive it. This class is not
+/// thread-safe as get() lazily updates the pool: once the DEX file is parsed,
+/// the pool is only read by DEX::File::strings() under `strings_once`.
+class StringPool {
+  public:
+  StringPool() = default;
+
+  /// Create a pool over `content` for the `nb_strings` `string_id_item`
+  /// located at the offset `string_ids`.
+  StringPool(span<const uint8_t> content, uint32_t string_ids, uint32_t nb_strings);
+
+  StringPool(const StringPool&) = delete;
+  StringPool& operator=(const StringPool&) = delete;
+
+  /// Number of strings in the pool
+  size_t size() const {
+    return entries_.size();
+  }
+
+  /// UTF-8 string associated with the given `string_id`. An empty view is
+  /// returned if the index or the string is corrupted.
+  std::string_view get(uint32_t idx) const {
+    if (idx >= entries_.size()) {
+      return {};
+    }
+    const entry_t& entry = entries_[idx];
+    if (entry.data == nullptr) {
+      return decode(idx);
+    }
+    return {entry.data, entry.size};
+  }
+
+  std::string_view operator[](uint32_t idx) const {
+    return get(idx);
+  }
+
+  /// Guard of the copy of the pool made by DEX::File::strings()
+  std::once_flag strings_once;
+
+  private:
+  struct entry_t {
+    /// nullptr if the string has not been decoded yet
+    const char* data = nullptr;
+    uint32_t size = 0;
+  };
+
+  std::string_view decode(uint32_t idx) const;
+
+  span<const uint8_t> content_;
+  uint32_t string_ids_ = 0;
+
+  mutable std::vector<entry_t> entries_;
+  mutable std::deque<std::string> utf8_;
+};
+
+}
+}
+}
+#endif
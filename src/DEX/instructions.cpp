@@ -18,306 +18,327 @@
 #include "LIEF/DEX/instructions.hpp"
 
 #include <algorithm>
-#include <map>
+#include <array>
+#include <climits>
 
 namespace LIEF {
 namespace DEX {
 
+// Opcode -> format lookup table
+static const std::array<INST_FORMATS, 256>& formats_table() {
+  static const std::array<INST_FORMATS, 256> TABLE = [] {
+    static const std::pair<OPCODES, INST_FORMATS> FORMATS[] = {
+      { OPCODES::OP_NOP,                    INST_FORMATS::F_10x },
+      { OPCODES::OP_MOVE,                   INST_FORMATS::F_12x },
+      { OPCODES::OP_MOVE_FROM_16,           INST_FORMATS::F_22x },
+      { OPCODES::OP_MOVE_16,                INST_FORMATS::F_32x },
+      { OPCODES::OP_MOVE_WIDE,              INST_FORMATS::F_12x },
+      { OPCODES::OP_MOVE_WIDE_FROM_16,      INST_FORMATS::F_22x },
+      { OPCODES::OP_MOVE_WIDE_16,           INST_FORMATS::F_32x },
+      { OPCODES::OP_MOVE_OBJECT,            INST_FORMATS::F_12x },
+      { OPCODES::OP_MOVE_OBJECT_FROM_16,    INST_FORMATS::F_22x },
+      { OPCODES::OP_MOVE_OBJECT_16,         INST_FORMATS::F_32x },
+      { OPCODES::OP_MOVE_RESULT,            INST_FORMATS::F_11x },
+      { OPCODES::OP_MOVE_RESULT_WIDE,       INST_FORMATS::F_11x },
+      { OPCODES::OP_MOVE_RESULT_OBJECT,     INST_FORMATS::F_11x },
+      { OPCODES::OP_MOVE_EXCEPTION,         INST_FORMATS::F_11x },
+      { OPCODES::OP_RETURN_VOID,            INST_FORMATS::F_10x },
+      { OPCODES::OP_RETURN,                 INST_FORMATS::F_11x },
+      { OPCODES::OP_RETURN_WIDE,            INST_FORMATS::F_11x },
+      { OPCODES::OP_RETURN_OBJECT,          INST_FORMATS::F_11x },
+      { OPCODES::OP_CONST_4,                INST_FORMATS::F_11n },
+      { OPCODES::OP_CONST_16,               INST_FORMATS::F_21s },
+      { OPCODES::OP_CONST,                  INST_FORMATS::F_31i },
+      { OPCODES::OP_CONST_HIGH_16,          INST_FORMATS::F_21h },
+      { OPCODES::OP_CONST_WIDE_16,          INST_FORMATS::F_21s },
+      { OPCODES::OP_CONST_WIDE_32,          INST_FORMATS::F_31i },
+      { OPCODES::OP_CONST_WIDE,             INST_FORMATS::F_51l },
+      { OPCODES::OP_CONST_WIDE_HIGH_16,     INST_FORMATS::F_21h },
+      { OPCODES::OP_CONST_STRING,           INST_FORMATS::F_21c },
+      { OPCODES::OP_CONST_STRING_JUMBO,     INST_FORMATS::F_31c },
+      { OPCODES::OP_CONST_CLASS,            INST_FORMATS::F_21c },
+      { OPCODES::OP_MONITOR_ENTER,          INST_FORMATS::F_11x },
+      { OPCODES::OP_MONITOR_EXIT,           INST_FORMATS::F_11x },
+      { OPCODES::OP_CHECK_CAST,             INST_FORMATS::F_21c },
+      { OPCODES::OP_INSTANCE_OF,            INST_FORMATS::F_22c },
+      { OPCODES::OP_ARRAY_LENGTH,           INST_FORMATS::F_12x },
+      { OPCODES::OP_NEW_INSTANCE,           INST_FORMATS::F_21c },
+      { OPCODES::OP_NEW_ARRAY,              INST_FORMATS::F_22c },
+      { OPCODES::OP_FILLED_NEW_ARRAY,       INST_FORMATS::F_35c },
+      { OPCODES::OP_FILLED_NEW_ARRAY_RANGE, INST_FORMATS::F_3rc },
+      { OPCODES::OP_FILL_ARRAY_DATA,        INST_FORMATS::F_31t },
+      { OPCODES::OP_THROW,                  INST_FORMATS::F_11x },
+      { OPCODES::OP_GOTO,                   INST_FORMATS::F_10t },
+      { OPCODES::OP_GOTO_16,                INST_FORMATS::F_20t },
+      { OPCODES::OP_GOTO_32,                INST_FORMATS::F_30t },
+      { OPCODES::OP_PACKED_SWITCH,          INST_FORMATS::F_31t },
+      { OPCODES::OP_SPARSE_SWITCH,          INST_FORMATS::F_31t },
+      { OPCODES::OP_CMPL_FLOAT,             INST_FORMATS::F_23x },
+      { OPCODES::OP_CMPG_FLOAT,             INST_FORMATS::F_23x },
+      { OPCODES::OP_CMPL_DOUBLE,            INST_FORMATS::F_23x },
+      { OPCODES::OP_CMPG_DOUBLE,            INST_FORMATS::F_23x },
+      { OPCODES::OP_CMP_LONG,               INST_FORMATS::F_23x },
+      { OPCODES::OP_IF_EQ,                  INST_FORMATS::F_22t },
+      { OPCODES::OP_IF_NE,                  INST_FORMATS::F_22t },
+      { OPCODES::OP_IF_LT,                  INST_FORMATS::F_22t },
+      { OPCODES::OP_IF_GE,                  INST_FORMATS::F_22t },
+      { OPCODES::OP_IF_GT,                  INST_FORMATS::F_22t },
+      { OPCODES::OP_IF_LE,                  INST_FORMATS::F_22t },
+      { OPCODES::OP_IF_EQZ,                 INST_FORMATS::F_21t },
+      { OPCODES::OP_IF_NEZ,                 INST_FORMATS::F_21t },
+      { OPCODES::OP_IF_LTZ,                 INST_FORMATS::F_21t },
+      { OPCODES::OP_IF_GEZ,                 INST_FORMATS::F_21t },
+      { OPCODES::OP_IF_GTZ,                 INST_FORMATS::F_21t },
+      { OPCODES::OP_IF_LEZ,                 INST_FORMATS::F_21t },
+      { OPCODES::OP_AGET,                   INST_FORMATS::F_23x },
+      { OPCODES::OP_AGET_WIDE,              INST_FORMATS::F_23x },
+      { OPCODES::OP_AGET_OBJECT,            INST_FORMATS::F_23x },
+      { OPCODES::OP_AGET_BOOLEAN,           INST_FORMATS::F_23x },
+      { OPCODES::OP_AGET_BYTE,              INST_FORMATS::F_23x },
+      { OPCODES::OP_AGET_CHAR,              INST_FORMATS::F_23x },
+      { OPCODES::OP_AGET_SHORT,             INST_FORMATS::F_23x },
+      { OPCODES::OP_APUT,                   INST_FORMATS::F_23x },
+      { OPCODES::OP_APUT_WIDE,              INST_FORMATS::F_23x },
+      { OPCODES::OP_APUT_OBJECT,            INST_FORMATS::F_23x },
+      { OPCODES::OP_APUT_BOOLEAN,           INST_FORMATS::F_23x },
+      { OPCODES::OP_APUT_BYTE,              INST_FORMATS::F_23x },
+      { OPCODES::OP_APUT_CHAR,              INST_FORMATS::F_23x },
+      { OPCODES::OP_APUT_SHORT,             INST_FORMATS::F_23x },
+      { OPCODES::OP_IGET,                   INST_FORMATS::F_22c },
+      { OPCODES::OP_IGET_WIDE,              INST_FORMATS::F_22c },
+      { OPCODES::OP_IGET_OBJECT,            INST_FORMATS::F_22c },
+      { OPCODES::OP_IGET_BOOLEAN,           INST_FORMATS::F_22c },
+      { OPCODES::OP_IGET_BYTE,              INST_FORMATS::F_22c },
+      { OPCODES::OP_IGET_CHAR,              INST_FORMATS::F_22c },
+      { OPCODES::OP_IGET_SHORT,             INST_FORMATS::F_22c },
+      { OPCODES::OP_IPUT,                   INST_FORMATS::F_22c },
+      { OPCODES::OP_IPUT_WIDE,              INST_FORMATS::F_22c },
+      { OPCODES::OP_IPUT_OBJECT,            INST_FORMATS::F_22c },
+      { OPCODES::OP_IPUT_BOOLEAN,           INST_FORMATS::F_22c },
+      { OPCODES::OP_IPUT_BYTE,              INST_FORMATS::F_22c },
+      { OPCODES::OP_IPUT_CHAR,              INST_FORMATS::F_22c },
+      { OPCODES::OP_IPUT_SHORT,             INST_FORMATS::F_22c },
+      { OPCODES::OP_SGET,                   INST_FORMATS::F_21c },
+      { OPCODES::OP_SGET_WIDE,              INST_FORMATS::F_21c },
+      { OPCODES::OP_SGET_OBJECT,            INST_FORMATS::F_21c },
+      { OPCODES::OP_SGET_BOOLEAN,           INST_FORMATS::F_21c },
+      { OPCODES::OP_SGET_BYTE,              INST_FORMATS::F_21c },
+      { OPCODES::OP_SGET_CHAR,              INST_FORMATS::F_21c },
+      { OPCODES::OP_SGET_SHORT,             INST_FORMATS::F_21c },
+      { OPCODES::OP_SPUT,                   INST_FORMATS::F_21c },
+      { OPCODES::OP_SPUT_WIDE,              INST_FORMATS::F_21c },
+      { OPCODES::OP_SPUT_OBJECT,            INST_FORMATS::F_21c },
+      { OPCODES::OP_SPUT_BOOLEAN,           INST_FORMATS::F_21c },
+      { OPCODES::OP_SPUT_BYTE,              INST_FORMATS::F_21c },
+      { OPCODES::OP_SPUT_CHAR,              INST_FORMATS::F_21c },
+      { OPCODES::OP_SPUT_SHORT,             INST_FORMATS::F_21c },
+      { OPCODES::OP_INVOKE_VIRTUAL,         INST_FORMATS::F_35c },
+      { OPCODES::OP_INVOKE_SUPER,           INST_FORMATS::F_35c },
+      { OPCODES::OP_INVOKE_DIRECT,          INST_FORMATS::F_35c },
+      { OPCODES::OP_INVOKE_STATIC,          INST_FORMATS::F_35c },
+      { OPCODES::OP_INVOKE_INTERFACE,       INST_FORMATS::F_35c },
+      { OPCODES::OP_RETURN_VOID_NO_BARRIER, INST_FORMATS::F_10x },
+      { OPCODES::OP_INVOKE_VIRTUAL_RANGE,   INST_FORMATS::F_3rc },
+      { OPCODES::OP_INVOKE_SUPER_RANGE,     INST_FORMATS::F_3rc },
+      { OPCODES::OP_INVOKE_DIRECT_RANGE,    INST_FORMATS::F_3rc },
+      { OPCODES::OP_INVOKE_STATIC_RANGE,    INST_FORMATS::F_3rc },
+      { OPCODES::OP_INVOKE_INTERFACE_RANGE, INST_FORMATS::F_3rc },
+      { OPCODES::OP_NEG_INT,                INST_FORMATS::F_12x },
+      { OPCODES::OP_NOT_INT,                INST_FORMATS::F_12x },
+      { OPCODES::OP_NEG_LONG,               INST_FORMATS::F_12x },
+      { OPCODES::OP_NOT_LONG,               INST_FORMATS::F_12x },
+      { OPCODES::OP_NEG_FLOAT,              INST_FORMATS::F_12x },
+      { OPCODES::OP_NEG_DOUBLE,             INST_FORMATS::F_12x },
+      { OPCODES::OP_INT_TO_LONG,            INST_FORMATS::F_12x },
+      { OPCODES::OP_INT_TO_FLOAT,           INST_FORMATS::F_12x },
+      { OPCODES::OP_INT_TO_DOUBLE,          INST_FORMATS::F_12x },
+      { OPCODES::OP_LONG_TO_INT,            INST_FORMATS::F_12x },
+      { OPCODES::OP_LONG_TO_FLOAT,          INST_FORMATS::F_12x },
+      { OPCODES::OP_LONG_TO_DOUBLE,         INST_FORMATS::F_12x },
+      { OPCODES::OP_FLOAT_TO_INT,           INST_FORMATS::F_12x },
+      { OPCODES::OP_FLOAT_TO_LONG,          INST_FORMATS::F_12x },
+      { OPCODES::OP_FLOAT_TO_DOUBLE,        INST_FORMATS::F_12x },
+      { OPCODES::OP_DOUBLE_TO_INT,          INST_FORMATS::F_12x },
+      { OPCODES::OP_DOUBLE_TO_LONG,         INST_FORMATS::F_12x },
+      { OPCODES::OP_DOUBLE_TO_FLOAT,        INST_FORMATS::F_12x },
+      { OPCODES::OP_INT_TO_BYTE,            INST_FORMATS::F_12x },
+      { OPCODES::OP_INT_TO_CHAR,            INST_FORMATS::F_12x },
+      { OPCODES::OP_INT_TO_SHORT,           INST_FORMATS::F_12x },
+      { OPCODES::OP_ADD_INT,                INST_FORMATS::F_23x },
+      { OPCODES::OP_SUB_INT,                INST_FORMATS::F_23x },
+      { OPCODES::OP_MUL_INT,                INST_FORMATS::F_23x },
+      { OPCODES::OP_DIV_INT,                INST_FORMATS::F_23x },
+      { OPCODES::OP_REM_INT,                INST_FORMATS::F_23x },
+      { OPCODES::OP_AND_INT,                INST_FORMATS::F_23x },
+      { OPCODES::OP_OR_INT,                 INST_FORMATS::F_23x },
+      { OPCODES::OP_XOR_INT,                INST_FORMATS::F_23x },
+      { OPCODES::OP_SHL_INT,                INST_FORMATS::F_23x },
+      { OPCODES::OP_SHR_INT,                INST_FORMATS::F_23x },
+      { OPCODES::OP_USHR_INT,               INST_FORMATS::F_23x },
+      { OPCODES::OP_ADD_LONG,               INST_FORMATS::F_23x },
+      { OPCODES::OP_SUB_LONG,               INST_FORMATS::F_23x },
+      { OPCODES::OP_MUL_LONG,               INST_FORMATS::F_23x },
+      { OPCODES::OP_DIV_LONG,               INST_FORMATS::F_23x },
+      { OPCODES::OP_REM_LONG,               INST_FORMATS::F_23x },
+      { OPCODES::OP_AND_LONG,               INST_FORMATS::F_23x },
+      { OPCODES::OP_OR_LONG,                INST_FORMATS::F_23x },
+      { OPCODES::OP_XOR_LONG,               INST_FORMATS::F_23x },
+      { OPCODES::OP_SHL_LONG,               INST_FORMATS::F_23x },
+      { OPCODES::OP_SHR_LONG,               INST_FORMATS::F_23x },
+      { OPCODES::OP_USHR_LONG,              INST_FORMATS::F_23x },
+      { OPCODES::OP_ADD_FLOAT,              INST_FORMATS::F_23x },
+      { OPCODES::OP_SUB_FLOAT,              INST_FORMATS::F_23x },
+      { OPCODES::OP_MUL_FLOAT,              INST_FORMATS::F_23x },
+      { OPCODES::OP_DIV_FLOAT,              INST_FORMATS::F_23x },
+      { OPCODES::OP_REM_FLOAT,              INST_FORMATS::F_23x },
+      { OPCODES::OP_ADD_DOUBLE,             INST_FORMATS::F_23x },
+      { OPCODES::OP_SUB_DOUBLE,             INST_FORMATS::F_23x },
+      { OPCODES::OP_MUL_DOUBLE,             INST_FORMATS::F_23x },
+      { OPCODES::OP_DIV_DOUBLE,             INST_FORMATS::F_23x },
+      { OPCODES::OP_REM_DOUBLE,             INST_FORMATS::F_23x },
+      { OPCODES::OP_ADD_INT_2_ADDR,         INST_FORMATS::F_12x },
+      { OPCODES::OP_SUB_INT_2_ADDR,         INST_FORMATS::F_12x },
+      { OPCODES::OP_MUL_INT_2_ADDR,         INST_FORMATS::F_12x },
+      { OPCODES::OP_DIV_INT_2_ADDR,         INST_FORMATS::F_12x },
+      { OPCODES::OP_REM_INT_2_ADDR,         INST_FORMATS::F_12x },
+      { OPCODES::OP_AND_INT_2_ADDR,         INST_FORMATS::F_12x },
+      { OPCODES::OP_OR_INT_2_ADDR,          INST_FORMATS::F_12x },
+      { OPCODES::OP_XOR_INT_2_ADDR,         INST_FORMATS::F_12x },
+      { OPCODES::OP_SHL_INT_2_ADDR,         INST_FORMATS::F_12x },
+      { OPCODES::OP_SHR_INT_2_ADDR,         INST_FORMATS::F_12x },
+      { OPCODES::OP_USHR_INT_2_ADDR,        INST_FORMATS::F_12x },
+      { OPCODES::OP_ADD_LONG_2_ADDR,        INST_FORMATS::F_12x },
+      { OPCODES::OP_SUB_LONG_2_ADDR,        INST_FORMATS::F_12x },
+      { OPCODES::OP_MUL_LONG_2_ADDR,        INST_FORMATS::F_12x },
+      { OPCODES::OP_DIV_LONG_2_ADDR,        INST_FORMATS::F_12x },
+      { OPCODES::OP_REM_LONG_2_ADDR,        INST_FORMATS::F_12x },
+      { OPCODES::OP_AND_LONG_2_ADDR,        INST_FORMATS::F_12x },
+      { OPCODES::OP_OR_LONG_2_ADDR,         INST_FORMATS::F_12x },
+      { OPCODES::OP_XOR_LONG_2_ADDR,        INST_FORMATS::F_12x },
+      { OPCODES::OP_SHL_LONG_2_ADDR,        INST_FORMATS::F_12x },
+      { OPCODES::OP_SHR_LONG_2_ADDR,        INST_FORMATS::F_12x },
+      { OPCODES::OP_USHR_LONG_2_ADDR,       INST_FORMATS::F_12x },
+      { OPCODES::OP_ADD_FLOAT_2_ADDR,       INST_FORMATS::F_12x },
+      { OPCODES::OP_SUB_FLOAT_2_ADDR,       INST_FORMATS::F_12x },
+      { OPCODES::OP_MUL_FLOAT_2_ADDR,       INST_FORMATS::F_12x },
+      { OPCODES::OP_DIV_FLOAT_2_ADDR,       INST_FORMATS::F_12x },
+      { OPCODES::OP_REM_FLOAT_2_ADDR,       INST_FORMATS::F_12x },
+      { OPCODES::OP_ADD_DOUBLE_2_ADDR,      INST_FORMATS::F_12x },
+      { OPCODES::OP_SUB_DOUBLE_2_ADDR,      INST_FORMATS::F_12x },
+      { OPCODES::OP_MUL_DOUBLE_2_ADDR,      INST_FORMATS::F_12x },
+      { OPCODES::OP_DIV_DOUBLE_2_ADDR,      INST_FORMATS::F_12x },
+      { OPCODES::OP_REM_DOUBLE_2_ADDR,      INST_FORMATS::F_12x },
+      { OPCODES::OP_ADD_INT_LIT_16,         INST_FORMATS::F_22s },
+      { OPCODES::OP_RSUB_INT,               INST_FORMATS::F_22s },
+      { OPCODES::OP_MUL_INT_LIT_16,         INST_FORMATS::F_22s },
+      { OPCODES::OP_DIV_INT_LIT_16,         INST_FORMATS::F_22s },
+      { OPCODES::OP_REM_INT_LIT_16,         INST_FORMATS::F_22s },
+      { OPCODES::OP_AND_INT_LIT_16,         INST_FORMATS::F_22s },
+      { OPCODES::OP_OR_INT_LIT_16,          INST_FORMATS::F_22s },
+      { OPCODES::OP_XOR_INT_LIT_16,         INST_FORMATS::F_22s },
+      { OPCODES::OP_ADD_INT_LIT_8,          INST_FORMATS::F_22b },
+      { OPCODES::OP_RSUB_INT_LIT_8,         INST_FORMATS::F_22b },
+      { OPCODES::OP_MUL_INT_LIT_8,          INST_FORMATS::F_22b },
+      { OPCODES::OP_DIV_INT_LIT_8,          INST_FORMATS::F_22b },
+      { OPCODES::OP_REM_INT_LIT_8,          INST_FORMATS::F_22b },
+      { OPCODES::OP_AND_INT_LIT_8,          INST_FORMATS::F_22b },
+      { OPCODES::OP_OR_INT_LIT_8,           INST_FORMATS::F_22b },
+      { OPCODES::OP_XOR_INT_LIT_8,          INST_FORMATS::F_22b },
+      { OPCODES::OP_SHL_INT_LIT_8,          INST_FORMATS::F_22b },
+      { OPCODES::OP_SHR_INT_LIT_8,          INST_FORMATS::F_22b },
+      { OPCODES::OP_USHR_INT_LIT_8,         INST_FORMATS::F_22b },
+
+      { OPCODES::OP_INVOKE_POLYMORPHIC,       INST_FORMATS::F_45cc },
+      { OPCODES::OP_INVOKE_POLYMORPHIC_RANGE, INST_FORMATS::F_4rcc },
+      { OPCODES::OP_INVOKE_CUSTOM,            INST_FORMATS::F_35c  },
+      { OPCODES::OP_INVOKE_CUSTOM_RANGE,      INST_FORMATS::F_3rc  },
+
+      { OPCODES::OP_CONST_METHOD_HANDLE,        INST_FORMATS::F_21c },
+      { OPCODES::OP_CONST_METHOD_TYPE,          INST_FORMATS::F_21c },
+
+      { OPCODES::OP_IGET_QUICK,                 INST_FORMATS::F_22c },
+      { OPCODES::OP_IGET_WIDE_QUICK,            INST_FORMATS::F_22c },
+      { OPCODES::OP_IGET_OBJECT_QUICK,          INST_FORMATS::F_22c },
+      { OPCODES::OP_IPUT_QUICK,                 INST_FORMATS::F_22c },
+      { OPCODES::OP_IPUT_WIDE_QUICK,            INST_FORMATS::F_22c },
+      { OPCODES::OP_IPUT_OBJECT_QUICK,          INST_FORMATS::F_22c },
+      { OPCODES::OP_INVOKE_VIRTUAL_QUICK,       INST_FORMATS::F_35c },
+      { OPCODES::OP_INVOKE_VIRTUAL_RANGE_QUICK, INST_FORMATS::F_3rc },
+      { OPCODES::OP_IPUT_BOOLEAN_QUICK,         INST_FORMATS::F_22c },
+      { OPCODES::OP_IPUT_BYTE_QUICK,            INST_FORMATS::F_22c },
+      { OPCODES::OP_IPUT_CHAR_QUICK,            INST_FORMATS::F_22c },
+      { OPCODES::OP_IPUT_SHORT_QUICK,           INST_FORMATS::F_22c },
+      { OPCODES::OP_IGET_BOOLEAN_QUICK,         INST_FORMATS::F_22c },
+      { OPCODES::OP_IGET_BYTE_QUICK,            INST_FORMATS::F_22c },
+      { OPCODES::OP_IGET_CHAR_QUICK,            INST_FORMATS::F_22c },
+      { OPCODES::OP_IGET_SHORT_QUICK,           INST_FORMATS::F_22c },
+    };
+
+    std::array<INST_FORMATS, 256> table;
+    table.fill(INST_FORMATS::F_00x);
+    for (const auto& [op, fmt] : FORMATS) {
+      table[op] = fmt;
+    }
+    return table;
+  }();
+  return TABLE;
+}
+
+// Format -> size (in bytes) lookup table
+static const std::array<size_t, INST_FORMATS::F_4rcc + 1>& sizes_table() {
+  static const std::array<size_t, INST_FORMATS::F_4rcc + 1> TABLE = [] {
+    static const std::pair<INST_FORMATS, size_t> SIZES[] = {
+      { INST_FORMATS::F_00x,   SIZE_MAX  },
+      { INST_FORMATS::F_10x,   2    },
+      { INST_FORMATS::F_12x,   2    },
+      { INST_FORMATS::F_11n,   2    },
+      { INST_FORMATS::F_11x,   2    },
+      { INST_FORMATS::F_10t,   2    },
+      { INST_FORMATS::F_20t,   4    },
+      { INST_FORMATS::F_20bc,  4    },
+      { INST_FORMATS::F_22x,   4    },
+      { INST_FORMATS::F_21t,   4    },
+      { INST_FORMATS::F_21s,   4    },
+      { INST_FORMATS::F_21h,   4    },
+      { INST_FORMATS::F_21c,   4    },
+      { INST_FORMATS::F_23x,   4    },
+      { INST_FORMATS::F_22b,   4    },
+      { INST_FORMATS::F_22t,   4    },
+      { INST_FORMATS::F_22s,   4    },
+      { INST_FORMATS::F_22c,   4    },
+      { INST_FORMATS::F_22cs,  4    },
+      { INST_FORMATS::F_30t,   6    },
+      { INST_FORMATS::F_32x,   6    },
+      { INST_FORMATS::F_31i,   6    },
+      { INST_FORMATS::F_31t,   6    },
+      { INST_FORMATS::F_31c,   6    },
+      { INST_FORMATS::F_35c,   6    },
+      { INST_FORMATS::F_35ms,  6    },
+      { INST_FORMATS::F_35mi,  6    },
+      { INST_FORMATS::F_3rc,   6    },
+      { INST_FORMATS::F_3rms,  6    },
+      { INST_FORMATS::F_3rmi,  6    },
+      { INST_FORMATS::F_45cc,  8    },
+      { INST_FORMATS::F_4rcc,  8    },
+      { INST_FORMATS::F_51l,   10   },
+    };
+
+    std::array<size_t, INST_FORMATS::F_4rcc + 1> table;
+    table.fill(SIZE_MAX);
+    for (const auto& [fmt, size] : SIZES) {
+      table[fmt] = size;
+    }
+    return table;
+  }();
+  return TABLE;
+}
+
 INST_FORMATS inst_format_from_opcode(OPCODES op) {
-  static const std::map<OPCODES, INST_FORMATS> size_map {
-    { OPCODES::OP_NOP,                    INST_FORMATS::F_10x },
-    { OPCODES::OP_MOVE,                   INST_FORMATS::F_12x },
-    { OPCODES::OP_MOVE_FROM_16,           INST_FORMATS::F_22x },
-    { OPCODES::OP_MOVE_16,                INST_FORMATS::F_32x },
-    { OPCODES::OP_MOVE_WIDE,              INST_FORMATS::F_12x },
-    { OPCODES::OP_MOVE_WIDE_FROM_16,      INST_FORMATS::F_22x },
-    { OPCODES::OP_MOVE_WIDE_16,           INST_FORMATS::F_32x },
-    { OPCODES::OP_MOVE_OBJECT,            INST_FORMATS::F_12x },
-    { OPCODES::OP_MOVE_OBJECT_FROM_16,    INST_FORMATS::F_22x },
-    { OPCODES::OP_MOVE_OBJECT_16,         INST_FORMATS::F_32x },
-    { OPCODES::OP_MOVE_RESULT,            INST_FORMATS::F_11x },
-    { OPCODES::OP_MOVE_RESULT_WIDE,       INST_FORMATS::F_11x },
-    { OPCODES::OP_MOVE_RESULT_OBJECT,     INST_FORMATS::F_11x },
-    { OPCODES::OP_MOVE_EXCEPTION,         INST_FORMATS::F_11x },
-    { OPCODES::OP_RETURN_VOID,            INST_FORMATS::F_10x },
-    { OPCODES::OP_RETURN,                 INST_FORMATS::F_11x },
-    { OPCODES::OP_RETURN_WIDE,            INST_FORMATS::F_11x },
-    { OPCODES::OP_RETURN_OBJECT,          INST_FORMATS::F_11x },
-    { OPCODES::OP_CONST_4,                INST_FORMATS::F_11n },
-    { OPCODES::OP_CONST_16,               INST_FORMATS::F_21s },
-    { OPCODES::OP_CONST,                  INST_FORMATS::F_31i },
-    { OPCODES::OP_CONST_HIGH_16,          INST_FORMATS::F_21h },
-    { OPCODES::OP_CONST_WIDE_16,          INST_FORMATS::F_21s },
-    { OPCODES::OP_CONST_WIDE_32,          INST_FORMATS::F_31i },
-    { OPCODES::OP_CONST_WIDE,             INST_FORMATS::F_51l },
-    { OPCODES::OP_CONST_WIDE_HIGH_16,     INST_FORMATS::F_21h },
-    { OPCODES::OP_CONST_STRING,           INST_FORMATS::F_21c },
-    { OPCODES::OP_CONST_STRING_JUMBO,     INST_FORMATS::F_31c },
-    { OPCODES::OP_CONST_CLASS,            INST_FORMATS::F_21c },
-    { OPCODES::OP_MONITOR_ENTER,          INST_FORMATS::F_11x },
-    { OPCODES::OP_MONITOR_EXIT,           INST_FORMATS::F_11x },
-    { OPCODES::OP_CHECK_CAST,             INST_FORMATS::F_21c },
-    { OPCODES::OP_INSTANCE_OF,            INST_FORMATS::F_22c },
-    { OPCODES::OP_ARRAY_LENGTH,           INST_FORMATS::F_12x },
-    { OPCODES::OP_NEW_INSTANCE,           INST_FORMATS::F_21c },
-    { OPCODES::OP_NEW_ARRAY,              INST_FORMATS::F_22c },
-    { OPCODES::OP_FILLED_NEW_ARRAY,       INST_FORMATS::F_35c },
-    { OPCODES::OP_FILLED_NEW_ARRAY_RANGE, INST_FORMATS::F_3rc },
-    { OPCODES::OP_FILL_ARRAY_DATA,        INST_FORMATS::F_31t },
-    { OPCODES::OP_THROW,                  INST_FORMATS::F_11x },
-    { OPCODES::OP_GOTO,                   INST_FORMATS::F_10t },
-    { OPCODES::OP_GOTO_16,                INST_FORMATS::F_20t },
-    { OPCODES::OP_GOTO_32,                INST_FORMATS::F_30t },
-    { OPCODES::OP_PACKED_SWITCH,          INST_FORMATS::F_31t },
-    { OPCODES::OP_SPARSE_SWITCH,          INST_FORMATS::F_31t },
-    { OPCODES::OP_CMPL_FLOAT,             INST_FORMATS::F_23x },
-    { OPCODES::OP_CMPG_FLOAT,             INST_FORMATS::F_23x },
-    { OPCODES::OP_CMPL_DOUBLE,            INST_FORMATS::F_23x },
-    { OPCODES::OP_CMPG_DOUBLE,            INST_FORMATS::F_23x },
-    { OPCODES::OP_CMP_LONG,               INST_FORMATS::F_23x },
-    { OPCODES::OP_IF_EQ,                  INST_FORMATS::F_22t },
-    { OPCODES::OP_IF_NE,                  INST_FORMATS::F_22t },
-    { OPCODES::OP_IF_LT,                  INST_FORMATS::F_22t },
-    { OPCODES::OP_IF_GE,                  INST_FORMATS::F_22t },
-    { OPCODES::OP_IF_GT,                  INST_FORMATS::F_22t },
-    { OPCODES::OP_IF_LE,                  INST_FORMATS::F_22t },
-    { OPCODES::OP_IF_EQZ,                 INST_FORMATS::F_21t },
-    { OPCODES::OP_IF_NEZ,                 INST_FORMATS::F_21t },
-    { OPCODES::OP_IF_LTZ,                 INST_FORMATS::F_21t },
-    { OPCODES::OP_IF_GEZ,                 INST_FORMATS::F_21t },
-    { OPCODES::OP_IF_GTZ,                 INST_FORMATS::F_21t },
-    { OPCODES::OP_IF_LEZ,                 INST_FORMATS::F_21t },
-    { OPCODES::OP_AGET,                   INST_FORMATS::F_23x },
-    { OPCODES::OP_AGET_WIDE,              INST_FORMATS::F_23x },
-    { OPCODES::OP_AGET_OBJECT,            INST_FORMATS::F_23x },
-    { OPCODES::OP_AGET_BOOLEAN,           INST_FORMATS::F_23x },
-    { OPCODES::OP_AGET_BYTE,              INST_FORMATS::F_23x },
-    { OPCODES::OP_AGET_CHAR,              INST_FORMATS::F_23x },
-    { OPCODES::OP_AGET_SHORT,             INST_FORMATS::F_23x },
-    { OPCODES::OP_APUT,                   INST_FORMATS::F_23x },
-    { OPCODES::OP_APUT_WIDE,              INST_FORMATS::F_23x },
-    { OPCODES::OP_APUT_OBJECT,            INST_FORMATS::F_23x },
-    { OPCODES::OP_APUT_BOOLEAN,           INST_FORMATS::F_23x },
-    { OPCODES::OP_APUT_BYTE,              INST_FORMATS::F_23x },
-    { OPCODES::OP_APUT_CHAR,              INST_FORMATS::F_23x },
-    { OPCODES::OP_APUT_SHORT,             INST_FORMATS::F_23x },
-    { OPCODES::OP_IGET,                   INST_FORMATS::F_22c },
-    { OPCODES::OP_IGET_WIDE,              INST_FORMATS::F_22c },
-    { OPCODES::OP_IGET_OBJECT,            INST_FORMATS::F_22c },
-    { OPCODES::OP_IGET_BOOLEAN,           INST_FORMATS::F_22c },
-    { OPCODES::OP_IGET_BYTE,              INST_FORMATS::F_22c },
-    { OPCODES::OP_IGET_CHAR,              INST_FORMATS::F_22c },
-    { OPCODES::OP_IGET_SHORT,             INST_FORMATS::F_22c },
-    { OPCODES::OP_IPUT,                   INST_FORMATS::F_22c },
-    { OPCODES::OP_IPUT_WIDE,              INST_FORMATS::F_22c },
-    { OPCODES::OP_IPUT_OBJECT,            INST_FORMATS::F_22c },
-    { OPCODES::OP_IPUT_BOOLEAN,           INST_FORMATS::F_22c },
-    { OPCODES::OP_IPUT_BYTE,              INST_FORMATS::F_22c },
-    { OPCODES::OP_IPUT_CHAR,              INST_FORMATS::F_22c },
-    { OPCODES::OP_IPUT_SHORT,             INST_FORMATS::F_22c },
-    { OPCODES::OP_SGET,                   INST_FORMATS::F_21c },
-    { OPCODES::OP_SGET_WIDE,              INST_FORMATS::F_21c },
-    { OPCODES::OP_SGET_OBJECT,            INST_FORMATS::F_21c },
-    { OPCODES::OP_SGET_BOOLEAN,           INST_FORMATS::F_21c },
-    { OPCODES::OP_SGET_BYTE,              INST_FORMATS::F_21c },
-    { OPCODES::OP_SGET_CHAR,              INST_FORMATS::F_21c },
-    { OPCODES::OP_SGET_SHORT,             INST_FORMATS::F_21c },
-    { OPCODES::OP_SPUT,                   INST_FORMATS::F_21c },
-    { OPCODES::OP_SPUT_WIDE,              INST_FORMATS::F_21c },
-    { OPCODES::OP_SPUT_OBJECT,            INST_FORMATS::F_21c },
-    { OPCODES::OP_SPUT_BOOLEAN,           INST_FORMATS::F_21c },
-    { OPCODES::OP_SPUT_BYTE,              INST_FORMATS::F_21c },
-    { OPCODES::OP_SPUT_CHAR,              INST_FORMATS::F_21c },
-    { OPCODES::OP_SPUT_SHORT,             INST_FORMATS::F_21c },
-    { OPCODES::OP_INVOKE_VIRTUAL,         INST_FORMATS::F_35c },
-    { OPCODES::OP_INVOKE_SUPER,           INST_FORMATS::F_35c },
-    { OPCODES::OP_INVOKE_DIRECT,          INST_FORMATS::F_35c },
-    { OPCODES::OP_INVOKE_STATIC,          INST_FORMATS::F_35c },
-    { OPCODES::OP_INVOKE_INTERFACE,       INST_FORMATS::F_35c },
-    { OPCODES::OP_RETURN_VOID_NO_BARRIER, INST_FORMATS::F_10x },
-    { OPCODES::OP_INVOKE_VIRTUAL_RANGE,   INST_FORMATS::F_3rc },
-    { OPCODES::OP_INVOKE_SUPER_RANGE,     INST_FORMATS::F_3rc },
-    { OPCODES::OP_INVOKE_DIRECT_RANGE,    INST_FORMATS::F_3rc },
-    { OPCODES::OP_INVOKE_STATIC_RANGE,    INST_FORMATS::F_3rc },
-    { OPCODES::OP_INVOKE_INTERFACE_RANGE, INST_FORMATS::F_3rc },
-    { OPCODES::OP_NEG_INT,                INST_FORMATS::F_12x },
-    { OPCODES::OP_NOT_INT,                INST_FORMATS::F_12x },
-    { OPCODES::OP_NEG_LONG,               INST_FORMATS::F_12x },
-    { OPCODES::OP_NOT_LONG,               INST_FORMATS::F_12x },
-    { OPCODES::OP_NEG_FLOAT,              INST_FORMATS::F_12x },
-    { OPCODES::OP_NEG_DOUBLE,             INST_FORMATS::F_12x },
-    { OPCODES::OP_INT_TO_LONG,            INST_FORMATS::F_12x },
-    { OPCODES::OP_INT_TO_FLOAT,           INST_FORMATS::F_12x },
-    { OPCODES::OP_INT_TO_DOUBLE,          INST_FORMATS::F_12x },
-    { OPCODES::OP_LONG_TO_INT,            INST_FORMATS::F_12x },
-    { OPCODES::OP_LONG_TO_FLOAT,          INST_FORMATS::F_12x },
-    { OPCODES::OP_LONG_TO_DOUBLE,         INST_FORMATS::F_12x },
-    { OPCODES::OP_FLOAT_TO_INT,           INST_FORMATS::F_12x },
-    { OPCODES::OP_FLOAT_TO_LONG,          INST_FORMATS::F_12x },
-    { OPCODES::OP_FLOAT_TO_DOUBLE,        INST_FORMATS::F_12x },
-    { OPCODES::OP_DOUBLE_TO_INT,          INST_FORMATS::F_12x },
-    { OPCODES::OP_DOUBLE_TO_LONG,         INST_FORMATS::F_12x },
-    { OPCODES::OP_DOUBLE_TO_FLOAT,        INST_FORMATS::F_12x },
-    { OPCODES::OP_INT_TO_BYTE,            INST_FORMATS::F_12x },
-    { OPCODES::OP_INT_TO_CHAR,            INST_FORMATS::F_12x },
-    { OPCODES::OP_INT_TO_SHORT,           INST_FORMATS::F_12x },
-    { OPCODES::OP_ADD_INT,                INST_FORMATS::F_23x },
-    { OPCODES::OP_SUB_INT,                INST_FORMATS::F_23x },
-    { OPCODES::OP_MUL_INT,                INST_FORMATS::F_23x },
-    { OPCODES::OP_DIV_INT,                INST_FORMATS::F_23x },
-    { OPCODES::OP_REM_INT,                INST_FORMATS::F_23x },
-    { OPCODES::OP_AND_INT,                INST_FORMATS::F_23x },
-    { OPCODES::OP_OR_INT,                 INST_FORMATS::F_23x },
-    { OPCODES::OP_XOR_INT,                INST_FORMATS::F_23x },
-    { OPCODES::OP_SHL_INT,                INST_FORMATS::F_23x },
-    { OPCODES::OP_SHR_INT,                INST_FORMATS::F_23x },
-    { OPCODES::OP_USHR_INT,               INST_FORMATS::F_23x },
-    { OPCODES::OP_ADD_LONG,               INST_FORMATS::F_23x },
-    { OPCODES::OP_SUB_LONG,               INST_FORMATS::F_23x },
-    { OPCODES::OP_MUL_LONG,               INST_FORMATS::F_23x },
-    { OPCODES::OP_DIV_LONG,               INST_FORMATS::F_23x },
-    { OPCODES::OP_REM_LONG,               INST_FORMATS::F_23x },
-    { OPCODES::OP_AND_LONG,               INST_FORMATS::F_23x },
-    { OPCODES::OP_OR_LONG,                INST_FORMATS::F_23x },
-    { OPCODES::OP_XOR_LONG,               INST_FORMATS::F_23x },
-    { OPCODES::OP_SHL_LONG,               INST_FORMATS::F_23x },
-    { OPCODES::OP_SHR_LONG,               INST_FORMATS::F_23x },
-    { OPCODES::OP_USHR_LONG,              INST_FORMATS::F_23x },
-    { OPCODES::OP_ADD_FLOAT,              INST_FORMATS::F_23x },
-    { OPCODES::OP_SUB_FLOAT,              INST_FORMATS::F_23x },
-    { OPCODES::OP_MUL_FLOAT,              INST_FORMATS::F_23x },
-    { OPCODES::OP_DIV_FLOAT,              INST_FORMATS::F_23x },
-    { OPCODES::OP_REM_FLOAT,              INST_FORMATS::F_23x },
-    { OPCODES::OP_ADD_DOUBLE,             INST_FORMATS::F_23x },
-    { OPCODES::OP_SUB_DOUBLE,             INST_FORMATS::F_23x },
-    { OPCODES::OP_MUL_DOUBLE,             INST_FORMATS::F_23x },
-    { OPCODES::OP_DIV_DOUBLE,             INST_FORMATS::F_23x },
-    { OPCODES::OP_REM_DOUBLE,             INST_FORMATS::F_23x },
-    { OPCODES::OP_ADD_INT_2_ADDR,         INST_FORMATS::F_12x },
-    { OPCODES::OP_SUB_INT_2_ADDR,         INST_FORMATS::F_12x },
-    { OPCODES::OP_MUL_INT_2_ADDR,         INST_FORMATS::F_12x },
-    { OPCODES::OP_DIV_INT_2_ADDR,         INST_FORMATS::F_12x },
-    { OPCODES::OP_REM_INT_2_ADDR,         INST_FORMATS::F_12x },
-    { OPCODES::OP_AND_INT_2_ADDR,         INST_FORMATS::F_12x },
-    { OPCODES::OP_OR_INT_2_ADDR,          INST_FORMATS::F_12x },
-    { OPCODES::OP_XOR_INT_2_ADDR,         INST_FORMATS::F_12x },
-    { OPCODES::OP_SHL_INT_2_ADDR,         INST_FORMATS::F_12x },
-    { OPCODES::OP_SHR_INT_2_ADDR,         INST_FORMATS::F_12x },
-    { OPCODES::OP_USHR_INT_2_ADDR,        INST_FORMATS::F_12x },
-    { OPCODES::OP_ADD_LONG_2_ADDR,        INST_FORMATS::F_12x },
-    { OPCODES::OP_SUB_LONG_2_ADDR,        INST_FORMATS::F_12x },
-    { OPCODES::OP_MUL_LONG_2_ADDR,        INST_FORMATS::F_12x },
-    { OPCODES::OP_DIV_LONG_2_ADDR,        INST_FORMATS::F_12x },
-    { OPCODES::OP_REM_LONG_2_ADDR,        INST_FORMATS::F_12x },
-    { OPCODES::OP_AND_LONG_2_ADDR,        INST_FORMATS::F_12x },
-    { OPCODES::OP_OR_LONG_2_ADDR,         INST_FORMATS::F_12x },
-    { OPCODES::OP_XOR_LONG_2_ADDR,        INST_FORMATS::F_12x },
-    { OPCODES::OP_SHL_LONG_2_ADDR,        INST_FORMATS::F_12x },
-    { OPCODES::OP_SHR_LONG_2_ADDR,        INST_FORMATS::F_12x },
-    { OPCODES::OP_USHR_LONG_2_ADDR,       INST_FORMATS::F_12x },
-    { OPCODES::OP_ADD_FLOAT_2_ADDR,       INST_FORMATS::F_12x },
-    { OPCODES::OP_SUB_FLOAT_2_ADDR,       INST_FORMATS::F_12x },
-    { OPCODES::OP_MUL_FLOAT_2_ADDR,       INST_FORMATS::F_12x },
-    { OPCODES::OP_DIV_FLOAT_2_ADDR,       INST_FORMATS::F_12x },
-    { OPCODES::OP_REM_FLOAT_2_ADDR,       INST_FORMATS::F_12x },
-    { OPCODES::OP_ADD_DOUBLE_2_ADDR,      INST_FORMATS::F_12x },
-    { OPCODES::OP_SUB_DOUBLE_2_ADDR,      INST_FORMATS::F_12x },
-    { OPCODES::OP_MUL_DOUBLE_2_ADDR,      INST_FORMATS::F_12x },
-    { OPCODES::OP_DIV_DOUBLE_2_ADDR,      INST_FORMATS::F_12x },
-    { OPCODES::OP_REM_DOUBLE_2_ADDR,      INST_FORMATS::F_12x },
-    { OPCODES::OP_ADD_INT_LIT_16,         INST_FORMATS::F_22s },
-    { OPCODES::OP_RSUB_INT,               INST_FORMATS::F_22s },
-    { OPCODES::OP_MUL_INT_LIT_16,         INST_FORMATS::F_22s },
-    { OPCODES::OP_DIV_INT_LIT_16,         INST_FORMATS::F_22s },
-    { OPCODES::OP_REM_INT_LIT_16,         INST_FORMATS::F_22s },
-    { OPCODES::OP_AND_INT_LIT_16,         INST_FORMATS::F_22s },
-    { OPCODES::OP_OR_INT_LIT_16,          INST_FORMATS::F_22s },
-    { OPCODES::OP_XOR_INT_LIT_16,         INST_FORMATS::F_22s },
-    { OPCODES::OP_ADD_INT_LIT_8,          INST_FORMATS::F_22b },
-    { OPCODES::OP_RSUB_INT_LIT_8,         INST_FORMATS::F_22b },
-    { OPCODES::OP_MUL_INT_LIT_8,          INST_FORMATS::F_22b },
-    { OPCODES::OP_DIV_INT_LIT_8,          INST_FORMATS::F_22b },
-    { OPCODES::OP_REM_INT_LIT_8,          INST_FORMATS::F_22b },
-    { OPCODES::OP_AND_INT_LIT_8,          INST_FORMATS::F_22b },
-    { OPCODES::OP_OR_INT_LIT_8,           INST_FORMATS::F_22b },
-    { OPCODES::OP_XOR_INT_LIT_8,          INST_FORMATS::F_22b },
-    { OPCODES::OP_SHL_INT_LIT_8,          INST_FORMATS::F_22b },
-    { OPCODES::OP_SHR_INT_LIT_8,          INST_FORMATS::F_22b },
-    { OPCODES::OP_USHR_INT_LIT_8,         INST_FORMATS::F_22b },
-
-    { OPCODES::OP_INVOKE_POLYMORPHIC,       INST_FORMATS::F_45cc },
-    { OPCODES::OP_INVOKE_POLYMORPHIC_RANGE, INST_FORMATS::F_4rcc },
-    { OPCODES::OP_INVOKE_CUSTOM,            INST_FORMATS::F_35c  },
-    { OPCODES::OP_INVOKE_CUSTOM_RANGE,      INST_FORMATS::F_3rc  },
-
-    { OPCODES::OP_CONST_METHOD_HANDLE,        INST_FORMATS::F_21c },
-    { OPCODES::OP_CONST_METHOD_TYPE,          INST_FORMATS::F_21c },
-
-    { OPCODES::OP_IGET_QUICK,                 INST_FORMATS::F_22c },
-    { OPCODES::OP_IGET_WIDE_QUICK,            INST_FORMATS::F_22c },
-    { OPCODES::OP_IGET_OBJECT_QUICK,          INST_FORMATS::F_22c },
-    { OPCODES::OP_IPUT_QUICK,                 INST_FORMATS::F_22c },
-    { OPCODES::OP_IPUT_WIDE_QUICK,            INST_FORMATS::F_22c },
-    { OPCODES::OP_IPUT_OBJECT_QUICK,          INST_FORMATS::F_22c },
-    { OPCODES::OP_INVOKE_VIRTUAL_QUICK,       INST_FORMATS::F_35c },
-    { OPCODES::OP_INVOKE_VIRTUAL_RANGE_QUICK, INST_FORMATS::F_3rc },
-    { OPCODES::OP_IPUT_BOOLEAN_QUICK,         INST_FORMATS::F_22c },
-    { OPCODES::OP_IPUT_BYTE_QUICK,            INST_FORMATS::F_22c },
-    { OPCODES::OP_IPUT_CHAR_QUICK,            INST_FORMATS::F_22c },
-    { OPCODES::OP_IPUT_SHORT_QUICK,           INST_FORMATS::F_22c },
-    { OPCODES::OP_IGET_BOOLEAN_QUICK,         INST_FORMATS::F_22c },
-    { OPCODES::OP_IGET_BYTE_QUICK,            INST_FORMATS::F_22c },
-    { OPCODES::OP_IGET_CHAR_QUICK,            INST_FORMATS::F_22c },
-    { OPCODES::OP_IGET_SHORT_QUICK,           INST_FORMATS::F_22c },
-
-  };
-
-  auto   it  = size_map.find(op);
-  //if (it == std::end(size_map)) {
-  //  std::cout << std::hex << "OP: " << op << '\n';
-  //}
-  return it == size_map.end() ? INST_FORMATS::F_00x : it->second;
+  return formats_table()[op];
 }
 
 size_t inst_size_from_format(INST_FORMATS fmt) {
-  static const std::map<INST_FORMATS, size_t> size_map {
-    { INST_FORMATS::F_00x,   SIZE_MAX  },
-    { INST_FORMATS::F_10x,   2    },
-    { INST_FORMATS::F_12x,   2    },
-    { INST_FORMATS::F_11n,   2    },
-    { INST_FORMATS::F_11x,   2    },
-    { INST_FORMATS::F_10t,   2    },
-    { INST_FORMATS::F_20t,   4    },
-    { INST_FORMATS::F_20bc,  4    },
-    { INST_FORMATS::F_22x,   4    },
-    { INST_FORMATS::F_21t,   4    },
-    { INST_FORMATS::F_21s,   4    },
-    { INST_FORMATS::F_21h,   4    },
-    { INST_FORMATS::F_21c,   4    },
-    { INST_FORMATS::F_23x,   4    },
-    { INST_FORMATS::F_22b,   4    },
-    { INST_FORMATS::F_22t,   4    },
-    { INST_FORMATS::F_22s,   4    },
-    { INST_FORMATS::F_22c,   4    },
-    { INST_FORMATS::F_22cs,  4    },
-    { INST_FORMATS::F_30t,   6    },
-    { INST_FORMATS::F_32x,   6    },
-    { INST_FORMATS::F_31i,   6    },
-    { INST_FORMATS::F_31t,   6    },
-    { INST_FORMATS::F_31c,   6    },
-    { INST_FORMATS::F_35c,   6    },
-    { INST_FORMATS::F_35ms,  6    },
-    { INST_FORMATS::F_35mi,  6    },
-    { INST_FORMATS::F_3rc,   6    },
-    { INST_FORMATS::F_3rms,  6    },
-    { INST_FORMATS::F_3rmi,  6    },
-    { INST_FORMATS::F_45cc,  8    },
-    { INST_FORMATS::F_4rcc,  8    },
-    { INST_FORMATS::F_51l,   10   },
-  };
-
-  auto   it  = size_map.find(fmt);
-  return it == size_map.end() ? 0 : it->second;
+  return fmt < sizes_table().size() ? sizes_table()[fmt] : 0;
 }
 
 size_t inst_size_from_opcode(OPCODES op) {
@@ -408,6 +429,158 @@ size_t switch_array_size(const uint8_t* ptr, const uint8_t* end) {
 
 }
 
+
+template<size_t N>
+static uint32_t sext(uint32_t value) {
+  static_assert(N > 0 && N < 32);
+  const uint32_t sign = 1u << (N - 1);
+  value &= (1u << N) - 1;
+  return (value ^ sign) - sign;
 }
+
+void InstructionIterator::decode() {
+  const size_t remaining = pos_ < bytecode_.size() ? bytecode_.size() - pos_ : 0;
+  if (remaining < sizeof(uint16_t)) {
+    pos_ = bytecode_.size();
+    return;
+  }
+
+  const uint8_t* ptr = bytecode_.data() + pos_;
+  const uint8_t* end = bytecode_.data() + bytecode_.size();
+
+  inst_ = Instruction{};
+  inst_.pc = pos_ / sizeof(uint16_t);
+  inst_.opcode = static_cast<OPCODES>(ptr[0]);
+
+  // Payloads are encoded with the `nop` opcode followed by their identifier
+  if (inst_.opcode == OPCODES::OP_NOP && ptr[1] != 0) {
+    const size_t hdr_size = ptr[1] == (IDENT_SPARSE_SWITCH >> 8) ?
+                            sizeof(sparse_switch) : sizeof(packed_switch);
+    const size_t size = remaining < hdr_size ? SIZE_MAX : switch_array_size(ptr, end);
+    if (size == SIZE_MAX || size > remaining) {
+      pos_ = bytecode_.size();
+      return;
+    }
+    switch (ptr[1]) {
+      case IDENT_PACKED_SWITCH >> 8:
+        inst_.kind = Instruction::KIND::PACKED_SWITCH_PAYLOAD; break;
+      case IDENT_SPARSE_SWITCH >> 8:
+        inst_.kind = Instruction::KIND::SPARSE_SWITCH_PAYLOAD; break;
+      default:
+        inst_.kind = Instruction::KIND::FILL_ARRAY_DATA_PAYLOAD; break;
+    }
+    inst_.raw = bytecode_.subspan(pos_, size);
+    return;
+  }
+
+  inst_.format = inst_format_from_opcode(inst_.opcode);
+  const size_t size = inst_size_from_format(inst_.format);
+  if (size == SIZE_MAX || size == 0 || size > remaining) {
+    pos_ = bytecode_.size();
+    return;
+  }
+  inst_.raw = bytecode_.subspan(pos_, size);
+
+  // 16-bit code units of the instruction
+  uint16_t u[5] = {0, 0, 0, 0, 0};
+  for (size_t i = 0; i < size / sizeof(uint16_t); ++i) {
+    u[i] = static_cast<uint16_t>(ptr[2 * i] | (ptr[2 * i + 1] << 8));
+  }
+
+  const uint32_t AA = u[0] >> 8;
+  const uint32_t A  = (u[0] >> 8) & 0xF;
+  const uint32_t B  = u[0] >> 12;
+
+  switch (inst_.format) {
+    case F_10x:
+    case F_00x:
+      break;
+
+    case F_12x:
+      inst_.vA = A; inst_.vB = B; break;
+
+    case F_11n:
+      inst_.vA = A; inst_.vB = sext<4>(B); break;
+
+    case F_11x:
+      inst_.vA = AA; break;
+
+    case F_10t:
+      inst_.vA = sext<8>(AA); break;
+
+    case F_20t:
+      inst_.vA = sext<16>(u[1]); break;
+
+    case F_20bc:
+    case F_22x:
+    case F_21c:
+      inst_.vA = AA; inst_.vB = u[1]; break;
+
+    case F_21t:
+    case F_21s:
+      inst_.vA = AA; inst_.vB = sext<16>(u[1]); break;
+
+    case F_21h:
+      inst_.vA = AA; inst_.vB = u[1];
+      inst_.vB_wide = static_cast<uint64_t>(u[1]) <<
+                      (inst_.opcode == OPCODES::OP_CONST_WIDE_HIGH_16 ? 48 : 16);
+      break;
+
+    case F_23x:
+      inst_.vA = AA; inst_.vB = u[1] & 0xFF; inst_.vC = u[1] >> 8; break;
+
+    case F_22b:
+      inst_.vA = AA; inst_.vB = u[1] & 0xFF; inst_.vC = sext<8>(u[1] >> 8); break;
+
+    case F_22t:
+    case F_22s:
+      inst_.vA = A; inst_.vB = B; inst_.vC = sext<16>(u[1]); break;
+
+    case F_22c:
+    case F_22cs:
+      inst_.vA = A; inst_.vB = B; inst_.vC = u[1]; break;
+
+    case F_30t:
+      inst_.vA = u[1] | (static_cast<uint32_t>(u[2]) << 16); break;
+
+    case F_32x:
+      inst_.vA = u[1]; inst_.vB = u[2]; break;
+
+    case F_31i:
+    case F_31t:
+    case F_31c:
+      inst_.vA = AA; inst_.vB = u[1] | (static_cast<uint32_t>(u[2]) << 16);
+      inst_.vB_wide = static_cast<uint64_t>(static_cast<int64_t>(static_cast<int32_t>(inst_.vB)));
+      break;
+
+    case F_35c:
+    case F_35ms:
+    case F_35mi:
+    case F_45cc:
+      inst_.vA = B; inst_.vB = u[1]; inst_.vC = u[2] & 0xF;
+      inst_.args[0] = u[2] & 0xF;
+      inst_.args[1] = (u[2] >> 4) & 0xF;
+      inst_.args[2] = (u[2] >> 8) & 0xF;
+      inst_.args[3] = (u[2] >> 12) & 0xF;
+      inst_.args[4] = A;
+      inst_.vH = u[3];
+      break;
+
+    case F_3rc:
+    case F_3rms:
+    case F_3rmi:
+    case F_4rcc:
+      inst_.vA = AA; inst_.vB = u[1]; inst_.vC = u[2]; inst_.vH = u[3]; break;
+
+    case F_51l:
+      inst_.vA = AA;
+      inst_.vB_wide = static_cast<uint64_t>(u[1])        |
+                      static_cast<uint64_t>(u[2]) << 16  |
+                      static_cast<uint64_t>(u[3]) << 32  |
+                      static_cast<uint64_t>(u[4]) << 48;
+      break;
+  }
 }
 
+}
+}
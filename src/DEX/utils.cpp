@@ -24,7 +24,7 @@
 namespace LIEF {
 namespace DEX {
 
-inline bool is_dex(BinaryStream& stream) {
+bool is_dex(BinaryStream& stream) {
   using magic_t = std::array<char, sizeof(details::magic)>;
   if (auto magic_res = stream.peek<magic_t>(0)) {
     const auto magic = *magic_res;
@@ -0,0 +1,956 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+
+#include "logging.hpp"
+#include "hash_stream.hpp"
+#include "parallel.hpp"
+
+#include "LIEF/config.h"
+#include "LIEF/iostream.hpp"
+#include "LIEF/utils.hpp"
+#include "LIEF/Abstract/Binary.hpp"
+#include "LIEF/Abstract/Header.hpp"
+#include "LIEF/Abstract/Parser.hpp"
+#include "LIEF/Abstract/Section.hpp"
+#include "LIEF/BinaryStream/VectorStream.hpp"
+#include "LIEF/ELF/Binary.hpp"
+#include "LIEF/ELF/Note.hpp"
+#include "LIEF/ELF/Section.hpp"
+
+#if defined(LIEF_PE_SUPPORT)
+#include "LIEF/PE/Binary.hpp"
+#include "LIEF/PE/debug/CodeViewPDB.hpp"
+#endif
+
+#if defined(LIEF_MACHO_SUPPORT)
+#include "LIEF/MachO/Binary.hpp"
+#include "LIEF/MachO/UUIDCommand.hpp"
+#endif
+
+#include "LIEF/DWARF/AddressIndex.hpp"
+
+#include "DWARF/LineTable.hpp"
+#include "DWARF/RangeTable.hpp"
+#include "DWARF/Reader.hpp"
+#include "DWARF/constants.hpp"
+
+namespace LIEF {
+namespace dwarf {
+
+namespace details {
+
+/// Subprogram of a compilation unit. The address ranges are stored in the
+/// RangeTable of the unit.
+struct function_entry_t {
+  strref_t name = 0;
+  strref_t linkage_name = 0;
+};
+
+/// Lazily-decoded information of a compilation unit
+struct unit_state_t {
+  std::once_flag functions_once;
+  std::atomic<bool> functions_ready{false};
+  std::vector<function_entry_t> functions;
+  RangeTable ranges;
+
+  std::once_flag lines_once;
+  std::unique_ptr<LineTable> lines;
+};
+
+class AddressIndex {
+  public:
+  static constexpr uint64_t CACHE_MAGIC = 0x584957444645494c; // LIEFDWIX
+  static constexpr uint32_t CACHE_VERSION = 3;
+
+  /// Maximum number of DW_AT_specification/DW_AT_abstract_origin that are
+  /// followed to resolve the name of a function
+  static constexpr size_t MAX_REF_DEPTH = 8;
+
+  AddressIndex(const Binary& bin, const sections_t& sections) :
+    reader(sections),
+    binary(&bin)
+  {}
+
+  static std::unique_ptr<AddressIndex> build(const Binary& bin,
+                                             const dwarf::AddressIndex::config_t& config);
+
+  static std::unique_ptr<AddressIndex> load(const Binary& bin, const std::string& path,
+                                            const std::vector<uint8_t>& fingerprint);
+
+  /// Key that identifies the binary (and its debug info) in the on-disk cache
+  static std::vector<uint8_t> compute_fingerprint(const Binary& bin,
+                                                  const sections_t& sections);
+
+  ok_error_t save(const std::string& path) const;
+
+  const unit_t* unit_for(uint64_t offset) const;
+
+  const unit_state_t& functions(uint32_t idx) const {
+    unit_state_t& state = states[idx];
+    std::call_once(state.functions_once, [&] {
+      decode_functions(idx, state);
+      state.functions_ready = true;
+    });
+    return state;
+  }
+
+  const LineTable* lines(uint32_t idx) const {
+    unit_state_t& state = states[idx];
+    std::call_once(state.lines_once, [&] {
+      const unit_t& unit = units[idx];
+      if (unit.stmt_list == unit_t::NONE) {
+        return;
+      }
+      auto table = LineTable::parse(reader, unit);
+      if (!table) {
+        LIEF_DEBUG("Unit 0x{:x}: can't decode the line program at 0x{:x}",
+                   unit.offset, unit.stmt_list);
+        return;
+      }
+      state.lines = std::make_unique<LineTable>(std::move(*table));
+    });
+    return state.lines.get();
+  }
+
+  Reader reader;
+  const Binary* binary = nullptr;
+
+  /// Fingerprint of the binary if it has already been computed, otherwise
+  /// save() computes it
+  std::vector<uint8_t> fingerprint;
+
+  std::vector<unit_t> units;
+  RangeTable ranges;
+  std::unique_ptr<unit_state_t[]> states;
+  bool has_aranges = false;
+  bool from_cache = false;
+
+  private:
+  void init_states() {
+    states = std::make_unique<unit_state_t[]>(units.size());
+  }
+
+  void parse_aranges(std::vector<bool>& covered);
+  void decode_functions(uint32_t idx, unit_state_t& state) const;
+  void resolve_names(const unit_t& unit, const AbbrevTable& abbrevs,
+                     uint64_t offset, function_entry_t& func) const;
+};
+
+// Subset of the attributes of a DW_TAG_subprogram
+struct subprogram_t {
+  form_value_t low_pc;
+  form_value_t high_pc;
+  form_value_t ranges;
+  strref_t name = 0;
+  strref_t linkage_name = 0;
+  uint64_t ref = unit_t::NONE;
+  bool declaration = false;
+
+  void update(uint16_t attr, const form_value_t& value) {
+    switch (attr) {
+      case DW_AT::low_pc:            low_pc = value; break;
+      case DW_AT::high_pc:           high_pc = value; break;
+      case DW_AT::ranges:            ranges = value; break;
+      case DW_AT::name:              name = value.value; break;
+      case DW_AT::linkage_name:
+      case DW_AT::MIPS_linkage_name: linkage_name = value.value; break;
+      case DW_AT::specification:
+      case DW_AT::abstract_origin:   ref = value.value; break;
+      case DW_AT::declaration:       declaration = value.value != 0; break;
+      default: break;
+    }
+  }
+};
+
+// The DWARF sections are named `.debug_xxx` in ELF and PE binaries and
+// `__debug_xxx` in Mach-O binaries (with a name truncated to 16 chars).
+static span<const uint8_t>* section_slot(sections_t& sections, std::string_view name) {
+  if (name.substr(0, 2) == "__") {
+    name.remove_prefix(2);
+  } else if (name.substr(0, 1) == ".") {
+    name.remove_prefix(1);
+  } else {
+    return nullptr;
+  }
+
+  if (name == "debug_info")        { return &sections.info; }
+  if (name == "debug_abbrev")      { return &sections.abbrev; }
+  if (name == "debug_aranges")     { return &sections.aranges; }
+  if (name == "debug_line")        { return &sections.line; }
+  if (name == "debug_line_str")    { return &sections.line_str; }
+  if (name == "debug_str")         { return &sections.str; }
+  if (name == "debug_str_offsets" ||
+      name == "debug_str_offs")    { return &sections.str_offsets; }
+  if (name == "debug_addr")        { return &sections.addr; }
+  if (name == "debug_ranges")      { return &sections.ranges; }
+  if (name == "debug_rnglists")    { return &sections.rnglists; }
+  return nullptr;
+}
+
+static sections_t collect_sections(const Binary& bin) {
+  sections_t sections;
+  sections.swap = bin.header().endianness() == Header::ENDIANNESS::BIG;
+
+  for (const Section& section : bin.sections()) {
+    span<const uint8_t>* slot = section_slot(sections, section.name());
+    if (slot == nullptr) {
+      continue;
+    }
+
+    if (bin.format() == Binary::FORMATS::ELF &&
+        static_cast<const ELF::Section&>(section).has(ELF::Section::FLAGS::COMPRESSED))
+    {
+      LIEF_WARN("'{}' is compressed which is not supported", section.name());
+      continue;
+    }
+    *slot = section.content();
+  }
+  return sections;
+}
+
+enum class FINGERPRINT_KIND : uint8_t {
+  SECTIONS_SHA256 = 0,
+  ELF_BUILD_ID,
+  MACHO_UUID,
+  PE_PDB_GUID,
+};
+
+// Identifier of the build embedded in the binary: the GNU build-id note
+// (ELF), LC_UUID (Mach-O) or the GUID/age of the CodeView PDB entry (PE).
+static FINGERPRINT_KIND build_identifier(const Binary& bin,
+                                         std::vector<uint8_t>& identifier)
+{
+  switch (bin.format()) {
+#if defined(LIEF_ELF_SUPPORT)
+    case Binary::FORMATS::ELF:
+      {
+        const ELF::Note* note =
+          static_cast<const ELF::Binary&>(bin).get(ELF::Note::TYPE::GNU_BUILD_ID);
+        if (note == nullptr || note->description().empty()) {
+          break;
+        }
+        span<const uint8_t> desc = note->description();
+        identifier.assign(desc.begin(), desc.end());
+        return FINGERPRINT_KIND::ELF_BUILD_ID;
+      }
+#endif
+
+#if defined(LIEF_MACHO_SUPPORT)
+    case Binary::FORMATS::MACHO:
+      {
+        const MachO::UUIDCommand* cmd = static_cast<const MachO::Binary&>(bin).uuid();
+        if (cmd == nullptr) {
+          break;
+        }
+        const MachO::uuid_t& uuid = cmd->uuid();
+        identifier.assign(uuid.begin(), uuid.end());
+        return FINGERPRINT_KIND::MACHO_UUID;
+      }
+#endif
+
+#if defined(LIEF_PE_SUPPORT)
+    case Binary::FORMATS::PE:
+      {
+        const PE::CodeViewPDB* pdb = static_cast<const PE::Binary&>(bin).codeview_pdb();
+        if (pdb == nullptr) {
+          break;
+        }
+        const PE::CodeViewPDB::signature_t& sig = pdb->signature();
+        identifier.assign(sig.begin(), sig.end());
+        const uint32_t age = pdb->age();
+        for (size_t i = 0; i < sizeof(age); ++i) {
+          identifier.push_back((age >> (8 * i)) & 0xff);
+        }
+        return FINGERPRINT_KIND::PE_PDB_GUID;
+      }
+#endif
+
+    default:
+      break;
+  }
+  return FINGERPRINT_KIND::SECTIONS_SHA256;
+}
+
+// When the binary embeds a build identifier, the index is keyed on this
+// identifier and the sizes of the DWARF sections. Otherwise, it falls back on
+// a SHA-256 over the full content of the DWARF sections so that any change in
+// the debug info invalidates the index.
+std::vector<uint8_t> AddressIndex::compute_fingerprint(const Binary& bin,
+                                                       const sections_t& sections)
+{
+  const span<const uint8_t> all[] = {
+    sections.info, sections.abbrev, sections.aranges, sections.line,
+    sections.line_str, sections.str, sections.str_offsets, sections.addr,
+    sections.ranges, sections.rnglists,
+  };
+
+  vector_iostream os;
+  std::vector<uint8_t> identifier;
+  const FINGERPRINT_KIND kind = build_identifier(bin, identifier);
+  os.write<uint8_t>(static_cast<uint8_t>(kind));
+
+  if (kind != FINGERPRINT_KIND::SECTIONS_SHA256) {
+    os.write<uint32_t>(identifier.size())
+      .write(identifier);
+    for (span<const uint8_t> content : all) {
+      os.write<uint64_t>(content.size());
+    }
+    return os.raw();
+  }
+
+  hashstream hs(hashstream::HASH::SHA256);
+  for (span<const uint8_t> content : all) {
+    hs.write<uint64_t>(content.size());
+    hs.write(content.data(), content.size());
+  }
+  os.write(hs.raw());
+  return os.raw();
+}
+
+const unit_t* AddressIndex::unit_for(uint64_t offset) const {
+  auto it = std::upper_bound(units.begin(), units.end(), offset,
+    [] (uint64_t offset, const unit_t& unit) {
+      return offset < unit.offset;
+    });
+
+  if (it == units.begin()) {
+    return nullptr;
+  }
+  --it;
+  return offset < it->end ? &*it : nullptr;
+}
+
+void AddressIndex::parse_aranges(std::vector<bool>& covered) {
+  const span<const uint8_t> aranges = reader.sections().aranges;
+  SpanStream stream = reader.stream(aranges);
+
+  while (stream.pos() < stream.size()) {
+    const uint64_t set_start = stream.pos();
+    unit_t header;
+    auto length = stream.read<uint32_t>();
+    if (!length) {
+      break;
+    }
+
+    uint64_t set_length = *length;
+    if (*length == 0xffffffff) {
+      header.dwarf64 = true;
+      set_length = stream.read<uint64_t>().value_or(0);
+    }
+
+    if (set_length == 0 || set_length > stream.size() - stream.pos()) {
+      LIEF_DEBUG(".debug_aranges: corrupted set at offset 0x{:x}", set_start);
+      break;
+    }
+    const uint64_t set_end = stream.pos() + set_length;
+
+    auto version = stream.read<uint16_t>();
+    auto info_offset = reader.read_offset(stream, header);
+    auto addr_size = stream.read<uint8_t>();
+    auto seg_size = stream.read<uint8_t>();
+    if (!version || !info_offset || !addr_size || !seg_size) {
+      break;
+    }
+
+    const unit_t* unit = unit_for(*info_offset);
+    if (unit == nullptr || unit->offset != *info_offset ||
+        (*addr_size != 4 && *addr_size != 8))
+    {
+      LIEF_DEBUG(".debug_aranges: skipping the set at offset 0x{:x}", set_start);
+      stream.setpos(set_end);
+      continue;
+    }
+
+    // The first tuple is aligned on the size of a tuple
+    const uint64_t tuple_size = 2 * *addr_size + *seg_size;
+    const uint64_t header_size = stream.pos() - set_start;
+    stream.setpos(set_start + align(header_size, 2 * *addr_size));
+
+    const auto idx = static_cast<uint32_t>(unit - units.data());
+    while (stream.pos() + tuple_size <= set_end) {
+      stream.increment_pos(*seg_size);
+      auto addr = reader.read_sized(stream, *addr_size);
+      auto size = reader.read_sized(stream, *addr_size);
+      if (!addr || !size || (*addr == 0 && *size == 0)) {
+        break;
+      }
+      ranges.add(*addr, *addr + *size, idx);
+    }
+    covered[idx] = true;
+    stream.setpos(set_end);
+  }
+}
+
+std::unique_ptr<AddressIndex>
+  AddressIndex::build(const Binary& bin, const dwarf::AddressIndex::config_t& config)
+{
+  sections_t sections = collect_sections(bin);
+  if (sections.info.empty() || sections.abbrev.empty()) {
+    LIEF_DEBUG("No DWARF information");
+    return nullptr;
+  }
+
+  auto index = std::make_unique<AddressIndex>(bin, sections);
+
+  uint64_t offset = 0;
+  while (offset < sections.info.size()) {
+    auto unit = index->reader.read_unit_header(offset);
+    if (!unit) {
+      LIEF_WARN("Can't read the unit at offset 0x{:x} of .debug_info", offset);
+      break;
+    }
+    offset = unit->end;
+    if (unit->type == DW_UT::compile || unit->type == DW_UT::partial ||
+        unit->type == DW_UT::skeleton)
+    {
+      index->units.push_back(*unit);
+    }
+  }
+  index->init_states();
+
+  const size_t nb_units = index->units.size();
+  std::vector<bool> covered(nb_units, false);
+  if (!sections.aranges.empty()) {
+    index->parse_aranges(covered);
+    index->has_aranges = !index->ranges.empty();
+  }
+
+  // Read the unit DIEs and use their ranges for the units that are not
+  // described in .debug_aranges
+  std::vector<ranges_t> unit_ranges(nb_units);
+  const Reader& reader = index->reader;
+  auto read_unit = [&] (size_t i) {
+    unit_t& unit = index->units[i];
+    if (!reader.read_unit_die(unit, covered[i] ? nullptr : &unit_ranges[i])) {
+      LIEF_DEBUG("Can't read the DIE of the unit 0x{:x}", unit.offset);
+    }
+  };
+
+  if (config.eager) {
+    parallel_for(nb_units, read_unit);
+  } else {
+    for (size_t i = 0; i < nb_units; ++i) {
+      read_unit(i);
+    }
+  }
+
+  for (size_t i = 0; i < nb_units; ++i) {
+    if (covered[i]) {
+      continue;
+    }
+
+    const auto idx = static_cast<uint32_t>(i);
+    // The unit DIE does not describe the address range of the unit
+    // (e.g. old compilers): fallback on its subprograms.
+    if (unit_ranges[i].empty()) {
+      for (const RangeTable::entry_t& entry : index->functions(idx).ranges.entries()) {
+        index->ranges.add(entry.low, entry.high, idx);
+      }
+      continue;
+    }
+
+    for (const auto& [low, high] : unit_ranges[i]) {
+      index->ranges.add(low, high, idx);
+    }
+  }
+  index->ranges.finalize();
+
+  if (config.eager) {
+    parallel_for(nb_units, [&] (size_t i) {
+      index->functions(static_cast<uint32_t>(i));
+    });
+  }
+
+  LIEF_DEBUG("DWARF index: {} units, {} ranges (aranges: {})",
+             nb_units, index->ranges.size(), index->has_aranges);
+  return index;
+}
+
+void AddressIndex::decode_functions(uint32_t idx, unit_state_t& state) const {
+  const unit_t& unit = units[idx];
+  const AbbrevTable abbrevs = AbbrevTable::parse(reader, unit);
+
+  SpanStream stream = reader.stream(reader.sections().info.first(unit.end));
+  stream.setpos(unit.die_offset);
+
+  ranges_t func_ranges;
+  while (stream.pos() < unit.end) {
+    auto code = stream.read_uleb128();
+    if (!code) {
+      break;
+    }
+
+    // End of the children of a DIE
+    if (*code == 0) {
+      continue;
+    }
+
+    const abbrev_t* abbrev = abbrevs.get(*code);
+    if (abbrev == nullptr) {
+      LIEF_DEBUG("Unit 0x{:x}: unknown abbreviation #{} at offset 0x{:x}",
+                 unit.offset, *code, stream.pos());
+      break;
+    }
+
+    if (abbrev->tag != DW_TAG::subprogram) {
+      if (!reader.skip_attributes(stream, unit, *abbrev)) {
+        break;
+      }
+      continue;
+    }
+
+    subprogram_t sub;
+    auto res = reader.read_attributes(stream, unit, *abbrev,
+      [&sub] (uint16_t attr, const form_value_t& value) {
+        sub.update(attr, value);
+      });
+
+    if (!res) {
+      break;
+    }
+
+    if (sub.declaration) {
+      continue;
+    }
+
+    func_ranges.clear();
+    if (sub.ranges.form != 0) {
+      reader.ranges(unit, sub.ranges, /*unit_die=*/false, func_ranges);
+    } else if (sub.low_pc.form != 0 && sub.high_pc.form != 0) {
+      auto low = reader.address(unit, sub.low_pc);
+      auto high = low ? reader.high_pc(unit, *low, sub.high_pc) : low;
+      if (low && high && *low < *high) {
+        func_ranges.emplace_back(*low, *high);
+      }
+    }
+
+    if (func_ranges.empty()) {
+      continue;
+    }
+
+    function_entry_t func;
+    func.name = reader.resolve(unit, sub.name);
+    func.linkage_name = reader.resolve(unit, sub.linkage_name);
+    if ((func.name == 0 || func.linkage_name == 0) && sub.ref != unit_t::NONE) {
+      resolve_names(unit, abbrevs, sub.ref, func);
+    }
+
+    const auto func_idx = static_cast<uint32_t>(state.functions.size());
+    state.functions.push_back(func);
+    for (const auto& [low, high] : func_ranges) {
+      state.ranges.add(low, high, func_idx);
+    }
+  }
+  state.ranges.finalize();
+}
+
+void AddressIndex::resolve_names(const unit_t& current, const AbbrevTable& abbrevs,
+                                 uint64_t offset, function_entry_t& func) const
+{
+  for (size_t depth = 0; depth < MAX_REF_DEPTH && offset != unit_t::NONE; ++depth) {
+    const unit_t* unit = unit_for(offset);
+    if (unit == nullptr) {
+      return;
+    }
+
+    SpanStream stream = reader.stream(reader.sections().info.first(unit->end));
+    stream.setpos(offset);
+    auto code = stream.read_uleb128();
+    if (!code || *code == 0) {
+      return;
+    }
+
+    abbrev_t other;
+    const abbrev_t* abbrev = nullptr;
+    if (unit == &current) {
+      abbrev = abbrevs.get(*code);
+    } else if (auto res = reader.find_abbrev(*unit, *code)) {
+      other = std::move(*res);
+      abbrev = &other;
+    }
+
+    if (abbrev == nullptr) {
+      return;
+    }
+
+    subprogram_t sub;
+    auto res = reader.read_attributes(stream, *unit, *abbrev,
+      [&sub] (uint16_t attr, const form_value_t& value) {
+        sub.update(attr, value);
+      });
+
+    if (!res) {
+      return;
+    }
+
+    if (func.name == 0) {
+      func.name = reader.resolve(*unit, sub.name);
+    }
+
+    if (func.linkage_name == 0) {
+      func.linkage_name = reader.resolve(*unit, sub.linkage_name);
+    }
+
+    if (func.name != 0 && func.linkage_name != 0) {
+      return;
+    }
+    offset = sub.ref;
+  }
+}
+
+ok_error_t AddressIndex::save(const std::string& path) const {
+  const std::vector<uint8_t> key = fingerprint.empty() ?
+                                   compute_fingerprint(*binary, reader.sections()) :
+                                   fingerprint;
+  vector_iostream os;
+  os.write<uint64_t>(CACHE_MAGIC)
+    .write<uint32_t>(CACHE_VERSION)
+    .write<uint32_t>(key.size())
+    .write(key)
+    .write<uint8_t>(has_aranges ? 1 : 0);
+
+  os.write<uint64_t>(units.size());
+  for (const unit_t& unit : units) {
+    os.write<uint64_t>(unit.offset)
+      .write<uint64_t>(unit.end)
+      .write<uint64_t>(unit.die_offset)
+      .write<uint64_t>(unit.abbrev_offset)
+      .write<uint16_t>(unit.version)
+      .write<uint8_t>(unit.type)
+      .write<uint8_t>(unit.addr_size)
+      .write<uint8_t>(unit.dwarf64 ? 1 : 0)
+      .write<uint64_t>(unit.base_address)
+      .write<uint64_t>(unit.stmt_list)
+      .write<uint64_t>(unit.str_offsets_base)
+      .write<uint64_t>(unit.addr_base)
+      .write<uint64_t>(unit.rnglists_base)
+      .write<uint64_t>(unit.ranges_base)
+      .write<uint64_t>(unit.name)
+      .write<uint64_t>(unit.comp_dir);
+  }
+
+  auto write_ranges = [&os] (const RangeTable& table) {
+    os.write<uint64_t>(table.size());
+    for (const RangeTable::entry_t& entry : table.entries()) {
+      os.write<uint64_t>(entry.low)
+        .write<uint64_t>(entry.high)
+        .write<uint32_t>(entry.value);
+    }
+  };
+
+  write_ranges(ranges);
+
+  // Subprograms of the units that have already been decoded
+  for (size_t i = 0; i < units.size(); ++i) {
+    const unit_state_t& state = states[i];
+    if (!state.functions_ready) {
+      continue;
+    }
+    os.write<uint32_t>(i)
+      .write<uint64_t>(state.functions.size());
+    for (const function_entry_t& func : state.functions) {
+      os.write<uint64_t>(func.name)
+        .write<uint64_t>(func.linkage_name);
+    }
+    write_ranges(state.ranges);
+  }
+
+  std::ofstream output(path, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!output) {
+    LIEF_ERR("Can't open '{}' for writing", path);
+    return make_error_code(lief_errors::file_error);
+  }
+  const std::vector<uint8_t>& raw = os.raw();
+  output.write(reinterpret_cast<const char*>(raw.data()), raw.size());
+  return ok();
+}
+
+std::unique_ptr<AddressIndex>
+  AddressIndex::load(const Binary& bin, const std::string& path,
+                     const std::vector<uint8_t>& expected)
+{
+  // A missing cache is the common case: don't go through from_file() which
+  // logs an error
+  if (!std::ifstream(path, std::ios::in | std::ios::binary)) {
+    return nullptr;
+  }
+
+  auto stream = VectorStream::from_file(path);
+  if (!stream) {
+    return nullptr;
+  }
+
+  sections_t sections = collect_sections(bin);
+  if (sections.info.empty()) {
+    return nullptr;
+  }
+
+  std::vector<uint8_t> fingerprint;
+
+  auto magic = stream->read<uint64_t>();
+  auto version = stream->read<uint32_t>();
+  auto fingerprint_size = stream->read<uint32_t>();
+  if (!magic || *magic != CACHE_MAGIC || !version || *version != CACHE_VERSION ||
+      !fingerprint_size || *fingerprint_size > stream->size())
+  {
+    LIEF_DEBUG("'{}' is not a valid DWARF index", path);
+    return nullptr;
+  }
+
+  auto has_fingerprint = stream->read_data(fingerprint, *fingerprint_size);
+  auto has_aranges = stream->read<uint8_t>();
+  if (!has_fingerprint || !has_aranges)
+  {
+    LIEF_DEBUG("'{}' is not a valid DWARF index", path);
+    return nullptr;
+  }
+
+  if (fingerprint != expected) {
+    LIEF_DEBUG("'{}' does not match the binary", path);
+    return nullptr;
+  }
+
+  auto index = std::make_unique<AddressIndex>(bin, sections);
+  index->fingerprint = expected;
+  index->has_aranges = *has_aranges != 0;
+  index->from_cache = true;
+
+  auto read_u64 = [&stream] (uint64_t& value) {
+    auto res = stream->read<uint64_t>();
+    value = res.value_or(0);
+    return (bool)res;
+  };
+
+  uint64_t nb_units = 0;
+  // Smallest serialized unit
+  static constexpr size_t UNIT_SIZE = 4 * sizeof(uint64_t) + 5 + 8 * sizeof(uint64_t);
+  if (!read_u64(nb_units) || nb_units > stream->size() / UNIT_SIZE) {
+    return nullptr;
+  }
+
+  index->units.resize(nb_units);
+  for (unit_t& unit : index->units) {
+    bool ok = read_u64(unit.offset) && read_u64(unit.end) &&
+              read_u64(unit.die_offset) && read_u64(unit.abbrev_offset);
+    auto version = stream->read<uint16_t>();
+    auto type = stream->read<uint8_t>();
+    auto addr_size = stream->read<uint8_t>();
+    auto dwarf64 = stream->read<uint8_t>();
+    ok = ok && version && type && addr_size && dwarf64 &&
+         read_u64(unit.base_address) && read_u64(unit.stmt_list) &&
+         read_u64(unit.str_offsets_base) && read_u64(unit.addr_base) &&
+         read_u64(unit.rnglists_base) && read_u64(unit.ranges_base) &&
+         read_u64(unit.name) && read_u64(unit.comp_dir);
+    if (!ok || unit.end > sections.info.size()) {
+      LIEF_DEBUG("'{}' is corrupted", path);
+      return nullptr;
+    }
+    unit.version = *version;
+    unit.type = *type;
+    unit.addr_size = *addr_size;
+    unit.dwarf64 = *dwarf64 != 0;
+  }
+  index->init_states();
+
+  auto read_ranges = [&] (RangeTable& table, size_t max_value) {
+    uint64_t count = 0;
+    if (!read_u64(count) || count > stream->size()) {
+      return false;
+    }
+    table.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+      uint64_t low = 0;
+      uint64_t high = 0;
+      if (!read_u64(low) || !read_u64(high)) {
+        return false;
+      }
+      auto value = stream->read<uint32_t>();
+      if (!value || *value >= max_value) {
+        return false;
+      }
+      table.add(low, high, *value);
+    }
+    table.finalize();
+    return true;
+  };
+
+  if (!read_ranges(index->ranges, nb_units)) {
+    LIEF_DEBUG("'{}' is corrupted", path);
+    return nullptr;
+  }
+
+  while (stream->pos() < stream->size()) {
+    auto idx = stream->read<uint32_t>();
+    uint64_t nb_functions = 0;
+    if (!idx || *idx >= nb_units || !read_u64(nb_functions) ||
+        nb_functions > stream->size())
+    {
+      LIEF_DEBUG("'{}' is corrupted", path);
+      return nullptr;
+    }
+
+    std::vector<function_entry_t> functions(nb_functions);
+    for (function_entry_t& func : functions) {
+      if (!read_u64(func.name) || !read_u64(func.linkage_name)) {
+        return nullptr;
+      }
+    }
+
+    RangeTable table;
+    if (!read_ranges(table, nb_functions)) {
+      LIEF_DEBUG("'{}' is corrupted", path);
+      return nullptr;
+    }
+
+    unit_state_t& state = index->states[*idx];
+    std::call_once(state.functions_once, [&] {
+      state.functions = std::move(functions);
+      state.ranges = std::move(table);
+      state.functions_ready = true;
+    });
+  }
+  return index;
+}
+
+}
+
+AddressIndex::AddressIndex(std::unique_ptr<details::AddressIndex> impl) :
+  impl_(std::move(impl))
+{}
+
+AddressIndex::~AddressIndex() = default;
+
+std::unique_ptr<AddressIndex>
+  AddressIndex::from_binary(const Binary& bin, const config_t& config)
+{
+  std::vector<uint8_t> fingerprint;
+  if (!config.cache_path.empty()) {
+    // Computed once and shared by load() and save()
+    fingerprint = details::AddressIndex::compute_fingerprint(
+        bin, details::collect_sections(bin));
+    if (auto impl = details::AddressIndex::load(bin, config.cache_path, fingerprint)) {
+      return std::unique_ptr<AddressIndex>(new AddressIndex(std::move(impl)));
+    }
+  }
+
+  auto impl = details::AddressIndex::build(bin, config);
+  if (impl == nullptr) {
+    return nullptr;
+  }
+
+  if (!config.cache_path.empty()) {
+    impl->fingerprint = std::move(fingerprint);
+    impl->save(config.cache_path);
+  }
+  return std::unique_ptr<AddressIndex>(new AddressIndex(std::move(impl)));
+}
+
+std::unique_ptr<AddressIndex> AddressIndex::from_binary(const Binary& bin) {
+  return from_binary(bin, config_t());
+}
+
+std::unique_ptr<AddressIndex>
+  AddressIndex::parse(const std::string& path, const config_t& config)
+{
+  std::unique_ptr<Binary> bin = LIEF::Parser::parse(path);
+  if (bin == nullptr) {
+    LIEF_ERR("Can't parse '{}'", path);
+    return nullptr;
+  }
+
+  std::unique_ptr<AddressIndex> index = from_binary(*bin, config);
+  if (index == nullptr) {
+    return nullptr;
+  }
+  index->owned_ = std::move(bin);
+  return index;
+}
+
+std::unique_ptr<AddressIndex> AddressIndex::parse(const std::string& path) {
+  return parse(path, config_t());
+}
+
+result<AddressIndex::function_t> AddressIndex::find_function(uint64_t address) const {
+  const details::Reader& reader = impl_->reader;
+  result<function_t> func = make_error_code(lief_errors::not_found);
+
+  impl_->ranges.find(address, [&] (const details::RangeTable::entry_t& unit) {
+    const details::unit_state_t& state = impl_->functions(unit.value);
+    return state.ranges.find(address, [&] (const details::RangeTable::entry_t& entry) {
+      const details::function_entry_t& info = state.functions[entry.value];
+      function_t out;
+      out.name = reader.string(info.name);
+      out.linkage_name = reader.string(info.linkage_name);
+      out.address = entry.low;
+      out.size = entry.high - entry.low;
+      func = std::move(out);
+      return true;
+    });
+  });
+  return func;
+}
+
+result<AddressIndex::line_t> AddressIndex::line_for(uint64_t address) const {
+  result<line_t> line = make_error_code(lief_errors::not_found);
+
+  impl_->ranges.find(address, [&] (const details::RangeTable::entry_t& unit) {
+    const details::LineTable* table = impl_->lines(unit.value);
+    if (table == nullptr) {
+      return false;
+    }
+
+    const details::LineTable::row_t* row = table->find(address);
+    if (row == nullptr) {
+      return false;
+    }
+
+    line_t out;
+    out.address = row->address;
+    out.file = table->file(row->file);
+    out.line = row->line;
+    out.column = row->column;
+    line = std::move(out);
+    return true;
+  });
+  return line;
+}
+
+ok_error_t AddressIndex::save(const std::string& path) const {
+  return impl_->save(path);
+}
+
+size_t AddressIndex::nb_units() const {
+  return impl_->units.size();
+}
+
+size_t AddressIndex::nb_ranges() const {
+  return impl_->ranges.size();
+}
+
+bool AddressIndex::has_aranges() const {
+  return impl_->has_aranges;
+}
+
+bool AddressIndex::from_cache() const {
+  return impl_->from_cache;
+}
+
+}
+}
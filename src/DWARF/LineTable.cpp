@@ -0,0 +1,459 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+#include "logging.hpp"
+
+#include "DWARF/LineTable.hpp"
+#include "DWARF/Reader.hpp"
+#include "DWARF/constants.hpp"
+
+namespace LIEF {
+namespace dwarf {
+namespace details {
+
+static bool is_absolute(std::string_view path) {
+  return (!path.empty() && (path[0] == '/' || path[0] == '\\')) ||
+         (path.size() > 2 && path[1] == ':');
+}
+
+static std::string join(std::string_view dir, std::string_view name) {
+  if (dir.empty() || is_absolute(name)) {
+    return std::string(name);
+  }
+  std::string path;
+  path.reserve(dir.size() + 1 + name.size());
+  path += dir;
+  if (path.back() != '/' && path.back() != '\\') {
+    path += '/';
+  }
+  path += name;
+  return path;
+}
+
+static result<std::string_view> read_cstr(SpanStream& stream) {
+  const uint8_t* p = stream.p();
+  const size_t avail = stream.size() - std::min<size_t>(stream.pos(), stream.size());
+  const void* nul = avail > 0 ? std::memchr(p, '\0', avail) : nullptr;
+  if (nul == nullptr) {
+    return make_error_code(lief_errors::read_error);
+  }
+  const size_t size = static_cast<const uint8_t*>(nul) - p;
+  stream.increment_pos(size + 1);
+  return std::string_view(reinterpret_cast<const char*>(p), size);
+}
+
+// DWARF 5 directory/file entry formats
+using entry_format_t = std::vector<attr_spec_t>;
+
+static ok_error_t read_entry_format(SpanStream& stream, entry_format_t& format) {
+  auto count = stream.read<uint8_t>();
+  if (!count) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  for (size_t i = 0; i < *count; ++i) {
+    auto type = stream.read_uleb128();
+    auto form = stream.read_uleb128();
+    if (!type || !form) {
+      return make_error_code(lief_errors::read_error);
+    }
+    attr_spec_t spec;
+    spec.attr = static_cast<uint16_t>(*type);
+    spec.form = static_cast<uint16_t>(*form);
+    format.push_back(spec);
+  }
+  return ok();
+}
+
+// Read the DWARF 5 directory or file table and call `fn(path, dir_index)`
+// for each entry
+template<class F>
+static ok_error_t read_entries(const Reader& reader, SpanStream& stream,
+                               const unit_t& unit, F&& fn)
+{
+  entry_format_t format;
+  if (!read_entry_format(stream, format)) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  auto count = stream.read_uleb128();
+  if (!count) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  for (size_t i = 0; i < *count; ++i) {
+    std::string_view path;
+    uint64_t dir_index = 0;
+    for (const attr_spec_t& spec : format) {
+      form_value_t value;
+      if (!reader.read_form(stream, unit, spec, value, Reader::LINE)) {
+        return make_error_code(lief_errors::read_error);
+      }
+
+      if (spec.attr == DW_LNCT::path) {
+        path = reader.string(reader.resolve(unit, value.value));
+      } else if (spec.attr == DW_LNCT::directory_index) {
+        dir_index = value.value;
+      }
+    }
+    fn(path, dir_index);
+  }
+  return ok();
+}
+
+result<LineTable> LineTable::parse(const Reader& reader, const unit_t& unit) {
+  SpanStream stream = reader.stream(reader.sections().line);
+  stream.setpos(unit.stmt_list);
+
+  // Unit-like structure used to decode the forms of the header
+  unit_t lunit = unit;
+
+  auto length = stream.read<uint32_t>();
+  if (!length) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  uint64_t unit_length = *length;
+  lunit.dwarf64 = false;
+  if (*length == 0xffffffff) {
+    auto length64 = stream.read<uint64_t>();
+    if (!length64) {
+      return make_error_code(lief_errors::read_error);
+    }
+    lunit.dwarf64 = true;
+    unit_length = *length64;
+  }
+
+  const uint64_t start = stream.pos();
+  if (unit_length > stream.size() - start) {
+    LIEF_DEBUG("Line program 0x{:x}: length (0x{:x}) is out of bounds",
+               unit.stmt_list, unit_length);
+    return make_error_code(lief_errors::corrupted);
+  }
+  const uint64_t end = start + unit_length;
+
+  auto version = stream.read<uint16_t>();
+  if (!version || *version < 2 || *version > 5) {
+    LIEF_DEBUG("Line program 0x{:x}: unsupported version", unit.stmt_list);
+    return make_error_code(lief_errors::not_supported);
+  }
+  lunit.version = *version;
+
+  if (lunit.version >= 5) {
+    auto addr_size = stream.read<uint8_t>();
+    auto seg_sel_size = stream.read<uint8_t>();
+    if (!addr_size || !seg_sel_size) {
+      return make_error_code(lief_errors::read_error);
+    }
+    if (*addr_size != 0) {
+      lunit.addr_size = *addr_size;
+    }
+  }
+
+  auto header_length = reader.read_offset(stream, lunit);
+  if (!header_length) {
+    return make_error_code(lief_errors::read_error);
+  }
+  const uint64_t program = stream.pos() + *header_length;
+
+  auto min_inst_length = stream.read<uint8_t>();
+  if (lunit.version >= 4) {
+    stream.increment_pos(sizeof(uint8_t)); // maximum_operations_per_instruction
+  }
+  auto default_is_stmt = stream.read<uint8_t>();
+  auto line_base = stream.read<int8_t>();
+  auto line_range = stream.read<uint8_t>();
+  auto opcode_base = stream.read<uint8_t>();
+  if (!min_inst_length || !default_is_stmt || !line_base || !line_range ||
+      !opcode_base)
+  {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  if (*line_range == 0 || *opcode_base == 0) {
+    LIEF_DEBUG("Line program 0x{:x}: corrupted header", unit.stmt_list);
+    return make_error_code(lief_errors::corrupted);
+  }
+
+  std::vector<uint8_t> std_lengths(*opcode_base - 1);
+  for (uint8_t& len : std_lengths) {
+    auto value = stream.read<uint8_t>();
+    if (!value) {
+      return make_error_code(lief_errors::read_error);
+    }
+    len = *value;
+  }
+
+  LineTable table;
+  std::vector<std::string> dirs;
+  const std::string_view comp_dir = reader.string(unit.comp_dir);
+
+  if (lunit.version >= 5) {
+    // The first entry of the directory table is the compilation directory
+    // and the other ones can be relative to it.
+    auto res = read_entries(reader, stream, lunit,
+      [&] (std::string_view path, uint64_t) {
+        dirs.push_back(dirs.empty() ? std::string(path) : join(dirs[0], path));
+      });
+    if (!res) {
+      return make_error_code(lief_errors::read_error);
+    }
+
+    res = read_entries(reader, stream, lunit,
+      [&] (std::string_view path, uint64_t dir) {
+        table.files_.push_back(join(dir < dirs.size() ? dirs[dir] : "", path));
+      });
+    if (!res) {
+      return make_error_code(lief_errors::read_error);
+    }
+  } else {
+    // Index 0 is the compilation directory
+    dirs.emplace_back(comp_dir);
+    while (true) {
+      auto dir = read_cstr(stream);
+      if (!dir) {
+        return make_error_code(lief_errors::read_error);
+      }
+      if (dir->empty()) {
+        break;
+      }
+      dirs.push_back(join(comp_dir, *dir));
+    }
+
+    // File indexes start at 1
+    table.files_.emplace_back();
+    while (true) {
+      auto name = read_cstr(stream);
+      if (!name) {
+        return make_error_code(lief_errors::read_error);
+      }
+      if (name->empty()) {
+        break;
+      }
+      auto dir = stream.read_uleb128();
+      auto mtime = stream.read_uleb128();
+      auto size = stream.read_uleb128();
+      if (!dir || !mtime || !size) {
+        return make_error_code(lief_errors::read_error);
+      }
+      table.files_.push_back(join(*dir < dirs.size() ? dirs[*dir] : "", *name));
+    }
+  }
+
+  // State machine (DWARF 5 - Section 6.2.2). VLIW op-index is not supported.
+  uint64_t address = 0;
+  uint32_t file = 1;
+  uint32_t line = 1;
+  uint16_t column = 0;
+  size_t seq_first = 0;
+
+  auto emit = [&] (bool end_sequence) {
+    table.rows_.push_back({address, file, line, column, end_sequence});
+    if (!end_sequence) {
+      return;
+    }
+    const auto idx = static_cast<uint32_t>(table.sequences_.size());
+    const size_t last = table.rows_.size() - 1;
+    table.sequences_.emplace_back(seq_first, last);
+    table.ranges_.add(table.rows_[seq_first].address, address, idx);
+
+    address = 0;
+    file = 1;
+    line = 1;
+    column = 0;
+    seq_first = table.rows_.size();
+  };
+
+  const uint8_t min_inst = *min_inst_length;
+  const uint8_t lrange = *line_range;
+  const int8_t lbase = *line_base;
+  const uint8_t obase = *opcode_base;
+
+  SpanStream program_stream = reader.stream(reader.sections().line.first(end));
+  program_stream.setpos(program);
+
+  bool corrupted = false;
+  while (!corrupted && program_stream.pos() < end) {
+    auto opcode = program_stream.read<uint8_t>();
+    if (!opcode) {
+      break;
+    }
+
+    // Special opcode
+    if (*opcode >= obase) {
+      const uint8_t adjusted = *opcode - obase;
+      address += (adjusted / lrange) * min_inst;
+      line += lbase + (adjusted % lrange);
+      emit(false);
+      continue;
+    }
+
+    // Extended opcode
+    if (*opcode == 0) {
+      auto len = program_stream.read_uleb128();
+      if (!len || *len == 0 || *len > end - program_stream.pos()) {
+        corrupted = true;
+        break;
+      }
+      const uint64_t next = program_stream.pos() + *len;
+      auto sub = program_stream.read<uint8_t>();
+      if (!sub) {
+        corrupted = true;
+        break;
+      }
+
+      switch (*sub) {
+        case DW_LNE::end_sequence:
+          emit(true);
+          break;
+
+        case DW_LNE::set_address:
+          {
+            const size_t size = *len - 1;
+            uint64_t value = 0;
+            if (size == 8) {
+              value = program_stream.read<uint64_t>().value_or(0);
+            } else if (size == 4) {
+              value = program_stream.read<uint32_t>().value_or(0);
+            } else if (size == 2) {
+              value = program_stream.read<uint16_t>().value_or(0);
+            }
+            address = value;
+            break;
+          }
+
+        case DW_LNE::define_file:
+          {
+            auto name = read_cstr(program_stream);
+            auto dir = program_stream.read_uleb128();
+            if (!name || !dir) {
+              corrupted = true;
+              break;
+            }
+            table.files_.push_back(join(*dir < dirs.size() ? dirs[*dir] : "", *name));
+            break;
+          }
+
+        default:
+          break;
+      }
+      program_stream.setpos(next);
+      continue;
+    }
+
+    switch (*opcode) {
+      case DW_LNS::copy:
+        emit(false);
+        break;
+
+      case DW_LNS::advance_pc:
+        {
+          auto value = program_stream.read_uleb128();
+          corrupted = !value;
+          address += value.value_or(0) * min_inst;
+          break;
+        }
+
+      case DW_LNS::advance_line:
+        {
+          auto value = program_stream.read_sleb128();
+          corrupted = !value;
+          line += static_cast<int64_t>(value.value_or(0));
+          break;
+        }
+
+      case DW_LNS::set_file:
+        {
+          auto value = program_stream.read_uleb128();
+          corrupted = !value;
+          file = static_cast<uint32_t>(value.value_or(0));
+          break;
+        }
+
+      case DW_LNS::set_column:
+        {
+          auto value = program_stream.read_uleb128();
+          corrupted = !value;
+          column = static_cast<uint16_t>(value.value_or(0));
+          break;
+        }
+
+      case DW_LNS::const_add_pc:
+        address += ((255 - obase) / lrange) * min_inst;
+        break;
+
+      case DW_LNS::fixed_advance_pc:
+        {
+          auto value = program_stream.read<uint16_t>();
+          corrupted = !value;
+          address += value.value_or(0);
+          break;
+        }
+
+      case DW_LNS::negate_stmt:
+      case DW_LNS::set_basic_block:
+      case DW_LNS::set_prologue_end:
+      case DW_LNS::set_epilogue_begin:
+        break;
+
+      default:
+        {
+          // Unknown standard opcode (or DW_LNS_set_isa): skip its ULEB128
+          // operands
+          for (size_t i = 0; i < std_lengths[*opcode - 1]; ++i) {
+            if (!program_stream.read_uleb128()) {
+              corrupted = true;
+              break;
+            }
+          }
+        }
+    }
+  }
+
+  if (corrupted) {
+    LIEF_DEBUG("Line program 0x{:x}: corrupted opcode at offset 0x{:x}",
+               unit.stmt_list, program_stream.pos());
+  }
+
+  table.ranges_.finalize();
+  return table;
+}
+
+const LineTable::row_t* LineTable::find(uint64_t address) const {
+  const row_t* row = nullptr;
+  ranges_.find(address, [&] (const RangeTable::entry_t& entry) {
+    const auto [first, last] = sequences_[entry.value];
+    auto begin = rows_.begin() + first;
+    auto it = std::upper_bound(begin, rows_.begin() + last, address,
+      [] (uint64_t address, const row_t& row) {
+        return address < row.address;
+      });
+
+    if (it == begin) {
+      return false;
+    }
+    row = &*(it - 1);
+    return true;
+  });
+  return row;
+}
+
+}
+}
+}
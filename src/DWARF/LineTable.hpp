@@ -0,0 +1,83 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_DWARF_LINE_TABLE_H
+#define LIEF_DWARF_LINE_TABLE_H
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "LIEF/errors.hpp"
+
+#include "DWARF/RangeTable.hpp"
+
+namespace LIEF {
+namespace dwarf {
+namespace details {
+class Reader;
+struct unit_t;
+
+/// Line-number matrix of a compilation unit decoded from its
+/// `.debug_line` program (DWARF 2 to 5)
+class LineTable {
+  public:
+  struct row_t {
+    uint64_t address = 0;
+    uint32_t file = 0;
+    uint32_t line = 0;
+    uint16_t column = 0;
+    bool end_sequence = false;
+  };
+
+  LineTable() = default;
+
+  /// Decode the line program referenced by the `DW_AT_stmt_list` of the
+  /// given unit
+  static result<LineTable> parse(const Reader& reader, const unit_t& unit);
+
+  /// Return the row that describes the given address or a nullptr if the
+  /// address is not covered by the line program
+  const row_t* find(uint64_t address) const;
+
+  /// Path of the file at the given index of the file table
+  const std::string& file(uint32_t idx) const {
+    static const std::string EMPTY;
+    return idx < files_.size() ? files_[idx] : EMPTY;
+  }
+
+  size_t size() const {
+    return rows_.size();
+  }
+
+  size_t nb_sequences() const {
+    return sequences_.size();
+  }
+
+  private:
+  std::vector<row_t> rows_;
+  std::vector<std::string> files_;
+
+  /// `[first row, end_sequence row]` of each sequence
+  std::vector<std::pair<uint32_t, uint32_t>> sequences_;
+
+  /// Address ranges of the sequences
+  RangeTable ranges_;
+};
+
+}
+}
+}
+#endif
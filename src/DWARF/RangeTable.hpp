@@ -0,0 +1,111 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_DWARF_RANGE_TABLE_H
+#define LIEF_DWARF_RANGE_TABLE_H
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace LIEF {
+namespace dwarf {
+namespace details {
+
+/// Sorted table of `[low, high)` address ranges associated with a value
+/// (e.g. an index of compilation unit).
+///
+/// The ranges can overlap. find() binary-searches the last range that
+/// starts before the address and walks backward while a previous range can
+/// still contain the address, which is bounded by the prefix maximum of the
+/// `high` addresses.
+class RangeTable {
+  public:
+  struct entry_t {
+    uint64_t low = 0;
+    uint64_t high = 0;
+    uint32_t value = 0;
+  };
+
+  void reserve(size_t size) {
+    entries_.reserve(size);
+  }
+
+  void add(uint64_t low, uint64_t high, uint32_t value) {
+    if (low < high) {
+      entries_.push_back({low, high, value});
+    }
+  }
+
+  /// Sort the ranges. This function must be called after the last add()
+  void finalize() {
+    std::stable_sort(entries_.begin(), entries_.end(),
+      [] (const entry_t& lhs, const entry_t& rhs) {
+        return lhs.low < rhs.low;
+      });
+
+    max_high_.resize(entries_.size());
+    uint64_t max_high = 0;
+    for (size_t i = 0; i < entries_.size(); ++i) {
+      max_high = std::max(max_high, entries_[i].high);
+      max_high_[i] = max_high;
+    }
+  }
+
+  /// Call `fn(entry)` for the ranges that contain the given address, from
+  /// the one with the highest start address, until `fn` returns true.
+  ///
+  /// Return true if `fn` returned true.
+  template<class F>
+  bool find(uint64_t address, F&& fn) const {
+    auto it = std::upper_bound(entries_.begin(), entries_.end(), address,
+      [] (uint64_t address, const entry_t& entry) {
+        return address < entry.low;
+      });
+
+    for (size_t i = it - entries_.begin(); i > 0; --i) {
+      if (max_high_[i - 1] <= address) {
+        break;
+      }
+      const entry_t& entry = entries_[i - 1];
+      if (address < entry.high && fn(entry)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const std::vector<entry_t>& entries() const {
+    return entries_;
+  }
+
+  size_t size() const {
+    return entries_.size();
+  }
+
+  bool empty() const {
+    return entries_.empty();
+  }
+
+  private:
+  std::vector<entry_t> entries_;
+
+  /// `max_high_[i]` is the maximum `high` address of the entries `[0, i]`
+  std::vector<uint64_t> max_high_;
+};
+
+}
+}
+}
+#endif
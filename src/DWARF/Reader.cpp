@@ -0,0 +1,841 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstring>
+
+#include "logging.hpp"
+
+#include "DWARF/Reader.hpp"
+#include "DWARF/constants.hpp"
+
+namespace LIEF {
+namespace dwarf {
+namespace details {
+
+// Parse the abbreviation located at the current position of the stream.
+// An abbreviation with a code of 0 marks the end of the table.
+static result<abbrev_t> parse_abbrev(SpanStream& stream) {
+  auto code = stream.read_uleb128();
+  if (!code) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  abbrev_t abbrev;
+  abbrev.code = *code;
+  if (abbrev.code == 0) {
+    return abbrev;
+  }
+
+  auto tag = stream.read_uleb128();
+  auto children = stream.read<uint8_t>();
+  if (!tag || !children) {
+    return make_error_code(lief_errors::read_error);
+  }
+  abbrev.tag = static_cast<uint16_t>(*tag);
+  abbrev.has_children = *children != 0;
+
+  while (true) {
+    auto attr = stream.read_uleb128();
+    auto form = stream.read_uleb128();
+    if (!attr || !form) {
+      return make_error_code(lief_errors::read_error);
+    }
+
+    if (*attr == 0 && *form == 0) {
+      break;
+    }
+
+    attr_spec_t spec;
+    spec.attr = static_cast<uint16_t>(*attr);
+    spec.form = static_cast<uint16_t>(*form);
+    if (spec.form == DW_FORM::implicit_const) {
+      auto value = stream.read_sleb128();
+      if (!value) {
+        return make_error_code(lief_errors::read_error);
+      }
+      spec.implicit_const = static_cast<int64_t>(*value);
+    }
+    abbrev.attrs.push_back(spec);
+  }
+  return abbrev;
+}
+
+AbbrevTable AbbrevTable::parse(const Reader& reader, const unit_t& unit) {
+  AbbrevTable table;
+  SpanStream stream = reader.stream(reader.sections().abbrev);
+  stream.setpos(unit.abbrev_offset);
+
+  while (true) {
+    auto abbrev = parse_abbrev(stream);
+    if (!abbrev) {
+      LIEF_DEBUG("Can't read the abbreviations at offset 0x{:x}", unit.abbrev_offset);
+      break;
+    }
+
+    if (abbrev->code == 0) {
+      break;
+    }
+
+    int64_t fixed_size = 0;
+    for (const attr_spec_t& spec : abbrev->attrs) {
+      const int64_t size = Reader::form_size(spec.form, unit);
+      if (size < 0) {
+        fixed_size = -1;
+        break;
+      }
+      fixed_size += size;
+    }
+    abbrev->fixed_size = fixed_size;
+    table.abbrevs_.push_back(std::move(*abbrev));
+  }
+
+  auto by_code = [] (const abbrev_t& lhs, const abbrev_t& rhs) {
+    return lhs.code < rhs.code;
+  };
+
+  if (!std::is_sorted(table.abbrevs_.begin(), table.abbrevs_.end(), by_code)) {
+    std::sort(table.abbrevs_.begin(), table.abbrevs_.end(), by_code);
+  }
+  return table;
+}
+
+const abbrev_t* AbbrevTable::find(uint64_t code) const {
+  auto it = std::lower_bound(abbrevs_.begin(), abbrevs_.end(), code,
+    [] (const abbrev_t& abbrev, uint64_t code) {
+      return abbrev.code < code;
+    });
+
+  if (it == abbrevs_.end() || it->code != code) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+result<unit_t> Reader::read_unit_header(uint64_t offset) const {
+  SpanStream stream = this->stream(sec_.info);
+  stream.setpos(offset);
+
+  unit_t unit;
+  unit.offset = offset;
+
+  auto length = stream.read<uint32_t>();
+  if (!length) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  uint64_t unit_length = *length;
+  if (*length == 0xffffffff) {
+    auto length64 = stream.read<uint64_t>();
+    if (!length64) {
+      return make_error_code(lief_errors::read_error);
+    }
+    unit.dwarf64 = true;
+    unit_length = *length64;
+  } else if (*length >= 0xfffffff0) {
+    LIEF_DEBUG("Unit 0x{:x}: reserved unit length (0x{:x})", offset, *length);
+    return make_error_code(lief_errors::corrupted);
+  }
+
+  const uint64_t start = stream.pos();
+  if (unit_length > stream.size() - start) {
+    LIEF_DEBUG("Unit 0x{:x}: length (0x{:x}) is out of bounds", offset, unit_length);
+    return make_error_code(lief_errors::corrupted);
+  }
+  unit.end = start + unit_length;
+
+  auto version = stream.read<uint16_t>();
+  if (!version) {
+    return make_error_code(lief_errors::read_error);
+  }
+  unit.version = *version;
+
+  // Units that are not supported are returned with a type of 0 so that the
+  // caller can skip them.
+  if (unit.version < 2 || unit.version > 5) {
+    LIEF_DEBUG("Unit 0x{:x}: DWARF version {} is not supported", offset, unit.version);
+    return unit;
+  }
+
+  if (unit.version >= 5) {
+    auto type = stream.read<uint8_t>();
+    auto addr_size = stream.read<uint8_t>();
+    auto abbrev_offset = read_offset(stream, unit);
+    if (!type || !addr_size || !abbrev_offset) {
+      return make_error_code(lief_errors::read_error);
+    }
+    unit.type = *type;
+    unit.addr_size = *addr_size;
+    unit.abbrev_offset = *abbrev_offset;
+
+    switch (unit.type) {
+      case DW_UT::skeleton:
+      case DW_UT::split_compile:
+        stream.increment_pos(sizeof(uint64_t)); // dwo_id
+        break;
+
+      case DW_UT::type:
+      case DW_UT::split_type:
+        stream.increment_pos(sizeof(uint64_t) + unit.offset_size()); // signature, type_offset
+        break;
+
+      default:
+        break;
+    }
+  } else {
+    auto abbrev_offset = read_offset(stream, unit);
+    auto addr_size = stream.read<uint8_t>();
+    if (!abbrev_offset || !addr_size) {
+      return make_error_code(lief_errors::read_error);
+    }
+    unit.type = DW_UT::compile;
+    unit.abbrev_offset = *abbrev_offset;
+    unit.addr_size = *addr_size;
+  }
+
+  if (unit.addr_size != 2 && unit.addr_size != 4 && unit.addr_size != 8) {
+    LIEF_DEBUG("Unit 0x{:x}: unsupported address size ({})", offset, unit.addr_size);
+    unit.type = 0;
+  }
+
+  unit.die_offset = stream.pos();
+  return unit;
+}
+
+ok_error_t Reader::read_unit_die(unit_t& unit, ranges_t* ranges) const {
+  SpanStream stream = this->stream(sec_.info.first(unit.end));
+  stream.setpos(unit.die_offset);
+
+  auto code = stream.read_uleb128();
+  if (!code || *code == 0) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  auto abbrev = find_abbrev(unit, *code);
+  if (!abbrev) {
+    LIEF_DEBUG("Unit 0x{:x}: can't find the abbreviation #{}", unit.offset, *code);
+    return make_error_code(lief_errors::corrupted);
+  }
+
+  if (abbrev->tag != DW_TAG::compile_unit && abbrev->tag != DW_TAG::partial_unit &&
+      abbrev->tag != DW_TAG::skeleton_unit)
+  {
+    return make_error_code(lief_errors::not_supported);
+  }
+
+  form_value_t low_pc;
+  form_value_t high_pc;
+  form_value_t rng;
+  auto res = read_attributes(stream, unit, *abbrev,
+    [&] (uint16_t attr, const form_value_t& value) {
+      switch (attr) {
+        case DW_AT::name:             unit.name = value.value; break;
+        case DW_AT::comp_dir:         unit.comp_dir = value.value; break;
+        case DW_AT::stmt_list:        unit.stmt_list = value.value; break;
+        case DW_AT::low_pc:           low_pc = value; break;
+        case DW_AT::high_pc:          high_pc = value; break;
+        case DW_AT::ranges:           rng = value; break;
+        case DW_AT::str_offsets_base: unit.str_offsets_base = value.value; break;
+        case DW_AT::addr_base:
+        case DW_AT::GNU_addr_base:    unit.addr_base = value.value; break;
+        case DW_AT::rnglists_base:    unit.rnglists_base = value.value; break;
+        case DW_AT::GNU_ranges_base:  unit.ranges_base = value.value; break;
+        default: break;
+      }
+    });
+
+  if (!res) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  // The attributes can reference the bases (e.g. DW_FORM_strx) which are
+  // only known once the DIE has been fully read.
+  unit.name = resolve(unit, unit.name);
+  unit.comp_dir = resolve(unit, unit.comp_dir);
+
+  if (low_pc.form != 0) {
+    if (auto addr = address(unit, low_pc)) {
+      unit.base_address = *addr;
+    }
+  }
+
+  if (ranges == nullptr) {
+    return ok();
+  }
+
+  if (rng.form != 0) {
+    this->ranges(unit, rng, /*unit_die=*/true, *ranges);
+  } else if (low_pc.form != 0 && high_pc.form != 0) {
+    if (auto end = this->high_pc(unit, unit.base_address, high_pc)) {
+      if (unit.base_address < *end) {
+        ranges->emplace_back(unit.base_address, *end);
+      }
+    }
+  }
+  return ok();
+}
+
+result<abbrev_t> Reader::find_abbrev(const unit_t& unit, uint64_t code) const {
+  SpanStream stream = this->stream(sec_.abbrev);
+  stream.setpos(unit.abbrev_offset);
+  while (true) {
+    auto abbrev = parse_abbrev(stream);
+    if (!abbrev) {
+      return make_error_code(lief_errors::read_error);
+    }
+
+    if (abbrev->code == 0) {
+      return make_error_code(lief_errors::not_found);
+    }
+
+    if (abbrev->code == code) {
+      return abbrev;
+    }
+  }
+}
+
+int64_t Reader::form_size(uint16_t form, const unit_t& unit) {
+  switch (form) {
+    case DW_FORM::flag_present:
+    case DW_FORM::implicit_const:
+      return 0;
+
+    case DW_FORM::data1:
+    case DW_FORM::ref1:
+    case DW_FORM::flag:
+    case DW_FORM::strx1:
+    case DW_FORM::addrx1:
+      return 1;
+
+    case DW_FORM::data2:
+    case DW_FORM::ref2:
+    case DW_FORM::strx2:
+    case DW_FORM::addrx2:
+      return 2;
+
+    case DW_FORM::strx3:
+    case DW_FORM::addrx3:
+      return 3;
+
+    case DW_FORM::data4:
+    case DW_FORM::ref4:
+    case DW_FORM::ref_sup4:
+    case DW_FORM::strx4:
+    case DW_FORM::addrx4:
+      return 4;
+
+    case DW_FORM::data8:
+    case DW_FORM::ref8:
+    case DW_FORM::ref_sig8:
+    case DW_FORM::ref_sup8:
+      return 8;
+
+    case DW_FORM::data16:
+      return 16;
+
+    case DW_FORM::addr:
+      return unit.addr_size;
+
+    case DW_FORM::strp:
+    case DW_FORM::line_strp:
+    case DW_FORM::sec_offset:
+    case DW_FORM::strp_sup:
+    case DW_FORM::GNU_ref_alt:
+    case DW_FORM::GNU_strp_alt:
+      return unit.offset_size();
+
+    case DW_FORM::ref_addr:
+      return unit.version <= 2 ? unit.addr_size : unit.offset_size();
+
+    default:
+      return -1;
+  }
+}
+
+result<uint64_t> Reader::read_sized(SpanStream& stream, size_t size) const {
+  switch (size) {
+    case 1:
+      if (auto value = stream.read<uint8_t>()) {
+        return *value;
+      }
+      break;
+
+    case 2:
+      if (auto value = stream.read<uint16_t>()) {
+        return *value;
+      }
+      break;
+
+    case 3:
+      {
+        const uint8_t* p = stream.p();
+        if (stream.pos() + 3 > stream.size()) {
+          break;
+        }
+        stream.increment_pos(3);
+        if (sec_.swap) {
+          return (uint64_t(p[0]) << 16) | (uint64_t(p[1]) << 8) | p[2];
+        }
+        return (uint64_t(p[2]) << 16) | (uint64_t(p[1]) << 8) | p[0];
+      }
+
+    case 4:
+      if (auto value = stream.read<uint32_t>()) {
+        return *value;
+      }
+      break;
+
+    case 8:
+      return stream.read<uint64_t>();
+
+    default:
+      break;
+  }
+  return make_error_code(lief_errors::read_error);
+}
+
+ok_error_t Reader::read_form(SpanStream& stream, const unit_t& unit,
+                             const attr_spec_t& spec, form_value_t& value,
+                             STR_KIND inline_str) const
+{
+  value.form = spec.form;
+  value.value = 0;
+
+  // Size of the block (if any) that follows the current position
+  result<uint64_t> block_size = 0;
+
+  switch (spec.form) {
+    case DW_FORM::flag_present:
+      value.value = 1;
+      return ok();
+
+    case DW_FORM::implicit_const:
+      value.value = static_cast<uint64_t>(spec.implicit_const);
+      return ok();
+
+    case DW_FORM::string:
+      {
+        value.value = make_str(inline_str, stream.pos());
+        const uint8_t* p = stream.p();
+        const size_t avail = stream.size() - std::min<size_t>(stream.pos(), stream.size());
+        const void* nul = avail > 0 ? std::memchr(p, '\0', avail) : nullptr;
+        if (nul == nullptr) {
+          return make_error_code(lief_errors::read_error);
+        }
+        stream.increment_pos(static_cast<const uint8_t*>(nul) - p + 1);
+        return ok();
+      }
+
+    case DW_FORM::sdata:
+      {
+        auto v = stream.read_sleb128();
+        if (!v) {
+          return make_error_code(lief_errors::read_error);
+        }
+        value.value = *v;
+        return ok();
+      }
+
+    case DW_FORM::udata:
+    case DW_FORM::ref_udata:
+    case DW_FORM::strx:
+    case DW_FORM::addrx:
+    case DW_FORM::loclistx:
+    case DW_FORM::rnglistx:
+    case DW_FORM::GNU_addr_index:
+    case DW_FORM::GNU_str_index:
+      {
+        auto v = stream.read_uleb128();
+        if (!v) {
+          return make_error_code(lief_errors::read_error);
+        }
+        value.value = *v;
+        break;
+      }
+
+    case DW_FORM::block1:
+      block_size = read_sized(stream, sizeof(uint8_t));
+      break;
+
+    case DW_FORM::block2:
+      block_size = read_sized(stream, sizeof(uint16_t));
+      break;
+
+    case DW_FORM::block4:
+      block_size = read_sized(stream, sizeof(uint32_t));
+      break;
+
+    case DW_FORM::block:
+    case DW_FORM::exprloc:
+      block_size = stream.read_uleb128();
+      break;
+
+    case DW_FORM::data16:
+      block_size = 16;
+      break;
+
+    case DW_FORM::indirect:
+      {
+        auto form = stream.read_uleb128();
+        if (!form || *form == DW_FORM::indirect) {
+          return make_error_code(lief_errors::read_error);
+        }
+        attr_spec_t indirect = spec;
+        indirect.form = static_cast<uint16_t>(*form);
+        return read_form(stream, unit, indirect, value, inline_str);
+      }
+
+    default:
+      {
+        const int64_t size = form_size(spec.form, unit);
+        if (size < 0) {
+          LIEF_DEBUG("Unsupported form: 0x{:04x}", spec.form);
+          return make_error_code(lief_errors::not_supported);
+        }
+        auto v = read_sized(stream, size);
+        if (!v) {
+          return make_error_code(lief_errors::read_error);
+        }
+        value.value = *v;
+      }
+  }
+
+  if (!block_size) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  if (*block_size > 0) {
+    if (*block_size > stream.size() - std::min<size_t>(stream.pos(), stream.size())) {
+      return make_error_code(lief_errors::read_error);
+    }
+    stream.increment_pos(*block_size);
+  }
+
+  switch (spec.form) {
+    case DW_FORM::strp:
+      value.value = make_str(STR, value.value);
+      break;
+
+    case DW_FORM::line_strp:
+      value.value = make_str(LINE_STR, value.value);
+      break;
+
+    case DW_FORM::strx:
+    case DW_FORM::strx1:
+    case DW_FORM::strx2:
+    case DW_FORM::strx3:
+    case DW_FORM::strx4:
+    case DW_FORM::GNU_str_index:
+      value.value = make_str(STRX, value.value);
+      break;
+
+    // Strings located in a supplementary object file
+    case DW_FORM::strp_sup:
+    case DW_FORM::GNU_strp_alt:
+      value.value = 0;
+      break;
+
+    case DW_FORM::ref1:
+    case DW_FORM::ref2:
+    case DW_FORM::ref4:
+    case DW_FORM::ref8:
+    case DW_FORM::ref_udata:
+      value.value += unit.offset;
+      break;
+
+    // References to a supplementary object file or to a type unit
+    case DW_FORM::ref_sup4:
+    case DW_FORM::ref_sup8:
+    case DW_FORM::ref_sig8:
+    case DW_FORM::GNU_ref_alt:
+      value.value = unit_t::NONE;
+      break;
+
+    default:
+      break;
+  }
+  return ok();
+}
+
+ok_error_t Reader::skip_attributes(SpanStream& stream, const unit_t& unit,
+                                   const abbrev_t& abbrev) const
+{
+  if (abbrev.fixed_size >= 0) {
+    if ((uint64_t)abbrev.fixed_size > stream.size() - std::min<size_t>(stream.pos(), stream.size())) {
+      return make_error_code(lief_errors::read_error);
+    }
+    stream.increment_pos(abbrev.fixed_size);
+    return ok();
+  }
+
+  for (const attr_spec_t& spec : abbrev.attrs) {
+    const int64_t size = form_size(spec.form, unit);
+    if (size >= 0) {
+      stream.increment_pos(size);
+      continue;
+    }
+
+    form_value_t value;
+    if (!read_form(stream, unit, spec, value)) {
+      return make_error_code(lief_errors::read_error);
+    }
+  }
+
+  if (stream.pos() > stream.size()) {
+    return make_error_code(lief_errors::read_error);
+  }
+  return ok();
+}
+
+result<uint64_t> Reader::index_address(const unit_t& unit, uint64_t index) const {
+  SpanStream stream = this->stream(sec_.addr);
+  stream.setpos(unit.addr_base + index * unit.addr_size);
+  return read_sized(stream, unit.addr_size);
+}
+
+result<uint64_t> Reader::address(const unit_t& unit, const form_value_t& value) const {
+  switch (value.form) {
+    case DW_FORM::addr:
+      return value.value;
+
+    case DW_FORM::addrx:
+    case DW_FORM::addrx1:
+    case DW_FORM::addrx2:
+    case DW_FORM::addrx3:
+    case DW_FORM::addrx4:
+    case DW_FORM::GNU_addr_index:
+      return index_address(unit, value.value);
+
+    default:
+      return make_error_code(lief_errors::not_supported);
+  }
+}
+
+result<uint64_t> Reader::high_pc(const unit_t& unit, uint64_t low_pc,
+                                 const form_value_t& value) const
+{
+  // DWARF 4+: when DW_AT_high_pc is a constant, it is an offset from
+  // DW_AT_low_pc
+  if (auto addr = address(unit, value)) {
+    return *addr;
+  }
+  return low_pc + value.value;
+}
+
+ok_error_t Reader::ranges(const unit_t& unit, const form_value_t& value,
+                          bool unit_die, ranges_t& out) const
+{
+  if (value.form == DW_FORM::rnglistx) {
+    SpanStream stream = this->stream(sec_.rnglists);
+    stream.setpos(unit.rnglists_base + value.value * unit.offset_size());
+    auto offset = read_offset(stream, unit);
+    if (!offset) {
+      return make_error_code(lief_errors::read_error);
+    }
+    return v5_ranges(unit, unit.rnglists_base + *offset, out);
+  }
+
+  if (unit.version >= 5) {
+    return v5_ranges(unit, value.value, out);
+  }
+
+  // GNU split DWARF: the offsets of the DIEs (except the unit DIE) are
+  // relative to DW_AT_GNU_ranges_base
+  return v4_ranges(unit, unit_die ? value.value : value.value + unit.ranges_base, out);
+}
+
+ok_error_t Reader::v4_ranges(const unit_t& unit, uint64_t offset, ranges_t& out) const {
+  SpanStream stream = this->stream(sec_.ranges);
+  stream.setpos(offset);
+
+  const uint64_t max_addr = unit.addr_size == sizeof(uint64_t) ?
+                            ~uint64_t(0) : (uint64_t(1) << (unit.addr_size * 8)) - 1;
+  uint64_t base = unit.base_address;
+  while (true) {
+    auto start = read_sized(stream, unit.addr_size);
+    auto end = read_sized(stream, unit.addr_size);
+    if (!start || !end) {
+      return make_error_code(lief_errors::read_error);
+    }
+
+    if (*start == 0 && *end == 0) {
+      return ok();
+    }
+
+    // Base address selection entry
+    if (*start == max_addr) {
+      base = *end;
+      continue;
+    }
+
+    if (*start < *end) {
+      out.emplace_back(base + *start, base + *end);
+    }
+  }
+}
+
+ok_error_t Reader::v5_ranges(const unit_t& unit, uint64_t offset, ranges_t& out) const {
+  SpanStream stream = this->stream(sec_.rnglists);
+  stream.setpos(offset);
+
+  uint64_t base = unit.base_address;
+  while (true) {
+    auto kind = stream.read<uint8_t>();
+    if (!kind) {
+      return make_error_code(lief_errors::read_error);
+    }
+
+    result<uint64_t> start = 0;
+    result<uint64_t> end = 0;
+    switch (*kind) {
+      case DW_RLE::end_of_list:
+        return ok();
+
+      case DW_RLE::base_addressx:
+        {
+          auto index = stream.read_uleb128();
+          if (!index) {
+            return make_error_code(lief_errors::read_error);
+          }
+          auto addr = index_address(unit, *index);
+          if (!addr) {
+            return make_error_code(lief_errors::read_error);
+          }
+          base = *addr;
+          continue;
+        }
+
+      case DW_RLE::base_address:
+        {
+          auto addr = read_sized(stream, unit.addr_size);
+          if (!addr) {
+            return make_error_code(lief_errors::read_error);
+          }
+          base = *addr;
+          continue;
+        }
+
+      case DW_RLE::startx_endx:
+        {
+          auto start_idx = stream.read_uleb128();
+          auto end_idx = stream.read_uleb128();
+          if (!start_idx || !end_idx) {
+            return make_error_code(lief_errors::read_error);
+          }
+          start = index_address(unit, *start_idx);
+          end = index_address(unit, *end_idx);
+          break;
+        }
+
+      case DW_RLE::startx_length:
+        {
+          auto start_idx = stream.read_uleb128();
+          auto length = stream.read_uleb128();
+          if (!start_idx || !length) {
+            return make_error_code(lief_errors::read_error);
+          }
+          start = index_address(unit, *start_idx);
+          if (start) {
+            end = *start + *length;
+          }
+          break;
+        }
+
+      case DW_RLE::offset_pair:
+        {
+          auto start_off = stream.read_uleb128();
+          auto end_off = stream.read_uleb128();
+          if (!start_off || !end_off) {
+            return make_error_code(lief_errors::read_error);
+          }
+          start = base + *start_off;
+          end = base + *end_off;
+          break;
+        }
+
+      case DW_RLE::start_end:
+        start = read_sized(stream, unit.addr_size);
+        end = read_sized(stream, unit.addr_size);
+        break;
+
+      case DW_RLE::start_length:
+        {
+          start = read_sized(stream, unit.addr_size);
+          auto length = stream.read_uleb128();
+          if (!length) {
+            return make_error_code(lief_errors::read_error);
+          }
+          if (start) {
+            end = *start + *length;
+          }
+          break;
+        }
+
+      default:
+        LIEF_DEBUG("Unknown range list entry: 0x{:02x} (offset: 0x{:x})",
+                   *kind, stream.pos() - 1);
+        return make_error_code(lief_errors::corrupted);
+    }
+
+    if (!start || !end) {
+      return make_error_code(lief_errors::read_error);
+    }
+
+    if (*start < *end) {
+      out.emplace_back(*start, *end);
+    }
+  }
+}
+
+strref_t Reader::resolve(const unit_t& unit, strref_t ref) const {
+  if ((ref >> STR_KIND_SHIFT) != STRX) {
+    return ref;
+  }
+
+  const uint64_t index = ref & STR_OFFSET_MASK;
+  SpanStream stream = this->stream(sec_.str_offsets);
+  stream.setpos(unit.str_offsets_base + index * unit.offset_size());
+  auto offset = read_offset(stream, unit);
+  if (!offset) {
+    return 0;
+  }
+  return make_str(STR, *offset);
+}
+
+std::string_view Reader::string(strref_t ref) const {
+  span<const uint8_t> content;
+  switch (ref >> STR_KIND_SHIFT) {
+    case STR:      content = sec_.str; break;
+    case LINE_STR: content = sec_.line_str; break;
+    case INFO:     content = sec_.info; break;
+    case LINE:     content = sec_.line; break;
+    default:       return {};
+  }
+
+  const uint64_t offset = ref & STR_OFFSET_MASK;
+  if (offset >= content.size()) {
+    return {};
+  }
+
+  const auto* start = reinterpret_cast<const char*>(content.data() + offset);
+  const size_t avail = content.size() - offset;
+  const void* nul = std::memchr(start, '\0', avail);
+  const size_t size = nul == nullptr ? avail : static_cast<const char*>(nul) - start;
+  return {start, size};
+}
+
+}
+}
+}
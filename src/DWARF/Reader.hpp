@@ -0,0 +1,275 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_DWARF_READER_H
+#define LIEF_DWARF_READER_H
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "LIEF/errors.hpp"
+#include "LIEF/span.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
+
+namespace LIEF {
+namespace dwarf {
+namespace details {
+
+/// Reference to a NUL-terminated string located in one of the DWARF
+/// sections. The upper bits identify the section (see Reader::STR_KIND) and
+/// the lower bits the offset of the string in this section. This allows to
+/// store (and serialize) the names without copying them.
+using strref_t = uint64_t;
+
+/// Sorted list of `[low, high)` address ranges
+using ranges_t = std::vector<std::pair<uint64_t, uint64_t>>;
+
+/// Content of the DWARF sections used by the index. The sections that are
+/// not present are empty.
+struct sections_t {
+  span<const uint8_t> info;
+  span<const uint8_t> abbrev;
+  span<const uint8_t> aranges;
+  span<const uint8_t> line;
+  span<const uint8_t> line_str;
+  span<const uint8_t> str;
+  span<const uint8_t> str_offsets;
+  span<const uint8_t> addr;
+  span<const uint8_t> ranges;
+  span<const uint8_t> rnglists;
+
+  /// True if the DWARF data must be byte-swapped (big-endian binary)
+  bool swap = false;
+};
+
+/// Compilation unit (header and unit DIE attributes)
+struct unit_t {
+  static constexpr uint64_t NONE = static_cast<uint64_t>(-1);
+
+  /// Offset of the unit header in `.debug_info`
+  uint64_t offset = 0;
+
+  /// Offset of the end of the unit in `.debug_info`
+  uint64_t end = 0;
+
+  /// Offset of the unit DIE in `.debug_info`
+  uint64_t die_offset = 0;
+
+  uint64_t abbrev_offset = 0;
+  uint16_t version = 0;
+  uint8_t type = 0;
+  uint8_t addr_size = 0;
+  bool dwarf64 = false;
+
+  /// `DW_AT_low_pc` of the unit DIE which is the base address of the
+  /// (v4) range lists
+  uint64_t base_address = 0;
+
+  /// Offset of the line program in `.debug_line`
+  uint64_t stmt_list = NONE;
+
+  uint64_t str_offsets_base = 0;
+  uint64_t addr_base = 0;
+  uint64_t rnglists_base = 0;
+  uint64_t ranges_base = 0;
+
+  strref_t name = 0;
+  strref_t comp_dir = 0;
+
+  uint8_t offset_size() const {
+    return dwarf64 ? sizeof(uint64_t) : sizeof(uint32_t);
+  }
+};
+
+struct attr_spec_t {
+  uint16_t attr = 0;
+  uint16_t form = 0;
+  int64_t implicit_const = 0;
+};
+
+struct abbrev_t {
+  uint64_t code = 0;
+  uint16_t tag = 0;
+  bool has_children = false;
+
+  /// Size of the attributes if all of them have a fixed size, -1 otherwise.
+  /// It is used to skip the DIEs we are not interested in.
+  int64_t fixed_size = -1;
+  std::vector<attr_spec_t> attrs;
+};
+
+/// Decoded value of an attribute.
+///
+/// - Constants, addresses (or `addrx` index) and section offsets are stored
+///   as-is.
+/// - References are converted into an absolute offset in `.debug_info`
+/// - Strings are converted into a strref_t
+struct form_value_t {
+  uint16_t form = 0;
+  uint64_t value = 0;
+};
+
+class Reader;
+
+/// Abbreviations of a compilation unit
+class AbbrevTable {
+  public:
+  AbbrevTable() = default;
+
+  static AbbrevTable parse(const Reader& reader, const unit_t& unit);
+
+  const abbrev_t* get(uint64_t code) const {
+    // Abbreviation codes are usually numbered from 1 without gaps
+    if (code >= 1 && code <= abbrevs_.size() && abbrevs_[code - 1].code == code) {
+      return &abbrevs_[code - 1];
+    }
+    return find(code);
+  }
+
+  size_t size() const {
+    return abbrevs_.size();
+  }
+
+  private:
+  const abbrev_t* find(uint64_t code) const;
+  std::vector<abbrev_t> abbrevs_;
+};
+
+/// Low-level reader of the DWARF sections (unit headers, DIEs, forms,
+/// strings and range lists)
+class Reader {
+  public:
+  enum STR_KIND : uint64_t {
+    NO_STR   = 0,
+    STR      = 1, ///< Offset in `.debug_str`
+    LINE_STR = 2, ///< Offset in `.debug_line_str`
+    INFO     = 3, ///< Offset in `.debug_info` (`DW_FORM_string`)
+    LINE     = 4, ///< Offset in `.debug_line` (`DW_FORM_string`)
+    STRX     = 5, ///< Unresolved index in `.debug_str_offsets`
+  };
+
+  static constexpr uint64_t STR_KIND_SHIFT = 60;
+  static constexpr uint64_t STR_OFFSET_MASK = (uint64_t(1) << STR_KIND_SHIFT) - 1;
+
+  static strref_t make_str(STR_KIND kind, uint64_t offset) {
+    return (static_cast<uint64_t>(kind) << STR_KIND_SHIFT) | (offset & STR_OFFSET_MASK);
+  }
+
+  Reader(const sections_t& sections) :
+    sec_(sections)
+  {}
+
+  const sections_t& sections() const {
+    return sec_;
+  }
+
+  /// Stream over the given section content, configured with the endianness
+  /// of the binary
+  SpanStream stream(span<const uint8_t> content) const {
+    SpanStream stream(content);
+    stream.set_endian_swap(sec_.swap);
+    return stream;
+  }
+
+  /// Parse the header of the unit located at the given offset in
+  /// `.debug_info`
+  result<unit_t> read_unit_header(uint64_t offset) const;
+
+  /// Read the attributes of the unit DIE (base address, line program, ...).
+  /// If `ranges` is not null, the address ranges covered by the unit are
+  /// appended to it.
+  ok_error_t read_unit_die(unit_t& unit, ranges_t* ranges = nullptr) const;
+
+  /// Read the abbreviation with the given code without parsing the whole
+  /// abbreviation table of the unit.
+  result<abbrev_t> find_abbrev(const unit_t& unit, uint64_t code) const;
+
+  /// Read a single attribute value. `inline_str` identifies the section
+  /// over which `stream` is opened (for `DW_FORM_string`).
+  ok_error_t read_form(SpanStream& stream, const unit_t& unit,
+                       const attr_spec_t& spec, form_value_t& value,
+                       STR_KIND inline_str = INFO) const;
+
+  /// Call `fn(attr, value)` for each attribute of the DIE described by
+  /// `abbrev`. The stream must be located after the abbreviation code.
+  template<class F>
+  ok_error_t read_attributes(SpanStream& stream, const unit_t& unit,
+                             const abbrev_t& abbrev, F&& fn) const
+  {
+    for (const attr_spec_t& spec : abbrev.attrs) {
+      form_value_t value;
+      if (!read_form(stream, unit, spec, value)) {
+        return make_error_code(lief_errors::read_error);
+      }
+      fn(spec.attr, value);
+    }
+    return ok();
+  }
+
+  /// Skip the attributes of the DIE described by `abbrev`
+  ok_error_t skip_attributes(SpanStream& stream, const unit_t& unit,
+                             const abbrev_t& abbrev) const;
+
+  /// Size of the given form or -1 if its size is variable
+  static int64_t form_size(uint16_t form, const unit_t& unit);
+
+  /// Resolve the address associated with a `DW_FORM_addr{x}` value
+  result<uint64_t> address(const unit_t& unit, const form_value_t& value) const;
+
+  /// Resolve the end address associated with a `DW_AT_high_pc` value
+  result<uint64_t> high_pc(const unit_t& unit, uint64_t low_pc,
+                           const form_value_t& value) const;
+
+  /// Decode the range list referenced by a `DW_AT_ranges` value and append
+  /// the ranges to `out`.
+  ok_error_t ranges(const unit_t& unit, const form_value_t& value,
+                    bool unit_die, ranges_t& out) const;
+
+  /// Convert a string reference that depends on the unit (`DW_FORM_strx`)
+  /// into a unit-independent reference
+  strref_t resolve(const unit_t& unit, strref_t ref) const;
+
+  /// Return the string associated with a (resolved) reference
+  std::string_view string(strref_t ref) const;
+
+  /// Read a section offset (4 or 8 bytes according to the DWARF format)
+  result<uint64_t> read_offset(SpanStream& stream, const unit_t& unit) const {
+    if (unit.dwarf64) {
+      return stream.read<uint64_t>();
+    }
+    auto value = stream.read<uint32_t>();
+    if (!value) {
+      return make_error_code(lief_errors::read_error);
+    }
+    return *value;
+  }
+
+  /// Read an unsigned integer of 1, 2, 3, 4 or 8 bytes
+  result<uint64_t> read_sized(SpanStream& stream, size_t size) const;
+
+  private:
+  result<uint64_t> index_address(const unit_t& unit, uint64_t index) const;
+
+  ok_error_t v4_ranges(const unit_t& unit, uint64_t offset, ranges_t& out) const;
+  ok_error_t v5_ranges(const unit_t& unit, uint64_t offset, ranges_t& out) const;
+
+  sections_t sec_;
+};
+
+}
+}
+}
+#endif
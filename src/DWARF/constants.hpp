@@ -0,0 +1,152 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_DWARF_CONSTANTS_H
+#define LIEF_DWARF_CONSTANTS_H
+#include <cstdint>
+
+// Subset of the DWARF constants (DWARF 5 - Section 7) used by the
+// address index
+namespace LIEF {
+namespace dwarf {
+namespace details {
+
+namespace DW_UT {
+static constexpr uint8_t compile       = 0x01;
+static constexpr uint8_t type          = 0x02;
+static constexpr uint8_t partial       = 0x03;
+static constexpr uint8_t skeleton      = 0x04;
+static constexpr uint8_t split_compile = 0x05;
+static constexpr uint8_t split_type    = 0x06;
+}
+
+namespace DW_TAG {
+static constexpr uint16_t compile_unit = 0x11;
+static constexpr uint16_t partial_unit = 0x3c;
+static constexpr uint16_t skeleton_unit = 0x4a;
+static constexpr uint16_t subprogram   = 0x2e;
+}
+
+namespace DW_AT {
+static constexpr uint16_t name             = 0x03;
+static constexpr uint16_t stmt_list        = 0x10;
+static constexpr uint16_t low_pc           = 0x11;
+static constexpr uint16_t high_pc          = 0x12;
+static constexpr uint16_t comp_dir         = 0x1b;
+static constexpr uint16_t abstract_origin  = 0x31;
+static constexpr uint16_t declaration      = 0x3c;
+static constexpr uint16_t specification    = 0x47;
+static constexpr uint16_t ranges           = 0x55;
+static constexpr uint16_t linkage_name     = 0x6e;
+static constexpr uint16_t str_offsets_base = 0x72;
+static constexpr uint16_t addr_base        = 0x73;
+static constexpr uint16_t rnglists_base    = 0x74;
+static constexpr uint16_t MIPS_linkage_name = 0x2007;
+static constexpr uint16_t GNU_ranges_base  = 0x2132;
+static constexpr uint16_t GNU_addr_base    = 0x2133;
+}
+
+namespace DW_FORM {
+static constexpr uint16_t addr           = 0x01;
+static constexpr uint16_t block2         = 0x03;
+static constexpr uint16_t block4         = 0x04;
+static constexpr uint16_t data2          = 0x05;
+static constexpr uint16_t data4          = 0x06;
+static constexpr uint16_t data8          = 0x07;
+static constexpr uint16_t string         = 0x08;
+static constexpr uint16_t block          = 0x09;
+static constexpr uint16_t block1         = 0x0a;
+static constexpr uint16_t data1          = 0x0b;
+static constexpr uint16_t flag           = 0x0c;
+static constexpr uint16_t sdata          = 0x0d;
+static constexpr uint16_t strp           = 0x0e;
+static constexpr uint16_t udata          = 0x0f;
+static constexpr uint16_t ref_addr       = 0x10;
+static constexpr uint16_t ref1           = 0x11;
+static constexpr uint16_t ref2           = 0x12;
+static constexpr uint16_t ref4           = 0x13;
+static constexpr uint16_t ref8           = 0x14;
+static constexpr uint16_t ref_udata      = 0x15;
+static constexpr uint16_t indirect       = 0x16;
+static constexpr uint16_t sec_offset     = 0x17;
+static constexpr uint16_t exprloc        = 0x18;
+static constexpr uint16_t flag_present   = 0x19;
+static constexpr uint16_t strx           = 0x1a;
+static constexpr uint16_t addrx          = 0x1b;
+static constexpr uint16_t ref_sup4       = 0x1c;
+static constexpr uint16_t strp_sup       = 0x1d;
+static constexpr uint16_t data16         = 0x1e;
+static constexpr uint16_t line_strp      = 0x1f;
+static constexpr uint16_t ref_sig8       = 0x20;
+static constexpr uint16_t implicit_const = 0x21;
+static constexpr uint16_t loclistx       = 0x22;
+static constexpr uint16_t rnglistx       = 0x23;
+static constexpr uint16_t ref_sup8       = 0x24;
+static constexpr uint16_t strx1          = 0x25;
+static constexpr uint16_t strx2          = 0x26;
+static constexpr uint16_t strx3          = 0x27;
+static constexpr uint16_t strx4          = 0x28;
+static constexpr uint16_t addrx1         = 0x29;
+static constexpr uint16_t addrx2         = 0x2a;
+static constexpr uint16_t addrx3         = 0x2b;
+static constexpr uint16_t addrx4         = 0x2c;
+static constexpr uint16_t GNU_addr_index = 0x1f01;
+static constexpr uint16_t GNU_str_index  = 0x1f02;
+static constexpr uint16_t GNU_ref_alt    = 0x1f20;
+static constexpr uint16_t GNU_strp_alt   = 0x1f21;
+}
+
+namespace DW_RLE {
+static constexpr uint8_t end_of_list   = 0x00;
+static constexpr uint8_t base_addressx = 0x01;
+static constexpr uint8_t startx_endx   = 0x02;
+static constexpr uint8_t startx_length = 0x03;
+static constexpr uint8_t offset_pair   = 0x04;
+static constexpr uint8_t base_address  = 0x05;
+static constexpr uint8_t start_end     = 0x06;
+static constexpr uint8_t start_length  = 0x07;
+}
+
+namespace DW_LNS {
+static constexpr uint8_t copy               = 0x01;
+static constexpr uint8_t advance_pc         = 0x02;
+static constexpr uint8_t advance_line       = 0x03;
+static constexpr uint8_t set_file           = 0x04;
+static constexpr uint8_t set_column         = 0x05;
+static constexpr uint8_t negate_stmt        = 0x06;
+static constexpr uint8_t set_basic_block    = 0x07;
+static constexpr uint8_t const_add_pc       = 0x08;
+static constexpr uint8_t fixed_advance_pc   = 0x09;
+static constexpr uint8_t set_prologue_end   = 0x0a;
+static constexpr uint8_t set_epilogue_begin = 0x0b;
+static constexpr uint8_t set_isa            = 0x0c;
+}
+
+namespace DW_LNE {
+static constexpr uint8_t end_sequence      = 0x01;
+static constexpr uint8_t set_address       = 0x02;
+static constexpr uint8_t define_file       = 0x03;
+static constexpr uint8_t set_discriminator = 0x04;
+}
+
+namespace DW_LNCT {
+static constexpr uint16_t path            = 0x1;
+static constexpr uint16_t directory_index = 0x2;
+}
+
+}
+}
+}
+#endif
@@ -54,6 +54,7 @@
 
 #include "ELF/DataHandler/Handler.hpp"
 #include "ELF/SizingInfo.hpp"
+#include "ELF/CompactRelocations.hpp"
 
 #include "Binary.tcc"
 #include "Object.tcc"
@@ -76,7 +77,8 @@ inline size_t get_relocation_sizeof(const Binary& bin, const Relocation& R) {
 
 Binary::Binary() :
   LIEF::Binary(LIEF::Binary::FORMATS::ELF),
-  sizing_info_{std::make_unique<sizing_info_t>()}
+  sizing_info_{std::make_unique<sizing_info_t>()},
+  compact_relocations_{std::make_unique<compact_relocations_t>()}
 {}
 
 size_t Binary::hash(const std::string& name) {
@@ -216,7 +218,9 @@ void Binary::remove(const Section& section, bool clear) {
   }
 
 
-  datahandler_->remove(s->file_offset(), s->size(), DataHandler::Node::SECTION);
+  if (s->node_ != nullptr) {
+    datahandler_->remove(*s->node_);
+  }
 
   // Patch header
   header().numberof_sections(header().numberof_sections() - 1);
@@ -262,7 +266,7 @@ int64_t Binary::symtab_idx(const std::string& name) const {
 
   auto it = std::find_if(symtab_symbols_.begin(), symtab_symbols_.end(),
     [&name] (const std::unique_ptr<Symbol>& S) {
-      return S->name() == name;
+      return static_cast<const Symbol&>(*S).name() == name;
     }
   );
 
@@ -288,7 +292,7 @@ int64_t Binary::dynsym_idx(const std::string& name) const {
 
   auto it = std::find_if(dynamic_symbols_.begin(), dynamic_symbols_.end(),
     [&name] (const std::unique_ptr<Symbol>& S) {
-      return S->name() == name;
+      return static_cast<const Symbol&>(*S).name() == name;
     }
   );
   if (it == dynamic_symbols_.end()) {
@@ -412,7 +416,7 @@ const Symbol* Binary::get_dynamic_symbol(const std::string& name) const {
   const auto it_symbol = std::find_if(
       std::begin(dynamic_symbols_), std::end(dynamic_symbols_),
       [&name] (const std::unique_ptr<Symbol>& s) {
-        return s->name() == name;
+        return static_cast<const Symbol&>(*s).name() == name;
       });
 
   if (it_symbol == std::end(dynamic_symbols_)) {
@@ -425,7 +429,7 @@ const Symbol* Binary::get_symtab_symbol(const std::string& name) const {
   const auto it_symbol = std::find_if(
       std::begin(symtab_symbols_), std::end(symtab_symbols_),
       [&name] (const std::unique_ptr<Symbol>& s) {
-        return s->name() == name;
+        return static_cast<const Symbol&>(*s).name() == name;
       });
   if (it_symbol == std::end(symtab_symbols_)) {
     return nullptr;
@@ -578,6 +582,7 @@ void Binary::remove_dynamic_symbol(Symbol* symbol) {
   }
 
   // Update relocations
+  materialize_relocations();
   auto it_relocation = std::find_if(std::begin(relocations_), std::end(relocations_),
       [symbol] (const std::unique_ptr<Relocation>& relocation) {
         return relocation->purpose() == Relocation::PURPOSE::PLTGOT &&
@@ -672,7 +677,88 @@ void Binary::remove_dynamic_symbol(Symbol* symbol) {
 // Dynamics
 // --------
 
+Binary::it_relocations Binary::relocations() {
+  materialize_relocations();
+  return relocations_;
+}
+
+Binary::it_const_relocations Binary::relocations() const {
+  materialize_relocations();
+  return relocations_;
+}
+
+void Binary::materialize_relocations() const {
+  if (compact_relocations_ == nullptr) {
+    return;
+  }
+
+  // The const accessors (e.g. relocations() const) can be called
+  // concurrently on the same binary: the first one converts the columns
+  // while the others wait for the conversion.
+  std::lock_guard<std::mutex> lock(compact_relocations_->lock);
+  if (compact_relocations_->empty()) {
+    return;
+  }
+
+  const compact_relocations_t::relr_t& relr = compact_relocations_->relr;
+  const compact_relocations_t::android_t& android = compact_relocations_->android;
+  auto* self = const_cast<Binary*>(this);
+
+  relocations_t relr_relocs;
+  relr_relocs.reserve(relr.offsets.size());
+  for (uint64_t offset : relr.offsets) {
+    auto reloc = std::make_unique<Relocation>(offset, relr.type,
+                                              Relocation::ENCODING::RELR);
+    reloc->purpose(Relocation::PURPOSE::DYNAMIC);
+    reloc->binary_ = self;
+    relr_relocs.push_back(std::move(reloc));
+  }
+
+  relocations_t android_relocs;
+  android_relocs.reserve(android.size());
+  const ARCH arch = header().machine_type();
+  for (size_t i = 0; i < android.size(); ++i) {
+    std::unique_ptr<Relocation> reloc;
+    if (type_ == Header::CLASS::ELF32) {
+      details::Elf32_Rela R;
+      R.r_offset = static_cast<uint32_t>(android.offsets[i]);
+      R.r_info   = static_cast<uint32_t>(android.infos[i]);
+      R.r_addend = static_cast<int32_t>(android.addends[i]);
+      reloc.reset(new Relocation(R, Relocation::PURPOSE::DYNAMIC,
+                                 Relocation::ENCODING::ANDROID_SLEB, arch));
+    } else {
+      details::Elf64_Rela R;
+      R.r_offset = android.offsets[i];
+      R.r_info   = android.infos[i];
+      R.r_addend = android.addends[i];
+      reloc.reset(new Relocation(R, Relocation::PURPOSE::DYNAMIC,
+                                 Relocation::ENCODING::ANDROID_SLEB, arch));
+    }
+    if (reloc->info() < dynamic_symbols_.size()) {
+      reloc->symbol_ = dynamic_symbols_[reloc->info()].get();
+    }
+    reloc->binary_ = self;
+    android_relocs.push_back(std::move(reloc));
+  }
+
+  // The relocations are inserted at the position they would have had if they
+  // were materialized by the parser. RELR relocations are always parsed
+  // before the Android packed relocations (i.e. relr.position <= android.position)
+  const size_t android_pos = std::min(android.position, relocations_.size());
+  relocations_.insert(relocations_.begin() + android_pos,
+                      std::make_move_iterator(android_relocs.begin()),
+                      std::make_move_iterator(android_relocs.end()));
+
+  const size_t relr_pos = std::min(relr.position, relocations_.size());
+  relocations_.insert(relocations_.begin() + relr_pos,
+                      std::make_move_iterator(relr_relocs.begin()),
+                      std::make_move_iterator(relr_relocs.end()));
+
+  compact_relocations_->clear();
+}
+
 Binary::it_dynamic_relocations Binary::dynamic_relocations() {
+  materialize_relocations();
   return {relocations_, [] (const std::unique_ptr<Relocation>& reloc) {
       return reloc->purpose() == Relocation::PURPOSE::DYNAMIC;
     }
@@ -680,6 +766,7 @@ Binary::it_dynamic_relocations Binary::dynamic_relocations() {
 }
 
 Binary::it_const_dynamic_relocations Binary::dynamic_relocations() const {
+  materialize_relocations();
   return {relocations_, [] (const std::unique_ptr<Relocation>& reloc) {
       return reloc->purpose() == Relocation::PURPOSE::DYNAMIC;
     }
@@ -705,8 +792,8 @@ Relocation& Binary::add_dynamic_relocation(const Relocation& relocation) {
     }
     const auto it_sym = std::find_if(
         std::begin(dynamic_symbols_), std::end(dynamic_symbols_),
-        [inner_sym] (const std::unique_ptr<Symbol>& s) {
-          return s->name() == inner_sym->name();
+        [associated_sym] (const std::unique_ptr<Symbol>& s) {
+          return static_cast<const Symbol&>(*s).name() == associated_sym->name();
         });
     const size_t idx = std::distance(std::begin(dynamic_symbols_), it_sym);
     relocation_ptr->info(idx);
@@ -746,8 +833,8 @@ Relocation& Binary::add_pltgot_relocation(const Relocation& relocation) {
     }
     const auto it_sym = std::find_if(
         std::begin(dynamic_symbols_), std::end(dynamic_symbols_),
-        [inner_sym] (const std::unique_ptr<Symbol>& s) {
-         return s->name() == inner_sym->name();
+        [associated_sym] (const std::unique_ptr<Symbol>& s) {
+         return static_cast<const Symbol&>(*s).name() == associated_sym->name();
         });
     const size_t idx = std::distance(std::begin(dynamic_symbols_), it_sym);
     relocation_ptr->info(idx);
@@ -820,6 +907,7 @@ Binary::it_const_object_relocations Binary::object_relocations() const {
 }
 
 LIEF::Binary::relocations_t Binary::get_abstract_relocations() {
+  materialize_relocations();
   LIEF::Binary::relocations_t relocations;
   relocations.reserve(relocations_.size());
   std::transform(std::begin(relocations_), std::end(relocations_),
@@ -959,7 +1047,7 @@ result<uint64_t> Binary::get_function_address(const std::string& func_name, bool
         }
 
         if (sname.empty()) {
-          sname = symbol->name();
+          sname = static_cast<const Symbol&>(*symbol).name();
         }
         return sname == func_name &&
                symbol->type() == Symbol::TYPE::FUNC;
@@ -1090,7 +1178,7 @@ Segment* Binary::replace(const Segment& new_segment, const Segment& original_seg
 
   DataHandler::Node new_node{new_segment_ptr->file_offset(), new_segment_ptr->physical_size(),
                              DataHandler::Node::SEGMENT};
-  datahandler_->add(new_node);
+  new_segment_ptr->node_ = &datahandler_->add(new_node);
   new_segment_ptr->handler_size_ = new_segment_ptr->physical_size();
 
   const uint64_t last_offset_sections = last_offset_section();
@@ -1139,7 +1227,9 @@ Segment* Binary::replace(const Segment& new_segment, const Segment& original_seg
 
   // Remove
   std::unique_ptr<Segment> local_original_segment = std::move(*it_original_segment);
-  datahandler_->remove(local_original_segment->file_offset(), local_original_segment->physical_size(), DataHandler::Node::SEGMENT);
+  if (local_original_segment->node_ != nullptr) {
+    datahandler_->remove(*local_original_segment->node_);
+  }
   segments_.erase(it_original_segment);
 
   // Patch shdr
@@ -1166,8 +1256,9 @@ void Binary::remove(const Segment& segment) {
   }
 
   std::unique_ptr<Segment> local_segment = std::move(*it_segment);
-  datahandler_->remove(local_segment->file_offset(), local_segment->physical_size(),
-                       DataHandler::Node::SEGMENT);
+  if (local_segment->node_ != nullptr) {
+    datahandler_->remove(*local_segment->node_);
+  }
   if (phdr_reloc_info_.new_offset > 0) {
     ++phdr_reloc_info_.nb_segments;
   }
@@ -1237,14 +1328,9 @@ Section* Binary::extend(const Section& section, uint64_t size) {
   }
 
 
+  // The new bytes are the (zero-filled) hole created above
   section_to_extend->size(section_to_extend->size() + size);
 
-  span<const uint8_t> content_ref = section_to_extend->content();
-  std::vector<uint8_t> content    = {std::begin(content_ref), std::end(content_ref)};
-  content.resize(section_to_extend->size(), 0);
-  section_to_extend->content(content);
-
-
   header().section_headers_offset(header().section_headers_offset() + shift);
 
   if (section_loaded) {
@@ -1422,6 +1508,25 @@ void Binary::patch_address(uint64_t address, uint64_t patch_value, size_t size,
   }
 }
 
+result<LIEF::Binary::content_region_t>
+  Binary::get_content_region(uint64_t address, LIEF::Binary::VA_TYPES)
+{
+  // Same resolution as patch_address(): object files do not have segments
+  if (header().file_type() == Header::FILE_TYPE::REL) {
+    Section* section = section_from_offset(address);
+    if (section == nullptr) {
+      return make_error_code(lief_errors::not_found);
+    }
+    return content_region_t{section->file_offset(), section->writable_content()};
+  }
+
+  Segment* segment = segment_from_virtual_address(address);
+  if (segment == nullptr) {
+    return make_error_code(lief_errors::not_found);
+  }
+  return content_region_t{segment->virtual_address(), segment->writable_content()};
+}
+
 
 void Binary::patch_pltgot(const Symbol& symbol, uint64_t address) {
   it_pltgot_relocations pltgot_relocations = this->pltgot_relocations();
@@ -1443,7 +1548,7 @@ void Binary::patch_pltgot(const Symbol& symbol, uint64_t address) {
 void Binary::patch_pltgot(const std::string& symbol_name, uint64_t address) {
   std::for_each(std::begin(dynamic_symbols_), std::end(dynamic_symbols_),
       [&symbol_name, address, this] (const std::unique_ptr<Symbol>& s) {
-        if (s->name() == symbol_name) {
+        if (static_cast<const Symbol&>(*s).name() == symbol_name) {
           patch_pltgot(*s, address);
         }
       });
@@ -2058,6 +2163,7 @@ LIEF::Binary::functions_t Binary::dtor_functions() const {
 
 
 const Relocation* Binary::get_relocation(uint64_t address) const {
+  materialize_relocations();
   const auto it = std::find_if(std::begin(relocations_), std::end(relocations_),
                                [address] (const std::unique_ptr<Relocation>& r) {
                                  return r->address() == address;
@@ -2072,6 +2178,7 @@ const Relocation* Binary::get_relocation(uint64_t address) const {
 }
 
 const Relocation* Binary::get_relocation(const Symbol& symbol) const {
+  materialize_relocations();
   const auto it = std::find_if(std::begin(relocations_), std::end(relocations_),
                                [&symbol] (const std::unique_ptr<Relocation>& r) {
                                  return r->has_symbol() && r->symbol() == &symbol;
@@ -2706,7 +2813,7 @@ uint64_t Binary::relocate_phdr_table_v3() {
 
   DataHandler::Node new_node{phdr_reloc_info_.new_offset, new_segtbl_sz,
                              DataHandler::Node::SEGMENT};
-  datahandler_->add(std::move(new_node));
+  phdr_load_segment->node_ = &datahandler_->add(new_node);
 
 
   const auto it_new_place = std::find_if(
@@ -2862,7 +2969,7 @@ uint64_t Binary::relocate_phdr_table_v2() {
   DataHandler::Node new_node{phdr_reloc_info_.new_offset, new_phdr_size,
                              DataHandler::Node::SEGMENT};
 
-  datahandler_->add(new_node);
+  nsegment_addr->node_ = &datahandler_->add(new_node);
 
   const auto it_new_segment_place = std::find_if(segments_.rbegin(), segments_.rend(),
       [nsegment_addr] (const std::unique_ptr<Segment>& s) {
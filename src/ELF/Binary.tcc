@@ -401,7 +401,7 @@ Segment* Binary::add_segment<Header::FILE_TYPE::EXEC>(const Segment& segment, ui
 
   DataHandler::Node new_node{new_segment->file_offset(), new_segment->physical_size(),
                              DataHandler::Node::SEGMENT};
-  datahandler_->add(new_node);
+  new_segment->node_ = &datahandler_->add(new_node);
   auto alloc = datahandler_->make_hole(last_offset_aligned, new_segment->physical_size());
   if (!alloc) {
     LIEF_ERR("Allocation failed");
@@ -444,7 +444,7 @@ Segment* Binary::add_segment<Header::FILE_TYPE::DYN>(const Segment& segment, uin
 
   DataHandler::Node new_node{new_segment->file_offset(), new_segment->physical_size(),
                              DataHandler::Node::SEGMENT};
-  datahandler_->add(new_node);
+  new_segment->node_ = &datahandler_->add(new_node);
 
   const uint64_t last_offset_sections = last_offset_section();
   const uint64_t last_offset_segments = last_offset_segment();
@@ -537,12 +537,6 @@ Segment* Binary::extend_segment<Segment::TYPE::LOAD>(const Segment& segment, uin
   segment_to_extend->physical_size(segment_to_extend->physical_size() + size);
   segment_to_extend->virtual_size(segment_to_extend->virtual_size() + size);
 
-  span<const uint8_t> content_ref = segment_to_extend->content();
-  std::vector<uint8_t> segment_content{content_ref.data(), std::end(content_ref)};
-
-  segment_content.resize(segment_to_extend->physical_size(), 0);
-  segment_to_extend->content(segment_content);
-
   // Patches
   header().section_headers_offset(header().section_headers_offset() + shift);
 
@@ -604,7 +598,7 @@ Section* Binary::add_section<true>(const Section& section) {
 
   DataHandler::Node new_node{new_section->file_offset(), new_section->size(),
                              DataHandler::Node::SECTION};
-  datahandler_->add(new_node);
+  new_section->node_ = &datahandler_->add(new_node);
 
   new_section->virtual_address(segment_added->virtual_address());
   new_section->size(segment_added->physical_size());
@@ -630,7 +624,7 @@ Section* Binary::add_section<false>(const Section& section) {
 
   DataHandler::Node new_node{new_section->file_offset(), new_section->size(),
                              DataHandler::Node::SECTION};
-  datahandler_->add(new_node);
+  new_section->node_ = &datahandler_->add(new_node);
 
   const uint64_t last_offset_sections = last_offset_section();
   const uint64_t last_offset_segments = last_offset_segment();
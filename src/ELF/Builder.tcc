@@ -48,6 +48,8 @@
 #include "LIEF/errors.hpp"
 
 #include "ELF/Structures.hpp"
+#include "ELF/CompactRelocations.hpp"
+#include "ELF/DataHandler/Handler.hpp"
 #include "ELF/SizingInfo.hpp"
 #include "Object.tcc"
 #include "ExeLayout.hpp"
@@ -62,6 +64,11 @@ ok_error_t Builder::build() {
   const char* type = ((binary_->type_ == Header::CLASS::ELF32) ? "ELF32" : "ELF64");
   LIEF_DEBUG("== Re-building {} ==", type);
 
+  if (binary_->datahandler_ != nullptr) {
+    // Apply the holes recorded by the modifications once for all
+    binary_->datahandler_->materialize();
+  }
+
   const Header::FILE_TYPE file_type = binary_->header().file_type();
   switch (file_type) {
     case Header::FILE_TYPE::DYN:
@@ -151,6 +158,7 @@ ok_error_t Builder::build_exe_lib() {
   }
 
   if (binary_->has(DynamicEntry::TAG::GNU_HASH) && config_.gnu_hash) {
+    layout->gnu_hash_bloom(config_.gnu_hash_maskwords, config_.gnu_hash_shift2);
     const size_t needed_size = layout->symbol_gnu_hash_size<ELF_T>();
     const uint64_t osize = binary_->sizing_info_->gnu_hash;
     const bool should_relocate = needed_size > osize || config_.force_relocate;
@@ -685,7 +693,7 @@ ok_error_t Builder::build_sections() {
     string_names_section->content(layout_->raw_shstr());
   }
 
-  const std::unordered_map<std::string, size_t>& shstr_map = layout_->shstr_map();
+  const StringTableBuilder::offsets_t& shstr_map = layout_->shstr_map();
   for (size_t i = 0; i < binary_->sections_.size(); ++i) {
     const std::unique_ptr<Section>& section = binary_->sections_[i];
     LIEF_DEBUG("[FRAME  ] {}", section->is_frame());
@@ -843,7 +851,7 @@ ok_error_t Builder::build_symtab_symbols() {
   content.reserve(layout->static_sym_size<ELF_T>());
 
   // On recent compilers, the symtab string table is merged with the section name table
-  const std::unordered_map<std::string, size_t>* str_map = nullptr;
+  const StringTableBuilder::offsets_t* str_map = nullptr;
   if (layout->is_strtab_shared_shstrtab()) {
     str_map = &layout->shstr_map();
   } else {
@@ -851,7 +859,7 @@ ok_error_t Builder::build_symtab_symbols() {
   }
 
   for (const std::unique_ptr<Symbol>& symbol : binary_->symtab_symbols_) {
-    const std::string& name = symbol->name();
+    const std::string& name = static_cast<const Symbol&>(*symbol).name();
 
     Elf_Off offset_name = 0;
     const auto it = str_map->find(name);
@@ -1078,9 +1086,7 @@ ok_error_t Builder::build_symbol_hash() {
   uint32_t* chain  = &new_hash_table_ptr[2 + nbucket];
   uint32_t idx = 0;
   for (const std::unique_ptr<Symbol>& symbol : binary_->dynamic_symbols_) {
-    uint32_t hash = binary_->type_ == Header::CLASS::ELF32 ?
-                    hash32(symbol->name().c_str()) :
-                    hash64(symbol->name().c_str());
+    const uint32_t hash = static_cast<const Symbol&>(*symbol).sysv_hash(binary_->type_);
 
     const size_t bucket_idx = hash % nbucket;
     if (bucket_idx >= buckets_limits) {
@@ -1147,7 +1153,7 @@ ok_error_t Builder::build_obj_symbols() {
 
   using Elf_Sym  = typename ELF_T::Elf_Sym;
   const auto* layout = static_cast<const ObjectFileLayout*>(layout_.get());
-  const std::unordered_map<std::string, size_t>* str_map = nullptr;
+  const StringTableBuilder::offsets_t* str_map = nullptr;
 
   if (layout->is_strtab_shared_shstrtab()) {
     str_map = &layout->shstr_map();
@@ -1165,7 +1171,7 @@ ok_error_t Builder::build_obj_symbols() {
   // Build symbols
   vector_iostream symbol_table_raw(should_swap());
   for (const std::unique_ptr<Symbol>& symbol : binary_->symtab_symbols_) {
-    const std::string& name = symbol->name();
+    const std::string& name = static_cast<const Symbol&>(*symbol).name();
     const auto offset_it = str_map->find(name);
     if (offset_it == std::end(*str_map)) {
       LIEF_ERR("Unable to find the symbol offset for '{}' in the string table", name);
@@ -1217,7 +1223,7 @@ ok_error_t Builder::build_dynamic_symbols() {
   // Build symbols
   vector_iostream symbol_table_raw(should_swap());
   for (const std::unique_ptr<Symbol>& symbol : binary_->dynamic_symbols_) {
-    const std::string& name = symbol->name();
+    const std::string& name = static_cast<const Symbol&>(*symbol).name();
     const auto& offset_it = dynstr_map.find(name);
     if (offset_it == std::end(dynstr_map)) {
       LIEF_ERR("Unable to find the symbol offset for '{}' in the string table", name);
@@ -1407,8 +1413,19 @@ ok_error_t Builder::build_dynamic_relocations() {
   using Elf_Rela   = typename ELF_T::Elf_Rela;
   using Elf_Rel    = typename ELF_T::Elf_Rel;
 
-  Binary::it_dynamic_relocations dynamic_relocations = binary_->dynamic_relocations();
-  if (dynamic_relocations.empty()) {
+  // Relocations are accessed through the raw container to avoid
+  // materializing the RELR/Android packed relocations which are not
+  // involved in DT_REL/DT_RELA
+  auto is_dynamic = [] (const std::unique_ptr<Relocation>& R) {
+    return R->purpose() == Relocation::PURPOSE::DYNAMIC;
+  };
+
+  const bool has_dynamic_relocations =
+    !binary_->compact_relocations_->empty() ||
+    std::any_of(binary_->relocations_.begin(), binary_->relocations_.end(),
+                is_dynamic);
+
+  if (!has_dynamic_relocations) {
     if (auto* DT = binary_->get(DynamicEntry::TAG::REL)) {
       if (auto* sec = binary_->section_from_virtual_address(DT->value())) {
         sec->size(0);
@@ -1455,10 +1472,11 @@ ok_error_t Builder::build_dynamic_relocations() {
 
 
   vector_iostream content(should_swap());
-  for (Relocation& relocation : binary_->dynamic_relocations()) {
-    if (!relocation.is_rel() && !relocation.is_rela()) {
+  for (std::unique_ptr<Relocation>& R : binary_->relocations_) {
+    if (!is_dynamic(R) || (!R->is_rel() && !R->is_rela())) {
       continue;
     }
+    Relocation& relocation = *R;
 
     // look for symbol index
     uint32_t idx = 0;
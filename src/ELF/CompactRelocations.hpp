@@ -0,0 +1,143 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_ELF_COMPACT_RELOCATIONS_H
+#define LIEF_ELF_COMPACT_RELOCATIONS_H
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "LIEF/span.hpp"
+#include "LIEF/ELF/Relocation.hpp"
+
+#if defined(_MSC_VER)
+#  include <intrin.h>
+#endif
+
+namespace LIEF {
+namespace ELF {
+
+/// Columnar storage for the relocations decoded from `DT_RELR` and from the
+/// Android packed format (`APS2`).
+///
+/// Android and ChromeOS libraries can contain hundreds of thousands of such
+/// relocations. Instead of creating a Relocation object for each of them,
+/// the parser only records their raw values in these columns. They are
+/// converted into Relocation objects the first time the relocations are
+/// accessed through the Binary's API (c.f. `Binary::materialize_relocations()`)
+/// while the ExeLayout can re-encode them directly from the columns.
+///
+/// The columns are only written by the parser and emptied (under #lock) by
+/// the materialization.
+struct compact_relocations_t {
+  /// Relocations decoded from `DT_RELR` (or `DT_ANDROID_RELR`)
+  struct relr_t {
+    /// Type of the relative relocation for the current architecture
+    Relocation::TYPE type = Relocation::TYPE::UNKNOWN;
+
+    /// Address of the relocations (sorted in increasing order as long as
+    /// the original table is well-formed)
+    std::vector<uint64_t> offsets;
+
+    /// Index in Binary::relocations_ at which these relocations must be
+    /// inserted when materialized
+    size_t position = 0;
+  };
+
+  /// Relocations decoded from `DT_ANDROID_REL[A]`.
+  ///
+  /// All the relocations of the table are stored (and not only the relative
+  /// ones) so that the original order is preserved on materialization.
+  struct android_t {
+    std::vector<uint64_t> offsets;
+    std::vector<uint64_t> infos; ///< Raw `r_info` values
+    std::vector<int64_t> addends;
+    size_t position = 0;
+
+    void reserve(size_t size) {
+      offsets.reserve(size);
+      infos.reserve(size);
+      addends.reserve(size);
+    }
+
+    void push_back(uint64_t offset, uint64_t info, int64_t addend) {
+      offsets.push_back(offset);
+      infos.push_back(info);
+      addends.push_back(addend);
+    }
+
+    size_t size() const {
+      return offsets.size();
+    }
+  };
+
+  size_t size() const {
+    return relr.offsets.size() + android.size();
+  }
+
+  bool empty() const {
+    return size() == 0;
+  }
+
+  void clear() {
+    relr = relr_t{};
+    android = android_t{};
+  }
+
+  relr_t relr;
+  android_t android;
+
+  /// Serialize the materialization which can be triggered concurrently by
+  /// the const accessors of the Binary
+  std::mutex lock;
+};
+
+/// Index of the least significant bit set in `value` (which must not be 0)
+inline uint32_t lsb_index(uint64_t value) {
+#if defined(_MSC_VER)
+  unsigned long idx = 0;
+  _BitScanForward64(&idx, value);
+  return static_cast<uint32_t>(idx);
+#else
+  return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+}
+
+/// Expand the `DT_RELR` entries into the list of the relocated addresses.
+///
+/// Bitmap entries are expanded with a bit-scan over the set bits instead
+/// of testing each bit of the word.
+template<class Elf_Relr>
+inline void decode_relr(span<const Elf_Relr> entries, std::vector<uint64_t>& offsets) {
+  static constexpr Elf_Relr WORDSIZE = sizeof(Elf_Relr);
+  static constexpr Elf_Relr NB_BITS  = 8 * sizeof(Elf_Relr) - 1;
+
+  Elf_Relr base = 0;
+  for (const Elf_Relr entry : entries) {
+    if ((entry & 1) == 0) {
+      offsets.push_back(entry);
+      base = entry + WORDSIZE;
+      continue;
+    }
+    for (uint64_t bitmap = entry >> 1; bitmap != 0; bitmap &= bitmap - 1) {
+      offsets.push_back(static_cast<Elf_Relr>(base + lsb_index(bitmap) * WORDSIZE));
+    }
+    base += NB_BITS * WORDSIZE;
+  }
+}
+
+}
+}
+#endif
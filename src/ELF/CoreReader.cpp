@@ -0,0 +1,310 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstring>
+
+#include "logging.hpp"
+
+#include "LIEF/BinaryStream/FileStream.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
+
+#include "LIEF/ELF/CoreReader.hpp"
+#include "LIEF/ELF/Parser.hpp"
+#include "LIEF/ELF/Segment.hpp"
+#include "LIEF/ELF/Note.hpp"
+#include "LIEF/ELF/utils.hpp"
+#include "LIEF/ELF/NoteDetails/core/CorePrStatus.hpp"
+#include "LIEF/ELF/NoteDetails/core/CorePrPsInfo.hpp"
+#include "LIEF/ELF/NoteDetails/core/CoreFile.hpp"
+#include "LIEF/ELF/NoteDetails/core/CoreAuxv.hpp"
+#include "LIEF/ELF/NoteDetails/core/CoreSigInfo.hpp"
+
+#include "ELF/Structures.hpp"
+
+namespace LIEF {
+namespace ELF {
+
+static bool should_swap(Header::ELF_DATA data) {
+  switch (data) {
+#ifdef __BYTE_ORDER__
+#if  defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    case Header::ELF_DATA::MSB:
+#elif defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    case Header::ELF_DATA::LSB:
+#endif
+      return true;
+#endif // __BYTE_ORDER__
+    default:
+      return false;
+  }
+}
+
+CoreReader::CoreReader(std::unique_ptr<BinaryStream> stream) :
+  stream_(std::move(stream))
+{}
+
+CoreReader::~CoreReader() = default;
+
+std::unique_ptr<CoreReader> CoreReader::parse(const std::string& file) {
+  auto stream = FileStream::from_file(file);
+  if (!stream) {
+    LIEF_ERR("Can't open '{}'", file);
+    return nullptr;
+  }
+  return parse(std::make_unique<FileStream>(std::move(*stream)));
+}
+
+std::unique_ptr<CoreReader> CoreReader::parse(std::unique_ptr<BinaryStream> stream) {
+  if (stream == nullptr || !is_elf(*stream)) {
+    return nullptr;
+  }
+
+  auto ident = stream->peek<Header::identity_t>(0);
+  if (!ident) {
+    LIEF_ERR("Can't read ELF identity");
+    return nullptr;
+  }
+
+  const auto ei_data  = static_cast<Header::ELF_DATA>((*ident)[Header::ELI_DATA]);
+  const auto ei_class = static_cast<Header::CLASS>((*ident)[Header::ELI_CLASS]);
+  stream->set_endian_swap(should_swap(ei_data));
+
+  std::unique_ptr<CoreReader> reader(new CoreReader(std::move(stream)));
+  ok_error_t is_ok = ok();
+  switch (ei_class) {
+    case Header::CLASS::ELF32:
+      is_ok = reader->parse_headers<details::ELF32>(); break;
+    case Header::CLASS::ELF64:
+      is_ok = reader->parse_headers<details::ELF64>(); break;
+    case Header::CLASS::NONE:
+    default:
+      {
+        LIEF_ERR("Can't determine the ELF class ({})", static_cast<size_t>(ei_class));
+        return nullptr;
+      }
+  }
+
+  if (!is_ok) {
+    return nullptr;
+  }
+
+  if (reader->header_.file_type() != Header::FILE_TYPE::CORE) {
+    LIEF_WARN("The ELF file is not a core file ({})",
+              to_string(reader->header_.file_type()));
+  }
+  return reader;
+}
+
+template<class ELF_T>
+ok_error_t CoreReader::parse_headers() {
+  using Elf_Ehdr = typename ELF_T::Elf_Ehdr;
+  using Elf_Phdr = typename ELF_T::Elf_Phdr;
+
+  auto ehdr = stream_->peek<Elf_Ehdr>(0);
+  if (!ehdr) {
+    LIEF_ERR("Can't read the ELF header");
+    return make_error_code(lief_errors::read_error);
+  }
+  header_ = Header(*ehdr);
+
+  const uint64_t phoff = header_.program_headers_offset();
+  const uint32_t nb_segments = std::min<uint32_t>(header_.numberof_segments(),
+                                                  Parser::NB_MAX_SEGMENTS);
+  const ARCH arch = header_.machine_type();
+  const Header::OS_ABI os = header_.identity_os_abi();
+
+  stream_->setpos(phoff);
+  segments_.reserve(nb_segments);
+  for (size_t i = 0; i < nb_segments; ++i) {
+    auto phdr = stream_->read<Elf_Phdr>();
+    if (!phdr) {
+      LIEF_ERR("Can't read segment #{:d}", i);
+      break;
+    }
+    segments_.push_back(std::unique_ptr<Segment>(new Segment(*phdr, arch, os)));
+  }
+
+  for (const std::unique_ptr<Segment>& segment : segments_) {
+    if (segment->type() == Segment::TYPE::NOTE) {
+      parse_notes(*segment);
+      continue;
+    }
+
+    if (segment->type() == Segment::TYPE::LOAD && segment->virtual_size() > 0) {
+      memory_index_.push_back({
+        segment->virtual_address(),
+        segment->virtual_address() + segment->virtual_size(),
+        segment.get()
+      });
+    }
+  }
+
+  std::sort(memory_index_.begin(), memory_index_.end(),
+            [] (const memory_range_t& lhs, const memory_range_t& rhs) {
+              return lhs.start < rhs.start;
+            });
+  return ok();
+}
+
+ok_error_t CoreReader::parse_notes(const Segment& segment) {
+  static constexpr auto ERROR_THRESHOLD = 6;
+
+  // Notes are small compared to the memory image: read the whole segment
+  // at once instead of issuing small reads on the underlying stream.
+  std::vector<uint8_t> content;
+  if (!stream_->peek_data(content, segment.file_offset(), segment.physical_size())) {
+    LIEF_ERR("Can't read the PT_NOTE segment at offset 0x{:x}", segment.file_offset());
+    return make_error_code(lief_errors::read_error);
+  }
+
+  SpanStream stream(content);
+  stream.set_endian_swap(stream_->should_swap());
+
+  size_t error_count = 0;
+  while (stream && stream.pos() < stream.size()) {
+    const uint64_t current_pos = stream.pos();
+    std::unique_ptr<Note> note = Note::create(stream, /*section_name=*/"",
+        header_.file_type(), header_.machine_type(), header_.identity_class());
+
+    if (note != nullptr) {
+      notes_.push_back(std::move(note));
+    } else {
+      LIEF_WARN("Note not parsed!");
+      ++error_count;
+    }
+
+    if (error_count > ERROR_THRESHOLD) {
+      LIEF_ERR("Too many errors while trying to parse notes");
+      return make_error_code(lief_errors::corrupted);
+    }
+
+    if (stream.pos() <= current_pos) {
+      return make_error_code(lief_errors::corrupted);
+    }
+  }
+  return ok();
+}
+
+template<class T>
+const T* CoreReader::find_note() const {
+  const auto it = std::find_if(notes_.begin(), notes_.end(),
+    [] (const std::unique_ptr<Note>& note) {
+      return T::classof(note.get());
+    }
+  );
+  return it != notes_.end() ? static_cast<const T*>(it->get()) : nullptr;
+}
+
+std::vector<const CorePrStatus*> CoreReader::threads() const {
+  std::vector<const CorePrStatus*> threads;
+  for (const std::unique_ptr<Note>& note : notes_) {
+    if (CorePrStatus::classof(note.get())) {
+      threads.push_back(static_cast<const CorePrStatus*>(note.get()));
+    }
+  }
+  return threads;
+}
+
+const CorePrPsInfo* CoreReader::process_info() const {
+  return find_note<CorePrPsInfo>();
+}
+
+const CoreFile* CoreReader::mapped_files() const {
+  return find_note<CoreFile>();
+}
+
+const CoreAuxv* CoreReader::auxv() const {
+  return find_note<CoreAuxv>();
+}
+
+const CoreSigInfo* CoreReader::siginfo() const {
+  return find_note<CoreSigInfo>();
+}
+
+const CoreReader::memory_range_t* CoreReader::find_range(uint64_t va) const {
+  const auto it = std::upper_bound(memory_index_.begin(), memory_index_.end(), va,
+    [] (uint64_t addr, const memory_range_t& range) {
+      return addr < range.start;
+    }
+  );
+  if (it == memory_index_.begin()) {
+    return nullptr;
+  }
+  const memory_range_t& range = *std::prev(it);
+  return va < range.end ? &range : nullptr;
+}
+
+const Segment* CoreReader::segment_from_virtual_address(uint64_t va) const {
+  const memory_range_t* range = find_range(va);
+  return range != nullptr ? range->segment : nullptr;
+}
+
+uint64_t CoreReader::memory_size() const {
+  uint64_t size = 0;
+  for (const memory_range_t& range : memory_index_) {
+    size += range.end - range.start;
+  }
+  return size;
+}
+
+ok_error_t CoreReader::read_memory(uint64_t va, span<uint8_t> buffer) const {
+  uint64_t addr = va;
+  size_t pos = 0;
+  while (pos < buffer.size()) {
+    const memory_range_t* range = find_range(addr);
+    if (range == nullptr) {
+      LIEF_DEBUG("Address 0x{:x} is not mapped in the core", addr);
+      return make_error_code(lief_errors::not_found);
+    }
+
+    const Segment& segment = *range->segment;
+    const uint64_t delta = addr - range->start;
+    const uint64_t count = std::min<uint64_t>(range->end - addr, buffer.size() - pos);
+
+    // Part of the range that is backed by the file
+    const uint64_t file_size = segment.physical_size();
+    const uint64_t in_file = delta < file_size ?
+                             std::min<uint64_t>(count, file_size - delta) : 0;
+    if (in_file > 0) {
+      auto is_ok = stream_->peek_in(buffer.data() + pos,
+                                    segment.file_offset() + delta, in_file);
+      if (!is_ok) {
+        LIEF_ERR("Can't read 0x{:x} bytes at offset 0x{:x}", in_file,
+                 segment.file_offset() + delta);
+        return make_error_code(lief_errors::read_error);
+      }
+    }
+    std::memset(buffer.data() + pos + in_file, 0, count - in_file);
+
+    pos  += count;
+    addr += count;
+  }
+  return ok();
+}
+
+result<std::vector<uint8_t>> CoreReader::read_memory(uint64_t va, uint64_t size) const {
+  if (size > memory_size()) {
+    return make_error_code(lief_errors::read_out_of_bound);
+  }
+  std::vector<uint8_t> content(size);
+  if (auto is_ok = read_memory(va, content); !is_ok) {
+    return make_error_code(is_ok.error());
+  }
+  return content;
+}
+
+}
+}
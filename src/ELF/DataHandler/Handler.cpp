@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <algorithm>
+#include <cstring>
 #include <utility>
 
 #include "logging.hpp"
@@ -29,29 +30,33 @@ namespace LIEF {
 namespace ELF {
 namespace DataHandler {
 
+// Below this size, the data after a hole are moved right away instead of
+// recording a pending hole
+static constexpr size_t EAGER_MOVE_SIZE = 0x10000;
+
 class DataHandlerStream : public BinaryStream {
   public:
-  DataHandlerStream(std::vector<uint8_t>& ref) :
+  DataHandlerStream(Handler& handler) :
     BinaryStream(STREAM_TYPE::ELF_DATA_HANDLER),
-    data_{ref}
+    handler_{handler}
   {
   }
 
   ~DataHandlerStream() override = default;
 
   uint64_t size() const override {
-    return data_.size();
+    return handler_.size();
   }
 
   result<const void*> read_at(uint64_t offset, uint64_t size, uint64_t /*va*/) const override {
-    if (offset > data_.size() || (offset + size) > data_.size()) {
+    if (offset > handler_.size() || size > handler_.size() - offset) {
       return make_error_code(lief_errors::read_error);
     }
-    return data_.data() + offset;
+    return handler_.view(offset, size).data();
   }
 
   private:
-  std::vector<uint8_t>& data_;
+  const Handler& handler_;
 };
 
 result<std::unique_ptr<Handler>> Handler::from_stream(std::unique_ptr<BinaryStream>& stream) {
@@ -61,7 +66,7 @@ result<std::unique_ptr<Handler>> Handler::from_stream(std::unique_ptr<BinaryStre
 
     hdl->data_ = std::move(vs.move_content());
     const uint64_t pos = vs.pos();
-    stream = std::make_unique<DataHandlerStream>(hdl->data_);
+    stream = std::make_unique<DataHandlerStream>(*hdl);
     stream->setpos(pos);
     return hdl;
   }
@@ -76,7 +81,7 @@ result<std::unique_ptr<Handler>> Handler::from_stream(std::unique_ptr<BinaryStre
     auto& vs = static_cast<FileStream&>(*stream);
     hdl->data_ = vs.content();
     const uint64_t pos = vs.pos();
-    stream = std::make_unique<DataHandlerStream>(hdl->data_);
+    stream = std::make_unique<DataHandlerStream>(*hdl);
     stream->setpos(pos);
     return hdl;
   }
@@ -90,66 +95,257 @@ result<std::unique_ptr<Handler>> Handler::from_stream(std::unique_ptr<BinaryStre
 }
 
 bool Handler::has(uint64_t offset, uint64_t size, Node::Type type) {
-  Node tmp{offset, size, type};
-  const auto it_node = std::find_if(std::begin(nodes_), std::end(nodes_),
-                                    [&tmp] (const std::unique_ptr<Node>& node) {
-                                      return tmp == *node;
-                                    });
-  return it_node != std::end(nodes_);
+  return nodes_.find(node_cmp_t::key_t{type, offset, size}) != nodes_.end();
 }
 
 result<Handler::ref_t<Node>> Handler::get(uint64_t offset, uint64_t size, Node::Type type) {
-  Node tmp{offset, size, type};
-
-  const auto it_node = std::find_if(std::begin(nodes_), std::end(nodes_),
-                                    [&tmp] (const std::unique_ptr<Node>& node) {
-                                      return tmp == *node;
-                                    });
-
-  if (it_node == std::end(nodes_)) {
+  auto it_node = nodes_.find(node_cmp_t::key_t{type, offset, size});
+  if (it_node == nodes_.end()) {
     return make_error_code(lief_errors::not_found);
   }
   return **it_node;
 }
 
+Handler::nodes_t::iterator Handler::find(const Node& node) {
+  auto [it, end] = nodes_.equal_range(node_cmp_t::key(node));
+  for (; it != end; ++it) {
+    if (it->get() == &node) {
+      return it;
+    }
+  }
+  return nodes_.end();
+}
 
 void Handler::remove(uint64_t offset, uint64_t size, Node::Type type) {
+  auto it_node = nodes_.find(node_cmp_t::key_t{type, offset, size});
+  if (it_node == nodes_.end()) {
+    LIEF_ERR("Unable to find the node");
+    return;
+  }
+  nodes_.erase(it_node);
+}
 
-  Node tmp{offset, size, type};
-
-  const auto it_node = std::find_if(std::begin(nodes_), std::end(nodes_),
-                                    [&tmp] (const std::unique_ptr<Node>& node) {
-                                      return tmp == *node;
-                                    });
+void Handler::remove(const Node& node) {
+  auto it_node = find(node);
+  if (it_node == nodes_.end()) {
+    LIEF_ERR("Unable to find the node");
+    return;
+  }
+  nodes_.erase(it_node);
+}
 
-  if (it_node == std::end(nodes_)) {
+void Handler::update(Node& node, uint64_t offset, uint64_t size) {
+  auto it_node = find(node);
+  if (it_node == nodes_.end()) {
     LIEF_ERR("Unable to find the node");
+    return;
   }
 
-   nodes_.erase(it_node);
+  // The key of the node changes: re-insert it (without reallocating it)
+  // such as the registry remains ordered
+  auto handle = nodes_.extract(it_node);
+  handle.value()->offset(offset);
+  handle.value()->size(size);
+  nodes_.insert(std::move(handle));
 }
 
-
 Node& Handler::create(uint64_t offset, uint64_t size, Node::Type type) {
-  nodes_.push_back(std::make_unique<Node>(offset, size, type));
-  return *nodes_.back();
+  return **nodes_.insert(std::make_unique<Node>(offset, size, type));
 }
 
-
 Node& Handler::add(const Node& node) {
-  nodes_.push_back(std::make_unique<Node>(node));
-  return *nodes_.back();
+  return **nodes_.insert(std::make_unique<Node>(node));
 }
 
 ok_error_t Handler::make_hole(uint64_t offset, uint64_t size) {
+  // reserve() drops the flattened copy of the image (if any)
   auto res = reserve(offset, size);
   if (!res) {
     return res;
   }
-  data_.insert(std::begin(data_) + offset, size, 0);
+
+  if (size == 0) {
+    return ok();
+  }
+
+  // Fast path: nothing is pending and only a few bytes need to be moved
+  // (e.g. a hole at the end of the file)
+  if (holes_.empty() && data_.size() - offset <= EAGER_MOVE_SIZE) {
+    data_.insert(std::begin(data_) + offset, size, 0);
+    return ok();
+  }
+
+  // Translate the offset into `data_`'s coordinates. If the new hole touches
+  // a pending one, the zeros are inserted in the pending hole.
+  uint64_t delta = 0;
+  auto it = holes_.begin();
+  for (; it != holes_.end(); ++it) {
+    const uint64_t start = it->offset + delta;
+    if (offset < start) {
+      break;
+    }
+    if (offset <= start + it->data.size()) {
+      it->data.insert(it->data.begin() + (offset - start), size, 0);
+      pending_size_ += size;
+      return ok();
+    }
+    delta += it->data.size();
+  }
+
+  holes_.insert(it, hole_t{offset - delta, std::vector<uint8_t>(size, 0)});
+  pending_size_ += size;
   return ok();
 }
 
+ok_error_t Handler::write(uint64_t offset, span<const uint8_t> content) {
+  if (content.empty()) {
+    return ok();
+  }
+
+  if (!flat_.empty()) {
+    materialize();
+  }
+
+  if (offset + content.size() > size()) {
+    auto res = reserve(offset, content.size());
+    if (!res) {
+      return res;
+    }
+  }
+
+  // Split the write between `data_` and the buffers of the pending holes
+  // such as the holes are not applied.
+  const uint8_t* src = content.data();
+  uint64_t pos = offset;
+  const uint64_t end = offset + content.size();
+  uint64_t delta = 0;
+  for (hole_t& hole : holes_) {
+    const uint64_t start = hole.offset + delta;
+    const uint64_t hole_end = start + hole.data.size();
+    if (pos < start) {
+      const uint64_t len = std::min(start, end) - pos;
+      std::memcpy(data_.data() + (pos - delta), src, len);
+      src += len;
+      pos += len;
+    }
+    if (pos < hole_end && pos < end) {
+      const uint64_t len = std::min(hole_end, end) - pos;
+      std::memcpy(hole.data.data() + (pos - start), src, len);
+      src += len;
+      pos += len;
+    }
+    if (pos == end) {
+      return ok();
+    }
+    delta += hole.data.size();
+  }
+  std::memcpy(data_.data() + (pos - delta), src, end - pos);
+  return ok();
+}
+
+void Handler::materialize() {
+  if (holes_.empty()) {
+    return;
+  }
+
+  LIEF_DEBUG("Apply {} pending hole(s) (0x{:x} bytes)", holes_.size(), pending_size_);
+
+  if (!flat_.empty()) {
+    // A const accessor already flattened the image: adopt the copy. The
+    // views on the copy remain valid as the buffer is not reallocated.
+    data_.swap(flat_);
+    std::vector<uint8_t>().swap(flat_);
+    holes_.clear();
+    pending_size_ = 0;
+    return;
+  }
+
+  uint64_t src_end = data_.size();
+  uint64_t dst_end = data_.size() + pending_size_;
+  data_.resize(dst_end, 0);
+
+  // Move the chunks from the last one such as each byte is moved once
+  for (auto it = holes_.rbegin(); it != holes_.rend(); ++it) {
+    const uint64_t chunk_size = src_end - it->offset;
+    dst_end -= chunk_size;
+    std::memmove(data_.data() + dst_end, data_.data() + it->offset, chunk_size);
+
+    dst_end -= it->data.size();
+    std::memcpy(data_.data() + dst_end, it->data.data(), it->data.size());
+    src_end = it->offset;
+  }
+
+  holes_.clear();
+  pending_size_ = 0;
+}
+
+span<const uint8_t> Handler::view(uint64_t offset, uint64_t size) const {
+  if (offset > this->size() || size > this->size() - offset) {
+    return {};
+  }
+
+  const uint64_t end = offset + size;
+  uint64_t delta = 0;
+  for (const hole_t& hole : holes_) {
+    const uint64_t start = hole.offset + delta;
+    const uint64_t hole_end = start + hole.data.size();
+    if (end <= start) {
+      break;
+    }
+    if (offset >= start && end <= hole_end) {
+      return {hole.data.data() + (offset - start), static_cast<size_t>(size)};
+    }
+    if (offset < hole_end) {
+      // The range is split between `data_` and the hole
+      return flattened().subspan(offset, size);
+    }
+    delta += hole.data.size();
+  }
+  return {data_.data() + (offset - delta), static_cast<size_t>(size)};
+}
+
+ok_error_t Handler::read(uint64_t offset, span<uint8_t> out) const {
+  if (offset > size() || out.size() > size() - offset) {
+    return make_error_code(lief_errors::read_out_of_bound);
+  }
+
+  uint8_t* dst = out.data();
+  uint64_t pos = offset;
+  const uint64_t end = offset + out.size();
+  uint64_t delta = 0;
+  for (const hole_t& hole : holes_) {
+    const uint64_t start = hole.offset + delta;
+    const uint64_t hole_end = start + hole.data.size();
+    if (pos < start) {
+      const uint64_t len = std::min(start, end) - pos;
+      std::memcpy(dst, data_.data() + (pos - delta), len);
+      dst += len;
+      pos += len;
+    }
+    if (pos < hole_end && pos < end) {
+      const uint64_t len = std::min(hole_end, end) - pos;
+      std::memcpy(dst, hole.data.data() + (pos - start), len);
+      dst += len;
+      pos += len;
+    }
+    if (pos == end) {
+      return ok();
+    }
+    delta += hole.data.size();
+  }
+  std::memcpy(dst, data_.data() + (pos - delta), end - pos);
+  return ok();
+}
+
+span<const uint8_t> Handler::flattened() const {
+  std::lock_guard<std::mutex> lock(flat_lock_);
+  if (flat_.empty()) {
+    LIEF_DEBUG("Flatten the image for a read across a pending hole");
+    flat_.resize(size());
+    read(0, flat_);
+  }
+  return flat_;
+}
 
 ok_error_t Handler::reserve(uint64_t offset, uint64_t size) {
   static constexpr auto MAX_MEMORY_SIZE = 6_GB;
@@ -167,12 +363,18 @@ ok_error_t Handler::reserve(uint64_t offset, uint64_t size) {
     return make_error_code(lief_errors::corrupted);
   }
 
-  const bool must_resize = data_.size() < (offset + size);
+  if (!flat_.empty()) {
+    materialize();
+  }
+
+  const bool must_resize = this->size() < (offset + size);
   if (!must_resize) {
     return ok();
   }
 
-  data_.resize(offset + size, 0);
+  // The pending holes are located before the end of `data_` so that
+  // the image can be extended without applying them.
+  data_.resize(data_.size() + (offset + size - this->size()), 0);
   return ok();
 }
 
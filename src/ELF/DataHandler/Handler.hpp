@@ -18,10 +18,14 @@
 #include <vector>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <tuple>
 
 #include "LIEF/visibility.h"
 #include "LIEF/utils.hpp"
 #include "LIEF/errors.hpp"
+#include "LIEF/span.hpp"
 
 #include "ELF/DataHandler/Node.hpp"
 
@@ -47,17 +51,44 @@ class LIEF_API Handler {
   Handler& operator=(const Handler&) = delete;
   Handler(const Handler&) = delete;
 
-  Handler& operator=(Handler&&) noexcept = default;
-  Handler(Handler&&) noexcept = default;
-
-  const std::vector<uint8_t>& content() const {
+  /// Content of the file image. The pending holes (see make_hole()) are
+  /// applied before returning the buffer.
+  ///
+  /// There is no const overload since this function modifies the buffer:
+  /// the const accessors must use view() or read().
+  std::vector<uint8_t>& content() {
+    materialize();
     return data_;
   }
 
-  std::vector<uint8_t>& content() {
-    return data_;
+  /// Read-only view on the `size` bytes located at the given offset of the
+  /// file image. The pending holes are **not** applied: the view points in
+  /// the buffer of the image or of a hole. If the range overlaps a hole
+  /// boundary, the view points in a flattened copy of the image which is
+  /// created once and kept until the next modification.
+  ///
+  /// The views remain valid until the handler is modified and this function
+  /// can be called concurrently. It returns an empty span if the range is
+  /// out of bounds.
+  span<const uint8_t> view(uint64_t offset, uint64_t size) const;
+
+  /// Copy the bytes located at the given offset of the file image in
+  /// `out`, without applying the pending holes nor allocating memory.
+  ok_error_t read(uint64_t offset, span<uint8_t> out) const;
+
+  /// Apply the pending holes in a single pass over the file image.
+  ///
+  /// This function is called by content() and by the builder.
+  void materialize();
+
+  /// Size of the file image, including the pending holes
+  uint64_t size() const {
+    return data_.size() + pending_size_;
   }
 
+  /// Register a copy of the given node. The returned reference is stable
+  /// until the node is removed and can be kept by the owner of the node
+  /// (Section, Segment) to access its content without a lookup.
   Node& add(const Node& node);
 
   bool has(uint64_t offset, uint64_t size, Node::Type type);
@@ -68,17 +99,89 @@ class LIEF_API Handler {
 
   void remove(uint64_t offset, uint64_t size, Node::Type type);
 
+  /// Remove the given node. The reference is invalidated.
+  void remove(const Node& node);
+
+  /// Change the offset and the size of a node registered in this handler.
+  /// The nodes must be updated through this function to keep the registry
+  /// ordered.
+  void update(Node& node, uint64_t offset, uint64_t size);
+
+  /// Insert `size` zero bytes at the given offset.
+  ///
+  /// The insertion is recorded and the data located after the offset is only
+  /// moved when the content is accessed. Hence, a sequence of insertions
+  /// (e.g. extending several sections) moves the data once.
   ok_error_t make_hole(uint64_t offset, uint64_t size);
 
+  /// Write the given bytes at the given offset of the file image without
+  /// applying the pending holes: the bytes located in a hole are stored with
+  /// the hole. The image is extended if needed.
+  ok_error_t write(uint64_t offset, span<const uint8_t> content);
+
+  /// True if some holes are not yet applied on the content
+  bool has_pending_holes() const {
+    return !holes_.empty();
+  }
+
   ok_error_t reserve(uint64_t offset, uint64_t size);
 
   static result<std::unique_ptr<Handler>> from_stream(std::unique_ptr<BinaryStream>& stream);
 
   private:
+  /// Range which is inserted in the image but not yet in `data_`.
+  /// The offset is expressed in `data_`'s coordinates and `data` holds the
+  /// bytes of the hole (zeros unless they have been written with write()).
+  struct hole_t {
+    uint64_t offset = 0;
+    std::vector<uint8_t> data;
+  };
+
+  /// Order the nodes by (type, offset, size) so that the lookups are
+  /// logarithmic. Nodes with the same key are allowed.
+  struct node_cmp_t {
+    using is_transparent = void;
+    using key_t = std::tuple<Node::Type, uint64_t, uint64_t>;
+
+    static key_t key(const Node& node) {
+      return {node.type(), node.offset(), node.size()};
+    }
+
+    bool operator()(const std::unique_ptr<Node>& lhs,
+                    const std::unique_ptr<Node>& rhs) const {
+      return key(*lhs) < key(*rhs);
+    }
+
+    bool operator()(const std::unique_ptr<Node>& lhs, const key_t& rhs) const {
+      return key(*lhs) < rhs;
+    }
+
+    bool operator()(const key_t& lhs, const std::unique_ptr<Node>& rhs) const {
+      return lhs < key(*rhs);
+    }
+  };
+  using nodes_t = std::multiset<std::unique_ptr<Node>, node_cmp_t>;
+
   Handler() = default;
   Handler(BinaryStream& stream);
+
+  /// Iterator on the given node or nodes_.end() if it is not registered
+  nodes_t::iterator find(const Node& node);
+
+  /// Flattened copy of the image used by view() for the ranges which
+  /// overlap a hole boundary
+  span<const uint8_t> flattened() const;
+
   std::vector<uint8_t> data_;
-  std::vector<std::unique_ptr<Node>> nodes_;
+  std::vector<hole_t> holes_; // Sorted by offset
+  uint64_t pending_size_ = 0;
+
+  // Only accessed by the const functions through flattened() and
+  // consumed by materialize()
+  mutable std::mutex flat_lock_;
+  mutable std::vector<uint8_t> flat_;
+
+  nodes_t nodes_;
 };
 } // namespace DataHandler
 } // namespace ELF
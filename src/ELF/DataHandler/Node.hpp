@@ -21,7 +21,10 @@
 
 namespace LIEF::ELF::DataHandler {
 
+class Handler;
+
 class LIEF_LOCAL Node {
+  friend class Handler;
   public:
   enum Type : uint8_t {
     SECTION = 0,
@@ -47,18 +50,6 @@ class LIEF_LOCAL Node {
     return type_;
   }
 
-  void size(uint64_t size) {
-    size_ = size;
-  }
-
-  void type(Type type) {
-    type_ = type;
-  }
-
-  void offset(uint64_t offset) {
-    offset_ = offset;
-  }
-
   bool operator==(const Node& rhs) const;
   bool operator!=(const Node& rhs) const {
     return !(*this == rhs);
@@ -76,6 +67,16 @@ class LIEF_LOCAL Node {
   ~Node() = default;
 
   private:
+  // The offset and the size are the key of the node in the Handler's
+  // registry: they must be changed with Handler::update()
+  void size(uint64_t size) {
+    size_ = size;
+  }
+
+  void offset(uint64_t offset) {
+    offset_ = offset;
+  }
+
   uint64_t size_ = 0;
   uint64_t offset_ = 0;
   Type type_ = Type::UNKNOWN;
@@ -42,8 +42,10 @@
 #include <iterator>
 
 #include "ELF/Structures.hpp"
+#include "ELF/CompactRelocations.hpp"
 #include "internal_utils.hpp"
 #include "logging.hpp"
+#include "parallel.hpp"
 #include "Layout.hpp"
 
 namespace LIEF {
@@ -111,46 +113,42 @@ class LIEF_LOCAL ExeLayout : public Layout {
       return raw_dynstr_.size();
     }
 
-    // Start with dynamic entries: NEEDED / SONAME etc
-    vector_iostream raw_dynstr;
-    raw_dynstr.write<uint8_t>(0);
+    StringTableBuilder opt_list;
+    opt_list.reserve(binary_->dynamic_symbols_.size());
 
-    std::vector<std::string> opt_list;
-
-    std::transform(binary_->dynamic_symbols_.begin(),
-                   binary_->dynamic_symbols_.end(),
-                   std::back_inserter(opt_list),
-                   [] (const std::unique_ptr<Symbol>& sym) {
-                     return sym->name();
-                   });
+    for (const std::unique_ptr<Symbol>& sym : binary_->dynamic_symbols_) {
+      const Symbol& csym = *sym;
+      opt_list.add(csym.name());
+    }
 
+    // Dynamic entries: NEEDED / SONAME etc
     for (std::unique_ptr<DynamicEntry>& entry : binary_->dynamic_entries_) {
       switch (entry->tag()) {
       case DynamicEntry::TAG::NEEDED:
         {
           const std::string& name = entry->as<DynamicEntryLibrary>()->name();
-          opt_list.push_back(name);
+          opt_list.add(name);
           break;
         }
 
       case DynamicEntry::TAG::SONAME:
         {
           const std::string& name = entry->as<DynamicSharedObject>()->name();
-          opt_list.push_back(name);
+          opt_list.add(name);
           break;
         }
 
       case DynamicEntry::TAG::RPATH:
         {
           const std::string& name = entry->as<DynamicEntryRpath>()->rpath();
-          opt_list.push_back(name);
+          opt_list.add(name);
           break;
         }
 
       case DynamicEntry::TAG::RUNPATH:
         {
           const std::string& name = entry->as<DynamicEntryRunPath>()->runpath();
-          opt_list.push_back(name);
+          opt_list.add(name);
           break;
         }
 
@@ -165,7 +163,7 @@ class LIEF_LOCAL ExeLayout : public Layout {
       for (const SymbolVersionAux& sva : saux) {
         const std::string& sva_name = sva.name();
         aux_names.push_back(sva_name);
-        opt_list.push_back(sva_name);
+        opt_list.add(sva_name);
       }
       auto res = verdef_info_.names_list.insert(std::move(aux_names));
       verdef_info_.def_to_names[&svd] = &*res.first;
@@ -174,24 +172,16 @@ class LIEF_LOCAL ExeLayout : public Layout {
     // Symbol version requirement
     for (const SymbolVersionRequirement& svr: binary_->symbols_version_requirement()) {
       const std::string& libname = svr.name();
-      opt_list.push_back(libname);
+      opt_list.add(libname);
       for (const SymbolVersionAuxRequirement& svar : svr.auxiliary_symbols()) {
         const std::string& name = svar.name();
-        opt_list.push_back(name);
+        opt_list.add(name);
       }
     }
 
-    size_t offset_counter = raw_dynstr.tellp();
-
-    std::vector<std::string> string_table_optimized = optimize(opt_list,
-                     [] (const std::string& name) { return name; },
-                     offset_counter, &offset_name_map_);
-
-    for (const std::string& name : string_table_optimized) {
-      raw_dynstr.write(name);
-    }
-
-    raw_dynstr.move(raw_dynstr_);
+    const size_t saved = opt_list.build(raw_dynstr_, offset_name_map_);
+    LIEF_DEBUG(".dynstr: 0x{:x} bytes (tail merging saved 0x{:x} bytes)",
+               raw_dynstr_.size(), saved);
     return raw_dynstr_.size();
   }
 
@@ -311,10 +301,13 @@ class LIEF_LOCAL ExeLayout : public Layout {
       return 0;
     }
 
+    std::vector<std::unique_ptr<Symbol>>& symbols = binary_->dynamic_symbols_;
+
     const uint32_t nb_buckets = gnu_hash->nb_buckets();
     const uint32_t symndx     = first_exported_symbol_index;
-    const uint32_t maskwords  = gnu_hash->maskwords();
-    const uint32_t shift2     = gnu_hash->shift2();
+    const uint32_t maskwords  = gnu_hash_maskwords_ > 0 ? gnu_hash_maskwords_ :
+                                                          gnu_hash->maskwords();
+    uint32_t shift2 = gnu_hash_shift2_ > 0 ? gnu_hash_shift2_ : gnu_hash->shift2();
 
     const std::vector<uint64_t>& filters = gnu_hash->bloom_filters();
     if (!filters.empty() && filters[0] == 0) {
@@ -325,26 +318,87 @@ class LIEF_LOCAL ExeLayout : public Layout {
       LIEF_DEBUG("Shift2 is null");
     }
 
+    // `hash >> shift2` is undefined for a (corrupted) shift greater than the
+    // size of the hash values. Use the value of lld in this case.
+    if (shift2 >= 32) {
+      LIEF_WARN("DT_GNU_HASH shift2 is out of range ({}). It is set to 26", shift2);
+      shift2 = 26;
+    }
+
     LIEF_DEBUG("Number of buckets       : 0x{:x}", nb_buckets);
     LIEF_DEBUG("First symbol idx        : 0x{:x}", symndx);
     LIEF_DEBUG("Number of bloom filters : 0x{:x}", maskwords);
     LIEF_DEBUG("Shift                   : 0x{:x}", shift2);
 
+    if (nb_buckets == 0 || maskwords == 0) {
+      LIEF_ERR("Invalid DT_GNU_HASH parameters (nb_buckets: {}, maskwords: {})",
+               nb_buckets, maskwords);
+      return 0;
+    }
+
+    if (symndx > symbols.size()) {
+      LIEF_ERR("First exported symbol index is out of range ({} > {})",
+               symndx, symbols.size());
+      return 0;
+    }
+
     // MANDATORY !
-    std::stable_sort(
-        std::begin(binary_->dynamic_symbols_) + symndx, std::end(binary_->dynamic_symbols_),
-        [&nb_buckets] (const std::unique_ptr<Symbol>& lhs, const std::unique_ptr<Symbol>& rhs) {
-          return (dl_new_hash(lhs->name().c_str()) % nb_buckets) <
-                 (dl_new_hash(rhs->name().c_str()) % nb_buckets);
+    // The exported symbols must be sorted by bucket. This is done with a
+    // stable counting sort (so that symbols from the same bucket keep their
+    // original order) whose histogram and scatter passes are spread over
+    // chunks of symbols.
+    const size_t nb_symbols = symbols.size() - symndx;
+    std::vector<uint32_t> hash_values(nb_symbols, 0);
+    {
+      static constexpr size_t MIN_CHUNK_SIZE = 0x4000;
+      const size_t nb_chunks = std::max<size_t>(1,
+          std::min(nb_workers(), nb_symbols / MIN_CHUNK_SIZE));
+      const size_t chunk_size = (nb_symbols + nb_chunks - 1) / nb_chunks;
+
+      std::vector<std::vector<uint32_t>> histograms(nb_chunks);
+      std::vector<uint32_t> hashes(nb_symbols, 0);
+
+      parallel_for(nb_chunks, [&] (size_t chunk) {
+        const size_t end = std::min(nb_symbols, (chunk + 1) * chunk_size);
+        std::vector<uint32_t>& histogram = histograms[chunk];
+        histogram.resize(nb_buckets, 0);
+        for (size_t i = chunk * chunk_size; i < end; ++i) {
+          const Symbol& sym = *symbols[symndx + i];
+          hashes[i] = sym.gnu_hash();
+          ++histogram[hashes[i] % nb_buckets];
+        }
+      });
+
+      // Turn the histograms into the position of the first symbol of each
+      // (chunk, bucket) pair
+      uint32_t offset = 0;
+      for (size_t bucket = 0; bucket < nb_buckets; ++bucket) {
+        for (std::vector<uint32_t>& histogram : histograms) {
+          const uint32_t count = histogram[bucket];
+          histogram[bucket] = offset;
+          offset += count;
+        }
+      }
+
+      std::vector<std::unique_ptr<Symbol>> sorted(nb_symbols);
+      parallel_for(nb_chunks, [&] (size_t chunk) {
+        const size_t end = std::min(nb_symbols, (chunk + 1) * chunk_size);
+        std::vector<uint32_t>& positions = histograms[chunk];
+        for (size_t i = chunk * chunk_size; i < end; ++i) {
+          const uint32_t pos = positions[hashes[i] % nb_buckets]++;
+          sorted[pos] = std::move(symbols[symndx + i]);
+          hash_values[pos] = hashes[i];
+        }
       });
-    Binary::it_dynamic_symbols dynamic_symbols = binary_->dynamic_symbols();
+      std::move(sorted.begin(), sorted.end(), symbols.begin() + symndx);
+    }
 
     vector_iostream raw_gnuhash;
     raw_gnuhash.reserve(
         4 * sizeof(uint32_t) +          // header
         maskwords * sizeof(uint) +    // bloom filters
         nb_buckets * sizeof(uint32_t) + // buckets
-        (dynamic_symbols.size() - symndx) * sizeof(uint32_t)); // hash values
+        nb_symbols * sizeof(uint32_t)); // hash values
 
     // Write header
     // =================================
@@ -359,11 +413,10 @@ class LIEF_LOCAL ExeLayout : public Layout {
     std::vector<uint> bloom_filters(maskwords, 0);
     size_t C = sizeof(uint) * 8; // 32 for ELF, 64 for ELF64
 
-    for (size_t i = symndx; i < dynamic_symbols.size(); ++i) {
-      const uint32_t hash = dl_new_hash(dynamic_symbols[i].name().c_str());
-      const size_t pos = (hash / C) & (gnu_hash->maskwords() - 1);
+    for (const uint32_t hash : hash_values) {
+      const size_t pos = (hash / C) & (maskwords - 1);
       uint V = (static_cast<uint>(1) << (hash % C)) |
-               (static_cast<uint>(1) << ((hash >> gnu_hash->shift2()) % C));
+               (static_cast<uint>(1) << ((hash >> shift2) % C));
       bloom_filters[pos] |= V;
     }
     for (size_t idx = 0; idx < bloom_filters.size(); ++idx) {
@@ -374,36 +427,25 @@ class LIEF_LOCAL ExeLayout : public Layout {
 
     // Write buckets and hash
     // =================================
-    int previous_bucket = -1;
-    size_t hash_value_idx = 0;
+    int64_t previous_bucket = -1;
     std::vector<uint32_t> buckets(nb_buckets, 0);
-    std::vector<uint32_t> hash_values(dynamic_symbols.size() - symndx, 0);
 
-    for (size_t i = symndx; i < dynamic_symbols.size(); ++i) {
-      LIEF_DEBUG("Dealing with symbol {}", to_string(dynamic_symbols[i]));
-      const uint32_t hash = dl_new_hash(dynamic_symbols[i].name().c_str());
-      int bucket = hash % nb_buckets;
-
-      if (bucket < previous_bucket) {
-        LIEF_ERR("Previous bucket is greater than the current one ({} < {})",
-                 bucket, previous_bucket);
-        return 0;
-      }
+    for (size_t i = 0; i < nb_symbols; ++i) {
+      LIEF_DEBUG("Dealing with symbol {}", to_string(*symbols[symndx + i]));
+      const uint32_t bucket = hash_values[i] % nb_buckets;
 
       if (bucket != previous_bucket) {
-        buckets[bucket] = i;
+        buckets[bucket] = symndx + i;
         previous_bucket = bucket;
-        if (hash_value_idx > 0) {
-          hash_values[hash_value_idx - 1] |= 1;
+        if (i > 0) {
+          hash_values[i - 1] |= 1;
         }
       }
-
-      hash_values[hash_value_idx] = hash & ~1;
-      ++hash_value_idx;
+      hash_values[i] &= ~1;
     }
 
-    if (hash_value_idx > 0) {
-      hash_values[hash_value_idx - 1] |= 1;
+    if (nb_symbols > 0) {
+      hash_values[nb_symbols - 1] |= 1;
     }
 
     raw_gnuhash
@@ -417,10 +459,13 @@ class LIEF_LOCAL ExeLayout : public Layout {
   size_t dynamic_relocations_size() {
     using Elf_Rela = typename ELF_T::Elf_Rela;
     using Elf_Rel  = typename ELF_T::Elf_Rel;
-    const Binary::it_dynamic_relocations& dyn_relocs = binary_->dynamic_relocations();
-    const size_t nb_rel_a = std::count_if(dyn_relocs.begin(), dyn_relocs.end(),
-      [] (const Relocation& R) {
-        return R.is_rel() || R.is_rela();
+    // Iterate over the raw relocations as REL/RELA relocations are never
+    // stored in the compact relocations
+    const size_t nb_rel_a = std::count_if(
+      binary_->relocations_.begin(), binary_->relocations_.end(),
+      [] (const std::unique_ptr<Relocation>& R) {
+        return R->purpose() == Relocation::PURPOSE::DYNAMIC &&
+               (R->is_rel() || R->is_rela());
       }
     );
 
@@ -514,70 +559,92 @@ class LIEF_LOCAL ExeLayout : public Layout {
       return raw_android_rela_.size();
     }
 
-    std::vector<const Relocation*> android_relocs;
-    std::vector<const Relocation*> relative_rels;
-    std::vector<const Relocation*> non_relative_rels;
-    android_relocs.reserve(20);
+    // The relocations are re-encoded from the compact (columnar) storage
+    // if they have not been materialized yet, otherwise from the Relocation
+    // objects.
+    struct packed_reloc_t {
+      uint64_t address = 0;
+      uint64_t info = 0;
+      int64_t addend = 0;
+    };
+
+    const compact_relocations_t::android_t& compact = binary_->compact_relocations_->android;
+    const uint64_t type_mask = elf_class == Header::CLASS::ELF32 ? 0xff : 0xffffffff;
+    const bool has_relative = relative_reloc != Relocation::TYPE::UNKNOWN;
+
+    size_t nb_relocs = 0;
+    std::vector<packed_reloc_t> relative_rels;
+    std::vector<packed_reloc_t> non_relative_rels;
 
-    for (const Relocation& R : binary_->relocations()) {
-      if (!R.is_android_packed()) {
+    for (size_t i = 0; i < compact.size(); ++i) {
+      packed_reloc_t R{compact.offsets[i], compact.infos[i], compact.addends[i]};
+      ++nb_relocs;
+      has_relative && (R.info & type_mask) == raw_relative_reloc ?
+        relative_rels.push_back(R) : non_relative_rels.push_back(R);
+    }
+
+    for (const std::unique_ptr<Relocation>& R : binary_->relocations_) {
+      if (!R->is_android_packed()) {
         continue;
       }
-      android_relocs.push_back(&R);
-      R.is_relative() ? relative_rels.push_back(&R) :
-                        non_relative_rels.push_back(&R);
+      ++nb_relocs;
+      packed_reloc_t PR{R->address(), R->r_info(elf_class), R->addend()};
+      R->is_relative() ? relative_rels.push_back(PR) :
+                         non_relative_rels.push_back(PR);
     }
 
     std::sort(relative_rels.begin(), relative_rels.end(),
-      [] (const Relocation* lhs, const Relocation* rhs) {
-        return lhs->address() < rhs->address();
+      [] (const packed_reloc_t& lhs, const packed_reloc_t& rhs) {
+        return lhs.address < rhs.address;
       }
     );
 
-    std::vector<const Relocation*> ungrouped_relative;
-    std::vector<std::vector<const Relocation*>> relative_groups;
-    for (auto i = relative_rels.begin(), e = relative_rels.end(); i != e;) {
-      std::vector<const Relocation*> group;
-      do {
-        group.push_back(*i++);
-      } while (i != e && (*(i - 1))->address() + wordsize == (*i)->address());
+    using group_t = std::pair<size_t, size_t>; // [start, end) in relative_rels
+    std::vector<packed_reloc_t> ungrouped_relative;
+    std::vector<group_t> relative_groups;
+    for (size_t i = 0, e = relative_rels.size(); i != e;) {
+      const size_t start = i++;
+      while (i != e && relative_rels[i - 1].address + wordsize == relative_rels[i].address) {
+        ++i;
+      }
 
-      if (group.size() < 8) {
+      if (i - start < 8) {
         ungrouped_relative.insert(ungrouped_relative.end(),
-                                  group.begin(), group.end());
+                                  relative_rels.begin() + start,
+                                  relative_rels.begin() + i);
       } else {
-        relative_groups.emplace_back(std::move(group));
+        relative_groups.emplace_back(start, i);
       }
     }
 
 
     std::sort(non_relative_rels.begin(), non_relative_rels.end(),
-      [elf_class] (const Relocation* lhs, const Relocation* rhs) {
-        if (lhs->r_info(elf_class) != rhs->r_info(elf_class)) {
-          return lhs->r_info(elf_class) < rhs->r_info(elf_class);
+      [] (const packed_reloc_t& lhs, const packed_reloc_t& rhs) {
+        if (lhs.info != rhs.info) {
+          return lhs.info < rhs.info;
         }
-        if (lhs->addend() != rhs->addend()) {
-          return lhs->addend() < rhs->addend();
+        if (lhs.addend != rhs.addend) {
+          return lhs.addend < rhs.addend;
         }
-        return lhs->address() < rhs->address();
+        return lhs.address < rhs.address;
       }
     );
 
-    std::vector<const Relocation*> ungrouped_non_relative;
-    std::vector<std::vector<const Relocation*>> non_relative_group;
+    std::vector<packed_reloc_t> ungrouped_non_relative;
+    std::vector<group_t> non_relative_group;
 
-    for (auto i = non_relative_rels.begin(),
-              e = non_relative_rels.end(); i != e;)
-    {
-      auto j = i + 1;
-      while (j != e && (*i)->r_info(elf_class) == (*j)->r_info(elf_class) &&
-             (!is_rela || (*i)->addend() == (*j)->addend()))
+    for (size_t i = 0, e = non_relative_rels.size(); i != e;) {
+      size_t j = i + 1;
+      while (j != e && non_relative_rels[i].info == non_relative_rels[j].info &&
+             (!is_rela || non_relative_rels[i].addend == non_relative_rels[j].addend))
       {
         ++j;
       }
 
-      if ((j - i) < 3 || (is_rela && (*i)->addend() != 0)) {
-        ungrouped_non_relative.insert(ungrouped_non_relative.end(), i, j);
+      if ((j - i) < 3 || (is_rela && non_relative_rels[i].addend != 0)) {
+        ungrouped_non_relative.insert(ungrouped_non_relative.end(),
+                                      non_relative_rels.begin() + i,
+                                      non_relative_rels.begin() + j);
       } else {
         non_relative_group.emplace_back(i, j);
       }
@@ -585,8 +652,8 @@ class LIEF_LOCAL ExeLayout : public Layout {
     }
 
     std::sort(ungrouped_non_relative.begin(), ungrouped_non_relative.end(),
-      [] (const Relocation* lhs, const Relocation* rhs) {
-        return lhs->address() < rhs->address();
+      [] (const packed_reloc_t& lhs, const packed_reloc_t& rhs) {
+        return lhs.address < rhs.address;
       }
     );
 
@@ -600,57 +667,58 @@ class LIEF_LOCAL ExeLayout : public Layout {
        .write('S')
        .write('2');
 
-    ios.write_sleb128(android_relocs.size());
+    ios.write_sleb128(nb_relocs);
     ios.write_sleb128(0);
 
-    for (const std::vector<const Relocation*>& g : relative_groups) {
+    for (const group_t& g : relative_groups) {
+      const packed_reloc_t& first = relative_rels[g.first];
+      const size_t g_size = g.second - g.first;
       ios.write_sleb128(1);
       ios.write_sleb128(GROUPED_BY_OFFSET_DELTA_FLAG | GROUPED_BY_INFO_FLAG |
                         has_addend_with_rela);
-      ios.write_sleb128(g[0]->address() - offset);
+      ios.write_sleb128(first.address - offset);
       ios.write_sleb128(raw_relative_reloc);
       if (is_rela) {
-        ios.write_sleb128(g[0]->addend() - addend);
-        addend = g[0]->addend();
+        ios.write_sleb128(first.addend - addend);
+        addend = first.addend;
       }
 
-      ios.write_sleb128(g.size() - 1);
+      ios.write_sleb128(g_size - 1);
       ios.write_sleb128(GROUPED_BY_OFFSET_DELTA_FLAG | GROUPED_BY_INFO_FLAG |
                         has_addend_with_rela);
       ios.write_sleb128(wordsize);
       ios.write_sleb128(raw_relative_reloc);
       if (is_rela) {
-        auto it = g.begin(); ++it;
-        for (; it != g.end(); ++it) {
-          ios.write_sleb128((*it)->addend() - addend);
-          addend = (*it)->addend();
+        for (size_t i = g.first + 1; i < g.second; ++i) {
+          ios.write_sleb128(relative_rels[i].addend - addend);
+          addend = relative_rels[i].addend;
         }
       }
-      offset = g.back()->address();
+      offset = relative_rels[g.second - 1].address;
     }
 
     if (!ungrouped_relative.empty()) {
       ios.write_sleb128(ungrouped_relative.size());
       ios.write_sleb128(GROUPED_BY_INFO_FLAG | has_addend_with_rela);
       ios.write_sleb128(raw_relative_reloc);
-      for (const Relocation* R : ungrouped_relative) {
-        ios.write_sleb128(R->address() - offset);
-        offset = R->address();
+      for (const packed_reloc_t& R : ungrouped_relative) {
+        ios.write_sleb128(R.address - offset);
+        offset = R.address;
         if (is_rela) {
-          ios.write_sleb128(R->addend() - addend);
-          addend = R->addend();
+          ios.write_sleb128(R.addend - addend);
+          addend = R.addend;
         }
       }
     }
 
-    for (const std::vector<const Relocation*>& g: non_relative_group) {
-      ios.write_sleb128(g.size());
+    for (const group_t& g : non_relative_group) {
+      ios.write_sleb128(g.second - g.first);
       ios.write_sleb128(GROUPED_BY_INFO_FLAG);
-      ios.write_sleb128(static_cast<Elf_Xword>(g[0]->r_info(elf_class)));
+      ios.write_sleb128(static_cast<Elf_Xword>(non_relative_rels[g.first].info));
 
-      for (const Relocation* R : g) {
-        ios.write_sleb128(R->address() - offset);
-        offset = R->address();
+      for (size_t i = g.first; i < g.second; ++i) {
+        ios.write_sleb128(non_relative_rels[i].address - offset);
+        offset = non_relative_rels[i].address;
       }
       addend = 0;
     }
@@ -658,13 +726,13 @@ class LIEF_LOCAL ExeLayout : public Layout {
     if (!ungrouped_non_relative.empty()) {
       ios.write_sleb128(ungrouped_non_relative.size());
       ios.write_sleb128(has_addend_with_rela);
-      for (const Relocation* R : ungrouped_non_relative) {
-        ios.write_sleb128(R->address() - offset);
-        offset = R->address();
-        ios.write_sleb128(static_cast<Elf_Xword>(R->r_info(elf_class)));
+      for (const packed_reloc_t& R : ungrouped_non_relative) {
+        ios.write_sleb128(R.address - offset);
+        offset = R.address;
+        ios.write_sleb128(static_cast<Elf_Xword>(R.info));
         if (is_rela) {
-          ios.write_sleb128(R->addend() - addend);
-          addend = R->addend();
+          ios.write_sleb128(R.addend - addend);
+          addend = R.addend;
         }
       }
     }
@@ -688,27 +756,30 @@ class LIEF_LOCAL ExeLayout : public Layout {
       return raw_relr_.size();
     }
 
-    std::vector<const Relocation*> relr_relocs;
-    relr_relocs.reserve(20);
+    // Addresses of the relocations that are still in the compact storage
+    // are used as-is while the materialized ones are collected from the
+    // Relocation objects.
+    const std::vector<uint64_t>& compact_offsets = binary_->compact_relocations_->relr.offsets;
+    std::vector<uint64_t> offsets;
+    offsets.reserve(compact_offsets.size());
+    offsets.insert(offsets.end(), compact_offsets.begin(), compact_offsets.end());
 
-    for (const Relocation& R : binary_->relocations()) {
-      if (R.is_relatively_encoded()) {
-        relr_relocs.push_back(&R);
+    for (const std::unique_ptr<Relocation>& R : binary_->relocations_) {
+      if (R->is_relatively_encoded()) {
+        offsets.push_back(R->address());
       }
     }
 
-    std::unique_ptr<uint64_t[]> offsets(new uint64_t[relr_relocs.size()]);
-    for (size_t i = 0; i < relr_relocs.size(); ++i) {
-      offsets[i] = relr_relocs[i]->address();
+    if (!std::is_sorted(offsets.begin(), offsets.end())) {
+      std::sort(offsets.begin(), offsets.end());
     }
-    std::sort(offsets.get(), offsets.get() + relr_relocs.size());
 
     const size_t wordsize = sizeof(Elf_Addr);
     const size_t nbits = wordsize * 8 - 1;
 
     vector_iostream raw_relr;
 
-    for (size_t i = 0, e = relr_relocs.size(); i != e;) {
+    for (size_t i = 0, e = offsets.size(); i != e;) {
       raw_relr.write<Elf_Addr>(offsets[i]);
       uint64_t base = offsets[i] + wordsize;
       ++i;
@@ -761,6 +832,24 @@ class LIEF_LOCAL ExeLayout : public Layout {
     relocate_gnu_hash_ = val;
   }
 
+  /// Override the bloom filter parameters of the DT_GNU_HASH table.
+  /// A null value keeps the original one.
+  void gnu_hash_bloom(uint32_t maskwords, uint32_t shift2) {
+    // maskwords must be a power of 2
+    uint32_t pow2 = 1;
+    while (pow2 < maskwords && pow2 < (1u << 31)) {
+      pow2 <<= 1;
+    }
+    gnu_hash_maskwords_ = maskwords > 0 ? pow2 : 0;
+
+    // The hash values are 32 bits wide
+    if (shift2 >= 32) {
+      LIEF_ERR("Invalid DT_GNU_HASH shift2 ({}): the original value is kept", shift2);
+      shift2 = 0;
+    }
+    gnu_hash_shift2_ = shift2;
+  }
+
   void relocate_sysv_hash(uint64_t size) {
     sysv_size_ = size;
   }
@@ -968,6 +1057,7 @@ class LIEF_LOCAL ExeLayout : public Layout {
       hdr.section_name_table_idx(binary_->sections_.size() - 1);
     }
 
+    binary_->materialize_relocations();
     for (std::unique_ptr<Relocation>& reloc : binary_->relocations_) {
       relocations_addresses_[reloc->address()] = reloc.get();
     }
@@ -1679,7 +1769,7 @@ class LIEF_LOCAL ExeLayout : public Layout {
     return true;
   }
 
-  const std::unordered_map<std::string, size_t>& dynstr_map() const {
+  const StringTableBuilder::offsets_t& dynstr_map() const {
     return offset_name_map_;
   }
 
@@ -1695,7 +1785,7 @@ class LIEF_LOCAL ExeLayout : public Layout {
   ExeLayout() = delete;
   private:
 
-  std::unordered_map<std::string, size_t> offset_name_map_;
+  StringTableBuilder::offsets_t offset_name_map_;
   std::unordered_map<const Note*, size_t> notes_off_map_;
 
   sym_verdef_info_t verdef_info_;
@@ -1712,6 +1802,8 @@ class LIEF_LOCAL ExeLayout : public Layout {
 
   std::vector<uint8_t> raw_gnu_hash_;
   bool relocate_gnu_hash_{false};
+  uint32_t gnu_hash_maskwords_ = 0;
+  uint32_t gnu_hash_shift2_ = 0;
 
   std::vector<uint8_t> raw_relr_;
   bool relocate_relr_{false};
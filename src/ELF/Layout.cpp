@@ -12,13 +12,14 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
+
 #include "Layout.hpp"
 #include "LIEF/ELF/Binary.hpp"
 #include "LIEF/ELF/Symbol.hpp"
 #include "LIEF/ELF/Section.hpp"
-#include "internal_utils.hpp"
-
-#include <LIEF/iostream.hpp>
+#include "LIEF/ELF/Note.hpp"
+#include "logging.hpp"
 
 namespace LIEF {
 namespace ELF {
@@ -53,23 +54,20 @@ size_t Layout::section_strtab_size() {
     return 0;
   }
 
-  vector_iostream raw_strtab;
-  raw_strtab.write<uint8_t>(0);
-
-  size_t offset_counter = raw_strtab.tellp();
-
   if (binary_->symtab_symbols_.empty()) {
     return 0;
   }
 
-  std::vector<std::string> symstr_opt = optimize(binary_->symtab_symbols_,
-                      [] (const std::unique_ptr<Symbol>& sym) { return sym->name(); },
-                      offset_counter, &strtab_name_map_);
-
-  for (const std::string& name : symstr_opt) {
-    raw_strtab.write(name);
+  StringTableBuilder strtab;
+  strtab.reserve(binary_->symtab_symbols_.size());
+  for (const std::unique_ptr<Symbol>& sym : binary_->symtab_symbols_) {
+    const Symbol& csym = *sym;
+    strtab.add(csym.name());
   }
-  raw_strtab.move(raw_strtab_);
+
+  const size_t saved = strtab.build(raw_strtab_, strtab_name_map_);
+  LIEF_DEBUG(".strtab: 0x{:x} bytes (tail merging saved 0x{:x} bytes)",
+             raw_strtab_.size(), saved);
   return raw_strtab_.size();
 }
 
@@ -79,11 +77,6 @@ size_t Layout::section_shstr_size() {
     return raw_shstrtab_.size();
   }
 
-  vector_iostream raw_shstrtab;
-
-  // In the ELF format all the .str sections
-  // start with a null entry.
-  raw_shstrtab.write<uint8_t>(0);
   std::vector<std::string> sec_names;
   sec_names.reserve(binary_->sections_.size());
   std::transform(std::begin(binary_->sections_), std::end(binary_->sections_),
@@ -112,28 +105,27 @@ size_t Layout::section_shstr_size() {
     }
   }
 
-  // First write section names
-  size_t offset_counter = raw_shstrtab.tellp();
-  std::vector<std::string> shstrtab_opt = optimize(sec_names, [] (const std::string& s) { return s; },
-                      offset_counter, &shstr_name_map_);
-
-  for (const std::string& name : shstrtab_opt) {
-    raw_shstrtab.write(name);
+  // In the ELF format all the .str sections start with a null entry
+  // (written by the StringTableBuilder)
+  StringTableBuilder shstrtab;
+  shstrtab.reserve(sec_names.size());
+  for (const std::string& name : sec_names) {
+    shstrtab.add(name);
   }
 
   // Check if the .shstrtab and the .strtab are shared (optimization used by clang)
   // in this case, include the symtab symbol names
   if (!binary_->symtab_symbols_.empty() && is_strtab_shared_shstrtab()) {
-    offset_counter = raw_shstrtab.tellp();
-    std::vector<std::string> symstr_opt = optimize(binary_->symtab_symbols_,
-                       [] (const std::unique_ptr<Symbol>& sym) { return sym->name(); },
-                       offset_counter, &shstr_name_map_);
-    for (const std::string& name : symstr_opt) {
-      raw_shstrtab.write(name);
+    shstrtab.reserve(sec_names.size() + binary_->symtab_symbols_.size());
+    for (const std::unique_ptr<Symbol>& sym : binary_->symtab_symbols_) {
+      const Symbol& csym = *sym;
+      shstrtab.add(csym.name());
     }
   }
 
-  raw_shstrtab.move(raw_shstrtab_);
+  const size_t saved = shstrtab.build(raw_shstrtab_, shstr_name_map_);
+  LIEF_DEBUG(".shstrtab: 0x{:x} bytes (tail merging saved 0x{:x} bytes)",
+             raw_shstrtab_.size(), saved);
   return raw_shstrtab_.size();
 }
 
@@ -20,6 +20,8 @@
 #include <string>
 #include <vector>
 
+#include "string_table.hpp"
+
 namespace LIEF {
 namespace ELF {
 class Section;
@@ -30,11 +32,11 @@ class Layout {
     binary_(&bin)
   {}
 
-  virtual const std::unordered_map<std::string, size_t>& shstr_map() const {
+  virtual const StringTableBuilder::offsets_t& shstr_map() const {
     return shstr_name_map_;
   }
 
-  virtual const std::unordered_map<std::string, size_t>& strtab_map() const {
+  virtual const StringTableBuilder::offsets_t& strtab_map() const {
     return strtab_name_map_;
   }
 
@@ -64,8 +66,8 @@ class Layout {
   protected:
   Binary* binary_ = nullptr;
 
-  std::unordered_map<std::string, size_t> shstr_name_map_;
-  std::unordered_map<std::string, size_t> strtab_name_map_;
+  StringTableBuilder::offsets_t shstr_name_map_;
+  StringTableBuilder::offsets_t strtab_name_map_;
 
   std::vector<uint8_t> raw_shstrtab_;
   std::vector<uint8_t> raw_strtab_;
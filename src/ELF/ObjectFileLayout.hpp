@@ -82,9 +82,11 @@ class LIEF_LOCAL ObjectFileLayout : public Layout {
       const size_t needed_size = sec_reloc_info_[&sec];
       LIEF_DEBUG("Need to relocate: '{}' (0x{:x} bytes)", sec.name(), needed_size);
 
-      DataHandler::Node new_node{last_offset_sections, needed_size,
-                                 DataHandler::Node::SECTION};
-      binary_->datahandler_->add(new_node);
+      // The section's node (if any) is moved by Section::offset()/size()
+      if (sec.node_ == nullptr) {
+        sec.node_ = &binary_->datahandler_->create(last_offset_sections, needed_size,
+                                                   DataHandler::Node::SECTION);
+      }
       binary_->datahandler_->make_hole(last_offset_sections, needed_size);
 
       sec.offset(last_offset_sections);
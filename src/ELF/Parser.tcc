@@ -46,9 +46,11 @@
 #include "ELF/Structures.hpp"
 #include "ELF/DataHandler/Handler.hpp"
 #include "ELF/SizingInfo.hpp"
+#include "ELF/CompactRelocations.hpp"
 
 #include "Object.tcc"
 #include "internal_utils.hpp"
+#include "parallel.hpp"
 
 namespace LIEF {
 namespace ELF {
@@ -152,18 +154,7 @@ ok_error_t Parser::parse_binary() {
   // otherwise, only the non-allocated sections to avoid parsing dynamic
   // relocations (or plt relocations) twice.
   if (config_.parse_relocations) {
-    bool skip_allocated_sections = !binary_->relocations_.empty();
-    for (const Section& section : binary_->sections()) {
-      if (skip_allocated_sections && section.has(Section::FLAGS::ALLOC)){
-        continue;
-      }
-      if (section.type() == Section::TYPE::REL) {
-        parse_section_relocations<ELF_T, typename ELF_T::Elf_Rel>(section);
-      }
-      else if (section.type() == Section::TYPE::RELA) {
-        parse_section_relocations<ELF_T, typename ELF_T::Elf_Rela>(section);
-      }
-    }
+    parse_sections_relocations<ELF_T>();
   }
   if (config_.parse_symbol_versions) {
     link_symbol_version();
@@ -855,7 +846,7 @@ ok_error_t Parser::parse_sections() {
 
     if (section->size() == 0 && section->file_offset() > 0 && access_content) {
       // Even if the size is 0, it is worth creating the node
-      handler.create(section->file_offset(), 0, DataHandler::Node::SECTION);
+      section->node_ = &handler.create(section->file_offset(), 0, DataHandler::Node::SECTION);
     }
 
     // Only if it contains data (with bits)
@@ -872,8 +863,8 @@ ok_error_t Parser::parse_sections() {
         read_size = Section::MAX_SECTION_SIZE;
       }
 
-      handler.create(section->file_offset(), read_size,
-                     DataHandler::Node::SECTION);
+      section->node_ = &handler.create(section->file_offset(), read_size,
+                                       DataHandler::Node::SECTION);
 
       const Elf_Off offset_to_content = section->file_offset();
       auto alloc = binary_->datahandler_->reserve(section->file_offset(), read_size);
@@ -968,8 +959,8 @@ ok_error_t Parser::parse_segments() {
         read_size = stream_->size();
       }
 
-      segment->datahandler_->create(segment->file_offset(), read_size,
-                                    DataHandler::Node::SEGMENT);
+      segment->node_ = &segment->datahandler_->create(
+          segment->file_offset(), read_size, DataHandler::Node::SEGMENT);
       segment->handler_size_ = read_size;
 
       const bool corrupted_offset = segment->file_offset() > stream_->size() ||
@@ -1008,8 +999,8 @@ ok_error_t Parser::parse_segments() {
       }
     } else {
       segment->handler_size_ = segment->physical_size();
-      segment->datahandler_->create(segment->file_offset(), segment->physical_size(),
-                                    DataHandler::Node::SEGMENT);
+      segment->node_ = &segment->datahandler_->create(
+          segment->file_offset(), segment->physical_size(), DataHandler::Node::SEGMENT);
     }
 
     for (std::unique_ptr<Section>& section : binary_->sections_) {
@@ -1067,10 +1058,17 @@ ok_error_t Parser::parse_packed_relocations(uint64_t offset, uint64_t size) {
   uint64_t nb_relocs = *res_nb_relocs;
   uint64_t r_offset = *res_rels_offset;
   uint64_t addend = 0;
-  const ARCH arch = binary_->header().machine_type();
 
   LIEF_DEBUG("Nb relocs: {}", nb_relocs);
 
+  // The relocations are stored in a columnar form and only converted into
+  // Relocation objects when accessed (c.f. Binary::materialize_relocations)
+  compact_relocations_t::android_t& packed = binary_->compact_relocations_->android;
+  if (packed.size() == 0) {
+    packed.position = binary_->relocations_.size();
+  }
+  packed.reserve(packed.size() + std::min<uint64_t>(nb_relocs, Parser::NB_MAX_RELOCATIONS));
+
   while (nb_relocs > 0) {
     auto nb_reloc_group_r = rel_stream->read_sleb128();
     if (!nb_reloc_group_r) {
@@ -1126,10 +1124,7 @@ ok_error_t Parser::parse_packed_relocations(uint64_t offset, uint64_t size) {
       R.r_info = info;
       R.r_addend = addend;
       R.r_offset = r_offset;
-      auto reloc = std::unique_ptr<Relocation>(new Relocation(R, Relocation::PURPOSE::DYNAMIC,
-        Relocation::ENCODING::ANDROID_SLEB, arch));
-      bind_symbol(*reloc);
-      insert_relocation(std::move(reloc));
+      packed.push_back(R.r_offset, R.r_info, R.r_addend);
     }
   }
   return ok();
@@ -1139,10 +1134,8 @@ template<typename ELF_T>
 ok_error_t Parser::parse_relative_relocations(uint64_t offset, uint64_t size) {
   LIEF_DEBUG("Parsing relative relocations");
   using Elf_Relr = typename ELF_T::uint;
-  using Elf_Addr = typename ELF_T::uint;
   ScopedStream rel_stream(*stream_, offset);
 
-  Elf_Addr base = 0;
   const ARCH arch = binary_->header().machine_type();
   Relocation::TYPE type = Relocation::TYPE::UNKNOWN;
   switch (arch) {
@@ -1165,32 +1158,26 @@ ok_error_t Parser::parse_relative_relocations(uint64_t offset, uint64_t size) {
       break;
   }
 
-  while (rel_stream->pos() < (offset + size)) {
+  const size_t nb_entries = std::min<size_t>(size / sizeof(Elf_Relr),
+                                             Parser::NB_MAX_RELOCATIONS);
+  std::vector<Elf_Relr> entries;
+  entries.reserve(nb_entries);
+  for (size_t i = 0; i < nb_entries; ++i) {
     auto opt_relr = rel_stream->read<Elf_Relr>();
     if (!opt_relr) {
       break;
     }
-    Elf_Relr rel = *opt_relr;
-    if ((rel & 1) == 0) {
-      Elf_Addr r_offset = rel;
-      auto reloc = std::make_unique<Relocation>(r_offset, type,
-                                                Relocation::ENCODING::RELR);
-      reloc->purpose(Relocation::PURPOSE::DYNAMIC);
-      insert_relocation(std::move(reloc));
-      base = rel + sizeof(Elf_Addr);
-    } else {
-      for (Elf_Addr offset = base; (rel >>= 1) != 0; offset += sizeof(Elf_Addr)) {
-        if ((rel & 1) != 0) {
-          Elf_Addr r_offset = offset;
-          auto reloc = std::make_unique<Relocation>(r_offset, type,
-                                                    Relocation::ENCODING::RELR);
-          reloc->purpose(Relocation::PURPOSE::DYNAMIC);
-          insert_relocation(std::move(reloc));
-        }
-      }
-      base += (8 * sizeof(Elf_Relr) - 1) * sizeof(Elf_Addr);
-    }
+    entries.push_back(*opt_relr);
   }
+
+  // RELR relocations are only stored as a list of addresses
+  // (c.f. Binary::materialize_relocations)
+  compact_relocations_t::relr_t& relr = binary_->compact_relocations_->relr;
+  if (relr.offsets.empty()) {
+    relr.position = binary_->relocations_.size();
+  }
+  relr.type = type;
+  decode_relr<Elf_Relr>(entries, relr.offsets);
   return ok();
 }
 
@@ -1202,7 +1189,13 @@ ok_error_t Parser::parse_dynamic_relocations(uint64_t relocations_offset, uint64
   LIEF_DEBUG("== Parsing dynamic relocations ==");
 
   // Already parsed
-  if (binary_->dynamic_relocations().size() > 0) {
+  const bool has_dynamic = !binary_->compact_relocations_->empty() ||
+    std::any_of(binary_->relocations_.begin(), binary_->relocations_.end(),
+      [] (const std::unique_ptr<Relocation>& R) {
+        return R->purpose() == Relocation::PURPOSE::DYNAMIC;
+      });
+
+  if (has_dynamic) {
     return ok();
   }
 
@@ -1540,7 +1533,13 @@ ok_error_t Parser::parse_pltgot_relocations(uint64_t offset, uint64_t size) {
   using Elf_Off  = typename ELF_T::Elf_Off;
 
   // Already Parsed
-  if (binary_->pltgot_relocations().size() > 0) {
+  const bool has_pltgot = std::any_of(
+    binary_->relocations_.begin(), binary_->relocations_.end(),
+    [] (const std::unique_ptr<Relocation>& R) {
+      return R->purpose() == Relocation::PURPOSE::PLTGOT;
+    });
+
+  if (has_pltgot) {
     return ok();
   }
 
@@ -1604,8 +1603,75 @@ struct RelocationSetHash {
   }
 };
 
+template<typename ELF_T>
+ok_error_t Parser::parse_sections_relocations() {
+  // Relocation sections are independent from each other: they are decoded
+  // concurrently in their own buffer and then merged in the order of the
+  // section table so that the final list does not depend on the scheduling.
+  //
+  // If we already have relocations (from the dynamic table), we only consider
+  // the non-allocated sections to avoid parsing dynamic relocations (or plt
+  // relocations) twice.
+  const bool skip_allocated_sections = !binary_->relocations_.empty() ||
+                                       !binary_->compact_relocations_->empty();
+
+  std::vector<const Section*> reloc_sections;
+  for (const Section& section : binary_->sections()) {
+    if (skip_allocated_sections && section.has(Section::FLAGS::ALLOC)) {
+      continue;
+    }
+    if (section.type() == Section::TYPE::REL ||
+        section.type() == Section::TYPE::RELA)
+    {
+      reloc_sections.push_back(&section);
+    }
+  }
+
+  if (reloc_sections.empty()) {
+    return ok();
+  }
+
+  // Resolve the content serially as it goes through the DataHandler
+  std::vector<span<const uint8_t>> contents;
+  contents.reserve(reloc_sections.size());
+  for (const Section* section : reloc_sections) {
+    contents.push_back(section->content());
+  }
+
+  std::vector<std::vector<std::unique_ptr<Relocation>>> relocations(reloc_sections.size());
+
+  parallel_for(reloc_sections.size(), [&] (size_t i) {
+    const Section& section = *reloc_sections[i];
+    if (section.type() == Section::TYPE::REL) {
+      parse_section_relocations<ELF_T, typename ELF_T::Elf_Rel>(
+          section, contents[i], relocations[i]);
+    } else {
+      parse_section_relocations<ELF_T, typename ELF_T::Elf_Rela>(
+          section, contents[i], relocations[i]);
+    }
+  });
+
+  size_t nb_relocations = binary_->relocations_.size();
+  for (const std::vector<std::unique_ptr<Relocation>>& relocs : relocations) {
+    nb_relocations += relocs.size();
+  }
+  binary_->relocations_.reserve(nb_relocations);
+
+  for (size_t i = 0; i < reloc_sections.size(); ++i) {
+    LIEF_DEBUG("#{} relocations found in {}", relocations[i].size(),
+               reloc_sections[i]->name());
+    for (std::unique_ptr<Relocation>& reloc : relocations[i]) {
+      insert_relocation(std::move(reloc));
+    }
+  }
+  return ok();
+}
+
 template<typename ELF_T, typename REL_T>
-ok_error_t Parser::parse_section_relocations(const Section& section) {
+ok_error_t Parser::parse_section_relocations(
+    const Section& section, span<const uint8_t> content,
+    std::vector<std::unique_ptr<Relocation>>& relocations) const
+{
   using Elf_Rel = typename ELF_T::Elf_Rel;
   using Elf_Rela = typename ELF_T::Elf_Rela;
 
@@ -1636,18 +1702,29 @@ ok_error_t Parser::parse_section_relocations(const Section& section) {
     std::is_same_v<REL_T, typename ELF_T::Elf_Rel> ? Relocation::ENCODING::REL :
                                                      Relocation::ENCODING::RELA;
 
-  auto nb_entries = static_cast<uint32_t>(section.size() / sizeof(REL_T));
+  auto nb_entries = static_cast<uint32_t>(content.size() / sizeof(REL_T));
   nb_entries = std::min<uint32_t>(nb_entries, Parser::NB_MAX_RELOCATIONS);
+  relocations.reserve(nb_entries);
+
+  // The symbol table referenced by sh_link is the same for all the entries
+  // so that the symbol of a relocation is resolved by its index
+  const std::vector<std::unique_ptr<Symbol>>& dynsyms = binary_->dynamic_symbols_;
+  const std::vector<std::unique_ptr<Symbol>>& symtab  = binary_->symtab_symbols_;
+
+  const bool use_dynsym = symbol_table == nullptr ||
+                          symbol_table->type() == Section::TYPE::DYNSYM;
+  const bool use_symtab = symbol_table == nullptr ||
+                          symbol_table->type() == Section::TYPE::SYMTAB;
 
   std::unordered_set<Relocation*, RelocationSetHash, RelocationSetEq> reloc_hash;
+  reloc_hash.reserve(nb_entries);
 
-  SpanStream reloc_stream(section.content());
+  SpanStream reloc_stream(content);
   const bool is_object_file =
     binary_->header().file_type() == Header::FILE_TYPE::REL &&
     binary_->segments_.empty();
 
-  size_t count = 0;
-  while (reloc_stream) {
+  for (uint32_t i = 0; i < nb_entries; ++i) {
     auto rel_hdr = reloc_stream.read<REL_T>();
     if (!rel_hdr) {
       LIEF_WARN("Can't parse relocation at offset: 0x{:04x} in {}",
@@ -1666,25 +1743,16 @@ ok_error_t Parser::parse_section_relocations(const Section& section) {
 
     const auto idx  = static_cast<uint32_t>(rel_hdr->r_info >> shift);
 
-    const bool is_from_dynsym = idx > 0 && idx < binary_->dynamic_symbols_.size() &&
-               (symbol_table == nullptr ||
-                symbol_table->type() == Section::TYPE::DYNSYM);
-
-    const bool is_from_symtab = idx < binary_->symtab_symbols_.size() &&
-                                (symbol_table == nullptr ||
-                                 symbol_table->type() == Section::TYPE::SYMTAB);
-    if (is_from_dynsym) {
-      reloc->symbol_ = binary_->dynamic_symbols_[idx].get();
-    } else if (is_from_symtab) {
-      reloc->symbol_ = binary_->symtab_symbols_[idx].get();
+    if (use_dynsym && idx > 0 && idx < dynsyms.size()) {
+      reloc->symbol_ = dynsyms[idx].get();
+    } else if (use_symtab && idx < symtab.size()) {
+      reloc->symbol_ = symtab[idx].get();
     }
 
     if (reloc_hash.insert(reloc.get()).second) {
-      ++count;
-      insert_relocation(std::move(reloc));
+      relocations.push_back(std::move(reloc));
     }
   }
-  LIEF_DEBUG("#{} relocations found in {}", count, section.name());
   return ok();
 }
 
@@ -137,6 +137,7 @@ void Section::swap(Section& other) noexcept {
   std::swap(segments_,       other.segments_);
   std::swap(is_frame_,       other.is_frame_);
   std::swap(datahandler_,    other.datahandler_);
+  std::swap(node_,           other.node_);
   std::swap(content_c_,      other.content_c_);
 }
 
@@ -151,8 +152,8 @@ bool Section::has(const Segment& segment) const {
 
 void Section::size(uint64_t size) {
   if (datahandler_ != nullptr && !is_frame()) {
-    if (auto node = datahandler_->get(file_offset(), this->size(), DataHandler::Node::SECTION)) {
-      node->get().size(size);
+    if (node_ != nullptr) {
+      datahandler_->update(*node_, node_->offset(), size);
     } else {
       if (type() != TYPE::NOBITS) {
         LIEF_ERR("Node not found. Can't resize the section {}", name());
@@ -166,8 +167,8 @@ void Section::size(uint64_t size) {
 
 void Section::offset(uint64_t offset) {
   if (datahandler_ != nullptr && !is_frame()) {
-    if (auto node = datahandler_->get(file_offset(), size(), DataHandler::Node::SECTION)) {
-      node->get().offset(offset);
+    if (node_ != nullptr) {
+      datahandler_->update(*node_, offset, node_->size());
     } else {
       if (type() != TYPE::NOBITS) {
         LIEF_WARN("Node not found. Can't change the offset of the section {}", name());
@@ -190,22 +191,14 @@ span<const uint8_t> Section::content() const {
     return {};
   }
 
-  auto res = datahandler_->get(offset(), size(), DataHandler::Node::SECTION);
-  if (!res) {
+  if (node_ == nullptr) {
     if (type() != TYPE::NOBITS) {
       LIEF_WARN("Section '{}' does not have content", name());
     }
     return {};
   }
-  const std::vector<uint8_t>& binary_content = datahandler_->content();
-  DataHandler::Node& node = res.value();
-  auto end_offset = (int64_t)node.offset() + (int64_t)node.size();
-  if (end_offset <= 0 || end_offset > (int64_t)binary_content.size()) {
-    return {};
-  }
-
-  const uint8_t* ptr = binary_content.data() + node.offset();
-  return {ptr, ptr + node.size()};
+  const DataHandler::Node& node = *node_;
+  return datahandler_->view(node.offset(), node.size());
 }
 
 std::vector<Section::FLAGS> Section::flags_list() const {
@@ -237,33 +230,26 @@ void Section::content(const std::vector<uint8_t>& data) {
              data.size(), file_offset(), name());
 
 
-  auto res = datahandler_->get(file_offset(), size(), DataHandler::Node::SECTION);
-  if (!res) {
+  if (node_ == nullptr) {
     LIEF_ERR("Can't find the node. The section's content can't be updated");
     return;
   }
 
-  DataHandler::Node& node = res.value();
-
-  std::vector<uint8_t>& binary_content = datahandler_->content();
-  datahandler_->reserve(node.offset(), data.size());
+  const DataHandler::Node& node = *node_;
 
   if (node.size() < data.size()) {
     LIEF_INFO("You inserted 0x{:x} bytes in the section '{}' which is 0x{:x} wide",
               data.size(), name(), node.size());
   }
 
-  auto max_offset = (int64_t)node.offset() + (int64_t)data.size();
-  if (max_offset < 0 || max_offset > (int64_t)binary_content.size()) {
+  // Do not access the content of the handler as it would apply the pending
+  // holes (e.g. the one created for this section by Binary::add())
+  if (!datahandler_->write(node.offset(), data)) {
     LIEF_ERR("Write out of range");
     return;
   }
 
   size(data.size());
-
-  std::copy(std::begin(data), std::end(data),
-            std::begin(binary_content) + node.offset());
-
 }
 
 
@@ -286,15 +272,11 @@ void Section::content(std::vector<uint8_t>&& data) {
   LIEF_DEBUG("Set 0x{:x} bytes in the data handler@0x{:x} of section '{}'",
              data.size(), file_offset(), name());
 
-  auto res = datahandler_->get(file_offset(), size(), DataHandler::Node::SECTION);
-  if (!res) {
+  if (node_ == nullptr) {
     LIEF_ERR("Can't find the node. The section's content can't be updated");
     return;
   }
-  DataHandler::Node& node = res.value();
-
-  std::vector<uint8_t>& binary_content = datahandler_->content();
-  datahandler_->reserve(node.offset(), data.size());
+  const DataHandler::Node& node = *node_;
 
   if (node.size() < data.size()) {
     LIEF_INFO("You inserted 0x{:x} bytes in the section '{}' which is 0x{:x} wide",
@@ -303,14 +285,10 @@ void Section::content(std::vector<uint8_t>&& data) {
 
   size(data.size());
 
-  auto max_offset = (int64_t)node.offset() + (int64_t)data.size();
-  if (max_offset < 0 || max_offset > (int64_t)binary_content.size()) {
+  if (!datahandler_->write(node.offset(), data)) {
     LIEF_ERR("Write out of range");
     return;
   }
-
-  std::move(std::begin(data), std::end(data),
-            std::begin(binary_content) + node.offset());
 }
 
 bool Section::has(Section::FLAGS flag) const {
@@ -368,12 +346,11 @@ Section& Section::clear(uint8_t value) {
   }
 
   std::vector<uint8_t>& binary_content = datahandler_->content();
-  auto res = datahandler_->get(file_offset(), size(), DataHandler::Node::SECTION);
-  if (!res) {
+  if (node_ == nullptr) {
     LIEF_ERR("Can't find the node. The section's content can't be cleared");
     return *this;
   }
-  DataHandler::Node& node = res.value();
+  const DataHandler::Node& node = *node_;
 
   std::fill_n(std::begin(binary_content) + node.offset(), size(), value);
   return *this;
@@ -387,6 +364,10 @@ span<uint8_t> Section::writable_content() {
   if (is_frame()) {
     return {};
   }
+  if (datahandler_ != nullptr) {
+    // The view must not point in a hole's buffer or in a flattened copy
+    datahandler_->materialize();
+  }
   span<const uint8_t> ref = static_cast<const Section*>(this)->content();
   return {const_cast<uint8_t*>(ref.data()), ref.size()};
 }
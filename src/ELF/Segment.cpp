@@ -125,6 +125,7 @@ void Segment::swap(Segment& other) {
   std::swap(handler_size_,     other.handler_size_);
   std::swap(sections_,         other.sections_);
   std::swap(datahandler_,      other.datahandler_);
+  std::swap(node_,             other.node_);
   std::swap(content_c_,        other.content_c_);
 }
 
@@ -160,24 +161,20 @@ span<const uint8_t> Segment::content() const {
     return content_c_;
   }
 
-  auto res = datahandler_->get(file_offset(), handler_size(), DataHandler::Node::SEGMENT);
-  if (!res) {
+  if (node_ == nullptr) {
     LIEF_ERR("Can't find the node. The segment's content can't be accessed");
     return {};
   }
-  DataHandler::Node& node = res.value();
+  const DataHandler::Node& node = *node_;
 
   // Create a span based on our values
-  const std::vector<uint8_t>& binary_content = datahandler_->content();
-  const size_t size = binary_content.size();
+  const uint64_t size = datahandler_->size();
   if (node.offset() >= size) {
     LIEF_ERR("Can't access content of segment {}:0x{:x}",
              to_string(type()), virtual_address());
     return {};
   }
 
-  const uint8_t* ptr = binary_content.data() + node.offset();
-
   /* node.size() overflow */
   if (node.offset() + node.size() < node.offset()) {
     return {};
@@ -185,27 +182,25 @@ span<const uint8_t> Segment::content() const {
 
   if ((node.offset() + node.size()) >= size) {
     if ((node.offset() + handler_size()) <= size) {
-      return {ptr, static_cast<size_t>(handler_size())};
+      return datahandler_->view(node.offset(), handler_size());
     }
     LIEF_ERR("Can't access content of segment {}:0x{:x}",
              to_string(type()), virtual_address());
     return {};
   }
 
-  return {ptr, static_cast<size_t>(node.size())};
+  return datahandler_->view(node.offset(), node.size());
 }
 
 size_t Segment::get_content_size() const {
   if (datahandler_ == nullptr) {
     return content_c_.size();
   }
-  auto res = datahandler_->get(file_offset(), handler_size(), DataHandler::Node::SEGMENT);
-  if (!res) {
+  if (node_ == nullptr) {
     LIEF_ERR("Can't find the node");
     return 0;
   }
-  DataHandler::Node& node = res.value();
-  return node.size();
+  return node_->size();
 }
 
 template<typename T>
@@ -216,15 +211,17 @@ T Segment::get_content_value(size_t offset) const {
                to_string(type()), virtual_address());
     memcpy(&ret, content_c_.data() + offset, sizeof(T));
   } else {
-    auto res = datahandler_->get(file_offset(), handler_size(), DataHandler::Node::SEGMENT);
-    if (!res) {
+    if (node_ == nullptr) {
       LIEF_ERR("Can't find the node associated with this segment");
       memset(&ret, 0, sizeof(T));
       return ret;
     }
-    const std::vector<uint8_t>& binary_content = datahandler_->content();
-    DataHandler::Node& node = res.value();
-    memcpy(&ret, binary_content.data() + node.offset() + offset, sizeof(T));
+    const DataHandler::Node& node = *node_;
+    auto res = datahandler_->read(node.offset() + offset,
+                                  {reinterpret_cast<uint8_t*>(&ret), sizeof(T)});
+    if (!res) {
+      memset(&ret, 0, sizeof(T));
+    }
   }
   return ret;
 }
@@ -245,12 +242,11 @@ void Segment::set_content_value(size_t offset, T value) {
     }
     memcpy(content_c_.data() + offset, &value, sizeof(T));
   } else {
-    auto res = datahandler_->get(file_offset(), handler_size(), DataHandler::Node::SEGMENT);
-    if (!res) {
+    if (node_ == nullptr) {
       LIEF_ERR("Can't find the node associated with this segment. The content can't be updated");
       return;
     }
-    DataHandler::Node& node = res.value();
+    const DataHandler::Node& node = *node_;
     std::vector<uint8_t>& binary_content = datahandler_->content();
 
     if (offset + sizeof(T) > binary_content.size()) {
@@ -294,9 +290,8 @@ void Segment::remove(Segment::FLAGS flag) {
 
 void Segment::file_offset(uint64_t file_offset) {
   if (datahandler_ != nullptr) {
-    auto res = datahandler_->get(this->file_offset(), handler_size(), DataHandler::Node::SEGMENT);
-    if (res) {
-      res->get().offset(file_offset);
+    if (node_ != nullptr) {
+      datahandler_->update(*node_, file_offset, node_->size());
     } else {
       LIEF_ERR("Can't find the node. The file offset can't be updated");
       return;
@@ -307,9 +302,8 @@ void Segment::file_offset(uint64_t file_offset) {
 
 void Segment::physical_size(uint64_t physical_size) {
   if (datahandler_ != nullptr) {
-    auto node = datahandler_->get(file_offset(), handler_size(), DataHandler::Node::SEGMENT);
-    if (node) {
-      node->get().size(physical_size);
+    if (node_ != nullptr) {
+      datahandler_->update(*node_, node_->offset(), physical_size);
       handler_size_ = physical_size;
     } else {
       LIEF_ERR("Can't find the node. The physical size can't be updated");
@@ -330,31 +324,25 @@ void Segment::content(std::vector<uint8_t> content) {
   LIEF_DEBUG("Set content of segment {}@0x{:x} in data handler @0x{:x} (0x{:x} bytes)",
              to_string(type()), virtual_address(), file_offset(), content.size());
 
-  auto res = datahandler_->get(file_offset(), handler_size(), DataHandler::Node::SEGMENT);
-  if (!res) {
+  if (node_ == nullptr) {
     LIEF_ERR("Can't find the node for updating content");
     return;
   }
-  DataHandler::Node& node = res.value();
-
-  std::vector<uint8_t>& binary_content = datahandler_->content();
-  datahandler_->reserve(node.offset(), content.size());
+  const DataHandler::Node& node = *node_;
 
   if (node.size() < content.size()) {
       LIEF_INFO("You inserted 0x{:x} bytes in the segment {}@0x{:x} which is 0x{:x} wide",
                 content.size(), to_string(type()), virtual_size(), node.size());
   }
 
-  auto max_offset = (int64_t)node.offset() + (int64_t)content.size();
-  if (max_offset < 0 || max_offset > (int64_t)binary_content.size()) {
+  // Do not access the content of the handler as it would apply the pending
+  // holes (e.g. the one created for this segment by Binary::add())
+  if (!datahandler_->write(node.offset(), content)) {
     LIEF_ERR("Write out of range");
     return;
   }
 
   physical_size(node.size());
-
-  std::move(std::begin(content), std::end(content),
-            std::begin(binary_content) + node.offset());
 }
 
 void Segment::accept(Visitor& visitor) const {
@@ -366,6 +354,10 @@ std::unique_ptr<SpanStream> Segment::stream() const {
 }
 
 span<uint8_t> Segment::writable_content() {
+  if (datahandler_ != nullptr) {
+    // The view must not point in a hole's buffer or in a flattened copy
+    datahandler_->materialize();
+  }
   span<const uint8_t> ref = static_cast<const Segment*>(this)->content();
   return {const_cast<uint8_t*>(ref.data()), ref.size()};
 }
@@ -22,6 +22,7 @@
 #include "LIEF/config.h"
 #include "LIEF/ELF/Symbol.hpp"
 #include "LIEF/ELF/SymbolVersion.hpp"
+#include "LIEF/ELF/utils.hpp"
 #include "LIEF/Visitor.hpp"
 #include "ELF/Structures.hpp"
 
@@ -42,7 +43,12 @@ Symbol::Symbol(const Symbol& other) : LIEF::Symbol{other},
   binding_{other.binding_},
   other_{other.other_},
   shndx_{other.shndx_},
-  arch_{other.arch_}
+  arch_{other.arch_},
+  gnu_hash_{other.gnu_hash_},
+  sysv_hash_{other.sysv_hash_},
+  // No reference on the name of the copy has been returned yet. The hashes
+  // are not cached if the name of `other` is exposed.
+  hash_flags_{(other.hash_flags_ & NAME_EXPOSED) != 0 ? uint8_t(0) : other.hash_flags_}
 {}
 
 
@@ -55,6 +61,16 @@ void Symbol::swap(Symbol& other) {
   std::swap(section_,        other.section_);
   std::swap(symbol_version_, other.symbol_version_);
   std::swap(arch_,           other.arch_);
+  std::swap(gnu_hash_,       other.gnu_hash_);
+  std::swap(sysv_hash_,      other.sysv_hash_);
+
+  // The cached hashes follow the name while a reference returned by name()
+  // is bound to the object (which then can't cache the hashes)
+  const bool exposed       = (hash_flags_ & NAME_EXPOSED) != 0;
+  const bool other_exposed = (other.hash_flags_ & NAME_EXPOSED) != 0;
+  std::swap(hash_flags_, other.hash_flags_);
+  hash_flags_       = exposed       ? uint8_t(NAME_EXPOSED) : uint8_t(hash_flags_ & ~NAME_EXPOSED);
+  other.hash_flags_ = other_exposed ? uint8_t(NAME_EXPOSED) : uint8_t(other.hash_flags_ & ~NAME_EXPOSED);
 }
 
 template<class T>
@@ -106,6 +122,32 @@ std::string Symbol::demangled_name() const {
   }
 }
 
+uint32_t Symbol::gnu_hash() const {
+  if ((hash_flags_ & NAME_EXPOSED) != 0) {
+    return dl_new_hash(name_.c_str());
+  }
+  if ((hash_flags_ & HAS_GNU_HASH) == 0) {
+    gnu_hash_ = dl_new_hash(name_.c_str());
+    hash_flags_ |= HAS_GNU_HASH;
+  }
+  return gnu_hash_;
+}
+
+uint32_t Symbol::sysv_hash(Header::CLASS cls) const {
+  const bool is64 = cls == Header::CLASS::ELF64;
+  if ((hash_flags_ & NAME_EXPOSED) != 0) {
+    return is64 ? hash64(name_.c_str()) : hash32(name_.c_str());
+  }
+  const bool cached = (hash_flags_ & HAS_SYSV_HASH) != 0 &&
+                      ((hash_flags_ & SYSV_HASH_64) != 0) == is64;
+  if (!cached) {
+    sysv_hash_ = is64 ? hash64(name_.c_str()) : hash32(name_.c_str());
+    hash_flags_ = (hash_flags_ & ~SYSV_HASH_64) | HAS_SYSV_HASH |
+                  (is64 ? SYSV_HASH_64 : 0);
+  }
+  return sysv_hash_;
+}
+
 bool Symbol::is_exported() const {
   bool is_exported = shndx() != SECTION_INDEX::UNDEF;
 
@@ -0,0 +1,378 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstring>
+
+#include "logging.hpp"
+
+#include "LIEF/BinaryStream/FileStream.hpp"
+#include "LIEF/ELF/quick_info.hpp"
+#include "LIEF/ELF/utils.hpp"
+#include "LIEF/ELF/Segment.hpp"
+#include "LIEF/ELF/DynamicEntry.hpp"
+#include "LIEF/ELF/Note.hpp"
+#include "LIEF/ELF/Parser.hpp"
+
+#include "ELF/Structures.hpp"
+
+namespace LIEF {
+namespace ELF {
+
+// Upper bound on the strings (interpreter, DT_NEEDED, ...) read by quick_info
+static constexpr size_t MAX_STRING_SIZE = 4096;
+
+// Upper bound on the size of the dynamic table and of the note segments.
+// These segments are usually smaller than a few KB.
+static constexpr size_t MAX_SEGMENT_SIZE = 1 << 20;
+
+static constexpr uint32_t NT_GNU_BUILD_ID = 3;
+static constexpr uint32_t NT_GNU_PROPERTY_TYPE_0 = 5;
+
+constexpr Header::ELF_DATA host_endianness() {
+  #if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && \
+      (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    return Header::ELF_DATA::MSB;
+  #else
+    return Header::ELF_DATA::LSB;
+  #endif
+}
+
+void quick_info_t::clear() {
+  cls = Header::CLASS::NONE;
+  endianness = Header::ELF_DATA::NONE;
+  file_type = Header::FILE_TYPE::NONE;
+  machine = ARCH::NONE;
+  entrypoint = 0;
+  has_dynamic = false;
+  interpreter.clear();
+  soname.clear();
+  rpath.clear();
+  runpath.clear();
+  needed.clear();
+  build_id.clear();
+  properties.clear();
+}
+
+// Read the null-terminated string located at `offset` (and before `end`)
+// by chunks instead of the byte-per-byte BinaryStream::peek_string
+static bool read_string(BinaryStream& stream, uint64_t offset, uint64_t end,
+                        std::string& out)
+{
+  static constexpr size_t CHUNK_SIZE = 64;
+  out.clear();
+  end = std::min<uint64_t>(end, stream.size());
+  char buffer[CHUNK_SIZE];
+  while (offset < end && out.size() < MAX_STRING_SIZE) {
+    const size_t size = std::min<uint64_t>(CHUNK_SIZE, end - offset);
+    if (!stream.peek_in(buffer, offset, size)) {
+      return false;
+    }
+    const auto* nul = static_cast<const char*>(std::memchr(buffer, '\0', size));
+    if (nul != nullptr) {
+      out.append(buffer, nul - buffer);
+      return true;
+    }
+    out.append(buffer, size);
+    offset += size;
+  }
+  return false;
+}
+
+template<class ELF_T>
+class QuickInfoReader {
+  public:
+  using Elf_Ehdr = typename ELF_T::Elf_Ehdr;
+  using Elf_Phdr = typename ELF_T::Elf_Phdr;
+  using Elf_Dyn  = typename ELF_T::Elf_Dyn;
+  using uint     = typename ELF_T::uint;
+
+  QuickInfoReader(BinaryStream& stream, quick_info_t& info) :
+    stream_(stream), info_(info)
+  {}
+
+  ok_error_t read() {
+    auto ehdr = stream_.peek<Elf_Ehdr>(0);
+    if (!ehdr) {
+      return make_error_code(lief_errors::read_error);
+    }
+
+    info_.file_type  = Header::FILE_TYPE(ehdr->e_type);
+    info_.machine    = ARCH(ehdr->e_machine);
+    info_.entrypoint = ehdr->e_entry;
+
+    if (ehdr->e_phoff == 0 || ehdr->e_phnum == 0) {
+      return ok();
+    }
+
+    if (ehdr->e_phentsize != sizeof(Elf_Phdr)) {
+      LIEF_DEBUG("Unexpected e_phentsize: {}", ehdr->e_phentsize);
+      return make_error_code(lief_errors::corrupted);
+    }
+
+    const size_t nb_segments = std::min<size_t>(ehdr->e_phnum, Parser::NB_MAX_SEGMENTS);
+    phdrs_.resize(nb_segments);
+    if (!stream_.peek_in(phdrs_.data(), ehdr->e_phoff, nb_segments * sizeof(Elf_Phdr))) {
+      LIEF_DEBUG("Can't read the program headers at 0x{:x}", ehdr->e_phoff);
+      return make_error_code(lief_errors::read_error);
+    }
+
+    if (stream_.should_swap()) {
+      for (Elf_Phdr& phdr : phdrs_) {
+        swap_endian(&phdr);
+      }
+    }
+
+    for (const Elf_Phdr& phdr : phdrs_) {
+      switch (Segment::TYPE(phdr.p_type)) {
+        case Segment::TYPE::INTERP:
+          read_string(stream_, phdr.p_offset, (uint64_t)phdr.p_offset + phdr.p_filesz,
+                      info_.interpreter);
+          break;
+
+        case Segment::TYPE::DYNAMIC:
+          info_.has_dynamic = true;
+          read_dynamic(phdr);
+          break;
+
+        case Segment::TYPE::NOTE:
+          read_notes(phdr);
+          break;
+
+        default:
+          break;
+      }
+    }
+    return ok();
+  }
+
+  private:
+  // Translate a virtual address (e.g. DT_STRTAB) into a file offset
+  result<uint64_t> va2offset(uint64_t va) const {
+    for (const Elf_Phdr& phdr : phdrs_) {
+      if (Segment::TYPE(phdr.p_type) != Segment::TYPE::LOAD) {
+        continue;
+      }
+      if (phdr.p_vaddr <= va && va < (uint64_t)phdr.p_vaddr + phdr.p_filesz) {
+        return phdr.p_offset + (va - phdr.p_vaddr);
+      }
+    }
+    return make_error_code(lief_errors::not_found);
+  }
+
+  void read_dynamic(const Elf_Phdr& phdr) {
+    const size_t size = std::min<uint64_t>(phdr.p_filesz, MAX_SEGMENT_SIZE);
+    const size_t nb_entries = size / sizeof(Elf_Dyn);
+    dynamic_.resize(nb_entries);
+    if (nb_entries == 0 ||
+        !stream_.peek_in(dynamic_.data(), phdr.p_offset, nb_entries * sizeof(Elf_Dyn)))
+    {
+      LIEF_DEBUG("Can't read the dynamic table at 0x{:x}", phdr.p_offset);
+      return;
+    }
+
+    // First pass: locate the string table which can be defined after
+    // the entries that reference it
+    uint64_t strtab = 0;
+    uint64_t strsz = 0;
+    size_t end = 0;
+    for (; end < nb_entries; ++end) {
+      Elf_Dyn& entry = dynamic_[end];
+      if (stream_.should_swap()) {
+        swap_endian(&entry);
+      }
+      const auto tag = DynamicEntry::TAG(entry.d_tag);
+      if (tag == DynamicEntry::TAG::DT_NULL_) {
+        break;
+      }
+      if (tag == DynamicEntry::TAG::STRTAB) {
+        strtab = entry.d_un.d_ptr;
+      } else if (tag == DynamicEntry::TAG::STRSZ) {
+        strsz = entry.d_un.d_val;
+      }
+    }
+
+    auto strtab_offset = va2offset(strtab);
+    if (!strtab_offset) {
+      LIEF_DEBUG("Can't resolve DT_STRTAB: 0x{:x}", strtab);
+      return;
+    }
+
+    const uint64_t strtab_end = strsz > 0 ? *strtab_offset + strsz : stream_.size();
+    auto read_dynstr = [&] (uint64_t offset, std::string& out) {
+      if (!read_string(stream_, *strtab_offset + offset, strtab_end, out)) {
+        LIEF_DEBUG("Can't read the dynamic string at offset 0x{:x}", offset);
+      }
+    };
+
+    // Second pass: resolve the strings
+    for (size_t i = 0; i < end; ++i) {
+      const Elf_Dyn& entry = dynamic_[i];
+      switch (DynamicEntry::TAG(entry.d_tag)) {
+        case DynamicEntry::TAG::NEEDED:
+          read_dynstr(entry.d_un.d_val, info_.needed.emplace_back());
+          break;
+        case DynamicEntry::TAG::SONAME:
+          read_dynstr(entry.d_un.d_val, info_.soname);
+          break;
+        case DynamicEntry::TAG::RPATH:
+          read_dynstr(entry.d_un.d_val, info_.rpath);
+          break;
+        case DynamicEntry::TAG::RUNPATH:
+          read_dynstr(entry.d_un.d_val, info_.runpath);
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  void read_notes(const Elf_Phdr& phdr) {
+    const size_t size = std::min<uint64_t>(phdr.p_filesz, MAX_SEGMENT_SIZE);
+    notes_.resize(size);
+    if (size == 0 || !stream_.peek_in(notes_.data(), phdr.p_offset, size)) {
+      LIEF_DEBUG("Can't read the notes at 0x{:x}", phdr.p_offset);
+      return;
+    }
+
+    const size_t align = phdr.p_align == 8 ? 8 : 4;
+    size_t pos = 0;
+    while (pos + 3 * sizeof(uint32_t) <= size) {
+      const uint32_t namesz = read_u32(pos);
+      const uint32_t descsz = read_u32(pos + sizeof(uint32_t));
+      const uint32_t type   = read_u32(pos + 2 * sizeof(uint32_t));
+
+      const uint64_t name_off = pos + 3 * sizeof(uint32_t);
+      const uint64_t desc_off = align_to(name_off + namesz, align);
+      const uint64_t next     = align_to(desc_off + descsz, align);
+      if (desc_off + descsz > size) {
+        LIEF_DEBUG("Note at 0x{:x} is truncated", phdr.p_offset + pos);
+        return;
+      }
+
+      static constexpr char GNU[] = "GNU";
+      const bool is_gnu = namesz == sizeof(GNU) &&
+                          std::memcmp(notes_.data() + name_off, GNU, sizeof(GNU)) == 0;
+
+      if (is_gnu && type == NT_GNU_BUILD_ID) {
+        info_.build_id.assign(notes_.data() + desc_off,
+                              notes_.data() + desc_off + descsz);
+      } else if (is_gnu && type == NT_GNU_PROPERTY_TYPE_0) {
+        read_properties(desc_off, desc_off + descsz);
+      }
+      pos = next;
+    }
+  }
+
+  // Decode the `pr_type`, `pr_datasz`, `pr_data` entries of a
+  // NT_GNU_PROPERTY_TYPE_0 note
+  void read_properties(uint64_t pos, uint64_t end) {
+    static constexpr size_t PROP_ALIGN = sizeof(uint);
+    while (pos + 2 * sizeof(uint32_t) <= end) {
+      quick_info_t::property_t prop;
+      prop.type = read_u32(pos);
+      const uint32_t datasz = read_u32(pos + sizeof(uint32_t));
+      const uint64_t data = pos + 2 * sizeof(uint32_t);
+      if (data + datasz > end) {
+        return;
+      }
+      if (datasz == sizeof(uint32_t)) {
+        prop.value = read_u32(data);
+      } else if (datasz == sizeof(uint64_t)) {
+        uint64_t value = 0;
+        std::memcpy(&value, notes_.data() + data, sizeof(value));
+        if (stream_.should_swap()) {
+          swap_endian(&value);
+        }
+        prop.value = value;
+      }
+      info_.properties.push_back(prop);
+      pos = align_to(data + datasz, PROP_ALIGN);
+    }
+  }
+
+  uint32_t read_u32(uint64_t pos) const {
+    uint32_t value = 0;
+    std::memcpy(&value, notes_.data() + pos, sizeof(value));
+    if (stream_.should_swap()) {
+      swap_endian(&value);
+    }
+    return value;
+  }
+
+  static uint64_t align_to(uint64_t value, uint64_t align) {
+    return (value + align - 1) & ~(align - 1);
+  }
+
+  BinaryStream& stream_;
+  quick_info_t& info_;
+  std::vector<Elf_Phdr> phdrs_;
+  std::vector<Elf_Dyn> dynamic_;
+  std::vector<uint8_t> notes_;
+};
+
+ok_error_t quick_info(BinaryStream& stream, quick_info_t& info) {
+  info.clear();
+  if (!is_elf(stream)) {
+    return make_error_code(lief_errors::file_format_error);
+  }
+
+  auto ident = stream.peek<Header::identity_t>(0);
+  if (!ident) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  info.cls = Header::CLASS((*ident)[Header::ELI_CLASS]);
+  info.endianness = Header::ELF_DATA((*ident)[Header::ELI_DATA]);
+  if (info.endianness != Header::ELF_DATA::LSB &&
+      info.endianness != Header::ELF_DATA::MSB)
+  {
+    LIEF_DEBUG("Unsupported EI_DATA: {}", (*ident)[Header::ELI_DATA]);
+    return make_error_code(lief_errors::corrupted);
+  }
+
+  ScopedStream scoped(stream, 0);
+  ToggleEndianness endian(stream, info.endianness != host_endianness());
+
+  switch (info.cls) {
+    case Header::CLASS::ELF32:
+      return QuickInfoReader<details::ELF32>(stream, info).read();
+    case Header::CLASS::ELF64:
+      return QuickInfoReader<details::ELF64>(stream, info).read();
+    case Header::CLASS::NONE:
+      break;
+  }
+  LIEF_DEBUG("Unsupported EI_CLASS: {}", (*ident)[Header::ELI_CLASS]);
+  return make_error_code(lief_errors::corrupted);
+}
+
+result<quick_info_t> quick_info(BinaryStream& stream) {
+  quick_info_t info;
+  if (auto is_ok = quick_info(stream, info); !is_ok) {
+    return make_error_code(get_error(is_ok));
+  }
+  return info;
+}
+
+result<quick_info_t> quick_info(const std::string& path) {
+  auto stream = FileStream::from_file(path);
+  if (!stream) {
+    return make_error_code(get_error(stream));
+  }
+  return quick_info(*stream);
+}
+
+}
+}
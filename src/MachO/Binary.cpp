@@ -190,6 +190,16 @@ span<const uint8_t> Binary::get_content_from_virtual_address(
   return {content.data() + offset, static_cast<size_t>(checked_size)};
 }
 
+result<LIEF::Binary::content_region_t>
+  Binary::get_content_region(uint64_t address, LIEF::Binary::VA_TYPES)
+{
+  SegmentCommand* segment = segment_from_virtual_address(address);
+  if (segment == nullptr) {
+    return make_error_code(lief_errors::not_found);
+  }
+  return content_region_t{segment->virtual_address(), segment->writable_content()};
+}
+
 
 uint64_t Binary::entrypoint() const {
   if (const MainCommand* cmd = main_command()) {
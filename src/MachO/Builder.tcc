@@ -55,6 +55,7 @@
 #include "MachO/exports_trie.hpp"
 #include "MachO/ChainedFixup.hpp"
 #include "MachO/ChainedBindingInfoList.hpp"
+#include "string_table.hpp"
 
 #include "internal_utils.hpp"
 
@@ -580,7 +581,7 @@ ok_error_t Builder::build(FunctionStarts& function_starts) {
 
 template<class MACHO_T>
 inline ok_error_t write_symbol(vector_iostream& nlist_table, Symbol& sym,
-                        std::unordered_map<std::string, size_t>& offset_name_map) {
+                        const StringTableBuilder::offsets_t& offset_name_map) {
   using nlist_t = typename MACHO_T::nlist;
   const std::string& name = sym.name();
   const auto it_name = offset_name_map.find(name);
@@ -637,7 +638,7 @@ ok_error_t Builder::build(SymbolCommand& symbol_command) {
 
   std::vector<uint8_t> strtab;
   std::vector<uint8_t> raw_nlist_table;
-  std::unordered_map<std::string, size_t> offset_name_map;
+  StringTableBuilder::offsets_t offset_name_map;
 
   details::symtab_command symtab;
   std::memset(&symtab, 0, sizeof(details::symtab_command));
@@ -664,20 +665,16 @@ ok_error_t Builder::build(SymbolCommand& symbol_command) {
       }
     }
 
-    size_t offset_counter = 1;
-    std::vector<std::string> string_table_opt = optimize(all_syms,
-                                                  [] (Symbol *const &sym) { return sym->name(); },
-                                                  offset_counter, &offset_name_map);
+    // 0 index is reserved (null entry written by the StringTableBuilder)
+    StringTableBuilder string_table;
+    string_table.reserve(all_syms.size());
+    for (const Symbol* sym : all_syms) {
+      string_table.add(sym->name());
+    }
     all_syms.clear();
 
-    // 0 index is reserved
-    vector_iostream raw_symbol_names;
-    raw_symbol_names.write<uint8_t>(0);
-    for (const std::string& name : string_table_opt) {
-      raw_symbol_names.write(name);
-    }
-    raw_symbol_names.align(8);
-    strtab = raw_symbol_names.raw();
+    const size_t saved = string_table.build(strtab, offset_name_map, /*alignment=*/8);
+    LIEF_DEBUG("LC_SYMTAB.strtab: tail merging saved 0x{:x} bytes", saved);
   }
 
   /* 2. Fille the n_list table */ {
@@ -1273,25 +1270,22 @@ ok_error_t Builder::build(DyldChainedFixups& fixups) {
 
 
   // Now build the imports and symbol table
-  vector_iostream string_pool;
+  std::vector<uint8_t> string_pool;
 
   vector_iostream imports;
   vector_iostream imports_addend;
   vector_iostream imports_addend64;
 
-  std::unordered_map<std::string, size_t> offset_name_map;
-  string_pool.write<uint8_t>(0);
-  size_t offset_counter = string_pool.tellp();
-  std::vector<std::string> string_table_optimized = optimize(fixups.internal_bindings_,
-                                  [] (const std::unique_ptr<ChainedBindingInfoList>& bnd) {
-                                    if (const Symbol* s = bnd->symbol()) {
-                                      return s->name();
-                                    }
-                                    return std::string();
-                                  }, offset_counter, &offset_name_map);
-  string_pool.reserve(string_table_optimized.size() * 10);
-  for (const std::string& name : string_table_optimized) {
-    string_pool.write(name);
+  StringTableBuilder::offsets_t offset_name_map;
+  {
+    StringTableBuilder string_table;
+    string_table.reserve(fixups.internal_bindings_.size());
+    for (const std::unique_ptr<ChainedBindingInfoList>& bnd : fixups.internal_bindings_) {
+      if (const Symbol* s = bnd->symbol()) {
+        string_table.add(s->name());
+      }
+    }
+    string_table.build(string_pool, offset_name_map);
   }
 
   const DYLD_CHAINED_FORMAT fmt = fixups.imports_format();
@@ -1434,7 +1428,7 @@ ok_error_t Builder::build(DyldChainedFixups& fixups) {
   hdr = reinterpret_cast<details::dyld_chained_fixups_header*>(lnk_data.raw().data());
   hdr->symbols_offset = lnk_data.size();
   lnk_data
-    .write(string_pool.raw())
+    .write(string_pool)
     .align(sizeof(pin_t));
 
   const std::vector<uint8_t>& raw = lnk_data.raw();
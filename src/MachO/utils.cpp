@@ -75,13 +75,18 @@ bool is_macho(const std::vector<uint8_t>& raw) {
   return false;
 }
 
+bool is_fat(BinaryStream& stream) {
+  if (auto magic_res = magic_from_stream(stream)) {
+    const MACHO_TYPES magic = *magic_res;
+    return magic == MACHO_TYPES::FAT_MAGIC ||
+           magic == MACHO_TYPES::FAT_CIGAM;
+  }
+  return false;
+}
+
 bool is_fat(const std::string& file) {
   if (auto stream = FileStream::from_file(file)) {
-    if (auto magic_res = magic_from_stream(*stream)) {
-      const MACHO_TYPES magic = *magic_res;
-      return magic == MACHO_TYPES::FAT_MAGIC ||
-             magic == MACHO_TYPES::FAT_CIGAM;
-    }
+    return is_fat(*stream);
   }
   return false;
 }
@@ -0,0 +1,90 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <fstream>
+
+#include "MappedFile.hpp"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace LIEF {
+namespace details {
+
+#if !defined(_WIN32)
+std::unique_ptr<MappedFile> MappedFile::open(const std::string& path) {
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  struct stat info;
+  if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+    ::close(fd);
+    return nullptr;
+  }
+
+  std::unique_ptr<MappedFile> file(new MappedFile());
+  file->size_ = static_cast<size_t>(info.st_size);
+  if (file->size_ == 0) {
+    ::close(fd);
+    return file;
+  }
+
+  void* addr = ::mmap(nullptr, file->size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (addr == MAP_FAILED) {
+    return nullptr;
+  }
+  file->data_ = static_cast<const uint8_t*>(addr);
+  file->mapped_ = true;
+  return file;
+}
+
+MappedFile::~MappedFile() {
+  if (mapped_) {
+    ::munmap(const_cast<uint8_t*>(data_), size_);
+  }
+}
+#else
+std::unique_ptr<MappedFile> MappedFile::open(const std::string& path) {
+  std::ifstream ifs(path, std::ios::in | std::ios::binary);
+  if (!ifs) {
+    return nullptr;
+  }
+
+  ifs.seekg(0, std::ios::end);
+  const auto size = static_cast<uint64_t>(ifs.tellg());
+  ifs.seekg(0, std::ios::beg);
+
+  std::unique_ptr<MappedFile> file(new MappedFile());
+  file->buffer_.resize(size);
+  if (!ifs.read(reinterpret_cast<char*>(file->buffer_.data()), size)) {
+    return nullptr;
+  }
+  file->data_ = file->buffer_.data();
+  file->size_ = file->buffer_.size();
+  return file;
+}
+
+MappedFile::~MappedFile() = default;
+#endif
+
+}
+}
@@ -0,0 +1,63 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_MAPPED_FILE_H
+#define LIEF_MAPPED_FILE_H
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "LIEF/span.hpp"
+
+namespace LIEF {
+namespace details {
+
+/// Read-only view over the content of a file.
+///
+/// On POSIX systems, the file is mapped in memory (`mmap`) so that only the
+/// pages that are accessed are read. On the other systems, the file is read
+/// in a buffer.
+class MappedFile {
+  public:
+  /// Return a nullptr if the file can't be opened. Unlike
+  /// VectorStream::from_file, no error is logged.
+  static std::unique_ptr<MappedFile> open(const std::string& path);
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  ~MappedFile();
+
+  span<const uint8_t> content() const {
+    return {data_, size_};
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  private:
+  MappedFile() = default;
+
+  const uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+  bool mapped_ = false;
+  std::vector<uint8_t> buffer_;
+};
+
+}
+}
+#endif
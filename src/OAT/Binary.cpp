@@ -13,7 +13,15 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <atomic>
 #include <fstream>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+
+#include "logging.hpp"
+
+#include "LIEF/BinaryStream/SpanStream.hpp"
 
 #include "LIEF/VDEX/File.hpp"
 #include "LIEF/DEX/File.hpp"
@@ -24,6 +32,10 @@
 #include "LIEF/OAT/Class.hpp"
 #include "LIEF/OAT/Method.hpp"
 #include "LIEF/OAT/DexFile.hpp"
+#include "LIEF/OAT/Parser.hpp"
+
+#include "ELF/DataHandler/Handler.hpp"
+#include "OAT/Structures.hpp"
 
 
 #if defined(LIEF_JSON_SUPPORT)
@@ -34,7 +46,18 @@
 namespace LIEF {
 namespace OAT {
 
-Binary::Binary() {
+struct Binary::classes_state_t {
+  /// Serialize the decoding of the classes (get_class() and decode_classes())
+  std::mutex lock;
+
+  /// Set once all the classes have been decoded. From this point, the
+  /// classes and the methods are no longer modified by the const functions.
+  std::atomic<bool> decoded{false};
+};
+
+Binary::Binary() :
+  classes_state_(std::make_unique<classes_state_t>())
+{
   format_ = LIEF::Binary::FORMATS::OAT;
 }
 
@@ -49,6 +72,9 @@ Header& Binary::header() {
 }
 
 Binary::it_dex_files Binary::dex_files() {
+  // The dex2dex info (used to deoptimize the DEX files) are attached to the
+  // DEX methods when the OAT methods are decoded
+  decode_classes();
   if (vdex_ != nullptr) {
     return vdex_->dex_files_;
   }
@@ -56,6 +82,7 @@ Binary::it_dex_files Binary::dex_files() {
 }
 
 Binary::it_const_dex_files Binary::dex_files() const {
+  decode_classes();
   if (vdex_ != nullptr) {
     return vdex_->dex_files_;
   }
@@ -63,32 +90,70 @@ Binary::it_const_dex_files Binary::dex_files() const {
 }
 
 Binary::it_oat_dex_files Binary::oat_dex_files() {
+  decode_classes();
   return oat_dex_files_;
 }
 
 Binary::it_const_oat_dex_files Binary::oat_dex_files() const {
+  decode_classes();
   return oat_dex_files_;
 }
 
 
 Binary::it_const_classes Binary::classes() const {
+  decode_classes();
   return classes_list_;
 }
 
 Binary::it_classes Binary::classes() {
+  decode_classes();
   return classes_list_;
 }
 
 bool Binary::has_class(const std::string& class_name) const {
-  return classes_.find(DEX::Class::fullname_normalized(class_name)) != std::end(classes_);
+  return get_class(class_name) != nullptr;
 }
 
 const Class* Binary::get_class(const std::string& class_name) const {
-  auto it = classes_.find(DEX::Class::fullname_normalized(class_name));
-  if (it == std::end(classes_)) {
+  const std::string descriptor = DEX::Class::fullname_normalized(class_name);
+  auto find = [&] () -> const Class* {
+    if (auto it = classes_.find(descriptor); it != std::end(classes_)) {
+      return it->second;
+    }
     return nullptr;
+  };
+
+  if (!lazy_classes_ || classes_state_->decoded.load(std::memory_order_acquire)) {
+    return find();
   }
-  return it->second;
+
+  std::lock_guard<std::mutex> lock(classes_state_->lock);
+  if (const Class* cls = find()) {
+    return cls;
+  }
+
+  if (classes_state_->decoded.load(std::memory_order_relaxed)) {
+    return nullptr;
+  }
+
+  for (const std::unique_ptr<DexFile>& oat_dex_file : oat_dex_files_) {
+    const DEX::File* dex_file = oat_dex_file->dex_file();
+    if (dex_file == nullptr) {
+      continue;
+    }
+
+    const DEX::Class* cls = lookup_class(*oat_dex_file, descriptor);
+    if (cls == nullptr) {
+      // The lookup table is missing (OAT < 79) or its hash does not match
+      cls = dex_file->get_class(descriptor);
+    }
+
+    if (cls == nullptr || cls->index() >= oat_dex_file->classes_offsets().size()) {
+      continue;
+    }
+    return decode_class(*oat_dex_file, *cls);
+  }
+  return nullptr;
 }
 
 Class* Binary::get_class(const std::string& class_name) {
@@ -97,6 +162,7 @@ Class* Binary::get_class(const std::string& class_name) {
 
 
 const Class* Binary::get_class(size_t index) const {
+  decode_classes();
   if (index >= classes_.size()) {
     return nullptr;
   }
@@ -117,14 +183,182 @@ Class* Binary::get_class(size_t index) {
 }
 
 Binary::it_const_methods Binary::methods() const {
+  decode_classes();
   return methods_;
 }
 
 Binary::it_methods Binary::methods() {
+  decode_classes();
   return methods_;
 }
 
+const Method* Binary::get_method(const std::string& class_name,
+                                 const std::string& method_name) const
+{
+  const Class* cls = get_class(class_name);
+  if (cls == nullptr) {
+    return nullptr;
+  }
+
+  for (const Method& method : cls->methods()) {
+    if (method.name() == method_name) {
+      return &method;
+    }
+  }
+  return nullptr;
+}
+
+Method* Binary::get_method(const std::string& class_name, const std::string& method_name) {
+  return const_cast<Method*>(static_cast<const Binary*>(this)->get_method(class_name, method_name));
+}
+
+span<const uint8_t> Binary::oat_image() const {
+  return oat_image_;
+}
+
+// Hash used by ART for the type lookup table (ComputeModifiedUtf8Hash)
+static uint32_t modified_utf8_hash(const std::string& str) {
+  uint32_t hash = 0;
+  for (char c : str) {
+    hash = hash * 31 + static_cast<int8_t>(c);
+  }
+  return hash;
+}
+
+// art/runtime/type_lookup_table.h
+const DEX::Class* Binary::lookup_class(const DexFile& oat_dex_file,
+                                       const std::string& descriptor) const
+{
+  using lookup_table_entry_t = details::OAT79_t::lookup_table_entry_t;
+  const DEX::File* dex_file = oat_dex_file.dex_file();
+  const uint32_t table_offset = oat_dex_file.lookup_table_offset();
+  if (dex_file == nullptr || table_offset == 0) {
+    return nullptr;
+  }
+
+  // The table is only generated for DEX files with less than 2^16 classes
+  const uint32_t nb_classes = dex_file->header().nb_classes();
+  if (nb_classes == 0 || nb_classes > std::numeric_limits<uint16_t>::max()) {
+    return nullptr;
+  }
+
+  uint32_t size = 1;
+  while (size < nb_classes) {
+    size <<= 1;
+  }
+  const uint32_t mask = size - 1;
+  const uint32_t hash_mask = static_cast<uint16_t>(~mask);
+
+  SpanStream stream(oat_image());
+  const uint32_t hash = modified_utf8_hash(descriptor);
+  uint32_t pos = hash & mask;
+
+  // A bucket can't have more than `size` entries
+  for (uint32_t i = 0; i < size; ++i) {
+    auto entry = stream.peek<lookup_table_entry_t>(table_offset + pos * sizeof(lookup_table_entry_t));
+    if (!entry || entry->str_offset == 0) {
+      return nullptr;
+    }
+
+    if ((hash & hash_mask) == (entry->data & hash_mask)) {
+      const DEX::Class* cls = dex_file->get_class(entry->data & mask);
+      if (cls != nullptr && cls->fullname() == descriptor) {
+        return cls;
+      }
+    }
+
+    if (entry->next_pos_delta == 0) {
+      return nullptr;
+    }
+    pos = (pos + entry->next_pos_delta) & mask;
+  }
+  return nullptr;
+}
+
+Class* Binary::decode_class(const DexFile& oat_dex_file, const DEX::Class& cls) const {
+  const uint32_t offset = oat_dex_file.classes_offsets()[cls.index()];
+  std::unique_ptr<Class> oat_class = Parser::parse_oat_class(*this, cls, offset);
+  if (oat_class == nullptr) {
+    LIEF_DEBUG("Can't decode the OAT class {} at 0x{:x}", cls.fullname(), offset);
+    return nullptr;
+  }
+  Class* ptr = oat_class.get();
+  classes_.emplace(ptr->fullname(), ptr);
+  classes_list_.push_back(std::move(oat_class));
+  return ptr;
+}
+
+void Binary::decode_classes() const {
+  if (!lazy_classes_ || classes_state_->decoded.load(std::memory_order_acquire)) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(classes_state_->lock);
+  if (classes_state_->decoded.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  LIEF_DEBUG("Decoding the OAT classes");
+
+  // Keep the order of the DEX files for the classes (and the methods) that
+  // have already been decoded by get_class()
+  std::unordered_map<const DEX::Class*, std::unique_ptr<Class>> decoded;
+  std::unordered_map<const Method*, std::unique_ptr<Method>> decoded_methods;
+  for (std::unique_ptr<Class>& cls : classes_list_) {
+    decoded.emplace(cls->dex_class(), std::move(cls));
+  }
+  for (std::unique_ptr<Method>& method : methods_) {
+    decoded_methods.emplace(method.get(), std::move(method));
+  }
+  classes_list_.clear();
+  methods_.clear();
+  classes_.clear();
+
+  for (size_t dex_idx = 0; dex_idx < oat_dex_files_.size(); ++dex_idx) {
+    const DexFile& oat_dex_file = *oat_dex_files_[dex_idx];
+    const DEX::File* dex_file = oat_dex_file.dex_file();
+    if (dex_file == nullptr) {
+      LIEF_ERR("Can't find the original DEX File associated with the OAT DEX File #{}", dex_idx);
+      continue;
+    }
+
+    const uint32_t nb_classes = dex_file->header().nb_classes();
+    LIEF_DEBUG("Dealing with DexFile #{:d} (#classes: {:d})", dex_idx, nb_classes);
+
+    for (size_t class_idx = 0; class_idx < nb_classes; ++class_idx) {
+      const DEX::Class* cls = dex_file->get_class(class_idx);
+      if (cls == nullptr) {
+        LIEF_ERR("Can't find the class at index #{}", class_idx);
+        continue;
+      }
+      if (cls->index() >= oat_dex_file.classes_offsets().size()) {
+        LIEF_WARN("cls.index() is not valid");
+        continue;
+      }
+
+      auto it = decoded.find(cls);
+      if (it == decoded.end()) {
+        decode_class(oat_dex_file, *cls);
+        continue;
+      }
+
+      Class* oat_class = it->second.get();
+      for (Method& method : oat_class->methods()) {
+        auto it_method = decoded_methods.find(&method);
+        if (it_method != decoded_methods.end()) {
+          methods_.push_back(std::move(it_method->second));
+        }
+      }
+      classes_.emplace(oat_class->fullname(), oat_class);
+      classes_list_.push_back(std::move(it->second));
+    }
+  }
+  classes_state_->decoded.store(true, std::memory_order_release);
+}
+
 Binary::dex2dex_info_t Binary::dex2dex_info() const {
+  // The dex2dex info are attached to the DEX methods by the OAT methods
+  decode_classes();
   dex2dex_info_t info;
 
   for (const DEX::File& dex_file : dex_files()) {
@@ -136,6 +370,7 @@ Binary::dex2dex_info_t Binary::dex2dex_info() const {
 std::string Binary::dex2dex_json_info() {
 
 #if defined(LIEF_JSON_SUPPORT)
+  decode_classes();
   json mapping = json::object();
 
   for (const DEX::File& dex_file : dex_files()) {
@@ -150,11 +385,6 @@ std::string Binary::dex2dex_json_info() {
 
 }
 
-void Binary::add_class(std::unique_ptr<Class> cls) {
-  classes_.emplace(cls->fullname(), cls.get());
-  classes_list_.push_back(std::move(cls));
-}
-
 void Binary::accept(Visitor& visitor) const {
   visitor.visit(*this);
 }
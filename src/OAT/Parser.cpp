@@ -16,8 +16,11 @@
 
 #include "logging.hpp"
 
+#include "LIEF/BinaryStream/SpanStream.hpp"
 #include "LIEF/BinaryStream/VectorStream.hpp"
 
+#include "LIEF/ELF/Symbol.hpp"
+
 #include "LIEF/OAT/Parser.hpp"
 #include "LIEF/OAT/Binary.hpp"
 #include "LIEF/OAT/utils.hpp"
@@ -26,6 +29,7 @@
 #include "LIEF/VDEX/Parser.hpp"
 
 #include "OAT/Structures.hpp"
+#include "ELF/DataHandler/Handler.hpp"
 
 #include "Parser.tcc"
 
@@ -139,5 +143,89 @@ void Parser::init() {
 
 }
 
+void Parser::parse_oat_image() {
+  Binary& oat = oat_binary();
+  const auto* oat_data = oat.get_dynamic_symbol("oatdata");
+  if (oat_data == nullptr) {
+    LIEF_ERR("Can't find the 'oatdata' symbol");
+    stream_ = std::make_unique<SpanStream>(span<const uint8_t>{});
+    return;
+  }
+
+  data_address_ = oat_data->value();
+  data_size_    = oat_data->size();
+
+  uint64_t image_size = data_size_;
+  const auto* oat_exec = oat.get_dynamic_symbol("oatexec");
+  if (oat_exec != nullptr) {
+    exec_start_ = oat_exec->value();
+    exec_size_  = oat_exec->size();
+    if (exec_start_ >= data_address_ + data_size_) {
+      image_size = exec_start_ + exec_size_ - data_address_;
+    }
+  }
+
+  // oatdata and oatexec are usually located at the same relative offsets in
+  // the file such as the image can be copied from the ELF's content in one
+  // go. The image is owned by the OAT binary since the classes are decoded
+  // lazily: the ELF's content might have been modified in the meantime.
+  const std::vector<uint8_t>& content = oat.datahandler_->content();
+  auto data_offset = oat.virtual_address_to_offset(data_address_);
+  auto exec_offset = oat.virtual_address_to_offset(exec_start_);
+  const bool is_contiguous =
+    data_offset && *data_offset <= content.size() &&
+    image_size <= content.size() - *data_offset &&
+    (oat_exec == nullptr || (exec_offset && *exec_offset - *data_offset == exec_start_ - data_address_));
+
+  if (is_contiguous) {
+    LIEF_DEBUG("OAT image: [0x{:x}, 0x{:x}]", *data_offset, *data_offset + image_size);
+    const auto it_start = content.begin() + *data_offset;
+    oat.oat_image_.assign(it_start, it_start + image_size);
+    stream_ = std::make_unique<SpanStream>(oat.oat_image());
+    return;
+  }
+
+  std::vector<uint8_t> raw_oat;
+  span<const uint8_t> raw_data = oat.get_content_from_virtual_address(data_address_, data_size_);
+  raw_oat.reserve(image_size);
+  std::copy(std::begin(raw_data), std::end(raw_data), std::back_inserter(raw_oat));
+
+  if (oat_exec != nullptr) {
+    span<const uint8_t> raw_oatexec = oat.get_content_from_virtual_address(exec_start_, exec_size_);
+    uint32_t padding = exec_start_ - (data_address_ + data_size_);
+    raw_oat.insert(std::end(raw_oat), padding, 0);
+    std::copy(std::begin(raw_oatexec), std::end(raw_oatexec), std::back_inserter(raw_oat));
+  }
+
+  uint32_t padding = align(raw_oat.size(), sizeof(uint32_t) * 8) - raw_oat.size();
+  raw_oat.insert(std::end(raw_oat), padding, 0);
+
+  oat.oat_image_ = std::move(raw_oat);
+  stream_ = std::make_unique<SpanStream>(oat.oat_image());
+}
+
+std::unique_ptr<Class> Parser::parse_oat_class(const Binary& oat, const DEX::Class& dex_class,
+                                               uint32_t offset)
+{
+  const oat_version_t version = oat.header_.version();
+  if (version <= details::OAT_064::oat_version) {
+    return parse_oat_class<details::OAT64_t>(oat, dex_class, offset);
+  }
+
+  if (version <= details::OAT_088::oat_version) {
+    return parse_oat_class<details::OAT79_t>(oat, dex_class, offset);
+  }
+
+  if (version <= details::OAT_124::oat_version) {
+    return parse_oat_class<details::OAT124_t>(oat, dex_class, offset);
+  }
+
+  if (version <= details::OAT_131::oat_version) {
+    return parse_oat_class<details::OAT131_t>(oat, dex_class, offset);
+  }
+
+  return parse_oat_class<details::OAT138_t>(oat, dex_class, offset);
+}
+
 } // namespace OAT
 } // namespace LIEF
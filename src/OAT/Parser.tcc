@@ -19,6 +19,7 @@
 #include "logging.hpp"
 
 #include "LIEF/utils.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
 
 #include "LIEF/DEX.hpp"
 #include "LIEF/ELF/Symbol.hpp"
@@ -56,45 +57,7 @@ void Parser::parse_oat_classes<details::OAT88_t>() {
 // ============
 template<>
 void Parser::parse_binary<details::OAT64_t>() {
-
-  std::vector<uint8_t> raw_oat;
-  auto& oat = oat_binary();
-  const auto* oat_data = oat.get_symbol("oatdata")->as<ELF::Symbol>();
-  if (oat_data != nullptr) {
-    raw_oat.reserve(oat_data->size());
-
-    span<const uint8_t> raw_data =
-      oat.get_content_from_virtual_address(oat_data->value(), oat_data->size());
-
-    std::copy(std::begin(raw_data), std::end(raw_data),
-              std::back_inserter(raw_oat));
-
-    data_address_ = oat_data->value();
-    data_size_    = oat_data->size();
-  }
-
-  const auto* oat_exec = oat.get_symbol("oatexec")->as<ELF::Symbol>();
-  if (oat_exec != nullptr) {
-
-    exec_start_ = oat_exec->value();
-    exec_size_  = oat_exec->size();
-
-    span<const uint8_t> raw_oatexec =
-      oat.get_content_from_virtual_address(oat_exec->value(), oat_exec->size());
-
-    uint32_t padding = exec_start_ - (data_address_ + data_size_);
-
-    raw_oat.reserve(raw_oat.size() + oat_exec->size() + padding);
-    raw_oat.insert(std::end(raw_oat), padding, 0);
-
-    std::copy(std::begin(raw_oatexec), std::end(raw_oatexec),
-              std::back_inserter(raw_oat));
-  }
-
-  uint32_t padding = align(raw_oat.size(), sizeof(uint32_t) * 8) - raw_oat.size();
-  raw_oat.insert(std::end(raw_oat), padding, 0);
-
-  stream_ = std::make_unique<VectorStream>(std::move(raw_oat));
+  parse_oat_image();
 
   parse_header<details::OAT64_t>();
   parse_dex_files<details::OAT64_t>();
@@ -103,45 +66,7 @@ void Parser::parse_binary<details::OAT64_t>() {
 
 template<>
 void Parser::parse_binary<details::OAT79_t>() {
-
-  std::vector<uint8_t> raw_oat;
-  auto& oat = oat_binary();
-  const auto* oat_data = oat.get_symbol("oatdata")->as<ELF::Symbol>();
-  if (oat_data != nullptr) {
-    raw_oat.reserve(oat_data->size());
-
-    span<const uint8_t> raw_data =
-      oat.get_content_from_virtual_address(oat_data->value(), oat_data->size());
-    std::move(std::begin(raw_data), std::end(raw_data),
-              std::back_inserter(raw_oat));
-
-    data_address_ = oat_data->value();
-    data_size_    = oat_data->size();
-  }
-
-  const auto* oat_exec = oat.get_symbol("oatexec")->as<ELF::Symbol>();
-  if (oat_exec != nullptr) {
-
-    exec_start_ = oat_exec->value();
-    exec_size_  = oat_exec->size();
-
-    span<const uint8_t> raw_oatexec =
-      oat.get_content_from_virtual_address(oat_exec->value(), oat_exec->size());
-
-    uint32_t padding = exec_start_ - (data_address_ + data_size_);
-
-    raw_oat.reserve(raw_oat.size() + oat_exec->size() + padding);
-    raw_oat.insert(std::end(raw_oat), padding, 0);
-
-    std::copy(std::begin(raw_oatexec), std::end(raw_oatexec),
-              std::back_inserter(raw_oat));
-  }
-
-  uint32_t padding = align(raw_oat.size(), sizeof(uint32_t) * 8) - raw_oat.size();
-  raw_oat.insert(std::end(raw_oat), padding, 0);
-
-  stream_ = std::make_unique<VectorStream>(std::move(raw_oat));
-
+  parse_oat_image();
 
   parse_header<details::OAT79_t>();
   parse_dex_files<details::OAT79_t>();
@@ -152,43 +77,7 @@ void Parser::parse_binary<details::OAT79_t>() {
 
 template<>
 void Parser::parse_binary<details::OAT88_t>() {
-  std::vector<uint8_t> raw_oat;
-  auto& oat = oat_binary();
-  const auto* oat_data = oat.get_symbol("oatdata")->as<ELF::Symbol>();
-  if (oat_data != nullptr) {
-    raw_oat.reserve(oat_data->size());
-
-    span<const uint8_t> raw_data =
-      oat.get_content_from_virtual_address(oat_data->value(), oat_data->size());
-    std::copy(std::begin(raw_data), std::end(raw_data),
-              std::back_inserter(raw_oat));
-
-    data_address_ = oat_data->value();
-    data_size_    = oat_data->size();
-  }
-
-  const auto* oat_exec = oat.get_symbol("oatexec")->as<ELF::Symbol>();
-  if (oat_exec != nullptr) {
-    exec_start_ = oat_exec->value();
-    exec_size_  = oat_exec->size();
-
-    span<const uint8_t> raw_oatexec =
-      oat.get_content_from_virtual_address(oat_exec->value(), oat_exec->size());
-
-    uint32_t padding = exec_start_ - (data_address_ + data_size_);
-
-    raw_oat.reserve(raw_oat.size() + oat_exec->size() + padding);
-    raw_oat.insert(std::end(raw_oat), padding, 0);
-
-    std::copy(std::begin(raw_oatexec), std::end(raw_oatexec),
-              std::back_inserter(raw_oat));
-  }
-
-  uint32_t padding = align(raw_oat.size(), sizeof(uint32_t) * 8) - raw_oat.size();
-  raw_oat.insert(std::end(raw_oat), padding, 0);
-
-  stream_ = std::make_unique<VectorStream>(std::move(raw_oat));
-
+  parse_oat_image();
 
   parse_header<details::OAT88_t>();
   parse_dex_files<details::OAT88_t>();
@@ -199,42 +88,7 @@ void Parser::parse_binary<details::OAT88_t>() {
 
 template<>
 void Parser::parse_binary<details::OAT124_t>() {
-  std::vector<uint8_t> raw_oat;
-  auto& oat = oat_binary();
-  const auto* oat_data = oat.get_symbol("oatdata")->as<ELF::Symbol>();
-  if (oat_data != nullptr) {
-    raw_oat.reserve(oat_data->size());
-
-    span<const uint8_t> raw_data =
-      oat.get_content_from_virtual_address(oat_data->value(), oat_data->size());
-    std::copy(std::begin(raw_data), std::end(raw_data),
-              std::back_inserter(raw_oat));
-
-    data_address_ = oat_data->value();
-    data_size_    = oat_data->size();
-  }
-
-  const auto* oat_exec = oat.get_symbol("oatexec")->as<ELF::Symbol>();
-  if (oat_exec != nullptr) {
-    exec_start_ = oat_exec->value();
-    exec_size_  = oat_exec->size();
-
-    span<const uint8_t> raw_oatexec =
-      oat.get_content_from_virtual_address(oat_exec->value(), oat_exec->size());
-
-    uint32_t padding = exec_start_ - (data_address_ + data_size_);
-
-    raw_oat.reserve(raw_oat.size() + oat_exec->size() + padding);
-    raw_oat.insert(std::end(raw_oat), padding, 0);
-
-    std::copy(std::begin(raw_oatexec), std::end(raw_oatexec),
-              std::back_inserter(raw_oat));
-  }
-
-  uint32_t padding = align(raw_oat.size(), sizeof(uint32_t) * 8) - raw_oat.size();
-  raw_oat.insert(std::end(raw_oat), padding, 0);
-
-  stream_ = std::make_unique<VectorStream>(std::move(raw_oat));
+  parse_oat_image();
 
   parse_header<details::OAT124_t>();
   parse_dex_files<details::OAT124_t>();
@@ -246,42 +100,7 @@ void Parser::parse_binary<details::OAT124_t>() {
 
 template<>
 void Parser::parse_binary<details::OAT131_t>() {
-  std::vector<uint8_t> raw_oat;
-  auto& oat = oat_binary();
-  const auto* oat_data = oat.get_symbol("oatdata")->as<ELF::Symbol>();
-  if (oat_data != nullptr) {
-    raw_oat.reserve(oat_data->size());
-
-    span<const uint8_t> raw_data =
-      oat.get_content_from_virtual_address(oat_data->value(), oat_data->size());
-    std::copy(std::begin(raw_data), std::end(raw_data),
-              std::back_inserter(raw_oat));
-
-    data_address_ = oat_data->value();
-    data_size_    = oat_data->size();
-  }
-
-  const auto* oat_exec = oat.get_symbol("oatexec")->as<ELF::Symbol>();
-  if (oat_exec != nullptr) {
-    exec_start_ = oat_exec->value();
-    exec_size_  = oat_exec->size();
-
-    span<const uint8_t> raw_oatexec =
-      oat.get_content_from_virtual_address(oat_exec->value(), oat_exec->size());
-
-    uint32_t padding = exec_start_ - (data_address_ + data_size_);
-
-    raw_oat.reserve(raw_oat.size() + oat_exec->size() + padding);
-    raw_oat.insert(std::end(raw_oat), padding, 0);
-
-    std::copy(std::begin(raw_oatexec), std::end(raw_oatexec),
-              std::back_inserter(raw_oat));
-  }
-
-  uint32_t padding = align(raw_oat.size(), sizeof(uint32_t) * 8) - raw_oat.size();
-  raw_oat.insert(std::end(raw_oat), padding, 0);
-
-  stream_ = std::make_unique<VectorStream>(std::move(raw_oat));
+  parse_oat_image();
 
   parse_header<details::OAT131_t>();
   parse_dex_files<details::OAT131_t>();
@@ -351,126 +170,108 @@ void Parser::parse_header_keys() {
 
 template<typename OAT_T>
 void Parser::parse_type_lookup_table() {
-  //using oat_header           = typename OAT_T::oat_header;
-  //using dex_file             = typename OAT_T::dex_file;
-  //using lookup_table_entry_t = typename OAT_T::lookup_table_entry_t;
-
-
-  //VLOG(VDEBUG) << "Parsing TypeLookupTable";
-  //for (size_t i = 0; i < oat.dex_files_.size(); ++i) {
-
-  //  const DexFile* oat_dex_file = oat.oat_dex_files_[i];
-  //  uint64_t tlt_offset = oat_dex_file->lookup_table_offset();
-
-  //  VLOG(VDEBUG) << "Getting TypeLookupTable for DexFile "
-  //                << oat_dex_file->location()
-  //                << " (#" << std::dec << oat_dex_file->dex_file().header().nb_classes() << ")";
-  //  for (size_t j = 0; j < oat_dex_file->dex_file().header().nb_classes();) {
-  //    const lookup_table_entry_t* entry = reinterpret_cast<const lookup_table_entry_t*>(stream_->read(tlt_offset, sizeof(lookup_table_entry_t)));
-
-  //    if (entry->str_offset) {
-  //      uint64_t string_offset = oat_dex_file->dex_offset() + entry->str_offset;
-  //      std::pair<uint64_t, uint64_t> len_size = stream_->read_uleb128(string_offset);
-  //      string_offset += len_size.second;
-  //      std::string class_name = stream_->get_string(string_offset);
-  //      //VLOG(VDEBUG) << "    " << "#" << std::dec << j << " " << class_name;
-  //      ++j;
-  //    }
-  //    tlt_offset += sizeof(lookup_table_entry_t);
-  //  }
-  //}
-}
-
-
-template<typename OAT_T>
-void Parser::parse_oat_classes() {
-  LIEF_DEBUG("Parsing OAT Classes");
+  using lookup_table_entry_t = typename OAT_T::lookup_table_entry_t;
   auto& oat = oat_binary();
-  for (size_t dex_idx = 0; dex_idx < oat.oat_dex_files_.size(); ++dex_idx) {
-    std::unique_ptr<DexFile>& oat_dex_file = oat.oat_dex_files_[dex_idx];
-    const DEX::File* dex_file_ptr = oat_dex_file->dex_file();
-    if (dex_file_ptr == nullptr) {
-      LIEF_ERR("Can't find the original DEX File associated with the OAT DEX File #{}", dex_idx);
+
+  // The tables are used by Binary::get_class() to resolve the classes
+  // on demand. We only check that they are consistent.
+  LIEF_DEBUG("Parsing TypeLookupTable");
+  for (const std::unique_ptr<DexFile>& oat_dex_file : oat.oat_dex_files_) {
+    const DEX::File* dex_file = oat_dex_file->dex_file();
+    const uint32_t offset = oat_dex_file->lookup_table_offset();
+    if (dex_file == nullptr || offset == 0) {
       continue;
     }
 
-    const DEX::File& dex_file = *dex_file_ptr;
-
-    const std::vector<uint32_t>& classes_offsets = oat_dex_file->classes_offsets();
-    uint32_t nb_classes = dex_file.header().nb_classes();
-    LIEF_DEBUG("Dealing with DexFile #{:d} (#classes: {:d})", dex_idx, nb_classes);
+    const uint32_t nb_classes = dex_file->header().nb_classes();
+    uint64_t nb_entries = 1;
+    while (nb_entries < nb_classes) {
+      nb_entries <<= 1;
+    }
 
-    for (size_t class_idx = 0; class_idx < nb_classes; ++class_idx) {
-      const DEX::Class* cls = dex_file.get_class(class_idx);
-      if (cls == nullptr) {
-        LIEF_ERR("Can't find the class at index #{}", class_idx);
-        continue;
-      }
-      if (cls->index() >= classes_offsets.size()) {
-        LIEF_WARN("cls.index() is not valid");
-        continue;
-      }
-      uint32_t oat_class_offset = classes_offsets[cls->index()];
-      stream_->setpos(oat_class_offset);
+    LIEF_DEBUG("TypeLookupTable for {} at 0x{:x} (#{} entries)",
+               oat_dex_file->location(), offset, nb_entries);
 
-      // OAT Status
-      auto res_status  = stream_->read<int16_t>();
-      if (!res_status) {
-        break;
-      }
-      auto status = static_cast<OAT_CLASS_STATUS>(*res_status);
+    const auto* entries = stream_->peek_array<lookup_table_entry_t>(offset, nb_entries);
+    if (entries == nullptr) {
+      LIEF_WARN("The TypeLookupTable of {} is corrupted", oat_dex_file->location());
+    }
+  }
+}
 
-      // OAT Type
-      auto res_type = stream_->read<int16_t>();
-      if (!res_type) {
-        break;
-      }
 
-      auto type = static_cast<OAT_CLASS_TYPES>(*res_type);
+template<typename OAT_T>
+void Parser::parse_oat_classes() {
+  auto& oat = oat_binary();
+  // The OAT classes and their methods are decoded on demand by
+  // Binary::get_class() and Binary::classes()
+  LIEF_DEBUG("OAT Classes will be decoded lazily");
+  oat.lazy_classes_ = true;
+}
 
-      // Bitmap (if type is "some compiled")
-      uint32_t method_bitmap_size = 0;
-      std::vector<uint32_t> bitmap;
+template<typename OAT_T>
+std::unique_ptr<Class> Parser::parse_oat_class(const Binary& oat, const DEX::Class& cls,
+                                               uint32_t offset)
+{
+  SpanStream stream(oat.oat_image());
+  stream.setpos(offset);
+
+  // OAT Status
+  auto res_status = stream.read<int16_t>();
+  if (!res_status) {
+    return nullptr;
+  }
+  auto status = static_cast<OAT_CLASS_STATUS>(*res_status);
 
-      if (type == OAT_CLASS_TYPES::OAT_CLASS_SOME_COMPILED) {
-        if (auto res = stream_->read<uint32_t>()) {
-          method_bitmap_size = *res;
-        } else {
-          break;
-        }
-        const uint32_t nb_entries = method_bitmap_size / sizeof(uint32_t);
+  // OAT Type
+  auto res_type = stream.read<int16_t>();
+  if (!res_type) {
+    return nullptr;
+  }
 
-        const auto* raw = stream_->read_array<uint32_t>(nb_entries);
-        if (raw != nullptr) {
-          bitmap = {raw, raw + nb_entries};
-        }
-      }
+  auto type = static_cast<OAT_CLASS_TYPES>(*res_type);
 
-      auto oat_class = std::make_unique<Class>(status, type, const_cast<DEX::Class*>(cls), bitmap);
+  // Bitmap (if type is "some compiled")
+  uint32_t method_bitmap_size = 0;
+  std::vector<uint32_t> bitmap;
 
-      Class& oat_cls_ref = *oat_class;
-      oat.add_class(std::move(oat_class));
+  if (type == OAT_CLASS_TYPES::OAT_CLASS_SOME_COMPILED) {
+    if (auto res = stream.read<uint32_t>()) {
+      method_bitmap_size = *res;
+    } else {
+      return nullptr;
+    }
+    const uint32_t nb_entries = method_bitmap_size / sizeof(uint32_t);
 
-      // Methods Offsets
-      const uint64_t method_offsets = stream_->pos();
-      parse_oat_methods<OAT_T>(method_offsets, oat_cls_ref, *cls);
+    const auto* raw = stream.read_array<uint32_t>(nb_entries);
+    if (raw != nullptr) {
+      bitmap = {raw, raw + nb_entries};
     }
   }
+
+  auto oat_class = std::make_unique<Class>(status, type, const_cast<DEX::Class*>(&cls), bitmap);
+
+  // Methods Offsets
+  const uint64_t method_offsets = stream.pos();
+  parse_oat_methods<OAT_T>(oat, stream, method_offsets, *oat_class, cls);
+  return oat_class;
 }
 
 template<typename OAT_T>
-void Parser::parse_oat_methods(uint64_t methods_offsets, Class& clazz, const DEX::Class& dex_class) {
+void Parser::parse_oat_methods(const Binary& oat, BinaryStream& stream,
+                               uint64_t methods_offsets, Class& clazz,
+                               const DEX::Class& dex_class)
+{
   using oat_quick_method_header = typename OAT_T::oat_quick_method_header;
   DEX::Class::it_const_methods methods = dex_class.methods();
 
-  auto& oat = oat_binary();
   for (const DEX::Method& method : methods) {
     if (!clazz.is_quickened(method)) {
       continue;
     }
 
     uint32_t computed_index = clazz.method_offsets_index(method);
-    auto code_off = stream_->peek<uint32_t>(methods_offsets + computed_index * sizeof(uint32_t));
+    auto code_off = stream.peek<uint32_t>(methods_offsets + computed_index * sizeof(uint32_t));
     if (!code_off) {
       break;
     }
@@ -479,7 +280,7 @@ void Parser::parse_oat_methods(uint64_t methods_offsets, Class& clazz, const DEX
     uint32_t quick_method_header_off = *code_off - sizeof(oat_quick_method_header);
     quick_method_header_off &= ~1u;
 
-    const auto res_quick_header = stream_->peek<oat_quick_method_header>(quick_method_header_off);
+    const auto res_quick_header = stream.peek<oat_quick_method_header>(quick_method_header_off);
     if (!res_quick_header) {
       break;
     }
@@ -492,7 +293,7 @@ void Parser::parse_oat_methods(uint64_t methods_offsets, Class& clazz, const DEX
 
     if (quick_header.code_size > 0) {
 
-      const auto* code = stream_->peek_array<uint8_t>(*code_off, quick_header.code_size);
+      const auto* code = stream.peek_array<uint8_t>(*code_off, quick_header.code_size);
       if (code != nullptr) {
         oat_method->quick_code_ = {code, code + quick_header.code_size};
       }
@@ -504,13 +305,13 @@ void Parser::parse_oat_methods(uint64_t methods_offsets, Class& clazz, const DEX
 
     // Quickened with "dex2dex"
     if (quick_header.code_size == 0 && vmap_table_offset > 0) {
-      stream_->setpos(vmap_table_offset);
+      stream.setpos(vmap_table_offset);
 
       for (size_t pc = 0, round = 0; pc < method.bytecode().size(); ++round) {
-        if (stream_->pos() >= stream_->size()) {
+        if (stream.pos() >= stream.size()) {
           break;
         }
-        auto res_new_pc = stream_->read_uleb128();
+        auto res_new_pc = stream.read_uleb128();
         if (!res_new_pc) {
           break;
         }
@@ -523,10 +324,10 @@ void Parser::parse_oat_methods(uint64_t methods_offsets, Class& clazz, const DEX
         pc = new_pc;
 
 
-        if (stream_->pos() >= stream_->size()) {
+        if (stream.pos() >= stream.size()) {
           break;
         }
-        auto res_index = stream_->read_uleb128();
+        auto res_index = stream.read_uleb128();
         if (!res_index) {
           break;
         }
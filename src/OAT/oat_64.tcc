@@ -93,6 +93,10 @@ void Parser::parse_dex_files<details::OAT64_t>() {
   }
 
 
+  // Collect views on the embedded DEX files so that they can be parsed
+  // concurrently by DEX::Parser::parse_all()
+  std::vector<span<const uint8_t>> dex_files;
+  std::vector<std::string> names;
   for (size_t i = 0; i < nb_dex_files; ++i) {
     if (i >= oat.oat_dex_files_.size()) {
       LIEF_WARN("DEX file #{} is out of bound", i);
@@ -106,13 +110,10 @@ void Parser::parse_dex_files<details::OAT64_t>() {
     if (!res_hdr) {
       break;
     }
-    const auto hdr = *res_hdr;
 
-    std::vector<uint8_t> data_v;
-    const auto* data = stream_->peek_array<uint8_t>(offset, hdr.file_size);
-
-    if (data != nullptr) {
-      data_v = {data, data + hdr.file_size};
+    span<const uint8_t> raw;
+    if (const auto* data = stream_->peek_array<uint8_t>(offset, res_hdr->file_size)) {
+      raw = {data, res_hdr->file_size};
     }
 
     std::string name = "classes";
@@ -121,15 +122,22 @@ void Parser::parse_dex_files<details::OAT64_t>() {
     }
     name += ".dex";
 
+    dex_files.push_back(raw);
+    names.push_back(std::move(name));
+  }
+
+  std::vector<std::unique_ptr<DEX::File>> parsed = DEX::Parser::parse_all(dex_files, names);
+  for (size_t i = 0; i < parsed.size(); ++i) {
     std::unique_ptr<DexFile>& oat_dex_file = oat.oat_dex_files_[i];
-    if (DEX::is_dex(data_v)) {
-      std::unique_ptr<DEX::File> dexfile = DEX::Parser::parse(std::move(data_v), name);
-      dexfile->location(oat_dex_file->location());
-      oat_dex_file->dex_file_ = dexfile.get();
-      oat.dex_files_.push_back(std::move(dexfile));
-    } else {
-      LIEF_WARN("{} ({}) at  0x{:x} is not a DEX file", name, oat_dex_file->location(), stream_->pos());
+    std::unique_ptr<DEX::File>& dexfile = parsed[i];
+    if (dexfile == nullptr) {
+      LIEF_WARN("{} ({}) at 0x{:x} is not a DEX file", names[i],
+                oat_dex_file->location(), oat_dex_file->dex_offset());
+      continue;
     }
+    dexfile->location(oat_dex_file->location());
+    oat_dex_file->dex_file_ = dexfile.get();
+    oat.dex_files_.push_back(std::move(dexfile));
   }
 }
 
@@ -95,6 +95,10 @@ void Parser::parse_dex_files<details::OAT79_t>() {
     oat.oat_dex_files_.push_back(std::move(dex_file));
   }
 
+  // Collect views on the embedded DEX files so that they can be parsed
+  // concurrently by DEX::Parser::parse_all()
+  std::vector<span<const uint8_t>> dex_files;
+  std::vector<std::string> names;
   for (size_t i = 0; i < nb_dex_files; ++i) {
     if (i >= oat.oat_dex_files_.size()) {
       LIEF_WARN("DEX file #{} is out of bound", i);
@@ -104,16 +108,14 @@ void Parser::parse_dex_files<details::OAT79_t>() {
 
     LIEF_DEBUG("Dealing with DEX file #{:d} at offset 0x{:x}", i, offset);
 
-    const auto res_dex_hdr = stream_->peek<dex35_header_t>(offset);
-    if (!res_dex_hdr) {
+    const auto res_hdr = stream_->peek<dex35_header_t>(offset);
+    if (!res_hdr) {
       break;
     }
-    const auto dex_hdr = *res_dex_hdr;
 
-    std::vector<uint8_t> data_v;
-    const auto* data = stream_->peek_array<uint8_t>(offset, dex_hdr.file_size);
-    if (data != nullptr) {
-      data_v = {data, data + dex_hdr.file_size};
+    span<const uint8_t> raw;
+    if (const auto* data = stream_->peek_array<uint8_t>(offset, res_hdr->file_size)) {
+      raw = {data, res_hdr->file_size};
     }
 
     std::string name = "classes";
@@ -122,27 +124,34 @@ void Parser::parse_dex_files<details::OAT79_t>() {
     }
     name += ".dex";
 
+    dex_files.push_back(raw);
+    names.push_back(std::move(name));
+  }
+
+  std::vector<std::unique_ptr<DEX::File>> parsed = DEX::Parser::parse_all(dex_files, names);
+  for (size_t i = 0; i < parsed.size(); ++i) {
     std::unique_ptr<DexFile>& oat_dex_file = oat.oat_dex_files_[i];
-    if (DEX::is_dex(data_v)) {
-      std::unique_ptr<DEX::File> dexfile = DEX::Parser::parse(std::move(data_v), name);
-      dexfile->location(oat_dex_file->location());
-      const uint32_t nb_classes = dexfile->header().nb_classes();
-
-      oat_dex_file->dex_file_ = dexfile.get();
-      oat.dex_files_.push_back(std::move(dexfile));
-
-      uint32_t classes_offset = classes_offsets_offset[i];
-      oat_dex_file->classes_offsets_.reserve(nb_classes);
-
-      for (size_t cls_idx = 0; cls_idx < nb_classes; ++cls_idx) {
-        if (auto off = stream_->peek<uint32_t>(classes_offset + cls_idx * sizeof(uint32_t))) {
-          oat_dex_file->classes_offsets_.push_back(*off);
-        } else {
-          break;
-        }
+    std::unique_ptr<DEX::File>& dexfile = parsed[i];
+    if (dexfile == nullptr) {
+      LIEF_WARN("{} ({}) at 0x{:x} is not a DEX file", names[i],
+                oat_dex_file->location(), oat_dex_file->dex_offset());
+      continue;
+    }
+    dexfile->location(oat_dex_file->location());
+    const uint32_t nb_classes = dexfile->header().nb_classes();
+
+    oat_dex_file->dex_file_ = dexfile.get();
+    oat.dex_files_.push_back(std::move(dexfile));
+
+    uint32_t classes_offset = classes_offsets_offset[i];
+    oat_dex_file->classes_offsets_.reserve(nb_classes);
+
+    for (size_t cls_idx = 0; cls_idx < nb_classes; ++cls_idx) {
+      if (auto off = stream_->peek<uint32_t>(classes_offset + cls_idx * sizeof(uint32_t))) {
+        oat_dex_file->classes_offsets_.push_back(*off);
+      } else {
+        break;
       }
-    } else {
-      LIEF_WARN("{} ({}) at  0x{:x} is not a DEX file", name, oat_dex_file->location(), stream_->pos());
     }
   }
 }
@@ -16,6 +16,9 @@
  */
 #include <string>
 #include "OAT/Structures.hpp"
+#include "ELF/Structures.hpp"
+#include "LIEF/BinaryStream/FileStream.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
 #include "LIEF/OAT/utils.hpp"
 #include "LIEF/ELF/Binary.hpp"
 #include "LIEF/ELF/Parser.hpp"
@@ -26,21 +29,118 @@
 namespace LIEF {
 namespace OAT {
 
-bool is_oat(const std::string& file) {
-  if (!ELF::is_elf(file)) {
+// OAT files are generated by dex2oat with a handful of sections and dynamic
+// symbols (oatdata, oatexec, oatlastword, oatbss, ...). These limits bound the
+// reads on regular ELF files.
+static constexpr size_t MAX_OAT_SECTIONS = 64;
+static constexpr size_t MAX_OAT_SYMBOLS  = 32;
+
+template<class ELF_T>
+static bool is_oat_impl(BinaryStream& stream) {
+  using Elf_Ehdr = typename ELF_T::Elf_Ehdr;
+  using Elf_Shdr = typename ELF_T::Elf_Shdr;
+  using Elf_Sym  = typename ELF_T::Elf_Sym;
+  static constexpr uint32_t SHT_NOBITS = 8;
+  static constexpr uint32_t SHT_DYNSYM = 11;
+
+  auto hdr = stream.peek<Elf_Ehdr>(0);
+  if (!hdr || hdr->e_shoff == 0 || hdr->e_shentsize != sizeof(Elf_Shdr) ||
+      hdr->e_shnum == 0 || hdr->e_shnum > MAX_OAT_SECTIONS)
+  {
+    return false;
+  }
+
+  auto get_section = [&] (size_t idx) {
+    return stream.peek<Elf_Shdr>(hdr->e_shoff + idx * sizeof(Elf_Shdr));
+  };
+
+  // Look for the virtual address of the `oatdata` symbol
+  uint64_t oatdata = 0;
+  for (size_t i = 0; i < hdr->e_shnum && oatdata == 0; ++i) {
+    auto dynsym = get_section(i);
+    if (!dynsym) {
+      return false;
+    }
+
+    if (dynsym->sh_type != SHT_DYNSYM) {
+      continue;
+    }
+
+    const uint64_t nb_symbols = dynsym->sh_size / sizeof(Elf_Sym);
+    auto dynstr = get_section(dynsym->sh_link);
+    if (nb_symbols > MAX_OAT_SYMBOLS || !dynstr) {
+      return false;
+    }
+
+    for (size_t j = 1; j < nb_symbols; ++j) {
+      auto sym = stream.peek<Elf_Sym>(dynsym->sh_offset + j * sizeof(Elf_Sym));
+      if (!sym) {
+        break;
+      }
+      auto name = stream.peek_string_at(dynstr->sh_offset + sym->st_name,
+                                        sizeof("oatdata"));
+      if (name && *name == "oatdata") {
+        oatdata = sym->st_value;
+        break;
+      }
+    }
+  }
+
+  if (oatdata == 0) {
     return false;
   }
 
-  if (const auto elf_binary = ELF::Parser::parse(file)) {
-    return is_oat(*elf_binary);
+  // Translate the address into an offset and check the OAT magic
+  using magic_t = std::array<uint8_t, sizeof(details::oat_magic)>;
+  for (size_t i = 0; i < hdr->e_shnum; ++i) {
+    auto section = get_section(i);
+    if (!section || section->sh_type == SHT_NOBITS ||
+        oatdata < section->sh_addr || oatdata >= section->sh_addr + section->sh_size)
+    {
+      continue;
+    }
+    auto magic = stream.peek<magic_t>(section->sh_offset + (oatdata - section->sh_addr));
+    return magic && std::equal(std::begin(*magic), std::end(*magic),
+                               std::begin(details::oat_magic));
+  }
+  return false;
+}
+
+bool is_oat(BinaryStream& stream) {
+  static constexpr size_t EI_CLASS = 4;
+  static constexpr size_t EI_DATA  = 5;
+  static constexpr uint8_t ELFCLASS32  = 1;
+  static constexpr uint8_t ELFCLASS64  = 2;
+  static constexpr uint8_t ELFDATA2LSB = 1;
+
+  if (!ELF::is_elf(stream)) {
+    return false;
+  }
+
+  auto ident = stream.peek<std::array<uint8_t, 16>>(0);
+  // OAT files are only generated for little-endian targets
+  if (!ident || (*ident)[EI_DATA] != ELFDATA2LSB) {
+    return false;
+  }
+
+  switch ((*ident)[EI_CLASS]) {
+    case ELFCLASS32: return is_oat_impl<ELF::details::ELF32>(stream);
+    case ELFCLASS64: return is_oat_impl<ELF::details::ELF64>(stream);
+    default: return false;
+  }
+}
+
+bool is_oat(const std::string& file) {
+  if (auto stream = FileStream::from_file(file)) {
+    return is_oat(*stream);
   }
   return false;
 }
 
 
 bool is_oat(const std::vector<uint8_t>& raw) {
-  if (const auto elf_binary = ELF::Parser::parse(raw)) {
-    return is_oat(*elf_binary);
+  if (auto stream = SpanStream::from_vector(raw)) {
+    return is_oat(*stream);
   }
   return false;
 }
@@ -710,6 +710,12 @@ uint32_t Binary::compute_checksum() const {
 }
 
 std::vector<uint8_t> Binary::authentihash(ALGORITHMS algo) const {
+  return std::move(authentihash(std::vector<ALGORITHMS>{algo}).front());
+}
+
+std::vector<std::vector<uint8_t>>
+  Binary::authentihash(const std::vector<ALGORITHMS>& algos) const
+{
   CONST_MAP_ALT HMAP = {
     std::pair(ALGORITHMS::MD5,     hashstream::HASH::MD5),
     std::pair(ALGORITHMS::SHA_1,   hashstream::HASH::SHA1),
@@ -717,15 +723,28 @@ std::vector<uint8_t> Binary::authentihash(ALGORITHMS algo) const {
     std::pair(ALGORITHMS::SHA_384, hashstream::HASH::SHA384),
     std::pair(ALGORITHMS::SHA_512, hashstream::HASH::SHA512),
   };
-  auto it_hash = HMAP.find(algo);
-  if (it_hash == std::end(HMAP)) {
-    LIEF_WARN("Unsupported hash algorithm: {}", to_string(algo));
-    return {};
+  std::vector<std::vector<uint8_t>> hashes(algos.size());
+
+  // Index in `hashes` of the digests computed by the stream
+  std::vector<size_t> indexes;
+  std::vector<hashstream::HASH> hash_types;
+  for (size_t i = 0; i < algos.size(); ++i) {
+    auto it_hash = HMAP.find(algos[i]);
+    if (it_hash == std::end(HMAP)) {
+      LIEF_WARN("Unsupported hash algorithm: {}", to_string(algos[i]));
+      continue;
+    }
+    indexes.push_back(i);
+    hash_types.push_back(it_hash->second);
   }
+
+  if (hash_types.empty()) {
+    return hashes;
+  }
+
   const size_t sizeof_ptr = type_ == PE_TYPE::PE32 ? sizeof(uint32_t) : sizeof(uint64_t);
-  const hashstream::HASH hash_type = it_hash->second;
-  hashstream ios(hash_type);
-  //vector_iostream ios;
+  // All the digests are computed in a single pass over the binary
+  hashstream ios(hash_types);
   ios // Hash dos header
     .write(dos_header_.magic())
     .write(dos_header_.used_bytes_in_last_page())
@@ -871,7 +890,7 @@ std::vector<uint8_t> Binary::authentihash(ALGORITHMS algo) const {
     const DataDirectory* cert_dir = this->cert_dir();
     if (cert_dir == nullptr) {
       LIEF_ERR("Can't find the data directory for CERTIFICATE_TABLE");
-      return {};
+      return hashes;
     }
     LIEF_DEBUG("Add overlay and omit 0x{:08x} - 0x{:08x}",
                cert_dir->RVA(), cert_dir->RVA() + cert_dir->size());
@@ -904,9 +923,11 @@ std::vector<uint8_t> Binary::authentihash(ALGORITHMS algo) const {
   // }
   // std::vector<uint8_t> hash = hashstream(hash_type).write(out).raw();
 
-  std::vector<uint8_t> hash = ios.raw();
-  LIEF_DEBUG("{}", hex_dump(hash));
-  return hash;
+  for (size_t i = 0; i < indexes.size(); ++i) {
+    hashes[indexes[i]] = std::move(ios.raw(i));
+    LIEF_DEBUG("{}", hex_dump(hashes[indexes[i]]));
+  }
+  return hashes;
 }
 
 Signature::VERIFICATION_FLAGS Binary::verify_signature(Signature::VERIFICATION_CHECKS checks) const {
@@ -1141,6 +1162,27 @@ void Binary::patch_address(uint64_t address, uint64_t patch_value,
   }
 }
 
+result<LIEF::Binary::content_region_t>
+  Binary::get_content_region(uint64_t address, LIEF::Binary::VA_TYPES addr_type)
+{
+  // Same conversion as patch_address(). The address of the region is
+  // expressed in the same kind of address as the input.
+  uint64_t base = 0;
+  if (addr_type == VA_TYPES::VA || addr_type == VA_TYPES::AUTO) {
+    const int64_t delta = address - optional_header().imagebase();
+
+    if (delta > 0 || addr_type == VA_TYPES::VA) {
+      base = optional_header().imagebase();
+    }
+  }
+
+  Section* section = section_from_rva(address - base);
+  if (section == nullptr) {
+    return make_error_code(lief_errors::not_found);
+  }
+  return content_region_t{base + section->virtual_address(), section->writable_content()};
+}
+
 span<const uint8_t> Binary::get_content_from_virtual_address(uint64_t virtual_address,
     uint64_t size, LIEF::Binary::VA_TYPES addr_type) const {
 
@@ -1188,6 +1230,10 @@ result<ResourcesManager> Binary::resources_manager() const {
   return *resources_;
 }
 
+result<ResourceDirectoryView> Binary::resources_view() const {
+  return ResourceDirectoryView::from(*this);
+}
+
 LIEF::Binary::functions_t Binary::ctor_functions() const {
   LIEF::Binary::functions_t functions;
 
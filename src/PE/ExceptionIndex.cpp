@@ -0,0 +1,251 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstring>
+
+#include "logging.hpp"
+
+#include "LIEF/BinaryStream/SpanStream.hpp"
+#include "LIEF/BinaryStream/VectorStream.hpp"
+
+#include "LIEF/PE/ExceptionIndex.hpp"
+#include "LIEF/PE/Binary.hpp"
+#include "LIEF/PE/DataDirectory.hpp"
+#include "LIEF/PE/utils.hpp"
+#include "LIEF/PE/exceptions_info/RuntimeFunctionX64.hpp"
+#include "LIEF/PE/exceptions_info/RuntimeFunctionAArch64.hpp"
+
+namespace LIEF::PE {
+
+// Size of the `RUNTIME_FUNCTION` structure for the given architecture or
+// 0 if the architecture does not use a `.pdata` table
+static size_t runtime_function_size(Header::MACHINE_TYPES arch) {
+  switch (arch) {
+    case Header::MACHINE_TYPES::AMD64:
+      return 3 * sizeof(uint32_t); // BeginAddress, EndAddress, UnwindData
+    case Header::MACHINE_TYPES::ARM64:
+      return 2 * sizeof(uint32_t); // BeginAddress, UnwindData
+    default:
+      return 0;
+  }
+}
+
+// Return true if `rva` is in the range of the function described by `info`
+static bool contains(const ExceptionInfo& info, uint32_t rva) {
+  if (rva < info.rva_start()) {
+    return false;
+  }
+
+  if (const auto* x64 = info.as<RuntimeFunctionX64>()) {
+    return rva < x64->rva_end();
+  }
+
+  if (const auto* arm64 = info.as<RuntimeFunctionAArch64>()) {
+    return rva < arm64->rva_end();
+  }
+  return false;
+}
+
+ExceptionIndex::ExceptionIndex(std::unique_ptr<BinaryStream> stream) :
+  parser_(std::move(stream))
+{}
+
+ExceptionIndex::~ExceptionIndex() = default;
+
+std::unique_ptr<ExceptionIndex>
+  ExceptionIndex::parse(const std::string& file, const ParserConfig& config)
+{
+  if (!is_pe(file)) {
+    return nullptr;
+  }
+
+  auto stream = VectorStream::from_file(file);
+  if (!stream) {
+    LIEF_ERR("Can't open '{}'", file);
+    return nullptr;
+  }
+  return parse(std::make_unique<VectorStream>(std::move(*stream)), config);
+}
+
+std::unique_ptr<ExceptionIndex>
+  ExceptionIndex::parse(std::unique_ptr<BinaryStream> stream,
+                        const ParserConfig& config)
+{
+  if (stream == nullptr || !is_pe(*stream)) {
+    return nullptr;
+  }
+
+  ParserConfig lazy_config = config;
+  lazy_config.parse_exceptions = false;
+
+  std::unique_ptr<ExceptionIndex> index(new ExceptionIndex(std::move(stream)));
+  index->parser_.init(lazy_config);
+  if (index->parser_.binary_ == nullptr) {
+    return nullptr;
+  }
+
+  const Binary& bin = index->binary();
+  index->entry_size_ = runtime_function_size(bin.header().machine());
+  if (index->entry_size_ == 0) {
+    LIEF_DEBUG("No exception table for the architecture: {}",
+               to_string(bin.header().machine()));
+    return index;
+  }
+
+  const DataDirectory* exception_dir = bin.exceptions_dir();
+  if (exception_dir == nullptr || exception_dir->RVA() == 0 ||
+      exception_dir->size() == 0)
+  {
+    return index;
+  }
+
+  index->pdata_ = exception_dir->content();
+  index->nb_entries_ = index->pdata_.size() / index->entry_size_;
+
+  LIEF_DEBUG("Exception table at 0x{:06x}: {} entries",
+             exception_dir->RVA(), index->nb_entries_);
+  return index;
+}
+
+const Binary& ExceptionIndex::binary() const {
+  return *parser_.binary_;
+}
+
+void ExceptionIndex::cache_size(size_t size) {
+  cache_size_ = std::max<size_t>(size, 1);
+  evict();
+}
+
+uint32_t ExceptionIndex::rva_start(size_t index) const {
+  uint32_t rva = 0;
+  std::memcpy(&rva, pdata_.data() + index * entry_size_, sizeof(rva));
+  return rva;
+}
+
+std::shared_ptr<ExceptionInfo> ExceptionIndex::find_exception(uint32_t rva) {
+  // Index of the first entry that starts after the given RVA
+  size_t lo = 0;
+  size_t hi = nb_entries_;
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (rva_start(mid) <= rva) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  if (lo == 0) {
+    return nullptr;
+  }
+
+  std::shared_ptr<entry_t> entry = decode(lo - 1);
+  if (entry == nullptr || entry->info == nullptr ||
+      !contains(*entry->info, rva))
+  {
+    return nullptr;
+  }
+
+  // Share the ownership of the whole entry so that the chained functions
+  // outlive an eviction from the cache
+  return std::shared_ptr<ExceptionInfo>(entry, entry->info.get());
+}
+
+std::shared_ptr<ExceptionIndex::entry_t> ExceptionIndex::decode(uint32_t index) {
+  if (auto it = cache_.find(index); it != cache_.end()) {
+    ++hits_;
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return *it->second;
+  }
+
+  ++misses_;
+  auto entry = std::make_shared<entry_t>();
+  entry->index = index;
+  entry->info = decode_entry(index);
+  if (entry->info == nullptr) {
+    LIEF_DEBUG("Can't decode the exception entry #{}", index);
+  } else {
+    resolve_chains(*entry);
+  }
+
+  // The exception infos memoized by the parser are owned by the cache and
+  // can be evicted
+  parser_.memoize_exception_info_.clear();
+  parser_.unresolved_chains_.clear();
+
+  lru_.push_front(entry);
+  cache_[index] = lru_.begin();
+  evict();
+  return entry;
+}
+
+std::unique_ptr<ExceptionInfo> ExceptionIndex::decode_entry(uint32_t index) {
+  SpanStream stream(pdata_.subspan(index * entry_size_, entry_size_));
+  return ExceptionInfo::parse(parser_, stream);
+}
+
+void ExceptionIndex::resolve_chains(entry_t& entry) {
+  // RuntimeFunctionX64::parse_unwind registers the chained entries that are
+  // not already decoded as "unresolved". Decode them on demand.
+  for (size_t depth = 0; !parser_.unresolved_chains_.empty(); ++depth) {
+    if (depth >= MAX_CHAIN_DEPTH) {
+      LIEF_WARN("Exception 0x{:06x}: too many chained unwind info",
+                entry.info->rva_start());
+      return;
+    }
+
+    auto [info, target] = parser_.unresolved_chains_.back();
+    parser_.unresolved_chains_.pop_back();
+
+    auto* func = info->as<RuntimeFunctionX64>();
+    if (func == nullptr || func->unwind_info() == nullptr) {
+      continue;
+    }
+
+    size_t lo = 0;
+    size_t hi = nb_entries_;
+    while (lo < hi) {
+      const size_t mid = lo + (hi - lo) / 2;
+      if (rva_start(mid) < target) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+
+    if (lo == nb_entries_ || rva_start(lo) != target) {
+      LIEF_DEBUG("RuntimeFunctionX64 0x{:06x}: Can't find linked chained info at 0x{:06x}",
+                 func->rva_start(), target);
+      continue;
+    }
+
+    std::unique_ptr<ExceptionInfo> chained = decode_entry(lo);
+    if (chained == nullptr) {
+      continue;
+    }
+    func->unwind_info()->chained = chained->as<RuntimeFunctionX64>();
+    entry.chain.push_back(std::move(chained));
+  }
+}
+
+void ExceptionIndex::evict() {
+  while (lru_.size() > cache_size_) {
+    cache_.erase(lru_.back()->index);
+    lru_.pop_back();
+  }
+}
+
+}
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <algorithm>
+#include <cstring>
 
 #include "LIEF/Visitor.hpp"
 
@@ -115,6 +116,12 @@ std::ostream& operator<<(std::ostream& os, const Header& entry) {
 
 }
 
+bool Header::is_known_machine(MACHINE_TYPES ty) {
+  // to_string() holds the exhaustive list of the machine types
+  return ty != MACHINE_TYPES::UNKNOWN &&
+         std::strcmp(to_string(ty), "UNKNOWN") != 0;
+}
+
 const char* to_string(Header::MACHINE_TYPES e) {
   #define ENTRY(X) std::pair(Header::MACHINE_TYPES::X, #X)
   STRING_MAP enums2str {
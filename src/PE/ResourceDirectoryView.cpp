@@ -0,0 +1,274 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+
+#include "logging.hpp"
+
+#include "LIEF/utils.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
+
+#include "LIEF/PE/ResourceDirectoryView.hpp"
+#include "LIEF/PE/Binary.hpp"
+#include "LIEF/PE/Section.hpp"
+
+#include "PE/Structures.hpp"
+
+namespace LIEF {
+namespace PE {
+
+// Same limit as the one used by the tree parser (ResourceNode::parse)
+static constexpr uint16_t MAX_NAME_SIZE = 100;
+
+result<ResourceDirectoryView> ResourceDirectoryView::from(const Binary& pe) {
+  const DataDirectory* rsrc_dir = pe.rsrc_dir();
+  if (rsrc_dir == nullptr || rsrc_dir->RVA() == 0) {
+    return make_error_code(lief_errors::not_found);
+  }
+
+  const Section* section = rsrc_dir->section();
+  if (section == nullptr) {
+    return make_error_code(lief_errors::not_found);
+  }
+
+  // The size of the data directory is not always accurate so the view
+  // covers the section from the root directory to its end.
+  span<const uint8_t> content = section->content();
+  const uint64_t rel_offset = rsrc_dir->RVA() - section->virtual_address();
+  if (rsrc_dir->RVA() < section->virtual_address() || rel_offset >= content.size()) {
+    return make_error_code(lief_errors::read_out_of_bound);
+  }
+
+  context_t ctx;
+  ctx.base = content.subspan(rel_offset);
+  ctx.pe = &pe;
+  ctx.rva = rsrc_dir->RVA();
+  return create(ctx, /*offset=*/0, /*depth=*/0);
+}
+
+result<ResourceDirectoryView>
+  ResourceDirectoryView::from(span<const uint8_t> tree, uint32_t rva)
+{
+  context_t ctx;
+  ctx.base = tree;
+  ctx.rva = rva;
+  return create(ctx, /*offset=*/0, /*depth=*/0);
+}
+
+result<ResourceDirectoryView>
+  ResourceDirectoryView::create(const context_t& ctx, uint32_t offset,
+                                uint32_t depth)
+{
+  SpanStream stream(ctx.base);
+  auto table = stream.peek<details::pe_resource_directory_table>(offset);
+  if (!table) {
+    LIEF_DEBUG("Can't read the resource directory at offset 0x{:x}", offset);
+    return make_error_code(lief_errors::read_error);
+  }
+
+  ResourceDirectoryView view(ctx, offset, depth);
+  view.characteristics_       = table->Characteristics;
+  view.time_date_stamp_       = table->TimeDateStamp;
+  view.major_version_         = table->MajorVersion;
+  view.minor_version_         = table->MinorVersion;
+  view.numberof_name_entries_ = table->NumberOfNameEntries;
+  view.numberof_id_entries_   = table->NumberOfIDEntries;
+
+  // Only consider the entries that are in the bounds of the tree
+  const uint64_t entries_offset = offset + sizeof(details::pe_resource_directory_table);
+  const uint64_t nb_entries = (uint64_t)table->NumberOfNameEntries +
+                              table->NumberOfIDEntries;
+  const uint64_t max_entries = entries_offset < ctx.base.size() ?
+    (ctx.base.size() - entries_offset) / sizeof(details::pe_resource_directory_entries) : 0;
+
+  if (nb_entries > max_entries) {
+    LIEF_WARN("Resource directory at offset 0x{:x} is truncated ({} entries vs {})",
+              offset, nb_entries, max_entries);
+  }
+  view.size_ = std::min(nb_entries, max_entries);
+  return view;
+}
+
+ResourceDirectoryView::Entry ResourceDirectoryView::entry_at(size_t idx) const {
+  const uint64_t entry_offset = offset_ + sizeof(details::pe_resource_directory_table) +
+                                idx * sizeof(details::pe_resource_directory_entries);
+  SpanStream stream(ctx_.base);
+  // Bounds are checked against `size_` by the callers
+  auto raw = stream.peek<details::pe_resource_directory_entries>(entry_offset);
+  return Entry(ctx_, depth_, raw->NameID.IntegerID, raw->RVA);
+}
+
+result<ResourceDirectoryView::Entry> ResourceDirectoryView::at(size_t idx) const {
+  if (idx >= size_) {
+    return make_error_code(lief_errors::read_out_of_bound);
+  }
+  return entry_at(idx);
+}
+
+result<ResourceDirectoryView::Entry> ResourceDirectoryView::find(uint32_t id) const {
+  // The ID entries follow the named entries and are sorted in ascending order
+  size_t lo = std::min<size_t>(numberof_name_entries_, size_);
+  size_t hi = size_;
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    Entry entry = entry_at(mid);
+    if (entry.id() == id) {
+      return entry;
+    }
+    if (entry.id() < id) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  // This order is not enforced by the loader: a malformed (or non-compliant)
+  // directory is looked up with a linear scan
+  for (size_t i = 0; i < size_; ++i) {
+    Entry entry = entry_at(i);
+    if (entry.id() == id) {
+      return entry;
+    }
+  }
+  return make_error_code(lief_errors::not_found);
+}
+
+result<ResourceDirectoryView::Entry>
+  ResourceDirectoryView::find(const std::u16string& name) const
+{
+  // The named entries are sorted with a case-sensitive comparison
+  size_t lo = 0;
+  size_t hi = std::min<size_t>(numberof_name_entries_, size_);
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    Entry entry = entry_at(mid);
+    const int cmp = entry.name().compare(name);
+    if (entry.has_name() && cmp == 0) {
+      return entry;
+    }
+    if (cmp < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  // Same as above: fallback on a linear scan
+  for (size_t i = 0; i < size_; ++i) {
+    Entry entry = entry_at(i);
+    if (entry.has_name() && entry.name() == name) {
+      return entry;
+    }
+  }
+  return make_error_code(lief_errors::not_found);
+}
+
+// Return the directory that contains the languages of the resource
+// identified by (type, id)
+static result<ResourceDirectoryView>
+  languages_dir(const ResourceDirectoryView& root, uint32_t type, uint32_t id)
+{
+  using Entry = ResourceDirectoryView::Entry;
+  return root.find(type)
+    .and_then([] (const Entry& e) { return e.directory(); })
+    .and_then([id] (const ResourceDirectoryView& dir) { return dir.find(id); })
+    .and_then([] (const Entry& e) { return e.directory(); });
+}
+
+result<ResourceDirectoryView::data_t>
+  ResourceDirectoryView::lookup(uint32_t type, uint32_t id, uint32_t lang) const
+{
+  return languages_dir(*this, type, id)
+    .and_then([lang] (const ResourceDirectoryView& dir) { return dir.find(lang); })
+    .and_then([] (const Entry& e) { return e.data(); });
+}
+
+result<ResourceDirectoryView::data_t>
+  ResourceDirectoryView::lookup(uint32_t type, uint32_t id) const
+{
+  return languages_dir(*this, type, id)
+    .and_then([] (const ResourceDirectoryView& dir) { return dir.at(0); })
+    .and_then([] (const Entry& e) { return e.data(); });
+}
+
+std::u16string ResourceDirectoryView::Entry::name() const {
+  if (!has_name()) {
+    return {};
+  }
+
+  SpanStream stream(ctx_.base);
+  const uint32_t offset = id_ & (~0x80000000);
+  auto length = stream.peek<uint16_t>(offset);
+  if (!length || *length > MAX_NAME_SIZE) {
+    return {};
+  }
+
+  auto name = stream.peek_u16string_at(offset + sizeof(uint16_t), *length);
+  if (!name) {
+    LIEF_DEBUG("Can't read the resource name at offset 0x{:x}", offset);
+    return {};
+  }
+  return std::move(*name);
+}
+
+std::string ResourceDirectoryView::Entry::utf8_name() const {
+  return u16tou8(name());
+}
+
+result<ResourceDirectoryView> ResourceDirectoryView::Entry::directory() const {
+  if (!is_directory()) {
+    return make_error_code(lief_errors::not_found);
+  }
+
+  if (depth_ + 1 > MAX_DEPTH) {
+    LIEF_WARN("Resource tree is too deep (loop?)");
+    return make_error_code(lief_errors::corrupted);
+  }
+  return create(ctx_, offset_ & (~0x80000000), depth_ + 1);
+}
+
+result<ResourceDirectoryView::data_t> ResourceDirectoryView::Entry::data() const {
+  if (!is_data()) {
+    return make_error_code(lief_errors::not_found);
+  }
+
+  SpanStream stream(ctx_.base);
+  auto raw = stream.peek<details::pe_resource_data_entry>(offset_);
+  if (!raw) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  data_t data;
+  data.rva       = raw->DataRVA;
+  data.code_page = raw->Codepage;
+  data.reserved  = raw->Reserved;
+
+  if (ctx_.pe != nullptr) {
+    data.content = ctx_.pe->get_content_from_virtual_address(
+        raw->DataRVA, raw->Size, Binary::VA_TYPES::RVA);
+    return data;
+  }
+
+  // Standalone tree: the payload must be located in the tree's buffer
+  if (ctx_.rva <= raw->DataRVA && raw->DataRVA - ctx_.rva < ctx_.base.size()) {
+    const size_t offset = raw->DataRVA - ctx_.rva;
+    const size_t size = std::min<size_t>(raw->Size, ctx_.base.size() - offset);
+    data.content = ctx_.base.subspan(offset, size);
+  }
+  return data;
+}
+
+}
+}
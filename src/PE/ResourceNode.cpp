@@ -353,6 +353,44 @@ ResourceNode::childs_t::iterator ResourceNode::insert_child(std::unique_ptr<Reso
   return childs_.insert(it, std::move(child));
 }
 
+const ResourceNode* ResourceNode::find_child(uint32_t id) const {
+  // The named entries should come first, followed by the ID entries sorted
+  // in ascending order (see: insert_child()). This is not guaranteed by the
+  // parser (on-disk order) nor after a modification with id() so the
+  // binary search is only used as a fast path.
+  const size_t size = childs_.size();
+  size_t lo = 0;
+  size_t hi = size;
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (childs_[mid]->has_name()) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  hi = size;
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (childs_[mid]->id() < id) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  if (lo < size && childs_[lo]->id() == id) {
+    return childs_[lo].get();
+  }
+
+  const auto it = std::find_if(childs_.begin(), childs_.end(),
+      [id] (const std::unique_ptr<ResourceNode>& node) {
+        return node->id() == id;
+      });
+  return it != childs_.end() ? it->get() : nullptr;
+}
+
 const ResourceNode& ResourceNode::safe_get_at(size_t idx) const {
   class InvalidNode : public ResourceNode {
     public:
@@ -56,17 +56,38 @@ std::string ResourcesManager::string_entry_t::string_u8() const {
 }
 
 const ResourceNode* ResourcesManager::get_node_type(ResourcesManager::TYPE type) const {
-  ResourceNode::it_childs nodes = resources_->childs();
-  const auto it_node = std::find_if(std::begin(nodes), std::end(nodes),
-      [type] (const ResourceNode& node) {
-        return TYPE(node.id()) == type;
-      });
+  return resources_->find_child((uint32_t)type);
+}
+
+const ResourceData* ResourcesManager::find(TYPE type, uint32_t id, uint32_t lang) const {
+  const ResourceNode* type_node = get_node_type(type);
+  if (type_node == nullptr) {
+    return nullptr;
+  }
 
-  if (it_node == std::end(nodes)) {
+  const ResourceNode* id_node = type_node->find_child(id);
+  if (id_node == nullptr) {
     return nullptr;
   }
 
-  return &*it_node;
+  const ResourceNode* lang_node = id_node->find_child(lang);
+  if (lang_node == nullptr) {
+    return nullptr;
+  }
+  return lang_node->cast<ResourceData>();
+}
+
+const ResourceData* ResourcesManager::find(TYPE type, uint32_t id) const {
+  const ResourceNode* type_node = get_node_type(type);
+  if (type_node == nullptr) {
+    return nullptr;
+  }
+
+  const ResourceNode* id_node = type_node->find_child(id);
+  if (id_node == nullptr) {
+    return nullptr;
+  }
+  return id_node->safe_get_at(0).cast<ResourceData>();
 }
 
 std::vector<ResourcesManager::TYPE> ResourcesManager::get_types() const {
@@ -0,0 +1,147 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <array>
+#include <cmath>
+#include <functional>
+
+#include "logging.hpp"
+#include "hash_stream.hpp"
+#include "parallel.hpp"
+
+#include "LIEF/PE/fingerprint.hpp"
+#include "LIEF/PE/Binary.hpp"
+#include "LIEF/PE/RichHeader.hpp"
+#include "LIEF/PE/Section.hpp"
+#include "LIEF/PE/utils.hpp"
+
+namespace LIEF {
+namespace PE {
+
+// Size of the chunks fed to the hash functions and to the entropy counter
+// so that they process the section's content while it is in the cache
+static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+// Same computation as LIEF::Section::entropy()
+static double entropy(const std::array<uint64_t, 256>& frequencies, size_t size) {
+  if (size <= 1) {
+    return 0.;
+  }
+  double entropy = 0.0;
+  for (uint64_t p : frequencies) {
+    if (p > 0) {
+      double freq = static_cast<double>(p) / static_cast<double>(size);
+      entropy += freq * std::log2l(freq);
+    }
+  }
+  return (-entropy);
+}
+
+static void fingerprint_section(const Section& section,
+                                const fingerprint_options_t& options,
+                                fingerprint_t::section_t& out)
+{
+  out.name = section.name();
+  out.virtual_address = section.virtual_address();
+
+  span<const uint8_t> content = section.content();
+  std::array<uint64_t, 256> frequencies = { {0} };
+
+  std::vector<hashstream::HASH> types;
+  if (options.section_hashes) {
+    types = {hashstream::HASH::MD5, hashstream::HASH::SHA256};
+  }
+  hashstream hs(types);
+
+  for (size_t pos = 0; pos < content.size(); pos += CHUNK_SIZE) {
+    span<const uint8_t> chunk = content.subspan(pos, std::min(CHUNK_SIZE, content.size() - pos));
+    hs.write(chunk.data(), chunk.size());
+    if (options.section_entropy) {
+      for (uint8_t x : chunk) {
+        frequencies[x]++;
+      }
+    }
+  }
+
+  if (options.section_hashes) {
+    out.md5    = std::move(hs.raw(0));
+    out.sha256 = std::move(hs.raw(1));
+  }
+
+  if (options.section_entropy) {
+    out.entropy = entropy(frequencies, content.size());
+  }
+}
+
+fingerprint_t fingerprint(const Binary& binary, const fingerprint_options_t& options) {
+  fingerprint_t fp;
+  // The digests are independent: each task writes its own field of `fp`
+  std::vector<std::function<void()>> tasks;
+
+  if (options.imphash) {
+    tasks.emplace_back([&] {
+      fp.imphash = get_imphash(binary, IMPHASH_MODE::LIEF);
+    });
+  }
+
+  if (options.imphash_pefile) {
+    tasks.emplace_back([&] {
+      fp.imphash_pefile = get_imphash(binary, IMPHASH_MODE::PEFILE);
+    });
+  }
+
+  if (const RichHeader* rich = binary.rich_header();
+      options.rich_header_hash && rich != nullptr)
+  {
+    tasks.emplace_back([&fp, rich] {
+      fp.rich_header_hash = rich->hash(ALGORITHMS::MD5);
+    });
+  }
+
+  if (!options.authentihash.empty()) {
+    tasks.emplace_back([&] {
+      std::vector<std::vector<uint8_t>> hashes = binary.authentihash(options.authentihash);
+      for (size_t i = 0; i < hashes.size(); ++i) {
+        if (!hashes[i].empty()) {
+          fp.authentihash[options.authentihash[i]] = std::move(hashes[i]);
+        }
+      }
+    });
+  }
+
+  if (options.checksum) {
+    tasks.emplace_back([&] {
+      fp.checksum = binary.compute_checksum();
+    });
+  }
+
+  if (options.section_hashes || options.section_entropy) {
+    fp.sections.resize(binary.sections().size());
+    size_t idx = 0;
+    for (const Section& section : binary.sections()) {
+      fingerprint_t::section_t& out = fp.sections[idx++];
+      tasks.emplace_back([&section, &options, &out] {
+        fingerprint_section(section, options, out);
+      });
+    }
+  }
+
+  LIEF_DEBUG("Fingerprint: {} tasks", tasks.size());
+  parallel_for(tasks.size(), [&] (size_t i) { tasks[i](); });
+  return fp;
+}
+
+}
+}
@@ -19,6 +19,7 @@
 #include <memory>
 
 #include <mbedtls/x509_crt.h>
+#include <mbedtls/asn1.h>
 
 #include "LIEF/utils.hpp"
 
@@ -56,6 +57,8 @@
 #include "messages.hpp"
 #include "internal_utils.hpp"
 
+#include "PE/signature/x509_cache.hpp"
+
 namespace LIEF {
 namespace PE {
 
@@ -555,8 +558,31 @@ result<SignatureParser::x509_certificates_t> SignatureParser::parse_certificates
   ASN1Reader asn1r(stream);
 
   x509_certificates_t certificates;
+  details::x509_cache& cache = details::x509_cache::get();
   const uint64_t cert_end_p = stream.size();
   while (stream.pos() < cert_end_p) {
+    details::digest_t digest = {0};
+    bool has_digest = false;
+    if (cache.enabled()) {
+      // Identify the certificate with the digest of its DER encoding
+      // (Certificate ::= SEQUENCE) to avoid parsing it again
+      const uint8_t* start = stream.p();
+      uint8_t* p = stream.p();
+      size_t len = 0;
+      int ret = mbedtls_asn1_get_tag(&p, stream.end(), &len,
+                                     MBEDTLS_ASN1_CONSTRUCTED | MBEDTLS_ASN1_SEQUENCE);
+      if (ret == 0) {
+        const size_t der_size = (p - start) + len;
+        digest = details::sha256(start, der_size);
+        has_digest = true;
+        if (details::x509_cache::crt_t crt = cache.find_crt(digest)) {
+          certificates.push_back(x509(std::move(crt)));
+          stream.increment_pos(der_size);
+          continue;
+        }
+      }
+    }
+
     auto cert = asn1r.read_cert();
     if (!cert) {
       LIEF_INFO("Can't parse X509 cert pkcs7-signed-data.certificates (pos: {:d})", stream.pos());
@@ -570,6 +596,11 @@ result<SignatureParser::x509_certificates_t> SignatureParser::parse_certificates
       mbedtls_x509_crt_info(buffer.data(), buffer.size(), "", cert_p.get());
       LIEF_DEBUG("\n{}\n", buffer.data());
     }
+    if (has_digest) {
+      details::x509_cache::crt_t crt = x509(cert_p.release()).x509_cert_;
+      certificates.push_back(x509(cache.insert_crt(digest, std::move(crt))));
+      continue;
+    }
     certificates.emplace_back(cert_p.release());
   }
   return certificates;
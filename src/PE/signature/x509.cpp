@@ -15,6 +15,7 @@
  */
 #include <cstring>
 #include <map>
+#include <mutex>
 #include <fstream>
 
 #include <mbedtls/platform.h>
@@ -36,6 +37,8 @@
 #include "LIEF/PE/signature/RsaInfo.hpp"
 #include "LIEF/PE/EnumToString.hpp"
 
+#include "PE/signature/x509_cache.hpp"
+
 namespace {
   // Copy this function from mbedtls since it is not exported
   inline int x509_get_current_time( mbedtls_x509_time *now )
@@ -333,27 +336,47 @@ bool x509::time_is_future(const date_t& from) {
   return check_time(from_mbedtls(now), from);
 }
 
+static void free_crt(mbedtls_x509_crt* crt) {
+  mbedtls_x509_crt_free(crt);
+  delete crt;
+}
+
+// The public-key operations of mbedtls are not thread-safe on a shared
+// context (the RSA context lazily caches some values) so they are
+// serialized per certificate.
+static std::mutex& pk_mutex(const mbedtls_x509_crt* crt) {
+  static std::array<std::mutex, 32> MUTEXES;
+  return MUTEXES[(reinterpret_cast<uintptr_t>(crt) >> 4) % MUTEXES.size()];
+}
+
+// Key that identifies a verification of `crt` against the `ca` list
+static details::digest_t verification_key(char kind, const mbedtls_x509_crt& crt,
+                                          const std::vector<const mbedtls_x509_crt*>& ca)
+{
+  std::vector<uint8_t> buffer;
+  buffer.reserve(1 + (1 + ca.size()) * sizeof(details::digest_t));
+  buffer.push_back(kind);
+
+  details::digest_t digest = details::sha256(crt.raw.p, crt.raw.len);
+  buffer.insert(buffer.end(), digest.begin(), digest.end());
+  for (const mbedtls_x509_crt* ca_crt : ca) {
+    digest = details::sha256(ca_crt->raw.p, ca_crt->raw.len);
+    buffer.insert(buffer.end(), digest.begin(), digest.end());
+  }
+  return details::sha256(buffer.data(), buffer.size());
+}
+
 x509::x509() = default;
 
 x509::x509(mbedtls_x509_crt* ca) :
-  x509_cert_{ca}
+  x509_cert_{ca, &free_crt}
 {}
 
-x509::x509(const x509& other) :
-  Object::Object{other}
-{
-  auto* crt = new mbedtls_x509_crt{};
-  mbedtls_x509_crt_init(crt);
-  int ret = mbedtls_x509_crt_parse_der(crt, other.x509_cert_->raw.p,
-                                       other.x509_cert_->raw.len);
-  if (ret != 0) {
-    LIEF_WARN("Failed to copy x509 certificate");
-    delete crt;
-    return;
-  }
+x509::x509(std::shared_ptr<mbedtls_x509_crt> crt) :
+  x509_cert_{std::move(crt)}
+{}
 
-  x509_cert_ = crt;
-}
+x509::x509(const x509& other) = default;
 
 x509& x509::operator=(x509 other) {
   swap(other);
@@ -519,6 +542,7 @@ bool x509::check_signature(const std::vector<uint8_t>& hash, const std::vector<u
     LIEF_ERR("Can't find algorithm {}", to_string(algo));
     return false;
   }
+  std::lock_guard<std::mutex> lock(pk_mutex(x509_cert_.get()));
   mbedtls_pk_context& ctx = x509_cert_->pk;
   int ret = mbedtls_pk_verify(&ctx,
     /* MD_HASH_ALGO       */ it_md->second,
@@ -574,9 +598,33 @@ x509::VERIFICATION_FLAGS x509::is_trusted_by(const std::vector<x509>& ca) const
     LIEF_WARN("Certificate chain is empty");
     return VERIFICATION_FLAGS::BADCERT_MISSING;
   }
-  std::vector<x509> ca_list = ca; // Explicit copy since we will modify mbedtls_x509_crt->next
-  for (size_t i = 0; i < ca_list.size() - 1; ++i) {
-    ca_list[i].x509_cert_->next = ca_list[i + 1].x509_cert_;
+
+  details::x509_cache& cache = details::x509_cache::get();
+  const bool use_cache = cache.enabled();
+  details::digest_t key = {0};
+  if (use_cache) {
+    std::vector<const mbedtls_x509_crt*> ca_crts;
+    ca_crts.reserve(ca.size());
+    for (const x509& crt : ca) {
+      ca_crts.push_back(crt.x509_cert_.get());
+    }
+    key = verification_key('T', *x509_cert_, ca_crts);
+    VERIFICATION_FLAGS flags = VERIFICATION_FLAGS::OK;
+    if (cache.find_flags(key, flags)) {
+      return flags;
+    }
+  }
+
+  // The trusted CA must be linked (mbedtls_x509_crt->next) but the
+  // certificates are shared: build the chain with copies of the CA.
+  mbedtls_x509_crt ca_chain;
+  mbedtls_x509_crt_init(&ca_chain);
+  for (const x509& crt : ca) {
+    int ret = mbedtls_x509_crt_parse_der(&ca_chain, crt.x509_cert_->raw.p,
+                                         crt.x509_cert_->raw.len);
+    if (ret != 0) {
+      LIEF_WARN("Failed to copy x509 certificate");
+    }
   }
 
   VERIFICATION_FLAGS result = VERIFICATION_FLAGS::OK;
@@ -594,8 +642,8 @@ x509::VERIFICATION_FLAGS x509::is_trusted_by(const std::vector<x509>& ca) const
   };
 
   int ret = mbedtls_x509_crt_verify_with_profile(
-      /* crt          */ x509_cert_,
-      /* Trusted CA   */ ca_list.front().x509_cert_,
+      /* crt          */ x509_cert_.get(),
+      /* Trusted CA   */ &ca_chain,
       /* CA's CRLs    */ nullptr,
       /* profile      */ &profile,
       /* Common Name  */ nullptr,
@@ -612,14 +660,26 @@ x509::VERIFICATION_FLAGS x509::is_trusted_by(const std::vector<x509>& ca) const
     result = from_mbedtls_err(flags);
   }
 
-  // Clear the chain since ~x509() will delete each object
-  for (size_t i = 0; i < ca_list.size(); ++i) {
-    ca_list[i].x509_cert_->next = nullptr;
+  mbedtls_x509_crt_free(&ca_chain);
+
+  if (use_cache) {
+    cache.insert_flags(key, result);
   }
   return result;
 }
 
 x509::VERIFICATION_FLAGS x509::verify(const x509& ca) const {
+  details::x509_cache& cache = details::x509_cache::get();
+  const bool use_cache = cache.enabled();
+  details::digest_t key = {0};
+  if (use_cache) {
+    key = verification_key('V', *ca.x509_cert_, {x509_cert_.get()});
+    VERIFICATION_FLAGS flags = VERIFICATION_FLAGS::OK;
+    if (cache.find_flags(key, flags)) {
+      return flags;
+    }
+  }
+
   uint32_t flags = 0;
   VERIFICATION_FLAGS result = VERIFICATION_FLAGS::OK;
   mbedtls_x509_crt_profile profile = {
@@ -633,9 +693,10 @@ x509::VERIFICATION_FLAGS x509::verify(const x509& ca) const {
     1          /* Min RSA key */,
   };
 
+  std::unique_lock<std::mutex> lock(pk_mutex(x509_cert_.get()));
   int ret = mbedtls_x509_crt_verify_with_profile(
-      /* crt          */ ca.x509_cert_,
-      /* Trusted CA   */ x509_cert_,
+      /* crt          */ ca.x509_cert_.get(),
+      /* Trusted CA   */ x509_cert_.get(),
       /* CA's CRLs    */ nullptr,
       /* profile      */ &profile,
       /* Common Name  */ nullptr,
@@ -651,6 +712,11 @@ x509::VERIFICATION_FLAGS x509::verify(const x509& ca) const {
     LIEF_WARN("X509 verify failed with: {} (0x{:x})\n{}", strerr, ret, out);
     result = from_mbedtls_err(flags);
   }
+  lock.unlock();
+
+  if (use_cache) {
+    cache.insert_flags(key, result);
+  }
   return result;
 }
 
@@ -748,14 +814,27 @@ void x509::accept(Visitor& visitor) const {
   visitor.visit(*this);
 }
 
-x509::~x509() {
-  mbedtls_x509_crt_free(x509_cert_);
-  delete x509_cert_;
+x509::~x509() = default;
+
+void x509::enable_cache(bool enabled, size_t max_size) {
+  details::x509_cache::get().enable(enabled, max_size);
+}
+
+bool x509::is_cache_enabled() {
+  return details::x509_cache::get().enabled();
+}
+
+void x509::clear_cache() {
+  details::x509_cache::get().clear();
+}
+
+x509::cache_stats_t x509::cache_stats() {
+  return details::x509_cache::get().stats();
 }
 
 std::ostream& operator<<(std::ostream& os, const x509& x509_cert) {
   std::vector<char> buffer(2048, 0);
-  int ret = mbedtls_x509_crt_info(buffer.data(), buffer.size(), "", x509_cert.x509_cert_);
+  int ret = mbedtls_x509_crt_info(buffer.data(), buffer.size(), "", x509_cert.x509_cert_.get());
   if (ret < 0) {
     os << "Can't print certificate information\n";
     return os;
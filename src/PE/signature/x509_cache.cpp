@@ -0,0 +1,107 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+
+#include "mbedtls/x509_crt.h"
+#include "mbedtls/sha256.h"
+
+#include "logging.hpp"
+
+#include "PE/signature/x509_cache.hpp"
+
+namespace LIEF {
+namespace PE {
+namespace details {
+
+// Verification results are smaller than the certificates and a certificate
+// is usually involved in several verifications
+static constexpr size_t VERIFICATIONS_FACTOR = 4;
+
+x509_cache& x509_cache::get() {
+  static x509_cache cache;
+  return cache;
+}
+
+void x509_cache::enable(bool value, size_t max_size) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  max_size_ = std::max<size_t>(max_size, 1);
+  certificates_.shrink(max_size_);
+  verifications_.shrink(max_size_ * VERIFICATIONS_FACTOR);
+  if (!value) {
+    certificates_.clear();
+    verifications_.clear();
+  }
+  enabled_.store(value, std::memory_order_relaxed);
+}
+
+x509_cache::crt_t x509_cache::find_crt(const digest_t& digest) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (const crt_t* crt = certificates_.find(digest)) {
+    ++stats_.hits;
+    return *crt;
+  }
+  ++stats_.misses;
+  return nullptr;
+}
+
+x509_cache::crt_t x509_cache::insert_crt(const digest_t& digest, crt_t crt) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return certificates_.insert(digest, std::move(crt), max_size_);
+}
+
+bool x509_cache::find_flags(const digest_t& key, x509::VERIFICATION_FLAGS& flags) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (const x509::VERIFICATION_FLAGS* value = verifications_.find(key)) {
+    ++stats_.verify_hits;
+    flags = *value;
+    return true;
+  }
+  ++stats_.verify_misses;
+  return false;
+}
+
+void x509_cache::insert_flags(const digest_t& key, x509::VERIFICATION_FLAGS flags) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  verifications_.insert(key, flags, max_size_ * VERIFICATIONS_FACTOR);
+}
+
+void x509_cache::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  certificates_.clear();
+  verifications_.clear();
+  stats_ = x509::cache_stats_t();
+}
+
+x509::cache_stats_t x509_cache::stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  x509::cache_stats_t stats = stats_;
+  stats.certificates  = certificates_.size();
+  stats.verifications = verifications_.size();
+  return stats;
+}
+
+digest_t sha256(const uint8_t* buffer, size_t size) {
+  digest_t digest = {0};
+  int ret = mbedtls_sha256(buffer, size, digest.data(), /*is224=*/0);
+  if (ret != 0) {
+    LIEF_WARN("mbedtls_sha256() failed with retcode: 0x{:x}", ret);
+  }
+  return digest;
+}
+
+}
+}
+}
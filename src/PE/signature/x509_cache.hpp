@@ -0,0 +1,140 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_PE_SIGNATURE_X509_CACHE_H
+#define LIEF_PE_SIGNATURE_X509_CACHE_H
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "LIEF/PE/signature/x509.hpp"
+
+struct mbedtls_x509_crt;
+
+namespace LIEF {
+namespace PE {
+namespace details {
+
+/// SHA-256 digest used to identify a certificate or a verification
+using digest_t = std::array<uint8_t, 32>;
+
+struct digest_hash {
+  size_t operator()(const digest_t& digest) const {
+    size_t value = 0;
+    std::memcpy(&value, digest.data(), sizeof(value));
+    return value;
+  }
+};
+
+/// Bounded map that evicts the least recently used entries
+template<class V>
+class lru_map {
+  public:
+  const V* find(const digest_t& key) {
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      return nullptr;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return &it->second->second;
+  }
+
+  const V& insert(const digest_t& key, V value, size_t max_size) {
+    if (auto it = index_.find(key); it != index_.end()) {
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return it->second->second;
+    }
+    entries_.emplace_front(key, std::move(value));
+    index_[key] = entries_.begin();
+    shrink(max_size);
+    return entries_.front().second;
+  }
+
+  void shrink(size_t max_size) {
+    while (entries_.size() > max_size) {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+  }
+
+  void clear() {
+    index_.clear();
+    entries_.clear();
+  }
+
+  size_t size() const {
+    return entries_.size();
+  }
+
+  private:
+  using entry_t = std::pair<digest_t, V>;
+  std::list<entry_t> entries_;
+  std::unordered_map<digest_t, typename std::list<entry_t>::iterator, digest_hash> index_;
+};
+
+/// Process-wide cache of the parsed certificates and of the results of
+/// x509::verify / x509::is_trusted_by (cf. x509::enable_cache)
+class x509_cache {
+  public:
+  using crt_t = std::shared_ptr<mbedtls_x509_crt>;
+
+  static x509_cache& get();
+
+  bool enabled() const {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  void enable(bool value, size_t max_size);
+
+  /// Return the certificate associated with the given DER digest or a
+  /// nullptr
+  crt_t find_crt(const digest_t& digest);
+
+  /// Register a parsed certificate and return the one that must be used (in
+  /// case of a concurrent insertion)
+  crt_t insert_crt(const digest_t& digest, crt_t crt);
+
+  /// Return the memoized verification flags for the given key
+  bool find_flags(const digest_t& key, x509::VERIFICATION_FLAGS& flags);
+
+  void insert_flags(const digest_t& key, x509::VERIFICATION_FLAGS flags);
+
+  void clear();
+
+  x509::cache_stats_t stats();
+
+  private:
+  x509_cache() = default;
+
+  std::atomic<bool> enabled_{false};
+  std::mutex mutex_;
+  size_t max_size_ = x509::DEFAULT_CACHE_SIZE;
+  lru_map<crt_t> certificates_;
+  lru_map<x509::VERIFICATION_FLAGS> verifications_;
+  x509::cache_stats_t stats_;
+};
+
+/// SHA-256 of the given buffer
+digest_t sha256(const uint8_t* buffer, size_t size);
+
+}
+}
+}
+#endif
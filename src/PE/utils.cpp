@@ -156,9 +156,68 @@ result<PE_TYPE> get_type(const std::vector<uint8_t>& raw) {
 }
 
 
+using ordinal_resolver_t = const char*(*)(uint32_t);
+
+// Return the function used to resolve the ordinals imported from the given
+// library (lowercase name) or a nullptr if there is no lookup table for this
+// library.
+static ordinal_resolver_t get_ordinal_resolver(const std::string& name, bool use_std) {
+  static const std::unordered_map<std::string, ordinal_resolver_t>
+  ordinals_library_tables =
+  {
+    { "kernel32.dll",   &kernel32_dll_lookup },
+    { "ntdll.dll",      &ntdll_dll_lookup    },
+    { "advapi32.dll",   &advapi32_dll_lookup },
+    { "msvcp110.dll",   &msvcp110_dll_lookup },
+    { "msvcp120.dll",   &msvcp120_dll_lookup },
+    { "msvcr100.dll",   &msvcr100_dll_lookup },
+    { "msvcr110.dll",   &msvcr110_dll_lookup },
+    { "msvcr120.dll",   &msvcr120_dll_lookup },
+    { "user32.dll",     &user32_dll_lookup   },
+    { "comctl32.dll",   &comctl32_dll_lookup },
+    { "ws2_32.dll",     &ws2_32_dll_lookup   },
+    { "shcore.dll",     &shcore_dll_lookup   },
+    { "oleaut32.dll",   &oleaut32_dll_lookup },
+    { "mfc42u.dll",     &mfc42u_dll_lookup   },
+    { "shlwapi.dll",    &shlwapi_dll_lookup  },
+    { "gdi32.dll",      &gdi32_dll_lookup    },
+    { "shell32.dll",    &shell32_dll_lookup  },
+  };
+
+  static const std::unordered_map<std::string, ordinal_resolver_t>
+  imphashstd_ordinals_library_tables =
+  {
+    { "ws2_32.dll",     &ws2_32_dll_lookup   },
+    { "wsock32.dll",    &ws2_32_dll_lookup   },
+    { "oleaut32.dll",   &oleaut32_dll_lookup },
+  };
+
+  const auto& tables = use_std ? imphashstd_ordinals_library_tables :
+                                 ordinals_library_tables;
+  auto it = tables.find(name);
+  return it != std::end(tables) ? it->second : nullptr;
+}
+
+// Name of the imported function with the ordinal resolved (if possible).
+// This is equivalent to resolve_ordinals() without copying the Import.
+static const char* resolved_name(const ImportEntry& entry, ordinal_resolver_t resolver) {
+  if (!entry.is_ordinal()) {
+    return entry.name().c_str();
+  }
+  if (resolver == nullptr) {
+    return nullptr;
+  }
+  return resolver(static_cast<uint32_t>(entry.ordinal()));
+}
+
+static bool has_ordinals(const Import& imp) {
+  Import::it_const_entries entries = imp.entries();
+  return std::any_of(std::begin(entries), std::end(entries),
+                     [] (const ImportEntry& entry) { return entry.is_ordinal(); });
+}
+
 std::string get_imphash_std(const Binary& binary) {
   static const std::set<std::string> ALLOWED_EXT = {"dll", "ocx", "sys"};
-  std::vector<uint8_t> md5_buffer(16);
   if (!binary.has_imports()) {
     return "";
   }
@@ -166,34 +225,30 @@ std::string get_imphash_std(const Binary& binary) {
   bool first_entry = true;
   hashstream hs(hashstream::HASH::MD5);
   for (const Import& imp : binary.imports()) {
-    Import resolved = imp;
-    if (auto resolution = resolve_ordinals(imp, /* strict */ false, /* use_std */ true)) {
-      resolved = std::move(*resolution);
-    }
-
-    size_t ext_idx = resolved.name().find_last_of('.');
-    std::string name = resolved.name();
-    std::string ext;
-    if (ext_idx != std::string::npos) {
-      ext = to_lower(resolved.name().substr(ext_idx + 1));
-    }
-    if (ALLOWED_EXT.find(ext) != std::end(ALLOWED_EXT)) {
-      name = name.substr(0, ext_idx);
+    // The whole entry string is lowercased, so we can work on the lowercase
+    // library name from the beginning
+    std::string name = to_lower(imp.name());
+    ordinal_resolver_t resolver = has_ordinals(imp) ?
+                                  get_ordinal_resolver(name, /*use_std=*/true) : nullptr;
+
+    size_t ext_idx = name.find_last_of('.');
+    if (ext_idx != std::string::npos &&
+        ALLOWED_EXT.find(name.substr(ext_idx + 1)) != std::end(ALLOWED_EXT))
+    {
+      name.resize(ext_idx);
     }
 
     std::string entries_string;
-    for (const ImportEntry& e : resolved.entries()) {
-      std::string funcname;
-      if (e.is_ordinal()) {
-        funcname = "ord" + std::to_string(e.ordinal());
-      } else {
-        funcname = e.name();
-      }
-
+    for (const ImportEntry& e : imp.entries()) {
       if (!entries_string.empty()) {
         entries_string += ',';
       }
-      entries_string.append(name).append(".").append(funcname);
+      entries_string.append(name).append(".");
+      if (const char* funcname = resolved_name(e, resolver)) {
+        entries_string.append(funcname);
+      } else {
+        entries_string.append("ord").append(std::to_string(e.ordinal()));
+      }
     }
     if (!first_entry) {
       lstr += ',';
@@ -221,28 +276,22 @@ std::string get_imphash_lief(const Binary& binary) {
 
   std::string import_list;
   for (const Import& imp : imports) {
-    Import resolved = imp;
-    if (auto resolution = resolve_ordinals(imp)) {
-      resolved = std::move(*resolution);
-    }
-
-    size_t ext_idx = resolved.name().find_last_of('.');
-    std::string name_without_ext = resolved.name();
+    std::string name_without_ext = to_lower(imp.name());
+    ordinal_resolver_t resolver = has_ordinals(imp) ?
+                                  get_ordinal_resolver(name_without_ext, /*use_std=*/false) : nullptr;
 
+    size_t ext_idx = name_without_ext.find_last_of('.');
     if (ext_idx != std::string::npos) {
-      name_without_ext = name_without_ext.substr(0, ext_idx);
+      name_without_ext.resize(ext_idx);
     }
 
     std::string entries_string;
-    for (const ImportEntry& e : resolved.entries()) {
-      if (e.is_ordinal()) {
-        entries_string.append(name_without_ext)
-                      .append(".#")
-                      .append(std::to_string(e.ordinal()));
+    for (const ImportEntry& e : imp.entries()) {
+      entries_string.append(name_without_ext);
+      if (const char* funcname = resolved_name(e, resolver)) {
+        entries_string.append(".").append(funcname);
       } else {
-        entries_string.append(name_without_ext)
-                      .append(".")
-                      .append(e.name());
+        entries_string.append(".#").append(std::to_string(e.ordinal()));
       }
     }
     import_list += to_lower(entries_string);
@@ -273,38 +322,6 @@ std::string get_imphash(const Binary& binary, IMPHASH_MODE mode) {
 }
 
 result<Import> resolve_ordinals(const Import& import, bool strict, bool use_std) {
-  static const std::unordered_map<std::string, const char* (*)(uint32_t)>
-  ordinals_library_tables =
-  {
-    { "kernel32.dll",   &kernel32_dll_lookup },
-    { "ntdll.dll",      &ntdll_dll_lookup    },
-    { "advapi32.dll",   &advapi32_dll_lookup },
-    { "msvcp110.dll",   &msvcp110_dll_lookup },
-    { "msvcp120.dll",   &msvcp120_dll_lookup },
-    { "msvcr100.dll",   &msvcr100_dll_lookup },
-    { "msvcr110.dll",   &msvcr110_dll_lookup },
-    { "msvcr120.dll",   &msvcr120_dll_lookup },
-    { "user32.dll",     &user32_dll_lookup   },
-    { "comctl32.dll",   &comctl32_dll_lookup },
-    { "ws2_32.dll",     &ws2_32_dll_lookup   },
-    { "shcore.dll",     &shcore_dll_lookup   },
-    { "oleaut32.dll",   &oleaut32_dll_lookup },
-    { "mfc42u.dll",     &mfc42u_dll_lookup   },
-    { "shlwapi.dll",    &shlwapi_dll_lookup  },
-    { "gdi32.dll",      &gdi32_dll_lookup    },
-    { "shell32.dll",    &shell32_dll_lookup  },
-  };
-
-  static const std::unordered_map<std::string, const char* (*)(uint32_t)>
-  imphashstd_ordinals_library_tables =
-  {
-    { "ws2_32.dll",     &ws2_32_dll_lookup   },
-    { "wsock32.dll",    &ws2_32_dll_lookup   },
-    { "oleaut32.dll",   &oleaut32_dll_lookup },
-  };
-
-  using ordinal_resolver_t = const char*(*)(uint32_t);
-
   Import::it_const_entries entries = import.entries();
 
   if (std::all_of(std::begin(entries), std::end(entries),
@@ -315,18 +332,7 @@ result<Import> resolve_ordinals(const Import& import, bool strict, bool use_std)
 
   std::string name = to_lower(import.name());
 
-  ordinal_resolver_t ordinal_resolver = nullptr;
-  if (use_std) {
-    auto it = imphashstd_ordinals_library_tables.find(name);
-    if (it != std::end(imphashstd_ordinals_library_tables)) {
-      ordinal_resolver = it->second;
-    }
-  } else {
-    auto it = ordinals_library_tables.find(name);
-    if (it != std::end(ordinals_library_tables)) {
-      ordinal_resolver = it->second;
-    }
-  }
+  ordinal_resolver_t ordinal_resolver = get_ordinal_resolver(name, use_std);
 
   if (ordinal_resolver == nullptr) {
     if (strict) {
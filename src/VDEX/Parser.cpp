@@ -35,20 +35,26 @@ namespace VDEX {
 Parser::~Parser() = default;
 Parser::Parser()  = default;
 
-std::unique_ptr<File> Parser::parse(const std::string& filename) {
-  Parser parser{filename};
+std::unique_ptr<File> Parser::parse(const std::string& filename,
+                                    const ParserConfig& config)
+{
+  Parser parser{filename, config};
   return std::unique_ptr<File>{parser.file_};
 }
 
-std::unique_ptr<File> Parser::parse(const std::vector<uint8_t>& data, const std::string& name) {
-  Parser parser{data, name};
+std::unique_ptr<File> Parser::parse(const std::vector<uint8_t>& data, const std::string& name,
+                                    const ParserConfig& config)
+{
+  Parser parser{data, name, config};
   return std::unique_ptr<File>{parser.file_};
 }
 
 
-Parser::Parser(const std::vector<uint8_t>& data, const std::string& name) :
+Parser::Parser(const std::vector<uint8_t>& data, const std::string& name,
+               const ParserConfig& config) :
   file_{new File{}},
-  stream_{std::make_unique<VectorStream>(data)}
+  stream_{std::make_unique<VectorStream>(data)},
+  config_{config}
 {
   if (!is_vdex(data)) {
     LIEF_ERR("{} is not a VDEX file!", name);
@@ -61,8 +67,9 @@ Parser::Parser(const std::vector<uint8_t>& data, const std::string& name) :
   init(name, version);
 }
 
-Parser::Parser(const std::string& file) :
-  file_{new File{}}
+Parser::Parser(const std::string& file, const ParserConfig& config) :
+  file_{new File{}},
+  config_{config}
 {
   if (!is_vdex(file)) {
     LIEF_ERR("{} is not a VDEX file!", file);
@@ -31,11 +31,21 @@ namespace VDEX {
 template<typename VDEX_T>
 void Parser::parse_file() {
 
+  LIEF_DEBUG("{}", config_.to_string());
   parse_header<VDEX_T>();
   parse_checksums<VDEX_T>();
-  parse_dex_files<VDEX_T>();
-  parse_verifier_deps<VDEX_T>();
-  parse_quickening_info<VDEX_T>();
+
+  if (config_.parse_dex_files) {
+    parse_dex_files<VDEX_T>();
+  }
+
+  if (config_.parse_verifier_deps) {
+    parse_verifier_deps<VDEX_T>();
+  }
+
+  if (config_.parse_dex_files && config_.parse_quickening_info) {
+    parse_quickening_info<VDEX_T>();
+  }
 
 }
 
@@ -54,7 +64,15 @@ void Parser::parse_header() {
 
 template<typename VDEX_T>
 void Parser::parse_checksums() {
-  //TODO
+  using vdex_header = typename VDEX_T::vdex_header;
+  const size_t nb_dex_files = file_->header().nb_dex_files();
+  const auto* checksums =
+    stream_->peek_array<details::checksum_t>(sizeof(vdex_header), nb_dex_files);
+  if (checksums == nullptr) {
+    LIEF_WARN("Can't read the DEX checksums");
+    return;
+  }
+  file_->checksums_ = {checksums, checksums + nb_dex_files};
 }
 
 template<typename VDEX_T>
@@ -65,13 +83,10 @@ void Parser::parse_dex_files() {
   uint64_t current_offset = sizeof(vdex_header) + nb_dex_files * sizeof(details::checksum_t);
   current_offset = align(current_offset, sizeof(uint32_t));
 
+  // The DEX files are parsed from views on the VDEX content
+  std::vector<span<const uint8_t>> dex_files;
+  dex_files.reserve(nb_dex_files);
   for (size_t i = 0; i < nb_dex_files; ++i) {
-    std::string name = "classes";
-    if (i > 0) {
-      name += std::to_string(i + 1);
-    }
-    name += ".dex";
-
     const auto res_dex_hdr = stream_->peek<DEX::details::header>(current_offset);
     if (!res_dex_hdr) {
       break;
@@ -80,21 +95,24 @@ void Parser::parse_dex_files() {
     const auto* data = stream_->peek_array<uint8_t>(current_offset, dex_hdr.file_size);
     if (data == nullptr) {
       LIEF_WARN("File #{:d} is corrupted!", i);
-      continue;
-    }
-
-    std::vector<uint8_t> data_v = {data, data + dex_hdr.file_size};
-
-    if (DEX::is_dex(data_v)) {
-      std::unique_ptr<DEX::File> dexfile = DEX::Parser::parse(std::move(data_v), name);
-      dexfile->name(name);
-      file_->dex_files_.push_back(std::move(dexfile));
+      dex_files.emplace_back();
     } else {
-      LIEF_WARN("File #{:d} is not a dex file!", i);
+      dex_files.emplace_back(data, dex_hdr.file_size);
     }
     current_offset += dex_hdr.file_size;
     current_offset = align(current_offset, sizeof(uint32_t));
   }
+
+  std::vector<std::unique_ptr<DEX::File>> files = DEX::Parser::parse_all(dex_files);
+  for (size_t i = 0; i < files.size(); ++i) {
+    if (files[i] == nullptr) {
+      if (!dex_files[i].empty()) {
+        LIEF_WARN("File #{:d} is not a dex file!", i);
+      }
+      continue;
+    }
+    file_->dex_files_.push_back(std::move(files[i]));
+  }
 }
 
 
@@ -102,14 +120,27 @@ template<typename VDEX_T>
 void Parser::parse_verifier_deps() {
   using vdex_header = typename VDEX_T::vdex_header;
 
-  uint64_t deps_offset = align(sizeof(vdex_header) + file_->header().dex_size(), sizeof(uint32_t));
+  uint64_t deps_offset = sizeof(vdex_header);
+  deps_offset += file_->header().nb_dex_files() * sizeof(details::checksum_t);
+  deps_offset += file_->header().dex_size();
+  deps_offset = align(deps_offset, sizeof(uint32_t));
 
-  LIEF_DEBUG("Parsing Verifier deps at 0x{:x}", deps_offset);
+  const uint32_t deps_size = file_->header().verifier_deps_size();
 
-  // 1. String table
-  // ===============
-  //val = stream_->read_uleb128(deps_offset);
-  //deps_offset += val.second;
+  LIEF_DEBUG("Verifier deps at 0x{:x} (0x{:x} bytes)", deps_offset, deps_size);
+
+  if (deps_size == 0) {
+    return;
+  }
+
+  // The ULEB128 stream is compact enough to be kept as-is. The records are
+  // decoded on demand by VerifierDeps::Iterator
+  const auto* raw = stream_->peek_array<uint8_t>(deps_offset, deps_size);
+  if (raw == nullptr) {
+    LIEF_WARN("The verifier deps are corrupted");
+    return;
+  }
+  file_->verifier_deps_ = {raw, raw + deps_size};
 }
 
 
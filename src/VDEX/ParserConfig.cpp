@@ -0,0 +1,34 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LIEF/VDEX/ParserConfig.hpp"
+#include <spdlog/fmt/fmt.h>
+#include <sstream>
+
+namespace LIEF::VDEX {
+
+std::string ParserConfig::to_string() const {
+  static constexpr auto WIDTH = 21;
+  using namespace fmt;
+  std::ostringstream os;
+  os << "ParserConfig {\n"
+     << format("  {:{}}: {}\n", "parse_dex_files", WIDTH, parse_dex_files)
+     << format("  {:{}}: {}\n", "parse_verifier_deps", WIDTH, parse_verifier_deps)
+     << format("  {:{}}: {}\n", "parse_quickening_info", WIDTH, parse_quickening_info)
+     << "}\n";
+  return os.str();
+}
+
+}
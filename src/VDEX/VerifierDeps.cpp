@@ -0,0 +1,210 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+
+#include "logging.hpp"
+#include "frozen.hpp"
+
+#include "LIEF/BinaryStream/SpanStream.hpp"
+#include "LIEF/VDEX/VerifierDeps.hpp"
+
+namespace LIEF {
+namespace VDEX {
+
+// Number of ULEB128 values for each kind of record
+static constexpr uint32_t RECORD_SIZES[] = {
+  /* ASSIGNABLE_TYPE   */ 2,
+  /* UNASSIGNABLE_TYPE */ 2,
+  /* CLASS             */ 2,
+  /* FIELD             */ 3,
+  /* DIRECT_METHOD     */ 3,
+  /* VIRTUAL_METHOD    */ 3,
+  /* INTERFACE_METHOD  */ 3,
+  /* UNVERIFIED_CLASS  */ 1,
+};
+
+// Skip the extra strings (null-terminated) located at the current position
+static bool skip_strings(SpanStream& stream, uint64_t nb_strings) {
+  const uint8_t* start = stream.start();
+  const size_t size = stream.size();
+  size_t pos = stream.pos();
+  for (size_t i = 0; i < nb_strings; ++i) {
+    if (pos >= size) {
+      return false;
+    }
+    const void* zero = std::memchr(start + pos, 0, size - pos);
+    if (zero == nullptr) {
+      return false;
+    }
+    pos = static_cast<const uint8_t*>(zero) - start + 1;
+  }
+  stream.setpos(pos);
+  return true;
+}
+
+// Skip the extra strings and the records of the DEX file located at the
+// current position
+static bool skip_dex(SpanStream& stream) {
+  auto nb_strings = stream.read_uleb128();
+  if (!nb_strings || !skip_strings(stream, *nb_strings)) {
+    return false;
+  }
+
+  for (uint32_t record_size : RECORD_SIZES) {
+    auto count = stream.read_uleb128();
+    if (!count || *count > stream.size() - stream.pos()) {
+      return false;
+    }
+    for (size_t j = 0; j < *count * record_size; ++j) {
+      if (!stream.read_uleb128()) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+uint32_t VerifierDeps::record_t::size() const {
+  return RECORD_SIZES[static_cast<uint32_t>(kind)];
+}
+
+std::string VerifierDeps::record_t::to_string() const {
+  std::string out = VDEX::to_string(kind);
+  out += " (dex #" + std::to_string(dex_idx) + "):";
+  for (size_t i = 0; i < size(); ++i) {
+    out += ' ' + std::to_string(values[i]);
+  }
+  return out;
+}
+
+VerifierDeps::Iterator::Iterator(span<const uint8_t> content, uint32_t nb_dex_files) :
+  content_(content),
+  nb_dex_files_(nb_dex_files)
+{
+  next();
+}
+
+void VerifierDeps::Iterator::next() {
+  if (pos_ == END) {
+    return;
+  }
+
+  SpanStream stream(content_);
+  stream.setpos(pos_);
+
+  while (remaining_ == 0) {
+    if (new_dex_) {
+      if (record_.dex_idx >= nb_dex_files_) {
+        return stop();
+      }
+      auto nb_strings = stream.read_uleb128();
+      if (!nb_strings || !skip_strings(stream, *nb_strings)) {
+        LIEF_DEBUG("Verifier deps of the DEX file #{} are corrupted", record_.dex_idx);
+        return stop();
+      }
+      new_dex_ = false;
+      record_.kind = KIND::ASSIGNABLE_TYPE;
+    } else if (record_.kind == KIND::UNVERIFIED_CLASS) {
+      ++record_.dex_idx;
+      new_dex_ = true;
+      continue;
+    } else {
+      record_.kind = static_cast<KIND>(static_cast<uint32_t>(record_.kind) + 1);
+    }
+
+    auto count = stream.read_uleb128();
+    // A record takes at least one byte per value
+    if (!count || *count > stream.size() - stream.pos()) {
+      LIEF_DEBUG("Verifier deps of the DEX file #{} are corrupted", record_.dex_idx);
+      return stop();
+    }
+    remaining_ = *count;
+  }
+
+  record_.values = {0, 0, 0};
+  for (size_t i = 0; i < record_.size(); ++i) {
+    auto value = stream.read_uleb128();
+    if (!value) {
+      return stop();
+    }
+    record_.values[i] = static_cast<uint32_t>(*value);
+  }
+  --remaining_;
+  pos_ = stream.pos();
+}
+
+std::vector<std::string> VerifierDeps::strings(uint32_t dex_idx) const {
+  if (dex_idx >= nb_dex_files_) {
+    return {};
+  }
+
+  SpanStream stream(content_);
+  for (uint32_t i = 0; i < dex_idx; ++i) {
+    if (!skip_dex(stream)) {
+      return {};
+    }
+  }
+
+  auto nb_strings = stream.read_uleb128();
+  if (!nb_strings || *nb_strings > stream.size() - stream.pos()) {
+    return {};
+  }
+
+  std::vector<std::string> strings;
+  strings.reserve(*nb_strings);
+  for (size_t i = 0; i < *nb_strings; ++i) {
+    auto str = stream.read_string();
+    if (!str) {
+      break;
+    }
+    strings.push_back(std::move(*str));
+  }
+  return strings;
+}
+
+result<uint64_t> VerifierDeps::consumed_size() const {
+  SpanStream stream(content_);
+  for (uint32_t i = 0; i < nb_dex_files_; ++i) {
+    if (!skip_dex(stream)) {
+      LIEF_DEBUG("Verifier deps of the DEX file #{} are corrupted", i);
+      return make_error_code(lief_errors::corrupted);
+    }
+  }
+  return stream.pos();
+}
+
+const char* to_string(VerifierDeps::KIND kind) {
+  #define ENTRY(X) std::pair(VerifierDeps::KIND::X, #X)
+  STRING_MAP enums2str {
+    ENTRY(ASSIGNABLE_TYPE),
+    ENTRY(UNASSIGNABLE_TYPE),
+    ENTRY(CLASS),
+    ENTRY(FIELD),
+    ENTRY(DIRECT_METHOD),
+    ENTRY(VIRTUAL_METHOD),
+    ENTRY(INTERFACE_METHOD),
+    ENTRY(UNVERIFIED_CLASS),
+  };
+  #undef ENTRY
+
+  if (auto it = enums2str.find(kind); it != enums2str.end()) {
+    return it->second;
+  }
+  return "UNKNOWN";
+}
+
+}
+}
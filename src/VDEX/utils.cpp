@@ -23,7 +23,7 @@
 namespace LIEF {
 namespace VDEX {
 
-inline bool is_vdex(BinaryStream& stream) {
+bool is_vdex(BinaryStream& stream) {
   using magic_t = std::array<char, sizeof(details::magic)>;
   if (auto magic_res = stream.peek<magic_t>(0)) {
     const auto magic = *magic_res;
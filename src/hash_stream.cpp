@@ -23,86 +23,69 @@ inline mbedtls_md_context_t* cast(std::unique_ptr<intptr_t>& in) {
   return reinterpret_cast<mbedtls_md_context_t*>(in.get());
 }
 
-hashstream::hashstream(HASH type) :
-  ctx_{reinterpret_cast<intptr_t*>(new mbedtls_md_context_t{})}
-{
-  int ret = 0;
-  mbedtls_md_init(cast(ctx_));
+inline mbedtls_md_type_t md_type(hashstream::HASH type) {
   switch (type) {
-    case HASH::MD5:
-      {
-        const mbedtls_md_info_t* info = mbedtls_md_info_from_type(MBEDTLS_MD_MD5);
-        ret = mbedtls_md_setup(cast(ctx_), info, 0);
-        this->output_.resize(mbedtls_md_get_size(info));
-        break;
-      }
-
-    case HASH::SHA1:
-      {
-        const mbedtls_md_info_t* info = mbedtls_md_info_from_type(MBEDTLS_MD_SHA1);
-        ret = mbedtls_md_setup(cast(ctx_), info, 0);
-        this->output_.resize(mbedtls_md_get_size(info));
-        break;
-      }
-
-    case HASH::SHA224:
-      {
-        const mbedtls_md_info_t* info = mbedtls_md_info_from_type(MBEDTLS_MD_SHA224);
-        ret = mbedtls_md_setup(cast(ctx_), info, 0);
-        this->output_.resize(mbedtls_md_get_size(info));
-        break;
-      }
-
-    case HASH::SHA256:
-      {
-        const mbedtls_md_info_t* info = mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
-        ret = mbedtls_md_setup(cast(ctx_), info, 0);
-        this->output_.resize(mbedtls_md_get_size(info));
-        break;
-      }
+    case hashstream::HASH::MD5:    return MBEDTLS_MD_MD5;
+    case hashstream::HASH::SHA1:   return MBEDTLS_MD_SHA1;
+    case hashstream::HASH::SHA224: return MBEDTLS_MD_SHA224;
+    case hashstream::HASH::SHA256: return MBEDTLS_MD_SHA256;
+    case hashstream::HASH::SHA384: return MBEDTLS_MD_SHA384;
+    case hashstream::HASH::SHA512: return MBEDTLS_MD_SHA512;
+  }
+  return MBEDTLS_MD_NONE;
+}
 
-    case HASH::SHA384:
-      {
-        const mbedtls_md_info_t* info = mbedtls_md_info_from_type(MBEDTLS_MD_SHA384);
-        ret = mbedtls_md_setup(cast(ctx_), info, 0);
-        this->output_.resize(mbedtls_md_get_size(info));
-        break;
-      }
+hashstream::hashstream(HASH type) :
+  hashstream(std::vector<HASH>{type})
+{}
 
+hashstream::hashstream(const std::vector<HASH>& types) {
+  ctx_.reserve(types.size());
+  outputs_.reserve(types.size());
+  for (HASH type : types) {
+    auto& ctx = ctx_.emplace_back(reinterpret_cast<intptr_t*>(new mbedtls_md_context_t{}));
+    std::vector<uint8_t>& output = outputs_.emplace_back();
+    mbedtls_md_init(cast(ctx));
 
-    case HASH::SHA512:
-      {
-        const mbedtls_md_info_t* info = mbedtls_md_info_from_type(MBEDTLS_MD_SHA512);
-        ret = mbedtls_md_setup(cast(ctx_), info, 0);
-        this->output_.resize(mbedtls_md_get_size(info));
-        break;
-      }
-  }
-  mbedtls_md_starts(cast(this->ctx_));
-  if (ret != 0) {
-    LIEF_WARN("Error while setting up hash function");
+    const mbedtls_md_info_t* info = mbedtls_md_info_from_type(md_type(type));
+    int ret = mbedtls_md_setup(cast(ctx), info, 0);
+    output.resize(mbedtls_md_get_size(info));
+    mbedtls_md_starts(cast(ctx));
+    if (ret != 0) {
+      LIEF_WARN("Error while setting up hash function");
+    }
   }
 }
 
 hashstream& hashstream::write(const uint8_t* s, size_t n) {
-  int ret = mbedtls_md_update(cast(this->ctx_), s, n);
-  if (ret != 0) {
-    LIEF_WARN("mbedtls_md_update(0x{}, 0x{:x}) failed with retcode: 0x{:x}", reinterpret_cast<uintptr_t>(s), n, ret);
+  for (std::unique_ptr<md_context_t>& ctx : ctx_) {
+    int ret = mbedtls_md_update(cast(ctx), s, n);
+    if (ret != 0) {
+      LIEF_WARN("mbedtls_md_update(0x{}, 0x{:x}) failed with retcode: 0x{:x}", reinterpret_cast<uintptr_t>(s), n, ret);
+    }
   }
   return *this;
 }
 
 hashstream& hashstream::flush() {
-  int ret = mbedtls_md_finish(cast(this->ctx_), this->output_.data());
-  if (ret != 0) {
-    LIEF_WARN("mbedtls_md_finish() failed with retcode: 0x{:x}", ret);
+  if (finished_) {
+    return *this;
   }
+  for (size_t i = 0; i < ctx_.size(); ++i) {
+    int ret = mbedtls_md_finish(cast(ctx_[i]), outputs_[i].data());
+    if (ret != 0) {
+      LIEF_WARN("mbedtls_md_finish() failed with retcode: 0x{:x}", ret);
+    }
+  }
+  finished_ = true;
   return *this;
 }
 
 hashstream::~hashstream() {
-  mbedtls_md_free(cast(ctx_));
-  delete reinterpret_cast<mbedtls_md_context_t*>(ctx_.release());
+  for (std::unique_ptr<md_context_t>& ctx : ctx_) {
+    mbedtls_md_free(cast(ctx));
+    delete reinterpret_cast<mbedtls_md_context_t*>(ctx.release());
+  }
 }
 
 
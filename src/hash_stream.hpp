@@ -36,6 +36,11 @@ class hashstream {
   };
   hashstream(HASH type);
 
+  /// Compute the digests of the same input with several algorithms in a
+  /// single pass. The digests are accessed with raw(size_t) in the order of
+  /// `types`.
+  hashstream(const std::vector<HASH>& types);
+
   hashstream& write(const uint8_t* s, size_t n);
   hashstream& put(uint8_t c) {
     return write(&c, 1);
@@ -79,21 +84,32 @@ class hashstream {
 
   hashstream& get(std::vector<uint8_t>& c) {
     flush();
-    c = output_;
+    c = outputs_[0];
     return *this;
   }
   hashstream& flush();
 
   std::vector<uint8_t>& raw() {
+    return raw(0);
+  }
+
+  std::vector<uint8_t>& raw(size_t idx) {
     flush();
-    return output_;
+    return outputs_[idx];
   }
+
+  /// Number of digests computed by this stream
+  size_t size() const {
+    return ctx_.size();
+  }
+
   ~hashstream();
 
   private:
-  std::vector<uint8_t> output_;
   using md_context_t = intptr_t;
-  std::unique_ptr<md_context_t> ctx_;
+  std::vector<std::vector<uint8_t>> outputs_;
+  std::vector<std::unique_ptr<md_context_t>> ctx_;
+  bool finished_ = false;
 };
 
 
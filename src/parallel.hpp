@@ -0,0 +1,76 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_PARALLEL_H
+#define LIEF_PARALLEL_H
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace LIEF {
+
+/// Return the number of worker threads that can be used by the
+/// parallel helpers (at least 1)
+inline size_t nb_workers() {
+  const unsigned hw = std::thread::hardware_concurrency();
+  return hw == 0 ? 1 : hw;
+}
+
+/// Call `fn(i)` for each `i` in `[0, count)` using a pool of worker threads.
+///
+/// Items are dispatched through a shared counter so that unbalanced items
+/// (e.g. sections of different sizes) are spread over the workers. The caller
+/// thread also processes items.
+///
+/// `fn` must be safe to call concurrently for **different** indexes. The
+/// order in which the items are processed is unspecified, therefore callers
+/// must write their output in a per-index slot and merge it afterward if
+/// they need a deterministic result.
+///
+/// The loop runs serially when `count < min_items` or when only one worker
+/// is available.
+template<class F>
+void parallel_for(size_t count, F&& fn, size_t min_items = 2) {
+  const size_t nb_threads = std::min(nb_workers(), count);
+  if (nb_threads <= 1 || count < min_items) {
+    for (size_t i = 0; i < count; ++i) {
+      fn(i);
+    }
+    return;
+  }
+
+  std::atomic<size_t> next{0};
+  auto worker = [&] {
+    for (size_t i = next++; i < count; i = next++) {
+      fn(i);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(nb_threads - 1);
+  for (size_t i = 1; i < nb_threads; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+
+  for (std::thread& t : threads) {
+    t.join();
+  }
+}
+
+}
+#endif
@@ -0,0 +1,162 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <array>
+
+#include "LIEF/utils.hpp"
+
+#include "string_table.hpp"
+#include "parallel.hpp"
+
+namespace LIEF {
+
+// Below this number of strings, the buckets are sorted in the current thread
+static constexpr size_t PARALLEL_THRESHOLD = 0x10000;
+
+// Character at the position `pos` starting from the end of the string or -1
+// if the string is shorter
+static inline int char_tail_at(std::string_view str, size_t pos) {
+  if (pos >= str.size()) {
+    return -1;
+  }
+  return static_cast<uint8_t>(str[str.size() - pos - 1]);
+}
+
+// Index of the bucket associated with the last character of the string.
+// Bucket 0 is for the strings ending with 0xFF, ..., bucket 255 for the
+// strings ending with 0x00 and bucket 256 for the empty strings
+static inline size_t bucket_of(std::string_view str) {
+  return 255 - char_tail_at(str, 0);
+}
+
+static inline bool ends_with(std::string_view str, std::string_view suffix) {
+  return str.size() >= suffix.size() &&
+         str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// Three-way radix quicksort of the reversed strings in decreasing order.
+// With this order, a string comes right after the strings it is a suffix of.
+// Contrary to a comparison-based sort, the characters already known to be
+// equal (before `pos`) are not compared again.
+static void multikey_sort(std::string_view* strings, size_t size, size_t pos) {
+  while (size > 1) {
+    // Partition the strings so that [0, i) are greater than the pivot,
+    // [i, j) are equal to the pivot and [j, size) are less than the pivot.
+    const int pivot = char_tail_at(strings[0], pos);
+    size_t i = 0;
+    size_t j = size;
+    for (size_t k = 1; k < j;) {
+      const int c = char_tail_at(strings[k], pos);
+      if (c > pivot) {
+        std::swap(strings[i++], strings[k++]);
+      } else if (c < pivot) {
+        std::swap(strings[--j], strings[k]);
+      } else {
+        ++k;
+      }
+    }
+    multikey_sort(strings, i, pos);
+    multikey_sort(strings + j, size - j, pos);
+
+    if (pivot == -1) {
+      // The strings in [i, j) are identical
+      return;
+    }
+    strings += i;
+    size = j - i;
+    ++pos;
+  }
+}
+
+size_t StringTableBuilder::build(std::vector<uint8_t>& output, offsets_t& offsets,
+                                 size_t alignment)
+{
+  static constexpr size_t NB_BUCKETS = 257;
+  std::array<size_t, NB_BUCKETS + 1> bounds{};
+
+  size_t naive_size = 1;
+  for (std::string_view str : strings_) {
+    ++bounds[bucket_of(str) + 1];
+    naive_size += str.size() + 1;
+  }
+
+  for (size_t i = 1; i < bounds.size(); ++i) {
+    bounds[i] += bounds[i - 1];
+  }
+
+  std::vector<std::string_view> sorted(strings_.size());
+  {
+    std::array<size_t, NB_BUCKETS + 1> pos = bounds;
+    for (std::string_view str : strings_) {
+      sorted[pos[bucket_of(str)]++] = str;
+    }
+  }
+
+  // The strings of a bucket share their last character
+  auto sort_bucket = [&] (size_t bucket) {
+    multikey_sort(sorted.data() + bounds[bucket],
+                  bounds[bucket + 1] - bounds[bucket], /*pos=*/1);
+  };
+
+  if (sorted.size() < PARALLEL_THRESHOLD) {
+    for (size_t bucket = 0; bucket < NB_BUCKETS - 1; ++bucket) {
+      sort_bucket(bucket);
+    }
+  } else {
+    parallel_for(NB_BUCKETS - 1, sort_bucket);
+  }
+
+  // The buffer is reserved upfront so that the views used as keys in
+  // `offsets` are not invalidated while the table is written
+  output.clear();
+  output.reserve(align(naive_size, alignment));
+  output.push_back(0);
+
+  offsets.clear();
+  offsets.reserve(strings_.size() + 1);
+  offsets.emplace(std::string_view(), 0);
+
+  auto view = [&output] (size_t offset, size_t size) {
+    return std::string_view(reinterpret_cast<const char*>(output.data()) + offset, size);
+  };
+
+  std::string_view prev;
+  size_t prev_offset = 0;
+  for (std::string_view str : sorted) {
+    if (str.empty()) {
+      continue;
+    }
+
+    if (ends_with(prev, str)) {
+      const size_t offset = prev_offset + prev.size() - str.size();
+      offsets.emplace(view(offset, str.size()), offset);
+      continue;
+    }
+
+    prev_offset = output.size();
+    output.insert(output.end(), str.begin(), str.end());
+    output.push_back(0);
+
+    prev = view(prev_offset, str.size());
+    offsets.emplace(prev, prev_offset);
+  }
+
+  const size_t saved = naive_size - output.size();
+  output.resize(align(output.size(), alignment), 0);
+  strings_.clear();
+  return saved;
+}
+
+}
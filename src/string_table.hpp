@@ -0,0 +1,70 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_STRING_TABLE_H
+#define LIEF_STRING_TABLE_H
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace LIEF {
+
+/// Builder for the NUL-terminated string tables used by the ELF
+/// (`.dynstr`, `.strtab`, `.shstrtab`) and Mach-O (`LC_SYMTAB`) formats.
+///
+/// Strings that are a suffix of another string are merged into the latter
+/// (tail merging): `bar` is stored as the tail of `foobar`. To find these
+/// suffixes, the strings are sorted on their reversed characters with a
+/// multikey quicksort which runs in parallel on the buckets associated with
+/// the last character.
+///
+/// The builder only manipulates views on the strings: their memory must
+/// remain valid until build() returns.
+class StringTableBuilder {
+  public:
+  /// Map a string to its offset in the table. The keys reference the
+  /// table's buffer.
+  using offsets_t = std::unordered_map<std::string_view, size_t>;
+
+  StringTableBuilder() = default;
+
+  void reserve(size_t size) {
+    strings_.reserve(size);
+  }
+
+  void add(std::string_view str) {
+    strings_.push_back(str);
+  }
+
+  /// Write the table in `output` and fill `offsets` with the offset of each
+  /// string added to the builder.
+  ///
+  /// The table starts with a null byte (the empty string is at offset 0) and
+  /// its size is padded with zeros to a multiple of `alignment`.
+  ///
+  /// As the keys of `offsets` point into `output`'s buffer, `output` must not
+  /// be modified (nor re-allocated) as long as `offsets` is used.
+  ///
+  /// Return the number of bytes saved by the merging.
+  size_t build(std::vector<uint8_t>& output, offsets_t& offsets,
+               size_t alignment = 1);
+
+  private:
+  std::vector<std::string_view> strings_;
+};
+
+}
+#endif
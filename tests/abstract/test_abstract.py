@@ -113,3 +113,23 @@ def test_entropy():
 
     assert weird_section_0 >= 0
     assert weird_section_1 >= 0
+
+def test_identify():
+    FMT = lief.FILE_FORMATS
+    assert lief.identify(get_sample('ELF/ELF32_x86_binary_ls.bin')) == FMT.ELF
+    assert lief.identify(get_sample('PE/PE64_x86-64_binary_ConsoleApplication1.exe')) == FMT.PE
+    assert lief.identify(get_sample('MachO/MachO64_x86-64_binary_id.bin')) == FMT.MACHO
+    assert lief.identify(get_sample('MachO/FAT_MachO_x86-x86-64-binary_fatall.bin')) == FMT.MACHO_FAT
+    assert lief.identify(get_sample('OAT/OAT_079_x86-64_CallDeviceId.oat')) == FMT.OAT
+    assert lief.identify(get_sample('DEX/DEX35_kik.android.12.8.0.dex')) == FMT.DEX
+    assert lief.identify(get_sample('VDEX/VDEX_06_x86-64_CallDeviceId.vdex')) == FMT.VDEX
+
+    # Same as lief.MachO.is_macho: the number of slices is not bounded
+    fat = b"\xca\xfe\xba\xbe\x00\x00\x00\x20" + b"\x00" * 32 * 20
+    assert lief.identify(fat) == FMT.MACHO_FAT
+    assert lief.identify(b"\xcf\xfa\xed\xfe" + b"\x00" * 28) == FMT.MACHO
+    assert lief.identify(b"MZ") == FMT.UNKNOWN
+    assert lief.identify(b"") == FMT.UNKNOWN
+
+    oat = lief.parse(get_sample('OAT/OAT_079_x86-64_CallDeviceId.oat'))
+    assert isinstance(oat, lief.OAT.Binary)
@@ -0,0 +1,107 @@
+import hashlib
+import shutil
+from pathlib import Path
+
+import lief
+import pytest
+from utils import get_sample
+
+@pytest.mark.parametrize("sample", [
+    "ELF/ELF64_x86-64_binary_ls.bin",
+    "PE/PE64_x86-64_binary_ConsoleApplication1.exe",
+    "MachO/MachO64_x86-64_binary_id.bin",
+])
+def test_cache(tmp_path: Path, sample: str):
+    path = get_sample(sample)
+    binary = lief.parse(path)
+    cache = lief.ParseCache((tmp_path / "cache").as_posix())
+
+    miss = cache.open(path)
+    assert miss is not None
+    assert not miss.from_cache
+
+    hit = cache.open(path)
+    assert hit is not None
+    assert hit.from_cache
+
+    for entry in (miss, hit):
+        assert entry.format == binary.format
+        assert entry.entrypoint == binary.entrypoint
+        assert entry.is_pie == binary.is_pie
+        assert entry.nb_symbols == len(binary.abstract.symbols)
+        assert entry.nb_relocations == len(binary.abstract.relocations)
+        assert entry.nb_exports == len(binary.exported_functions)
+        assert entry.nb_libraries == len(binary.libraries)
+
+        symbols = [entry.symbol_at(i) for i in range(entry.nb_symbols)]
+        assert [s.name for s in symbols] == [s.name for s in binary.abstract.symbols]
+        assert [s.value for s in symbols] == [s.value for s in binary.abstract.symbols]
+
+        relocations = [entry.relocation_at(i) for i in range(entry.nb_relocations)]
+        assert [r.address for r in relocations] == [r.address for r in binary.abstract.relocations]
+
+        exports = [entry.export_at(i) for i in range(entry.nb_exports)]
+        assert [(e.name, e.address) for e in exports] == \
+               [(f.name, f.address) for f in binary.exported_functions]
+
+        assert entry.symbol_at(entry.nb_symbols) is None
+
+    if hit.nb_imports > 0:
+        imp = hit.import_at(0)
+        assert hit.find_import(imp.name).address == imp.address
+    assert hit.find_export("__this_symbol_does_not_exist__") == lief.lief_errors.not_found
+
+def test_config(tmp_path: Path):
+    path = get_sample("ELF/ELF64_x86-64_binary_ls.bin")
+    cache = lief.ParseCache((tmp_path / "cache").as_posix())
+
+    assert not cache.open(path).from_cache
+
+    config = lief.ELF.ParserConfig()
+    config.parse_relocations = False
+    entry = cache.open(path, config)
+    assert not entry.from_cache
+    assert entry.nb_relocations == 0
+    assert cache.open(path, config).from_cache
+
+    # The default configuration of the ELF parser shares the entry of open(path)
+    assert cache.open(path, lief.ELF.ParserConfig()).from_cache
+
+def test_stale(tmp_path: Path):
+    path = tmp_path / "ls.bin"
+    shutil.copy(get_sample("ELF/ELF64_x86-64_binary_ls.bin"), path)
+    cache = lief.ParseCache((tmp_path / "cache").as_posix())
+    assert not cache.open(path.as_posix()).from_cache
+
+    # The entry is keyed by the content: modifying the file invalidates it
+    with open(path, "r+b") as f:
+        f.seek(0x200)
+        f.write(b"\xAA\xBB\xCC\xDD")
+    assert not cache.open(path.as_posix()).from_cache
+
+    for entry in (tmp_path / "cache").iterdir():
+        entry.write_bytes(b"\x00" * 16)
+    assert not cache.open(path.as_posix()).from_cache
+
+def test_digest(tmp_path: Path):
+    path = get_sample("ELF/ELF64_x86-64_binary_ls.bin")
+    cache_dir = tmp_path / "cache"
+    cache = lief.ParseCache(cache_dir.as_posix())
+    assert not cache.open(path).from_cache
+
+    # The entry is keyed by the SHA-256 of the file which is also stored in
+    # the header of the entry (after the magic, the version and the format)
+    digest = hashlib.sha256(Path(path).read_bytes()).digest()
+    entries = list(cache_dir.iterdir())
+    assert len(entries) == 1
+    assert entries[0].name.startswith(digest.hex())
+    raw = bytearray(entries[0].read_bytes())
+    assert raw[16:48] == digest
+
+    raw[16] ^= 0xff
+    entries[0].write_bytes(raw)
+    assert not cache.open(path).from_cache
+    assert cache.open(path).from_cache
+
+    # No temporary file is left in the cache directory
+    assert [e.name for e in cache_dir.iterdir()] == [entries[0].name]
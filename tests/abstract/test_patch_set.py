@@ -0,0 +1,103 @@
+import lief
+import pytest
+from utils import get_sample
+
+SAMPLES = [
+    "ELF/ELF64_x86-64_binary_ls.bin",
+    "PE/PE64_x86-64_binary_ConsoleApplication1.exe",
+    "MachO/MachO64_x86-64_binary_id.bin",
+]
+
+@pytest.mark.parametrize("sample", SAMPLES)
+def test_apply_rollback(sample: str):
+    binary = lief.parse(get_sample(sample))
+    addr = binary.entrypoint
+    original = bytes(binary.get_content_from_virtual_address(addr, 16))
+
+    patches = lief.PatchSet()
+    patches.add(addr + 8, [0xcc] * 4)
+    patches.add(addr, [0x90] * 4)
+    patches.add(addr + 4, 0x11223344, 4) # Adjacent to the previous one (not merged)
+    patches.add(addr + 2, [0x90, 0x90])  # Same bytes: merged
+    assert len(patches) == 4
+
+    assert patches.apply(binary)
+    assert patches.is_applied
+    assert not patches.conflicts
+    assert not patches.unresolved
+
+    content = bytes(binary.get_content_from_virtual_address(addr, 16))
+    assert content[:4] == b"\x90" * 4
+    assert content[4:8] == (0x11223344).to_bytes(4, "little")
+    assert content[8:12] == b"\xcc" * 4
+    assert content[12:] == original[12:]
+
+    # The patches must be rolled back before being applied again
+    assert patches.apply(binary).error == lief.lief_errors.not_supported
+
+    assert patches.rollback(binary)
+    assert not patches.is_applied
+    assert bytes(binary.get_content_from_virtual_address(addr, 16)) == original
+
+def test_conflicts():
+    binary = lief.parse(get_sample(SAMPLES[0]))
+    addr = binary.entrypoint
+    original = bytes(binary.get_content_from_virtual_address(addr, 8))
+
+    patches = lief.PatchSet()
+    patches.add(addr, [0x90] * 4)
+    patches.add(addr + 2, [0xcc] * 4)
+
+    assert patches.apply(binary).error == lief.lief_errors.corrupted
+    assert not patches.is_applied
+    assert len(patches.conflicts) == 1
+    assert patches.conflicts[0].address == addr + 2
+    assert patches.conflicts[0].size == 2
+
+    # Atomic: nothing has been written
+    assert bytes(binary.get_content_from_virtual_address(addr, 8)) == original
+
+def test_unresolved():
+    binary = lief.parse(get_sample(SAMPLES[0]))
+    addr = binary.entrypoint
+    original = bytes(binary.get_content_from_virtual_address(addr, 4))
+
+    patches = lief.PatchSet()
+    patches.add(addr, [0x90] * 4)
+    patches.add(0xdeadbeef0000, [0x90] * 4)
+
+    assert patches.apply(binary).error == lief.lief_errors.not_found
+    assert patches.unresolved == [0xdeadbeef0000]
+    assert bytes(binary.get_content_from_virtual_address(addr, 4)) == original
+
+def test_adjacent_regions():
+    pe = lief.PE.parse(get_sample(SAMPLES[1]))
+    first, second = pe.sections[0], pe.sections[1]
+
+    # Make the first section end where the second one starts
+    size = second.virtual_address - first.virtual_address
+    content = list(first.content)[:size]
+    first.content = content + [0] * (size - len(content))
+    first.virtual_size = size
+
+    boundary = pe.imagebase + second.virtual_address
+    original = bytes(pe.get_content_from_virtual_address(boundary - 4, 8))
+    assert len(original) == 4 # Limited to the first section
+
+    # Adjacent patches on both sides of the boundary
+    patches = lief.PatchSet()
+    patches.add(boundary - 4, [0xcc] * 4)
+    patches.add(boundary, [0x90] * 4)
+
+    assert patches.apply(pe)
+    assert not patches.unresolved
+    assert bytes(pe.get_content_from_virtual_address(boundary - 4, 4)) == b"\xcc" * 4
+    assert bytes(pe.get_content_from_virtual_address(boundary, 4)) == b"\x90" * 4
+
+    assert patches.rollback(pe)
+    assert bytes(pe.get_content_from_virtual_address(boundary - 4, 4)) == original
+
+    # A single patch can't straddle the boundary
+    patches = lief.PatchSet()
+    patches.add(boundary - 2, [0x90] * 4)
+    assert patches.apply(pe).error == lief.lief_errors.not_found
@@ -113,3 +113,93 @@ def test_kik_iterators():
 
 
 
+
+def test_parse_all():
+    raw = open(get_sample('DEX/DEX35_kik.android.12.8.0.dex'), 'rb').read()
+    files = lief.DEX.parse_all([raw, b"not a dex", raw])
+    assert len(files) == 3
+    assert files[1] is None
+
+    assert files[0].name == "classes.dex"
+    assert files[2].name == "classes3.dex"
+    for dex in (files[0], files[2]):
+        assert len(dex.classes) == len(KIK.classes)
+        assert len(dex.methods) == len(KIK.methods)
+        assert dex.header.checksum == KIK.header.checksum
+
+def test_instructions():
+    SafetyNetValidator = KIK.get_class("kik.android.challenge.SafetyNetValidator")
+    method = SafetyNetValidator.get_method("onConnected")[0]
+    insts = list(method.instructions)
+
+    assert [inst.opcode for inst in insts] == [0x55, 0x38, 0x12, 0x5c, 0x70, 0x0e]
+    assert [inst.pc for inst in insts] == [0, 2, 4, 5, 7, 10]
+    assert sum(inst.size for inst in insts) == len(method.bytecode)
+
+    iget = insts[0]
+    assert (iget.vA, iget.vB, iget.vC) == (0, 1, 0x72c0)
+
+    if_eqz = insts[1]
+    assert (if_eqz.vA, if_eqz.vB) == (0, 8)
+
+    invoke = insts[4]
+    assert invoke.vA == 1
+    assert invoke.vB == 0xd076
+    assert invoke.args == [1]
+    assert bytes(invoke.raw) == bytes([0x70, 0x10, 0x76, 0xd0, 0x01, 0x00])
+
+    # Every instruction of the file must be decoded
+    for method in KIK.methods:
+        size = sum(inst.size for inst in method.instructions)
+        assert size == len(method.bytecode)
+
+def test_parser_config():
+    config = lief.DEX.ParserConfig()
+    config.class_filters = ["kik.android.challenge."]
+    config.parse_fields = False
+
+    dex = lief.DEX.parse(get_sample('DEX/DEX35_kik.android.12.8.0.dex'), config=config)
+
+    # The ID tables are still complete
+    assert len(dex.classes) == len(KIK.classes)
+    assert len(dex.methods) == len(KIK.methods)
+    assert len(dex.fields) == len(KIK.fields)
+
+    m1 = dex.get_class("kik.android.challenge.SafetyNetValidator").get_method("onConnected")[0]
+    assert m1.access_flags == [lief.DEX.ACCESS_FLAGS.PUBLIC]
+    assert len(m1.bytecode) == 22
+
+    ValueAnimator = dex.get_class("android.animation.ValueAnimator")
+    assert ValueAnimator is not None
+
+    cls = dex.get_class("com.kik.video.mobile.KikVideoService$JoinConvoConferenceResponse$Result")
+    assert all(len(m.bytecode) == 0 for m in cls.methods)
+
+    assert config.accept_class("Lkik/android/challenge/SafetyNetValidator;")
+    assert not config.accept_class("Lkik/android/chat/Main;")
+
+def test_class_filters():
+    config = lief.DEX.ParserConfig()
+
+    # Java names that start with an 'L'
+    config.class_filters = ["LegacyApp"]
+    assert config.accept_class("LLegacyApp;")
+    assert config.accept_class("LLegacyAppMain;")
+    assert not config.accept_class("LegacyApp;")
+
+    config.class_filters = ["Lcom.foo."]
+    assert config.accept_class("LLcom/foo/Main;")
+    assert not config.accept_class("Lcom/foo/Main;")
+
+    # Descriptors
+    config.class_filters = ["Lcom/foo/"]
+    assert config.accept_class("Lcom/foo/Main;")
+    assert not config.accept_class("Lcom/foobar/Main;")
+
+    config.class_filters = ["LMain;"]
+    assert config.accept_class("LMain;")
+    assert not config.accept_class("LMainActivity;")
+
+    config.class_filters = ["[Lcom/foo/"]
+    assert config.accept_class("[Lcom/foo/Main;")
+    assert not config.accept_class("Lcom/foo/Main;")
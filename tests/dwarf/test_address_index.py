@@ -0,0 +1,133 @@
+import subprocess
+from pathlib import Path
+
+import lief
+import pytest
+from utils import get_compiler, is_linux
+
+if not is_linux():
+    pytest.skip("requires Linux", allow_module_level=True)
+
+SOURCE = """\
+#include <stdio.h>
+static int helper(int x) {
+  return x * 3 + 1;
+}
+
+__attribute__((noinline)) int compute(int a, int b) {
+  int r = 0;
+  for (int i = 0; i < a; ++i) {
+    r += helper(i) ^ b;
+  }
+  return r;
+}
+
+int main(int argc, char** argv) {
+  printf("%d\\n", compute(argc, 4));
+  return 0;
+}
+"""
+
+def compile_with(tmp_path: Path, *flags: str) -> Path:
+    src = tmp_path / "index.c"
+    out = tmp_path / "index.bin"
+    src.write_text(SOURCE)
+    subprocess.check_call([get_compiler(), "-O1", *flags, "-o", out, src])
+    return out
+
+@pytest.mark.parametrize("flags", [
+    ["-gdwarf-4"],
+    ["-gdwarf-5"],
+    ["-gdwarf-5", "-gdwarf64"],
+])
+def test_lookup(tmp_path: Path, flags):
+    path = compile_with(tmp_path, *flags)
+    elf = lief.ELF.parse(path)
+    index = lief.dwarf.AddressIndex.from_binary(elf)
+    assert index is not None
+    assert index.nb_units > 0
+
+    for name in ("compute", "main"):
+        addr = elf.get_symbol(name).value
+        func = index.find_function(addr + 1)
+        assert isinstance(func, lief.dwarf.AddressIndex.function_t)
+        assert func.name == name
+        assert func.address == addr
+
+        line = index.line_for(addr)
+        assert isinstance(line, lief.dwarf.AddressIndex.line_t)
+        assert line.file.endswith("index.c")
+        assert 6 <= line.line <= 17
+
+    assert index.find_function(0) == lief.lief_errors.not_found
+    assert index.line_for(0) == lief.lief_errors.not_found
+
+def test_cache(tmp_path: Path):
+    path = compile_with(tmp_path, "-g")
+    cache = tmp_path / "index.cache"
+
+    config = lief.dwarf.AddressIndex.config_t()
+    config.eager = True
+    config.cache_path = cache.as_posix()
+
+    elf = lief.ELF.parse(path)
+    index = lief.dwarf.AddressIndex.from_binary(elf, config)
+    assert not index.from_cache
+    assert cache.exists()
+
+    addr = elf.get_symbol("compute").value
+    expected = index.find_function(addr).name
+
+    cached = lief.dwarf.AddressIndex.from_binary(elf, config)
+    assert cached.from_cache
+    assert cached.nb_ranges == index.nb_ranges
+    assert cached.find_function(addr).name == expected
+    assert cached.line_for(addr).line == index.line_for(addr).line
+
+def test_stale_cache(tmp_path: Path):
+    path = compile_with(tmp_path, "-g", "-Wl,--build-id=none")
+    cache = tmp_path / "index.cache"
+
+    config = lief.dwarf.AddressIndex.config_t()
+    config.cache_path = cache.as_posix()
+
+    elf = lief.ELF.parse(path)
+    assert not elf.has(lief.ELF.Note.TYPE.GNU_BUILD_ID)
+    assert not lief.dwarf.AddressIndex.from_binary(elf, config).from_cache
+
+    # Without build-id, any change in the debug info must invalidate the
+    # on-disk index
+    debug_str = elf.get_section(".debug_str")
+    content = bytearray(debug_str.content)
+    content[len(content) // 2] ^= 0xff
+    debug_str.content = list(content)
+
+    index = lief.dwarf.AddressIndex.from_binary(elf, config)
+    assert index is not None
+    assert not index.from_cache
+
+def test_build_id_cache(tmp_path: Path):
+    path = compile_with(tmp_path, "-g", "-Wl,--build-id=sha1")
+    cache = tmp_path / "index.cache"
+
+    config = lief.dwarf.AddressIndex.config_t()
+    config.cache_path = cache.as_posix()
+
+    elf = lief.ELF.parse(path)
+    assert not lief.dwarf.AddressIndex.from_binary(elf, config).from_cache
+    assert lief.dwarf.AddressIndex.from_binary(elf, config).from_cache
+
+    # The index is keyed on the build-id
+    note = elf.get(lief.ELF.Note.TYPE.GNU_BUILD_ID)
+    build_id = list(note.description)
+    build_id[0] ^= 0xff
+    note.description = build_id
+
+    index = lief.dwarf.AddressIndex.from_binary(elf, config)
+    assert index is not None
+    assert not index.from_cache
+    assert lief.dwarf.AddressIndex.from_binary(elf, config).from_cache
+
+def test_no_dwarf(tmp_path: Path):
+    path = compile_with(tmp_path, "-g0")
+    assert lief.dwarf.AddressIndex.parse(path.as_posix()) is None
@@ -79,3 +79,74 @@ def test_gcc(tmp_path):
         stdout = P.stdout.read().decode("utf8")
         print(stdout)
         assert re.search(r'LIEF is Working', stdout) is not None
+
+def test_extend_non_loaded(tmp_path: Path):
+    sample_path = get_sample('ELF/ELF64_x86-64_binary_ls.bin')
+    output      = tmp_path / "ls.extended"
+
+    ls = lief.ELF.parse(sample_path)
+    originals = {s.name: bytes(s.content) for s in ls.sections if s.type != lief.ELF.Section.TYPE.NOBITS}
+
+    # Non-loaded sections: the holes are pending until the content is accessed
+    for i in range(20):
+        ls.extend(ls.get_section(".comment"), 0x10)
+        ls.extend(ls.get_section(".shstrtab"), 0x20)
+
+    comment = ls.get_section(".comment")
+    assert bytes(comment.content) == originals[".comment"] + b"\x00" * 20 * 0x10
+
+    shstrtab = ls.get_section(".shstrtab")
+    assert bytes(shstrtab.content) == originals[".shstrtab"] + b"\x00" * 20 * 0x20
+
+    for section in ls.sections:
+        if section.name in (".comment", ".shstrtab") or section.name not in originals:
+            continue
+        assert bytes(section.content) == originals[section.name]
+
+    ls.write(output.as_posix())
+    new = lief.ELF.parse(output)
+    assert bytes(new.get_section(".comment").content)[:len(originals[".comment"])] == originals[".comment"]
+    assert new.get_section(".text").content == ls.get_section(".text").content
+
+def test_add_segments_pending_holes(tmp_path: Path):
+    overlay = bytes(range(256)) * 0x1000
+    sample = tmp_path / "ls.overlay"
+    sample.write_bytes(Path(get_sample('ELF/ELF64_x86-64_binary_ls.bin')).read_bytes() + overlay)
+    output = tmp_path / "ls.segments"
+
+    ls = lief.ELF.parse(sample)
+    originals = {s.name: bytes(s.content) for s in ls.sections}
+
+    # The segments are inserted before the overlay: their content is written
+    # in the pending holes and the overlay is moved once by the builder.
+    segments = []
+    for i in range(20):
+        segment = lief.ELF.Segment()
+        segment.type = lief.ELF.Segment.TYPE.LOAD
+        segment.content = [i + 1] * 0x1000
+        segments.append(ls.add(segment))
+
+    # The content is readable while the holes are pending (the writable
+    # sections hold pointers which are relocated)
+    for i, segment in enumerate(segments):
+        assert bytes(segment.content) == bytes([i + 1]) * 0x1000
+    for section in ls.sections:
+        if section.name in originals and not section.has(lief.ELF.Section.FLAGS.WRITE):
+            assert bytes(section.content) == originals[section.name]
+
+    ls.write(output.as_posix())
+    raw = output.read_bytes()
+    assert raw.endswith(overlay)
+
+    new = lief.ELF.parse(output)
+    assert bytes(new.overlay) == overlay
+
+    for i, segment in enumerate(segments):
+        offset = segment.file_offset
+        assert raw[offset:offset + 0x1000] == bytes([i + 1]) * 0x1000
+        assert offset + 0x1000 <= len(raw) - len(overlay)
+
+        written = new.segment_from_offset(offset)
+        assert written is not None
+        assert written.type == lief.ELF.Segment.TYPE.LOAD
+        assert bytes(written.content)[:0x1000] == bytes([i + 1]) * 0x1000
@@ -349,3 +349,32 @@ def test_core_write(tmp_path: Path):
     assert len(note.description) == orig_siginfo_len
 
     assert note.sigerrno == 0xCC
+
+def test_core_reader():
+    path = get_sample('ELF/ELF64_AArch64_core_hello.core')
+    core: lief.ELF.Binary = lief.ELF.parse(path)
+    reader = lief.ELF.CoreReader.parse(path)
+    assert reader is not None
+
+    assert reader.header.file_type == lief.ELF.Header.FILE_TYPE.CORE
+    assert len(reader.segments) == len(core.segments)
+    assert len(reader.notes) == len(core.notes)
+    prstatus = [n for n in core.notes if isinstance(n, lief.ELF.CorePrStatus)]
+    assert len(reader.threads) == len(prstatus)
+    assert reader.threads[0].status.pid == prstatus[0].status.pid
+
+    core_file = next(n for n in core.notes if isinstance(n, lief.ELF.CoreFile))
+    assert reader.mapped_files is not None
+    assert len(reader.mapped_files.files) == len(core_file.files)
+    assert reader.process_info.info.pid == 8104
+
+    for segment in core.segments:
+        if segment.type != lief.ELF.Segment.TYPE.LOAD or segment.physical_size == 0:
+            continue
+        va = segment.virtual_address
+        size = min(segment.physical_size, 0x100)
+        assert reader.segment_from_virtual_address(va + size - 1).virtual_address == va
+        assert reader.read_memory(va, size) == bytes(segment.content[:size])
+
+    assert reader.segment_from_virtual_address(0) is None
+    assert reader.read_memory(0, 8) is None
@@ -77,6 +77,21 @@ def test_gnuhash():
     assert not gnu_hash.check("foofdsfdsfds")
     assert not gnu_hash.check("fazertrvkdfsrezklqpfjeopqdi")
 
+def test_gnuhash_shift2(tmp_path: Path):
+    for shift2, expected in ((10, 10), (40, 7)): # 40 is out of range: ignored
+        ls = lief.ELF.parse(get_sample('ELF/ELF64_x86-64_binary_ls.bin'))
+        output = tmp_path / f"ls.shift2.{shift2}"
+
+        builder = lief.ELF.Builder(ls)
+        builder.config.gnu_hash_shift2 = shift2
+        builder.build()
+        builder.write(output.as_posix())
+
+        new = lief.ELF.parse(output)
+        gnu_hash = new.gnu_hash
+        assert gnu_hash.shift2 == expected
+        assert all(gnu_hash.check(x.name) for x in list(new.dynamic_symbols)[gnu_hash.symbol_index:]) # type: ignore
+
 @pytest.mark.parametrize("sample", [
     "ELF/ELF64_x86-64_binary_ls.bin"
 ])
@@ -227,3 +227,30 @@ def test_i64_custom_types():
     elf = lief.ELF.parse(get_sample("ELF/elf-Linux-Alpha-bash"))
     assert elf.segments[9].type == lief.ELF.Segment.TYPE.PAX_FLAGS
     assert elf.segments[9].raw_flags == 10240
+
+def test_parse_buffer():
+    import gc
+    import mmap
+    path = get_sample('ELF/ELF64_x86-64_binary_ls.bin')
+    ref = lief.ELF.parse(path)
+
+    with open(path, "rb") as f:
+        with mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as mm:
+            elf = lief.ELF.parse(mm)
+            assert elf is not None
+            assert len(elf.sections) == len(ref.sections)
+
+            # The buffer is released once the parsing is done
+            mm.close()
+
+    raw = bytearray(Path(path).read_bytes())
+    elf = lief.ELF.parse(memoryview(raw))
+    assert elf is not None
+    assert lief.identify(memoryview(raw)) == lief.FILE_FORMATS.ELF
+
+    # The content view keeps the binary alive
+    text = elf.get_section(".text").content
+    assert text.readonly
+    del elf
+    gc.collect()
+    assert bytes(text) == bytes(ref.get_section(".text").content)
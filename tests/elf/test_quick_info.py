@@ -0,0 +1,51 @@
+#!/usr/bin/env python
+import pytest
+from pathlib import Path
+
+import lief
+from utils import get_sample
+
+SAMPLES = [
+    "ELF/ELF64_x86-64_binary_ls.bin",
+    "ELF/ELF64_x86-64_binary_etterlog.bin",
+    "ELF/ELF64_x86-64_library_libfreebl3.so",
+    "ELF/ELF64_AArch64_piebinary_ndkr16.bin",
+    "ELF/ELF32_ARM_binary_ls.bin",
+    "ELF/ELF32_x86_library_libshellx.so",
+]
+
+def _dynstr(elf: lief.ELF.Binary, tag: lief.ELF.DynamicEntry.TAG, attr: str) -> str:
+    entry = elf.get(tag)
+    return "" if entry is None else getattr(entry, attr)
+
+@pytest.mark.parametrize("sample", SAMPLES)
+def test_quick_info(sample: str):
+    path = get_sample(sample)
+    elf = lief.ELF.parse(path)
+    info = lief.ELF.quick_info(path)
+
+    assert info.cls == elf.header.identity_class
+    assert info.machine == elf.header.machine_type
+    assert info.file_type == elf.header.file_type
+    assert info.entrypoint == elf.header.entrypoint
+    assert info.interpreter == (elf.interpreter if elf.has_interpreter else "")
+    assert info.needed == elf.libraries
+    assert info.soname == _dynstr(elf, lief.ELF.DynamicEntry.TAG.SONAME, "name")
+    assert info.rpath == _dynstr(elf, lief.ELF.DynamicEntry.TAG.RPATH, "rpath")
+    assert info.runpath == _dynstr(elf, lief.ELF.DynamicEntry.TAG.RUNPATH, "runpath")
+
+    build_id = elf.get(lief.ELF.Note.TYPE.GNU_BUILD_ID)
+    assert info.build_id == (b"" if build_id is None else bytes(build_id.description))
+
+    # Same result from the raw bytes
+    raw = lief.ELF.quick_info(Path(path).read_bytes())
+    assert raw.needed == info.needed
+    assert raw.build_id == info.build_id
+
+def test_errors(tmp_path: Path):
+    assert lief.ELF.quick_info(str(tmp_path / "missing")) == lief.lief_errors.read_error
+    assert lief.ELF.quick_info(b"MZ" + b"\x00" * 0x100) == lief.lief_errors.file_format_error
+
+    # Truncated program headers
+    raw = Path(get_sample("ELF/ELF64_x86-64_binary_ls.bin")).read_bytes()
+    assert lief.ELF.quick_info(raw[:0x50]) == lief.lief_errors.read_error
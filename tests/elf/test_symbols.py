@@ -48,3 +48,31 @@ def test_demangling():
 
     assert elf.symbols[80].demangled_name == "vtable for std::basic_streambuf<char, std::char_traits<char>>"
     assert elf.symbols[4902].demangled_name == "typeinfo name for triton::smt2lib::smtAstIteNode"
+
+def test_symbols_table():
+    np = pytest.importorskip("numpy")
+    elf = lief.ELF.parse(get_sample("ELF/ELF64_x86-64_binary_ls.bin"))
+
+    symbols = [*elf.dynamic_symbols, *elf.symtab_symbols]
+    table = elf.symbols_table()
+    assert len(table["value"]) == len(symbols)
+    assert table["name_offsets"].dtype == np.int64
+    assert len(table["name_offsets"]) == len(symbols) + 1
+
+    data = table["name_data"].tobytes()
+    offsets = table["name_offsets"]
+    for idx, sym in enumerate(symbols):
+        assert data[offsets[idx]:offsets[idx + 1]].decode() == sym.name
+        assert table["value"][idx] == sym.value
+        assert table["size"][idx] == sym.size
+        assert table["binding"][idx] == sym.binding.value
+        assert table["shndx"][idx] == sym.shndx
+
+    relocations = list(elf.relocations)
+    table = elf.relocations_table()
+    assert np.array_equal(table["address"], [r.address for r in relocations])
+    assert np.array_equal(table["addend"], [r.addend for r in relocations])
+
+    table = elf.sections_table()
+    assert np.array_equal(table["offset"], [s.offset for s in elf.sections])
+    assert np.array_equal(table["flags"], [s.flags for s in elf.sections])
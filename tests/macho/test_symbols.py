@@ -184,3 +184,22 @@ def test_chained_exports_after_shift(tmp_path):
     macho.shift(shift)
     new_exports_addrs = [e.address for e in macho.dyld_exports_trie.exports]
     assert new_exports_addrs == expected_exports_addrs
+
+def test_symbols_table():
+    np = pytest.importorskip("numpy")
+    macho = lief.MachO.parse(get_sample("MachO/MachO64_x86-64_binary_sym2remove.bin")).at(0)
+
+    table = macho.symbols_table()
+    assert len(table["value"]) == len(macho.symbols)
+    data = table["name_data"].tobytes()
+    offsets = table["name_offsets"]
+    for idx, sym in enumerate(macho.symbols):
+        assert data[offsets[idx]:offsets[idx + 1]].decode() == sym.name
+        assert table["value"][idx] == sym.value
+        assert table["type"][idx] == sym.raw_type
+
+    table = macho.relocations_table()
+    assert np.array_equal(table["address"], [r.address for r in macho.relocations])
+
+    table = macho.sections_table()
+    assert np.array_equal(table["offset"], [s.offset for s in macho.sections])
@@ -96,3 +96,42 @@ def test_oat_methods():
     method = CallDeviceId.methods[0]
     assert method.name == "getIMEI"
     assert method.oat_class == CallDeviceId.get_class("Lre/android/art/CallDeviceId;")
+
+def test_oat_lazy_methods():
+    CallDeviceId = lief.parse(get_sample("OAT/OAT_079_x86-64_CallDeviceId.oat"))
+
+    method = CallDeviceId.get_method("re.android.art.CallDeviceId", "getIMEI")
+    assert method is not None
+    assert method.is_dex2dex_optimized
+    assert method.oat_class.fullname == "Lre/android/art/CallDeviceId;"
+    assert CallDeviceId.get_method("re.android.art.CallDeviceId", "unknown") is None
+    assert CallDeviceId.get_method("Lre/android/art/Unknown;", "getIMEI") is None
+
+    # The classes and methods that are already decoded must be kept
+    assert len(CallDeviceId.classes) == 1
+    assert len(CallDeviceId.methods) == 1
+    assert CallDeviceId.methods[0] == method
+
+def test_oat_lazy_deoptimize():
+    # The dex2dex info must be available without accessing the classes first
+    fresh = lief.parse(get_sample("OAT/OAT_079_x86-64_CallDeviceId.oat"))
+    dex = fresh.dex_files[0]
+    assert json.loads(dex.dex2dex_json_info) == {'Lre/android/art/CallDeviceId;': {'3': {'0': 0}}}
+
+    decoded = lief.parse(get_sample("OAT/OAT_079_x86-64_CallDeviceId.oat"))
+    assert len(decoded.methods) > 0
+    assert dex.raw(deoptimize=True) == decoded.dex_files[0].raw(deoptimize=True)
+    assert dex.raw(deoptimize=True) != dex.raw(deoptimize=False)
+
+def test_oat_image_after_modification():
+    oat = lief.parse(get_sample("OAT/OAT_079_x86-64_CallDeviceId.oat"))
+
+    # Wipe the oatdata region of the ELF before the classes are decoded
+    oatdata = oat.get_dynamic_symbol("oatdata")
+    oat.patch_address(oatdata.value, [0] * oatdata.size)
+
+    # The classes are decoded from the image captured by the parser
+    cls = oat.get_class("Lre/android/art/CallDeviceId;")
+    assert cls is not None
+    assert len(cls.methods) > 0
+    assert len(oat.methods) > 0
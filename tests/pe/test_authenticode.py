@@ -1,6 +1,7 @@
 #!/usr/bin/env python
 import pytest
 import json
+import hashlib
 import sys
 from itertools import chain
 
@@ -118,6 +119,78 @@ def test_api():
     pkcs7_sig = lief.PE.Signature.parse(list(sig.raw_der))
     assert avast.verify_signature(pkcs7_sig) == lief.PE.Signature.VERIFICATION_FLAGS.OK
 
+
+def test_fingerprint():
+    avast = lief.PE.parse(get_sample("PE/PE32_x86-64_binary_avast-free-antivirus-setup-online.exe"))
+
+    opt = lief.PE.fingerprint_options_t()
+    opt.imphash_pefile = True
+    opt.authentihash = [
+        lief.PE.ALGORITHMS.MD5, lief.PE.ALGORITHMS.SHA_1,
+        lief.PE.ALGORITHMS.SHA_256, lief.PE.ALGORITHMS.SHA_512,
+    ]
+    fp = lief.PE.fingerprint(avast, opt)
+
+    assert fp.imphash == lief.PE.get_imphash(avast, lief.PE.IMPHASH_MODE.LIEF)
+    assert fp.imphash_pefile == lief.PE.get_imphash(avast, lief.PE.IMPHASH_MODE.PEFILE)
+    assert fp.rich_header_hash == avast.rich_header.hash(lief.PE.ALGORITHMS.MD5)
+    assert fp.checksum == avast.compute_checksum()
+
+    assert len(fp.authentihash) == 4
+    for algo in opt.authentihash:
+        assert fp.authentihash[algo] == avast.authentihash(algo)
+
+    assert len(fp.sections) == len(avast.sections)
+    for digest, section in zip(fp.sections, avast.sections):
+        assert digest.name == section.name
+        assert digest.virtual_address == section.virtual_address
+        assert digest.md5 == hashlib.md5(bytes(section.content)).digest()
+        assert digest.sha256 == hashlib.sha256(bytes(section.content)).digest()
+        assert digest.entropy == pytest.approx(section.entropy)
+
+    opt = lief.PE.fingerprint_options_t()
+    opt.authentihash = []
+    opt.section_hashes = False
+    fp = lief.PE.fingerprint(avast, opt)
+    assert len(fp.authentihash) == 0
+    assert all(len(s.md5) == 0 for s in fp.sections)
+
+def test_x509_cache():
+    lief.PE.x509.enable_cache(max_size=16)
+    lief.PE.x509.clear_cache()
+    try:
+        assert lief.PE.x509.is_cache_enabled()
+        path = get_sample("PE/PE32_x86-64_binary_avast-free-antivirus-setup-online.exe")
+
+        first = lief.PE.parse(path)
+        stats = lief.PE.x509.cache_stats()
+        nb_certs = len(first.signatures[0].certificates)
+        assert stats.misses == nb_certs
+        assert stats.hits == 0
+        assert stats.certificates == nb_certs
+
+        second = lief.PE.parse(path)
+        stats = lief.PE.x509.cache_stats()
+        assert stats.hits == nb_certs
+        assert stats.certificates == nb_certs
+
+        cert_ca, cert_signer = second.signatures[0].certificates
+        assert cert_ca.subject == first.signatures[0].certificates[0].subject
+
+        for _ in range(2):
+            assert cert_ca.verify(cert_signer) == lief.PE.x509.VERIFICATION_FLAGS.BADCERT_EXPIRED
+            assert cert_signer.is_trusted_by([cert_ca]) == lief.PE.x509.VERIFICATION_FLAGS.BADCERT_EXPIRED
+        stats = lief.PE.x509.cache_stats()
+        assert stats.verify_misses == 2
+        assert stats.verify_hits == 2
+
+        assert second.verify_signature() == lief.PE.Signature.VERIFICATION_FLAGS.OK
+    finally:
+        lief.PE.x509.enable_cache(False)
+
+    assert not lief.PE.x509.is_cache_enabled()
+    assert lief.PE.x509.cache_stats().certificates == 0
+
 def test_json_serialization():
     avast = lief.PE.parse(get_sample("PE/PE32_x86-64_binary_avast-free-antivirus-setup-online.exe"))
     with open(get_sample("PE/PE32_x86-64_binary_avast-free-antivirus-setup-online-signature.json"), "rb") as f:
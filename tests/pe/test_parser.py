@@ -881,6 +881,52 @@ def test_exceptions_ahead_chained():
     assert func.unwind_info.chained is not None
     assert func.unwind_info.chained.rva_start == 0x20fd87
 
+def test_exception_index():
+    input_path = Path(get_sample("PE/hostfxr.dll"))
+    index = lief.PE.ExceptionIndex.parse(input_path.as_posix())
+    assert index is not None
+    assert len(index) == 1010
+    assert len(index.binary.exceptions) == 0
+
+    pe = lief.PE.parse(input_path, lief.PE.ParserConfig.all)
+    for e in pe.exceptions:
+        func: lief.PE.RuntimeFunctionX64 = index.find_exception(e.rva_start) # type: ignore
+        assert func is not None
+        assert func.rva_start == e.rva_start
+        assert func.rva_end == e.rva_end
+        assert str(func) == str(e)
+
+    # Address within a function
+    func: lief.PE.RuntimeFunctionX64 = index.find_exception(0x3A4C8) # type: ignore[no-redef]
+    assert func.rva_start == 0x3A4C0
+    assert func.unwind_info.version == 2
+
+    func: lief.PE.RuntimeFunctionX64 = index.find_exception(0x2e8e) # type: ignore[no-redef]
+    assert func.unwind_info.chained is not None
+    assert func.unwind_info.chained.rva_start == 0x2e70
+
+    assert index.find_exception(0) is None
+
+    index.cache_size = 1
+    misses = index.cache_misses
+    hits = index.cache_hits
+    index.find_exception(0x1000)
+    index.find_exception(0x1000)
+    assert index.cache_misses == misses + 1
+    assert index.cache_hits == hits + 1
+
+    # The entries returned previously outlive their eviction
+    assert func.rva_start <= 0x2e8e < func.rva_end
+    assert func.unwind_info.chained.rva_start == 0x2e70
+
+def test_exception_index_ahead_chained():
+    index = lief.PE.ExceptionIndex.parse(get_sample("PE/ntoskrnl.exe"))
+    assert len(index) == 38926
+
+    func: lief.PE.RuntimeFunctionX64 = index.find_exception(0x20fcb4) # type: ignore
+    assert func.unwind_info.chained is not None
+    assert func.unwind_info.chained.rva_start == 0x20fd87
+
 def test_exceptions_arm64x():
     input_path = Path(get_sample("PE/win11_arm64x_Windows.Media.Protection.PlayReady.dll"))
     pe = lief.PE.parse(input_path)
@@ -929,3 +929,47 @@ def test_driver_rsrc():
     assert version.file_info.file_subtype == 0
     assert version.file_info.file_date_ms == 0
     assert version.file_info.file_date_ls == 0
+
+def _compare_view(node: lief.PE.ResourceNode, view: lief.PE.ResourceDirectoryView):
+    assert len(view) == len(node.childs)
+    for idx, child in enumerate(node.childs):
+        entry = view.at(idx)
+        assert entry.id == child.id
+        if child.has_name:
+            assert entry.name == child.name
+            assert view.find(child.name).id == child.id
+        else:
+            assert view.find(child.id).id == child.id
+
+        if isinstance(child, lief.PE.ResourceData):
+            data = entry.data
+            assert data.code_page == child.code_page
+            assert bytes(data.content) == bytes(child.content)
+        else:
+            _compare_view(child, entry.directory)
+
+def test_resources_view():
+    input_path = get_sample('PE/PE64_x86-64_binary_mfc-application.exe')
+    pe = lief.PE.parse(input_path)
+    _compare_view(pe.resources, pe.resources_view)
+
+    config = lief.PE.ParserConfig()
+    config.parse_rsrc = False
+    lazy = lief.PE.parse(input_path, config)
+    assert lazy.resources is None
+
+    manager = pe.resources_manager
+    manifest_node = manager.get_node_type(lief.PE.ResourcesManager.TYPE.MANIFEST)
+    manifest_id = manifest_node.childs[0].id
+    lang = manifest_node.childs[0].childs[0].id
+
+    manifest = lazy.resources_view.lookup(lief.PE.ResourcesManager.TYPE.MANIFEST.value, manifest_id)
+    assert isinstance(manifest, lief.PE.ResourceDirectoryView.data_t)
+    assert bytes(manifest.content).decode() == manager.manifest
+
+    node = manager.find(lief.PE.ResourcesManager.TYPE.MANIFEST, manifest_id, lang)
+    assert node is not None
+    assert bytes(node.content) == bytes(manifest.content)
+    assert manager.find(lief.PE.ResourcesManager.TYPE.MANIFEST, manifest_id, lang + 1) is None
+
+    assert isinstance(lazy.resources_view.find(0x1234), lief.lief_errors)
@@ -19,3 +19,24 @@ def test_demangling():
     pe = lief.PE.parse(get_sample("PE/alink.dll"))
     entry = pe.get_export().entries[0]
     assert entry.demangled_name == "class ATL::CComModule & __cdecl GetATLModule(void)"
+
+def test_symbols_table():
+    np = pytest.importorskip("numpy")
+    pe = lief.PE.parse(get_sample("PE/PE64_x86-64_library_libLIEF.dll"))
+
+    table = pe.symbols_table()
+    assert len(table["value"]) == len(pe.symbols)
+    data = table["name_data"].tobytes()
+    offsets = table["name_offsets"]
+    for idx, sym in enumerate(pe.symbols):
+        assert data[offsets[idx]:offsets[idx + 1]].decode() == sym.name
+        assert table["value"][idx] == sym.value
+        assert table["section_idx"][idx] == sym.section_idx
+
+    entries = [e for r in pe.relocations for e in r.entries]
+    table = pe.relocations_table()
+    assert np.array_equal(table["address"], [e.address for e in entries])
+
+    table = pe.sections_table()
+    assert np.array_equal(table["virtual_address"], [s.virtual_address for s in pe.sections])
+    assert np.array_equal(table["characteristics"], [s.characteristics for s in pe.sections])
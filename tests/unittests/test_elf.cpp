@@ -17,7 +17,13 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
+#include <thread>
+
 #include "LIEF/ELF/Binary.hpp"
+#include "LIEF/ELF/Parser.hpp"
+#include "LIEF/ELF/Relocation.hpp"
+#include "LIEF/ELF/Symbol.hpp"
+#include "LIEF/ELF/utils.hpp"
 #include "LIEF/Abstract/Parser.hpp"
 
 #include "utils.hpp"
@@ -44,6 +50,67 @@ TEST_CASE("lief.test.elf", "[lief][test][elf]") {
       REQUIRE(LIEF::ELF::Binary::classof(bin.get()));
     }
   }
+
+  SECTION("symbol_hash_cache") {
+    using namespace LIEF::ELF;
+    Symbol sym("foo");
+    REQUIRE(sym.gnu_hash() == dl_new_hash("foo"));
+    REQUIRE(sym.sysv_hash(Header::CLASS::ELF64) == hash64("foo"));
+
+    sym.name("bar");
+    REQUIRE(sym.gnu_hash() == dl_new_hash("bar"));
+    REQUIRE(sym.sysv_hash(Header::CLASS::ELF32) == hash32("bar"));
+
+    // The name can be changed through the reference at any time
+    std::string& name = sym.name();
+    REQUIRE(sym.gnu_hash() == dl_new_hash("bar"));
+    name = "baz";
+    REQUIRE(sym.gnu_hash() == dl_new_hash("baz"));
+    REQUIRE(sym.sysv_hash(Header::CLASS::ELF64) == hash64("baz"));
+    sym.name("qux");
+    name = "quux";
+    REQUIRE(sym.gnu_hash() == dl_new_hash("quux"));
+
+    // The reference is bound to `sym`, not to the swapped value
+    Symbol other("other");
+    REQUIRE(other.gnu_hash() == dl_new_hash("other"));
+    std::swap(sym, other);
+    name = "swapped";
+    REQUIRE(sym.gnu_hash() == dl_new_hash("swapped"));
+    REQUIRE(other.gnu_hash() == dl_new_hash("quux"));
+
+    Symbol copy(sym);
+    REQUIRE(copy.gnu_hash() == dl_new_hash("swapped"));
+    name = "not-the-copy";
+    REQUIRE(copy.gnu_hash() == dl_new_hash("swapped"));
+  }
+
+  SECTION("concurrent_relocations") {
+    // The RELR relocations are materialized by the first const accessor
+    std::unique_ptr<ELF::Binary> bin =
+      ELF::Parser::parse(test::get_elf_sample("ls-glibc2.40-relr.elf"));
+    REQUIRE(bin != nullptr);
+    const ELF::Binary& cbin = *bin;
+
+    std::vector<size_t> counts(4, 0);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < counts.size(); ++i) {
+      threads.emplace_back([&cbin, &counts, i] {
+        for (const ELF::Relocation& R : cbin.relocations()) {
+          counts[i] += R.encoding() == ELF::Relocation::ENCODING::RELR ? 1 : 0;
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    REQUIRE(counts[0] > 0);
+    for (size_t count : counts) {
+      REQUIRE(count == counts[0]);
+    }
+    REQUIRE(cbin.relocations().size() == bin->relocations().size());
+  }
 }
 
 
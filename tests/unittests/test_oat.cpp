@@ -13,11 +13,15 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <thread>
+
 #include <catch2/catch_session.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
 #include "LIEF/OAT/Binary.hpp"
+#include "LIEF/OAT/Class.hpp"
+#include "LIEF/OAT/Parser.hpp"
 #include "LIEF/Abstract/Parser.hpp"
 
 #include "utils.hpp"
@@ -34,6 +38,48 @@ TEST_CASE("lief.test.oat", "[lief][test][oat]") {
       REQUIRE(LIEF::OAT::Binary::classof(bin.get()));
     }
   }
+
+  SECTION("concurrent_classes") {
+    // The classes are decoded by the first const accessor (get_class()
+    // decodes a single class, classes() decodes all of them)
+    std::unique_ptr<OAT::Binary> oat =
+      OAT::Parser::parse(test::get_oat_sample("OAT_064_AArch64_WallpaperCropper2.oat"));
+    REQUIRE(oat != nullptr);
+    const OAT::Binary& coat = *oat;
+
+    const std::string names[] = {
+      "android.support.v4.widget.ViewDragHelper",
+      "com.android.keyguard.KeyguardTransportControlView$SavedState$1",
+      "android.support.v4.os.ParcelableCompatCreatorHoneycombMR2Stub",
+    };
+
+    std::vector<size_t> counts(4, 0);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < counts.size(); ++i) {
+      threads.emplace_back([&, i] {
+        if (i % 2 == 0) {
+          counts[i] = coat.classes().size();
+          return;
+        }
+        for (const std::string& name : names) {
+          counts[i] += coat.get_class(name) != nullptr ? 1 : 0;
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    CHECK(counts[0] == 1992);
+    CHECK(counts[2] == 1992);
+    CHECK(counts[1] == 3);
+    CHECK(counts[3] == 3);
+
+    const OAT::Class* cls = coat.get_class(names[0]);
+    REQUIRE(cls != nullptr);
+    CHECK(cls->index() == 1066);
+    CHECK(cls->methods().size() == 49);
+  }
 }
 
 
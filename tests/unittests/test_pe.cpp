@@ -28,6 +28,7 @@
 #include "LIEF/PE/ResourceData.hpp"
 #include "LIEF/PE/ResourceNode.hpp"
 #include "LIEF/PE/ResourceDirectory.hpp"
+#include "LIEF/PE/ResourceDirectoryView.hpp"
 
 #include "utils.hpp"
 
@@ -74,6 +75,40 @@ TEST_CASE("lief.test.pe", "[lief][test][pe]") {
     }
   }
 
+  SECTION("resources_unsorted") {
+    using namespace PE;
+    ResourceDirectory root;
+    ResourceNode& first  = root.add_child(ResourceData(std::vector<uint8_t>{1}));
+    ResourceNode& second = root.add_child(ResourceData(std::vector<uint8_t>{2}));
+    ResourceNode& third  = root.add_child(ResourceData(std::vector<uint8_t>{3}));
+    first.id(10);
+    second.id(5);
+    third.id(1);
+    // The children are no longer sorted: {10, 5, 1}
+    for (uint32_t id : {10, 5, 1}) {
+      const ResourceNode* node = root.find_child(id);
+      REQUIRE(node != nullptr);
+      REQUIRE(node->id() == id);
+    }
+    REQUIRE(root.find_child(2) == nullptr);
+
+    // IMAGE_RESOURCE_DIRECTORY with ID entries in a non-compliant order
+    std::vector<uint8_t> tree(16 + 3 * 8);
+    tree[14] = 3; // NumberOfIdEntries
+    const uint8_t ids[] = {30, 10, 20};
+    for (size_t i = 0; i < 3; ++i) {
+      tree[16 + i * 8] = ids[i];
+    }
+    auto view = ResourceDirectoryView::from(tree, 0x1000);
+    REQUIRE(view);
+    for (uint32_t id : {10, 20, 30}) {
+      auto entry = view->find(id);
+      REQUIRE(entry);
+      REQUIRE(entry->id() == id);
+    }
+    REQUIRE(!view->find(15));
+  }
+
   SECTION("debug") {
     PE::Debug Wrong(static_cast<PE::Debug::TYPES>(-1));
     REQUIRE_THAT(to_string(Wrong.type()), Equals("UNKNOWN"));
@@ -0,0 +1,154 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <vector>
+
+#include "string_table.hpp"
+
+using namespace LIEF;
+
+// Check that `str` is stored as a NUL-terminated string at its offset
+static bool is_at_offset(const std::vector<uint8_t>& table,
+                         const StringTableBuilder::offsets_t& offsets,
+                         std::string_view str)
+{
+  auto it = offsets.find(str);
+  if (it == offsets.end() || it->second + str.size() >= table.size()) {
+    return false;
+  }
+  const size_t offset = it->second;
+  return std::string_view(reinterpret_cast<const char*>(table.data()) + offset,
+                          str.size()) == str && table[offset + str.size()] == 0;
+}
+
+TEST_CASE("lief.test.string_table", "[lief][test][string_table]") {
+  SECTION("tail_merging") {
+    const std::vector<std::string> strings = {
+      "foobar", "bar", "ar", "foo", "", "bar",
+    };
+
+    StringTableBuilder builder;
+    for (const std::string& str : strings) {
+      builder.add(str);
+    }
+
+    std::vector<uint8_t> table;
+    StringTableBuilder::offsets_t offsets;
+    const size_t saved = builder.build(table, offsets);
+
+    // \0foobar\0foo\0 (or \0foo\0foobar\0)
+    REQUIRE(table.size() == 12);
+    CHECK(saved == 24 - 12);
+    CHECK(table[0] == 0);
+    CHECK(offsets.size() == 5);
+
+    for (const std::string& str : strings) {
+      CHECK(is_at_offset(table, offsets, str));
+    }
+
+    CHECK(offsets[""] == 0);
+    CHECK(offsets["bar"] == offsets["foobar"] + 3);
+    CHECK(offsets["ar"] == offsets["foobar"] + 4);
+    CHECK(offsets["foo"] != offsets["foobar"]);
+  }
+
+  SECTION("alignment") {
+    StringTableBuilder builder;
+    builder.add("foobar");
+    builder.add("bar");
+    builder.add("foo");
+
+    std::vector<uint8_t> table;
+    StringTableBuilder::offsets_t offsets;
+    const size_t saved = builder.build(table, offsets, /*alignment=*/8);
+
+    // "bar" is merged and the padding is not accounted in the saved bytes
+    CHECK(saved == 4);
+    REQUIRE(table.size() == 16);
+    for (size_t i = 12; i < table.size(); ++i) {
+      CHECK(table[i] == 0);
+    }
+    CHECK(is_at_offset(table, offsets, "foobar"));
+    CHECK(is_at_offset(table, offsets, "foo"));
+    CHECK(offsets["bar"] == offsets["foobar"] + 3);
+  }
+
+  SECTION("empty") {
+    StringTableBuilder builder;
+    std::vector<uint8_t> table = {1, 2, 3};
+    StringTableBuilder::offsets_t offsets;
+
+    CHECK(builder.build(table, offsets) == 0);
+    CHECK(table == std::vector<uint8_t>{0});
+    REQUIRE(offsets.size() == 1);
+    CHECK(offsets[""] == 0);
+
+    builder.add("");
+    builder.build(table, offsets, /*alignment=*/4);
+    CHECK(table == std::vector<uint8_t>{0, 0, 0, 0});
+    CHECK(offsets.size() == 1);
+  }
+
+  SECTION("reuse") {
+    // The strings are cleared by build()
+    StringTableBuilder builder;
+    builder.add("foo");
+
+    std::vector<uint8_t> table;
+    StringTableBuilder::offsets_t offsets;
+    builder.build(table, offsets);
+    CHECK(table.size() == 5);
+
+    builder.add("bar");
+    builder.build(table, offsets);
+    CHECK(table.size() == 5);
+    CHECK(offsets.count("foo") == 0);
+    CHECK(is_at_offset(table, offsets, "bar"));
+  }
+
+  SECTION("parallel") {
+    // Enough strings to sort the buckets in parallel
+    std::vector<std::string> strings;
+    for (size_t i = 0; i < 0x12000; ++i) {
+      strings.push_back("sym_" + std::to_string(i));
+      strings.push_back("_" + std::to_string(i));
+    }
+
+    StringTableBuilder builder;
+    size_t expected_size = 1;
+    for (const std::string& str : strings) {
+      builder.add(str);
+      if (str[0] == 's') {
+        expected_size += str.size() + 1;
+      }
+    }
+
+    std::vector<uint8_t> table;
+    StringTableBuilder::offsets_t offsets;
+    builder.build(table, offsets);
+
+    CHECK(table.size() == expected_size);
+    CHECK(offsets.size() == strings.size() + 1);
+    size_t nb_errors = 0;
+    for (const std::string& str : strings) {
+      nb_errors += is_at_offset(table, offsets, str) ? 0 : 1;
+    }
+    CHECK(nb_errors == 0);
+  }
+}
@@ -0,0 +1,90 @@
+/* Copyright 2017 - 2025 R. Thomas
+ * Copyright 2017 - 2025 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "LIEF/VDEX/VerifierDeps.hpp"
+
+using namespace LIEF;
+using namespace std::string_literals;
+
+using KIND = VDEX::VerifierDeps::KIND;
+using record_t = VDEX::VerifierDeps::record_t;
+
+// Verifier dependencies of two DEX files followed by padding
+static const std::vector<uint8_t> DEPS = {
+  /* DEX #0 */
+  0x02, 'L', 'F', 'o', 'o', ';', 0x00, '[', 'I', 0x00, // extra strings
+  0x01, 0x05, 0x06,             // assignable types
+  0x00,                         // unassignable types
+  0x01, 0x03, 0x01,             // classes
+  0x01, 0xac, 0x02, 0x09, 0x07, // fields
+  0x01, 0x01, 0x02, 0x03,       // direct methods
+  0x00,                         // virtual methods
+  0x01, 0x04, 0x05, 0x06,       // interface methods
+  0x02, 0x08, 0x09,             // unverified classes
+
+  /* DEX #1 */
+  0x00,                                     // extra strings
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // empty sets
+  0x01, 0x0a,                               // unverified classes
+
+  /* Padding */
+  0x00, 0x00, 0x00,
+};
+
+static void check(const record_t& record, KIND kind, uint32_t dex_idx,
+                  std::array<uint32_t, 3> values)
+{
+  CHECK(record.kind == kind);
+  CHECK(record.dex_idx == dex_idx);
+  CHECK(record.values == values);
+}
+
+TEST_CASE("lief.test.vdex", "[lief][test][vdex]") {
+  SECTION("verifier_deps") {
+    VDEX::VerifierDeps deps(DEPS, 2);
+
+    std::vector<record_t> records;
+    for (const record_t& record : deps.records()) {
+      records.push_back(record);
+    }
+
+    REQUIRE(records.size() == 8);
+    check(records[0], KIND::ASSIGNABLE_TYPE,  0, {5, 6, 0});
+    check(records[1], KIND::CLASS,            0, {3, 1, 0});
+    check(records[2], KIND::FIELD,            0, {300, 9, 7});
+    check(records[3], KIND::DIRECT_METHOD,    0, {1, 2, 3});
+    check(records[4], KIND::INTERFACE_METHOD, 0, {4, 5, 6});
+    check(records[5], KIND::UNVERIFIED_CLASS, 0, {8, 0, 0});
+    check(records[6], KIND::UNVERIFIED_CLASS, 0, {9, 0, 0});
+    check(records[7], KIND::UNVERIFIED_CLASS, 1, {10, 0, 0});
+
+    // The records of the last DEX file end at the padding
+    CHECK(deps.consumed_size().value_or(0) == DEPS.size() - 3);
+
+    CHECK(deps.strings(0) == std::vector<std::string>{"LFoo;"s, "[I"s});
+    CHECK(deps.strings(1).empty());
+    CHECK(deps.strings(2).empty());
+  }
+
+  SECTION("verifier_deps_truncated") {
+    const std::vector<uint8_t> truncated(DEPS.begin(), DEPS.begin() + 20);
+    VDEX::VerifierDeps deps(truncated, 2);
+    CHECK(!deps.consumed_size());
+    CHECK(deps.strings(0).size() == 2);
+  }
+}
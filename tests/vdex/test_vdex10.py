@@ -43,3 +43,56 @@ def test_dex_files():
     #assert h == 4434625889427456908
     #assert h_file == 18446744071715884987
     #assert h_file_dopt == 18446744072171126186
+
+def test_verifier_deps():
+    config = lief.VDEX.ParserConfig()
+    config.parse_dex_files = False
+    telecom = lief.VDEX.parse(get_sample('VDEX/VDEX_10_AArch64_Telecom.vdex'), config=config)
+
+    assert len(telecom.dex_files) == 0
+    assert len(telecom.checksums) == 1
+
+    deps = telecom.verifier_deps
+    assert deps.nb_dex_files == 1
+    assert len(deps.content) == 18988
+
+    # The records of the (single) DEX file must span the whole section
+    assert deps.consumed_size == 18988
+
+    records = list(deps.records)
+    assert len(records) > 0
+    assert all(r.dex_idx == 0 for r in records)
+
+    kinds = [r.kind.value for r in records]
+    assert kinds == sorted(kinds)
+
+    # The extra strings are type descriptors
+    extra_strings = deps.strings(0)
+    assert all(s.startswith(("L", "[")) for s in extra_strings)
+
+    # Check the values against the DEX file
+    dex = lief.VDEX.parse(get_sample('VDEX/VDEX_10_AArch64_Telecom.vdex')).dex_files[0]
+    nb_strings = len(dex.strings) + len(extra_strings)
+    nb_types = len(dex.types)
+    KIND = lief.VDEX.VerifierDeps.KIND
+    for record in records:
+        values = record.values
+        if record.kind in (KIND.ASSIGNABLE_TYPE, KIND.UNASSIGNABLE_TYPE):
+            assert len(values) == 2
+            assert values[0] < nb_strings and values[1] < nb_strings
+        elif record.kind == KIND.CLASS:
+            assert len(values) == 2
+            assert values[0] < nb_types and values[1] <= 0xffff
+        elif record.kind == KIND.FIELD:
+            assert len(values) == 3
+            assert values[0] < len(dex.fields) and values[1] <= 0xffff
+        elif record.kind == KIND.UNVERIFIED_CLASS:
+            assert len(values) == 1
+            assert values[0] < nb_types
+        else:
+            assert len(values) == 3
+            assert values[0] < len(dex.methods) and values[1] <= 0xffff
+
+    config.parse_verifier_deps = False
+    telecom = lief.VDEX.parse(get_sample('VDEX/VDEX_10_AArch64_Telecom.vdex'), config=config)
+    assert len(list(telecom.verifier_deps.records)) == 0